@@ -0,0 +1,135 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <AzCore/Debug/Trace.h>
+
+#include <Utils/MappedFile.hpp>
+
+using Loherangrin::Games::O3DEJam2305::MappedFile;
+
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+bool MappedFile::Open(const char* i_filePath, AZStd::size_t i_minSize)
+{
+	Close();
+
+	const int fileDescriptor = open(i_filePath, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+	if(fileDescriptor < 0)
+	{
+		AZ_Error("MappedFile", false, "Unable to open %s", i_filePath);
+		return false;
+	}
+
+	m_fileHandle = fileDescriptor;
+
+	struct stat fileStatus;
+	if(fstat(fileDescriptor, &fileStatus) != 0)
+	{
+		Close();
+		return false;
+	}
+
+	const auto fileSize = static_cast<AZStd::size_t>(fileStatus.st_size);
+	if(fileSize >= i_minSize && fileSize > 0)
+	{
+		return Map(fileSize);
+	}
+
+	return Resize(i_minSize);
+}
+
+bool MappedFile::Resize(AZStd::size_t i_newSize)
+{
+	if(m_fileHandle == INVALID_HANDLE)
+	{
+		return false;
+	}
+
+	// the current mapping stays valid until the new one is in place, so a failed resize leaves the data readable
+	if(ftruncate(static_cast<int>(m_fileHandle), static_cast<off_t>(i_newSize)) != 0)
+	{
+		AZ_Error("MappedFile", false, "Unable to resize a mapped file to %zu bytes", i_newSize);
+		return false;
+	}
+
+	if(!Map(i_newSize))
+	{
+		if(m_data)
+		{
+			ftruncate(static_cast<int>(m_fileHandle), static_cast<off_t>(m_size));
+		}
+
+		return false;
+	}
+
+	return true;
+}
+
+void MappedFile::Flush()
+{
+	if(m_data)
+	{
+		msync(m_data, m_size, MS_ASYNC);
+	}
+}
+
+void MappedFile::Close()
+{
+	Unmap();
+
+	if(m_fileHandle != INVALID_HANDLE)
+	{
+		close(static_cast<int>(m_fileHandle));
+		m_fileHandle = INVALID_HANDLE;
+	}
+}
+
+bool MappedFile::Map(AZStd::size_t i_size)
+{
+	void* data = mmap(nullptr, i_size, PROT_READ | PROT_WRITE, MAP_SHARED, static_cast<int>(m_fileHandle), 0);
+	if(data == MAP_FAILED)
+	{
+		AZ_Error("MappedFile", false, "Unable to map %zu bytes of a file", i_size);
+		return false;
+	}
+
+	Unmap();
+
+	m_data = static_cast<AZ::u8*>(data);
+	m_size = i_size;
+
+	return true;
+}
+
+void MappedFile::Unmap()
+{
+	if(m_data)
+	{
+		munmap(m_data, m_size);
+
+		m_data = nullptr;
+		m_size = 0;
+	}
+}
@@ -0,0 +1,135 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/PlatformIncl.h>
+
+#include <Utils/MappedFile.hpp>
+
+using Loherangrin::Games::O3DEJam2305::MappedFile;
+
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+bool MappedFile::Open(const char* i_filePath, AZStd::size_t i_minSize)
+{
+	Close();
+
+	HANDLE file = CreateFileA(i_filePath, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if(file == INVALID_HANDLE_VALUE)
+	{
+		AZ_Error("MappedFile", false, "Unable to open %s", i_filePath);
+		return false;
+	}
+
+	m_fileHandle = reinterpret_cast<AZ::s64>(file);
+
+	LARGE_INTEGER fileSize;
+	if(!GetFileSizeEx(file, &fileSize))
+	{
+		Close();
+		return false;
+	}
+
+	const auto currentSize = static_cast<AZStd::size_t>(fileSize.QuadPart);
+	if(currentSize >= i_minSize && currentSize > 0)
+	{
+		return Map(currentSize);
+	}
+
+	return Resize(i_minSize);
+}
+
+bool MappedFile::Resize(AZStd::size_t i_newSize)
+{
+	if(m_fileHandle == INVALID_HANDLE)
+	{
+		return false;
+	}
+
+	// the mapping object extends the file to the requested size,
+	// while the current view stays valid until the new one is in place
+	return Map(i_newSize);
+}
+
+void MappedFile::Flush()
+{
+	if(m_data)
+	{
+		FlushViewOfFile(m_data, 0);
+	}
+}
+
+void MappedFile::Close()
+{
+	Unmap();
+
+	if(m_fileHandle != INVALID_HANDLE)
+	{
+		CloseHandle(reinterpret_cast<HANDLE>(m_fileHandle));
+		m_fileHandle = INVALID_HANDLE;
+	}
+}
+
+bool MappedFile::Map(AZStd::size_t i_size)
+{
+	const auto size = static_cast<AZ::u64>(i_size);
+
+	HANDLE mapping = CreateFileMappingA(reinterpret_cast<HANDLE>(m_fileHandle), nullptr, PAGE_READWRITE, static_cast<DWORD>(size >> 32), static_cast<DWORD>(size & 0xFFFFFFFF), nullptr);
+	if(!mapping)
+	{
+		AZ_Error("MappedFile", false, "Unable to map %zu bytes of a file", i_size);
+		return false;
+	}
+
+	void* data = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, i_size);
+	if(!data)
+	{
+		CloseHandle(mapping);
+
+		AZ_Error("MappedFile", false, "Unable to view %zu bytes of a mapped file", i_size);
+		return false;
+	}
+
+	Unmap();
+
+	m_mappingHandle = reinterpret_cast<AZ::s64>(mapping);
+
+	m_data = static_cast<AZ::u8*>(data);
+	m_size = i_size;
+
+	return true;
+}
+
+void MappedFile::Unmap()
+{
+	if(m_data)
+	{
+		UnmapViewOfFile(m_data);
+
+		m_data = nullptr;
+		m_size = 0;
+	}
+
+	if(m_mappingHandle != INVALID_HANDLE)
+	{
+		CloseHandle(reinterpret_cast<HANDLE>(m_mappingHandle));
+		m_mappingHandle = INVALID_HANDLE;
+	}
+}
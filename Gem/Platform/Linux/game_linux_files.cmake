@@ -1,3 +1,4 @@
 set(FILES
+    ../Common/UnixLike/MappedFile_UnixLike.cpp
     PAL_linux.cmake
 )
@@ -1,4 +1,5 @@
 set(FILES
+    ../Common/UnixLike/MappedFile_UnixLike.cpp
     ../../../Resources/Platform/Mac/Info.plist
     PAL_mac.cmake
 )
@@ -1,3 +1,4 @@
 set(FILES
+    ../Common/WinAPI/MappedFile_WinAPI.cpp
     PAL_windows.cmake
 )
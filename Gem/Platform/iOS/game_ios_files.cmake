@@ -1,4 +1,5 @@
 set(FILES
+    ../Common/UnixLike/MappedFile_UnixLike.cpp
     ../../../Resources/Platform/iOS/Info.plist
     PAL_ios.cmake
 )
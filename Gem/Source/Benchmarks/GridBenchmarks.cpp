@@ -0,0 +1,147 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+
+#include "../Core/FlowField.hpp"
+#include "../Core/GridRules.hpp"
+#include "../Core/LayoutPlan.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	static LayoutPlan::Settings CreateLayoutSettings(AZ::u16 i_gridLength, AZ::u16 i_maxObstacles)
+	{
+		LayoutPlan::Settings settings;
+		settings.m_gridLength = i_gridLength;
+		settings.m_maxObstacles = i_maxObstacles;
+		settings.m_obstacleCellSize = AZ::Vector2 { 6.f, 6.f };
+		settings.m_tileCellSize = AZ::Vector2 { 3.f, 3.f };
+		settings.m_nObstacleTypes = 3;
+		settings.m_nTileTypes = 4;
+
+		return settings;
+	}
+
+	// every tile of a grid, as the tiles pool does while spawning a layout
+	static void CalculateNeighbors(benchmark::State& io_state)
+	{
+		const auto gridLength = static_cast<AZ::u16>(io_state.range(0));
+
+		for([[maybe_unused]] auto _ : io_state)
+		{
+			for(AZ::u16 i = 0; i < gridLength; ++i)
+			{
+				for(AZ::u16 j = 0; j < gridLength; ++j)
+				{
+					benchmark::DoNotOptimize(GridRules::CalculateNeighbors(gridLength, i, j));
+				}
+			}
+		}
+
+		io_state.SetItemsProcessed(io_state.iterations() * gridLength * gridLength);
+	}
+
+	BENCHMARK(CalculateNeighbors)->Arg(11)->Arg(101)->Arg(317);
+
+	// obstacles and tiles of a whole layout, one obstacle every 25 tiles
+	static void GenerateLayout(benchmark::State& io_state)
+	{
+		const auto gridLength = static_cast<AZ::u16>(io_state.range(0));
+		const auto maxObstacles = static_cast<AZ::u16>((gridLength * gridLength) / 25);
+
+		const LayoutPlan::Settings settings = CreateLayoutSettings(gridLength, maxObstacles);
+
+		LayoutPlan plan;
+
+		for([[maybe_unused]] auto _ : io_state)
+		{
+			plan.Generate(settings, 1234);
+			benchmark::DoNotOptimize(plan.GetTiles().data());
+		}
+
+		io_state.SetItemsProcessed(io_state.iterations() * gridLength * gridLength);
+	}
+
+	BENCHMARK(GenerateLayout)->Arg(11)->Arg(33)->Arg(101)->Arg(317);
+
+	// the same layouts with their tiles planned in chunks of rows, by the given number of worker threads
+	static void GenerateLayoutInChunks(benchmark::State& io_state)
+	{
+		const auto gridLength = static_cast<AZ::u16>(io_state.range(0));
+		const auto maxObstacles = static_cast<AZ::u16>((gridLength * gridLength) / 25);
+		const auto nWorkerThreads = static_cast<AZ::u32>(io_state.range(1));
+
+		const LayoutPlan::Settings settings = CreateLayoutSettings(gridLength, maxObstacles);
+
+		AZ::JobManagerDesc jobManagerDesc;
+		for(AZ::u32 i = 0; i < nWorkerThreads; ++i)
+		{
+			jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc {});
+		}
+
+		AZ::JobManager jobManager { jobManagerDesc };
+		AZ::JobContext jobContext { jobManager };
+
+		LayoutPlan plan;
+
+		for([[maybe_unused]] auto _ : io_state)
+		{
+			plan.Generate(settings, 1234, &jobContext);
+			benchmark::DoNotOptimize(plan.GetTiles().data());
+		}
+
+		io_state.SetItemsProcessed(io_state.iterations() * gridLength * gridLength);
+	}
+
+	BENCHMARK(GenerateLayoutInChunks)->ArgsProduct({ { 317, 1024 }, { 1, 2, 4, 8 } })->UseRealTime();
+
+	// distances to the landing areas of a generated layout
+	static void BuildFlowField(benchmark::State& io_state)
+	{
+		const auto gridLength = static_cast<AZ::u16>(io_state.range(0));
+		const auto maxObstacles = static_cast<AZ::u16>((gridLength * gridLength) / 25);
+
+		LayoutPlan plan;
+		plan.Generate(CreateLayoutSettings(gridLength, maxObstacles), 1234);
+
+		AZStd::vector<TileId> targetCells;
+		for(const LayoutPlan::Tile& tile : plan.GetTiles())
+		{
+			if(tile.m_type == LayoutPlan::TILE_TYPES_LANDING_AREA)
+			{
+				targetCells.push_back(GridRules::CalculateTileId(gridLength, tile.m_row, tile.m_column));
+			}
+		}
+
+		FlowField flowField;
+
+		for([[maybe_unused]] auto _ : io_state)
+		{
+			flowField.Build(gridLength, plan.GetObstacleCells(), targetCells);
+			benchmark::DoNotOptimize(flowField.GetDistance(0));
+		}
+
+		io_state.SetItemsProcessed(io_state.iterations() * gridLength * gridLength);
+	}
+
+	BENCHMARK(BuildFlowField)->Arg(11)->Arg(33)->Arg(101)->Arg(317);
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,212 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <AzCore/std/containers/vector.h>
+
+#include "../Core/BeamRules.hpp"
+#include "../Core/CollectableRules.hpp"
+#include "../Core/RandomStream.hpp"
+#include "../Core/ScoreLedger.hpp"
+#include "../Core/StormRules.hpp"
+#include "../Core/TileRules.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	static constexpr float FRAME_TIME = 1.f / 60.f;
+	static constexpr ScoreLedger::TimeMs FRAME_TIME_MS = 16;
+
+	static AZStd::vector<TileState> CreateTiles(AZStd::size_t i_nTiles, const TileSettings& i_settings)
+	{
+		AZStd::vector<TileState> tiles;
+		tiles.resize(i_nTiles);
+
+		for(AZStd::size_t i = 0; i < i_nTiles; ++i)
+		{
+			tiles[i].m_energy = i_settings.m_maxEnergy * static_cast<float>(i % 10) / 10.f;
+			tiles[i].m_isClaimed = (i % 3 == 0);
+		}
+
+		return tiles;
+	}
+
+	// one frame of decay over every tile of the grid
+	static void TileDecay(benchmark::State& io_state)
+	{
+		const auto nTiles = static_cast<AZStd::size_t>(io_state.range(0));
+
+		const TileSettings settings {};
+		AZStd::vector<TileState> tiles = CreateTiles(nTiles, settings);
+
+		AZStd::vector<AZ::u8> nClaimedNeighbors;
+		nClaimedNeighbors.resize(nTiles);
+
+		for(AZStd::size_t i = 0; i < nTiles; ++i)
+		{
+			nClaimedNeighbors[i] = static_cast<AZ::u8>(i % (TileRules::MAX_NEIGHBORS + 1));
+		}
+
+		// energy is given back every other frame, so that the tiles don't end up clamped to 0
+		float direction = -1.f;
+
+		for([[maybe_unused]] auto _ : io_state)
+		{
+			for(AZStd::size_t i = 0; i < nTiles; ++i)
+			{
+				const float decay = TileRules::CalculateDecay(settings, nClaimedNeighbors[i], FRAME_TIME);
+				benchmark::DoNotOptimize(TileRules::AddEnergy(settings, tiles[i], direction * decay));
+			}
+
+			direction = -direction;
+			benchmark::ClobberMemory();
+		}
+
+		io_state.SetItemsProcessed(io_state.iterations() * nTiles);
+	}
+
+	BENCHMARK(TileDecay)->Arg(1000)->Arg(10000)->Arg(100000);
+
+	// one frame of a beam split among the selected tiles
+	static void BeamTransfer(benchmark::State& io_state)
+	{
+		const auto nSelectedTiles = static_cast<AZStd::size_t>(io_state.range(0));
+
+		const TileSettings settings {};
+		AZStd::vector<TileState> tiles = CreateTiles(nSelectedTiles, settings);
+
+		// energy is taken back every other frame, so that the tiles don't end up clamped to their maximum
+		float direction = 1.f;
+
+		for([[maybe_unused]] auto _ : io_state)
+		{
+			const auto transfer = BeamRules::CalculateTransfer(4.f, nSelectedTiles, FRAME_TIME);
+			benchmark::DoNotOptimize(transfer.m_sentEnergy);
+
+			for(TileState& tile : tiles)
+			{
+				benchmark::DoNotOptimize(TileRules::AddEnergy(settings, tile, direction * transfer.m_tileEnergy));
+			}
+
+			direction = -direction;
+			benchmark::ClobberMemory();
+		}
+
+		io_state.SetItemsProcessed(io_state.iterations() * nSelectedTiles);
+	}
+
+	BENCHMARK(BeamTransfer)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
+
+	// one frame of a storm hitting the tiles below it
+	static void StormDamage(benchmark::State& io_state)
+	{
+		const auto nHitTiles = static_cast<AZStd::size_t>(io_state.range(0));
+
+		const TileSettings settings {};
+		AZStd::vector<TileState> tiles = CreateTiles(nHitTiles, settings);
+
+		RandomStream randomStream { RandomStreamId::STORMS, 1234 };
+		const StormParameters storm = StormRules::GenerateStorm(StormSettings {}, randomStream);
+
+		// energy is given back every other frame, so that the tiles don't end up clamped to 0
+		float direction = -1.f;
+
+		for([[maybe_unused]] auto _ : io_state)
+		{
+			const float damage = StormRules::CalculateDamage(storm.m_strength, FRAME_TIME);
+
+			for(TileState& tile : tiles)
+			{
+				benchmark::DoNotOptimize(TileRules::AddEnergy(settings, tile, direction * damage));
+			}
+
+			direction = -direction;
+			benchmark::ClobberMemory();
+		}
+
+		io_state.SetItemsProcessed(io_state.iterations() * nHitTiles);
+	}
+
+	BENCHMARK(StormDamage)->Arg(9)->Arg(25)->Arg(100);
+
+	// one frame of payout, with a tile claimed and another one lost in between
+	static void ScorePayout(benchmark::State& io_state)
+	{
+		const auto nClaimedTiles = static_cast<TileCount>(io_state.range(0));
+
+		ScoreLedger ledger;
+		ledger.Configure(1, 5000);
+
+		ScoreLedger::TimeMs now = 0;
+		ledger.Start(now);
+
+		for(TileCount i = 0; i < nClaimedTiles; ++i)
+		{
+			ledger.ClaimTile(now);
+		}
+
+		for([[maybe_unused]] auto _ : io_state)
+		{
+			now += FRAME_TIME_MS;
+
+			ledger.ClaimTile(now);
+			ledger.LoseTile(now);
+			ledger.Settle(now);
+
+			benchmark::DoNotOptimize(ledger.GetTotalPoints());
+		}
+	}
+
+	BENCHMARK(ScorePayout)->Arg(1)->Arg(16)->Arg(256);
+
+	// a destroyed tile deciding whether to leave something behind
+	static void DropSampling(benchmark::State& io_state)
+	{
+		RandomStream randomStream { RandomStreamId::DROPS, 1234 };
+
+		for([[maybe_unused]] auto _ : io_state)
+		{
+			const CollectableType type = CollectableRules::SampleDrop(randomStream, 0.25f, CollectableRules::N_TYPES);
+			if(type != CollectableType::NONE)
+			{
+				benchmark::DoNotOptimize(CollectableRules::CalculateEffect(type, 10.f, 5.f));
+			}
+		}
+	}
+
+	BENCHMARK(DropSampling);
+
+	// tile types of a whole grid drawn by cell, without any state carried between them
+	static void BoundedSampling(benchmark::State& io_state)
+	{
+		const auto nCells = static_cast<AZ::u64>(io_state.range(0));
+		const RandomStream randomStream { RandomStreamId::TILE_TYPES, 1234 };
+
+		for([[maybe_unused]] auto _ : io_state)
+		{
+			for(AZ::u64 i = 0; i < nCells; ++i)
+			{
+				benchmark::DoNotOptimize(randomStream.GetBoundedAt(i, 7));
+			}
+		}
+
+		io_state.SetItemsProcessed(io_state.iterations() * nCells);
+	}
+
+	BENCHMARK(BoundedSampling)->Arg(121)->Arg(10201);
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,54 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "../Core/Simulation.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// a whole headless session, which puts every rule together, with as many ships as it takes to stress the beams, the tiles and the storms
+	static void RunSession(benchmark::State& io_state)
+	{
+		SimulationSettings settings;
+		settings.m_gridLength = static_cast<AZ::u16>(io_state.range(0));
+		settings.m_nSpaceships = static_cast<AZ::u8>(io_state.range(1));
+		settings.m_maxObstacles = static_cast<AZ::u16>((settings.m_gridLength * settings.m_gridLength) / 25);
+		settings.m_maxDuration = 120.f;
+
+		Simulation simulation;
+		AZ::u64 seed = 1;
+
+		AZ::u64 nSteps = 0;
+
+		for([[maybe_unused]] auto _ : io_state)
+		{
+			simulation.Start(settings, seed++);
+			while(simulation.Step())
+			{
+				++nSteps;
+			}
+
+			benchmark::DoNotOptimize(simulation.GetResult().m_totalPoints);
+		}
+
+		io_state.SetItemsProcessed(static_cast<int64_t>(nSteps));
+	}
+
+	BENCHMARK(RunSession)->ArgsProduct({ { 11, 33 }, { 1, 8, 64 } })->Unit(benchmark::kMillisecond);
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,583 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/math.h>
+
+#include "../EBuses/BeamBus.hpp"
+#include "../Utils/GameMetrics.hpp"
+#include "AutopilotComponent.hpp"
+
+using Loherangrin::Games::O3DEJam2305::AutopilotComponent;
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	AZ_CVAR(bool, game_autopilot, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Let the autopilot drive the spaceship, regardless of the component settings");
+
+} // Loherangrin::Games::O3DEJam2305
+
+void AutopilotComponent::Reflect(AZ::ReflectContext* io_context)
+{
+	if(auto serializeContext = azrtti_cast<AZ::SerializeContext*>(io_context))
+	{
+		serializeContext->Enum<Policy>()
+			->Version(0)
+			->Value("Scripted", Policy::SCRIPTED)
+			->Value("RandomWalk", Policy::RANDOM_WALK)
+			->Value("Greedy", Policy::GREEDY)
+		;
+
+		serializeContext->Enum<Command>()
+			->Version(0)
+			->Value("Wait", Command::WAIT)
+			->Value("Move", Command::MOVE)
+			->Value("Turn", Command::TURN)
+			->Value("ToggleLanding", Command::TOGGLE_LANDING)
+			->Value("ToggleBeam", Command::TOGGLE_BEAM)
+		;
+
+		serializeContext->Class<ScriptStep>()
+			->Version(0)
+			->Field("Command", &ScriptStep::m_command)
+			->Field("Value", &ScriptStep::m_value)
+			->Field("Duration", &ScriptStep::m_duration)
+		;
+
+		serializeContext->Class<AutopilotComponent, AZ::Component>()
+			->Version(0)
+			->Field("Enabled", &AutopilotComponent::m_isEnabled)
+			->Field("Restart", &AutopilotComponent::m_isAutoRestartEnabled)
+			->Field("RestartDelay", &AutopilotComponent::m_restartDelay)
+			->Field("Policy", &AutopilotComponent::m_policy)
+			->Field("Script", &AutopilotComponent::m_script)
+			->Field("Decision", &AutopilotComponent::m_decisionInterval)
+			->Field("Seed", &AutopilotComponent::m_randomSeed)
+			->Field("EnergyReturn", &AutopilotComponent::m_returnEnergyThreshold)
+			->Field("EnergyResume", &AutopilotComponent::m_resumeEnergyThreshold)
+			->Field("Arrival", &AutopilotComponent::m_arrivalRadius)
+			->Field("ToleranceTurn", &AutopilotComponent::m_turnTolerance)
+			->Field("ToleranceMove", &AutopilotComponent::m_moveTolerance)
+		;
+
+		if(AZ::EditContext* editContext = serializeContext->GetEditContext())
+		{
+			editContext->Enum<Policy>("Policy", "")
+				->Value("Scripted", Policy::SCRIPTED)
+				->Value("Random Walk", Policy::RANDOM_WALK)
+				->Value("Greedy", Policy::GREEDY)
+			;
+
+			editContext->Enum<Command>("Command", "")
+				->Value("Wait", Command::WAIT)
+				->Value("Move", Command::MOVE)
+				->Value("Turn", Command::TURN)
+				->Value("Take Off / Land", Command::TOGGLE_LANDING)
+				->Value("Beam On / Off", Command::TOGGLE_BEAM)
+			;
+
+			editContext->Class<ScriptStep>("Step", "")
+				->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+				->DataElement(AZ::Edit::UIHandlers::ComboBox, &ScriptStep::m_command, "Command", "")
+				->DataElement(AZ::Edit::UIHandlers::Default, &ScriptStep::m_value, "Value", "Direction for move and turn commands")
+				->DataElement(AZ::Edit::UIHandlers::Default, &ScriptStep::m_duration, "Duration", "")
+			;
+
+			editContext->Class<AutopilotComponent>("Autopilot", "Autopilot")
+				->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+					->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+				->DataElement(AZ::Edit::UIHandlers::Default, &AutopilotComponent::m_isEnabled, "Enabled", "Can be also enabled at runtime by the game_autopilot console variable")
+
+				->ClassElement(AZ::Edit::ClassElements::Group, "Session")
+					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+					->DataElement(AZ::Edit::UIHandlers::Default, &AutopilotComponent::m_isAutoRestartEnabled, "Restart", "")
+					->DataElement(AZ::Edit::UIHandlers::Default, &AutopilotComponent::m_restartDelay, "Delay", "")
+
+				->ClassElement(AZ::Edit::ClassElements::Group, "Policy")
+					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+					->DataElement(AZ::Edit::UIHandlers::ComboBox, &AutopilotComponent::m_policy, "Type", "")
+					->DataElement(AZ::Edit::UIHandlers::Default, &AutopilotComponent::m_script, "Script", "")
+					->DataElement(AZ::Edit::UIHandlers::Default, &AutopilotComponent::m_decisionInterval, "Decision", "")
+					->DataElement(AZ::Edit::UIHandlers::Default, &AutopilotComponent::m_randomSeed, "Seed", "")
+
+				->ClassElement(AZ::Edit::ClassElements::Group, "Energy")
+					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+					->DataElement(AZ::Edit::UIHandlers::Default, &AutopilotComponent::m_returnEnergyThreshold, "Return", "")
+					->DataElement(AZ::Edit::UIHandlers::Default, &AutopilotComponent::m_resumeEnergyThreshold, "Resume", "")
+
+				->ClassElement(AZ::Edit::ClassElements::Group, "Steering")
+					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+					->DataElement(AZ::Edit::UIHandlers::Default, &AutopilotComponent::m_arrivalRadius, "Arrival", "")
+					->DataElement(AZ::Edit::UIHandlers::Default, &AutopilotComponent::m_turnTolerance, "Tolerance - Turn", "")
+					->DataElement(AZ::Edit::UIHandlers::Default, &AutopilotComponent::m_moveTolerance, "Tolerance - Move", "")
+			;
+		}
+	}
+}
+
+void AutopilotComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided)
+{
+	io_provided.push_back(AZ_CRC_CE("AutopilotService"));
+}
+
+void AutopilotComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible)
+{
+	io_incompatible.push_back(AZ_CRC_CE("AutopilotService"));
+}
+
+void AutopilotComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& io_required)
+{
+	io_required.push_back(AZ_CRC_CE("SpaceshipService"));
+}
+
+void AutopilotComponent::GetDependentServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_dependent)
+{}
+
+void AutopilotComponent::Activate()
+{
+	m_state = State::MENU;
+	m_timer = m_restartDelay;
+
+	GameNotificationBus::Handler::BusConnect();
+	SpaceshipNotificationBus::Handler::BusConnect(GetEntityId());
+
+	GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::INPUT);
+}
+
+void AutopilotComponent::Deactivate()
+{
+	GameplayStageNotificationBus::Handler::BusDisconnect();
+
+	SpaceshipNotificationBus::Handler::BusDisconnect();
+	GameNotificationBus::Handler::BusDisconnect();
+}
+
+void AutopilotComponent::OnGameCreated()
+{
+	m_state = State::LOADING;
+}
+
+void AutopilotComponent::OnGameLoading()
+{
+	m_state = State::LOADING;
+}
+
+void AutopilotComponent::OnGameStarted()
+{
+	m_state = State::PLAYING;
+
+	m_randomGenerator.SetSeed(m_randomSeed);
+	ResetControls();
+
+	++m_nSessions;
+
+	if(IsEnabled())
+	{
+		AZ_TracePrintf("Autopilot", "Session %u started\n", m_nSessions);
+	}
+}
+
+void AutopilotComponent::OnGamePaused()
+{
+	m_state = State::PAUSED;
+}
+
+void AutopilotComponent::OnGameResumed()
+{
+	m_state = State::PLAYING;
+}
+
+void AutopilotComponent::OnGameEnded()
+{
+	if(IsEnabled())
+	{
+		ResetControls();
+
+		AZ_TracePrintf("Autopilot", "Session %u ended\n", m_nSessions);
+	}
+
+	m_state = State::ENDED;
+	m_timer = m_restartDelay;
+}
+
+void AutopilotComponent::OnGameDestroyed()
+{
+	m_state = State::MENU;
+	m_timer = m_restartDelay;
+}
+
+void AutopilotComponent::OnLandingStarted()
+{
+	m_isLanding = true;
+}
+
+void AutopilotComponent::OnTakeOffStarted()
+{
+	m_isLanding = false;
+}
+
+void AutopilotComponent::OnStageTick(float i_deltaTime)
+{
+	GAME_PROFILE_SCOPE(SPACESHIPS, "AutopilotComponent::OnStageTick");
+
+	if(!IsEnabled())
+	{
+		if(m_wasEnabled)
+		{
+			m_wasEnabled = false;
+
+			ResetControls();
+		}
+
+		return;
+	}
+
+	m_wasEnabled = true;
+
+	switch(m_state)
+	{
+		case State::MENU:
+		case State::ENDED:
+		{
+			RequestGame(i_deltaTime);
+		}
+		break;
+
+		case State::PLAYING:
+		{
+			AZ::Transform thisTransform { AZ::Transform::CreateIdentity() };
+			EBUS_EVENT_ID_RESULT(thisTransform, GetEntityId(), AZ::TransformBus, GetWorldTM);
+
+			switch(m_policy)
+			{
+				case Policy::SCRIPTED:
+				{
+					UpdateScripted(i_deltaTime);
+				}
+				break;
+
+				case Policy::RANDOM_WALK:
+				{
+					UpdateRandomWalk(i_deltaTime, thisTransform);
+				}
+				break;
+
+				case Policy::GREEDY:
+				{
+					UpdateGreedy(i_deltaTime, thisTransform);
+				}
+				break;
+			}
+		}
+		break;
+
+		default:
+		{}
+	}
+}
+
+
+bool AutopilotComponent::IsEnabled() const
+{
+	return (m_isEnabled || static_cast<bool>(game_autopilot));
+}
+
+void AutopilotComponent::RequestGame(float i_deltaTime)
+{
+	if(!m_isAutoRestartEnabled)
+	{
+		return;
+	}
+
+	m_timer -= i_deltaTime;
+	if(m_timer > 0.f)
+	{
+		return;
+	}
+
+	m_timer = m_restartDelay;
+
+	if(m_state == State::MENU)
+	{
+		EBUS_EVENT(GameRequestBus, NewGame);
+	}
+	else
+	{
+		EBUS_EVENT(GameRequestBus, RetryGame);
+	}
+}
+
+void AutopilotComponent::UpdateScripted(float i_deltaTime)
+{
+	if(m_script.empty())
+	{
+		return;
+	}
+
+	m_timer -= i_deltaTime;
+	if(m_timer > 0.f)
+	{
+		return;
+	}
+
+	const ScriptStep& step = m_script[m_scriptIndex];
+	ExecuteCommand(step.m_command, step.m_value);
+
+	m_timer = step.m_duration;
+	m_scriptIndex = (m_scriptIndex + 1) % m_script.size();
+}
+
+void AutopilotComponent::UpdateRandomWalk(float i_deltaTime, const AZ::Transform& i_transform)
+{
+	if(ManageEnergy(i_transform))
+	{
+		return;
+	}
+
+	m_timer -= i_deltaTime;
+	if(m_timer > 0.f)
+	{
+		return;
+	}
+
+	m_timer = m_decisionInterval;
+
+	const float moveDirection = (m_randomGenerator.GetRandomFloat() < RANDOM_WALK_MOVE_PROBABILITY) ? 1.f : 0.f;
+	const float turnDirection = static_cast<float>(static_cast<int>(m_randomGenerator.Getu64Random() % 3) - 1);
+
+	ExecuteCommand(Command::MOVE, moveDirection);
+	ExecuteCommand(Command::TURN, turnDirection);
+
+	if(m_randomGenerator.GetRandomFloat() < RANDOM_WALK_BEAM_PROBABILITY)
+	{
+		ExecuteCommand(Command::TOGGLE_BEAM, 0.f);
+	}
+}
+
+void AutopilotComponent::UpdateGreedy(float i_deltaTime, const AZ::Transform& i_transform)
+{
+	if(ManageEnergy(i_transform))
+	{
+		return;
+	}
+
+	m_timer -= i_deltaTime;
+	if(m_timer < 0.f || m_targetTileId == INVALID_TILE_ID)
+	{
+		m_timer = m_decisionInterval;
+
+		m_targetTileId = INVALID_TILE_ID;
+		EBUS_EVENT_RESULT(m_targetTileId, TilesRequestBus, FindNearestUnclaimedTile, i_transform.GetTranslation());
+	}
+
+	if(m_targetTileId == INVALID_TILE_ID)
+	{
+		ResetControls();
+		SetBeamEnabled(false);
+
+		return;
+	}
+
+	AZ::Vector3 targetPosition { AZ::Vector3::CreateZero() };
+	EBUS_EVENT_RESULT(targetPosition, TilesRequestBus, GetTilePosition, m_targetTileId);
+
+	AZ::Vector3 flowDirection { AZ::Vector3::CreateZero() };
+	EBUS_EVENT_RESULT(flowDirection, TilesRequestBus, GetFlowDirectionToTile, i_transform.GetTranslation(), m_targetTileId);
+
+	const bool hasArrived = FollowFlow(i_transform, flowDirection, targetPosition);
+	SetBeamEnabled(hasArrived);
+}
+
+bool AutopilotComponent::ManageEnergy(const AZ::Transform& i_transform)
+{
+	bool isLanded { false };
+	EBUS_EVENT_ID_RESULT(isLanded, GetEntityId(), SpaceshipRequestBus, IsLanded);
+
+	float energy { 0.f };
+	EBUS_EVENT_ID_RESULT(energy, GetEntityId(), SpaceshipRequestBus, GetNormalizedEnergy);
+
+	if(isLanded)
+	{
+		if(energy >= m_resumeEnergyThreshold)
+		{
+			m_isReturning = false;
+
+			ExecuteCommand(Command::TOGGLE_LANDING, 0.f);
+		}
+
+		return true;
+	}
+	else if(m_isLanding)
+	{
+		return true;
+	}
+
+	if(!m_isReturning)
+	{
+		if(energy >= m_returnEnergyThreshold)
+		{
+			return false;
+		}
+
+		m_isReturning = true;
+		SetBeamEnabled(false);
+	}
+
+	const AZ::Vector3 position = i_transform.GetTranslation();
+
+	TileId landingAreaId { INVALID_TILE_ID };
+	EBUS_EVENT_RESULT(landingAreaId, TilesRequestBus, FindLandingAreaAt, position, true);
+
+	AZ::Vector3 flowDirection { AZ::Vector3::CreateZero() };
+	if(landingAreaId == INVALID_TILE_ID)
+	{
+		EBUS_EVENT_RESULT(landingAreaId, TilesRequestBus, FindNearestClaimedLandingArea, position);
+		if(landingAreaId == INVALID_TILE_ID)
+		{
+			m_isReturning = false;
+
+			return false;
+		}
+
+		EBUS_EVENT_RESULT(flowDirection, TilesRequestBus, GetFlowDirectionToLandingArea, position);
+	}
+
+	AZ::Vector3 landingAreaPosition { AZ::Vector3::CreateZero() };
+	EBUS_EVENT_RESULT(landingAreaPosition, TilesRequestBus, GetTilePosition, landingAreaId);
+
+	if(FollowFlow(i_transform, flowDirection, landingAreaPosition))
+	{
+		ExecuteCommand(Command::TOGGLE_LANDING, 0.f);
+	}
+
+	return true;
+}
+
+bool AutopilotComponent::FollowFlow(const AZ::Transform& i_transform, const AZ::Vector3& i_flowDirection, const AZ::Vector3& i_target) const
+{
+	// without a flow (target cell reached or unreachable) the target is approached directly
+	if(i_flowDirection.IsZero())
+	{
+		return SteerTowards(i_transform, i_target);
+	}
+
+	const AZ::Vector3 waypoint = i_transform.GetTranslation() + i_flowDirection * (m_arrivalRadius + 1.f);
+	SteerTowards(i_transform, waypoint);
+
+	return false;
+}
+
+bool AutopilotComponent::SteerTowards(const AZ::Transform& i_transform, const AZ::Vector3& i_target) const
+{
+	AZ::Vector3 offset = i_target - i_transform.GetTranslation();
+	offset.SetZ(0.f);
+
+	if(offset.GetLength() < m_arrivalRadius)
+	{
+		ExecuteCommand(Command::MOVE, 0.f);
+		ExecuteCommand(Command::TURN, 0.f);
+
+		return true;
+	}
+
+	AZ::Vector3 forwardAxis = i_transform.GetBasisY();
+	forwardAxis.SetZ(0.f);
+
+	const float sine = forwardAxis.GetX() * offset.GetY() - forwardAxis.GetY() * offset.GetX();
+	const float cosine = forwardAxis.Dot(offset);
+	const float angle = AZStd::atan2(sine, cosine);
+
+	const float turnDirection = (AZStd::abs(angle) > AZ::DegToRad(m_turnTolerance))
+		? ((angle > 0.f) ? 1.f : -1.f)
+		: 0.f
+	;
+
+	const float moveDirection = (AZStd::abs(angle) < AZ::DegToRad(m_moveTolerance)) ? 1.f : 0.f;
+
+	ExecuteCommand(Command::TURN, turnDirection);
+	ExecuteCommand(Command::MOVE, moveDirection);
+
+	return false;
+}
+
+void AutopilotComponent::ExecuteCommand(Command i_command, float i_value) const
+{
+	switch(i_command)
+	{
+		case Command::MOVE:
+		{
+			EBUS_EVENT_ID(GetEntityId(), SpaceshipRequestBus, Move, i_value);
+		}
+		break;
+
+		case Command::TURN:
+		{
+			EBUS_EVENT_ID(GetEntityId(), SpaceshipRequestBus, Turn, i_value);
+		}
+		break;
+
+		case Command::TOGGLE_LANDING:
+		{
+			EBUS_EVENT_ID(GetEntityId(), SpaceshipRequestBus, ToggleLanding);
+		}
+		break;
+
+		case Command::TOGGLE_BEAM:
+		{
+			EBUS_EVENT_ID(GetEntityId(), BeamRequestBus, Toggle);
+		}
+		break;
+
+		default:
+		{}
+	}
+}
+
+void AutopilotComponent::SetBeamEnabled(bool i_isEnabled) const
+{
+	bool isBeamEnabled { false };
+	EBUS_EVENT_ID_RESULT(isBeamEnabled, GetEntityId(), BeamRequestBus, IsEnabled);
+
+	if(isBeamEnabled != i_isEnabled)
+	{
+		ExecuteCommand(Command::TOGGLE_BEAM, 0.f);
+	}
+}
+
+void AutopilotComponent::ResetControls()
+{
+	ExecuteCommand(Command::MOVE, 0.f);
+	ExecuteCommand(Command::TURN, 0.f);
+
+	m_timer = 0.f;
+	m_scriptIndex = 0;
+	m_targetTileId = INVALID_TILE_ID;
+
+	m_isReturning = false;
+}
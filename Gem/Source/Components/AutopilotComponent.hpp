@@ -0,0 +1,161 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/vector.h>
+
+#include "../EBuses/GameBus.hpp"
+#include "../EBuses/GameplayBus.hpp"
+#include "../EBuses/SpaceshipBus.hpp"
+#include "../EBuses/TileBus.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class AutopilotComponent
+		: public AZ::Component
+		, protected GameNotificationBus::Handler
+		, protected GameplayStageNotificationBus::Handler
+		, protected SpaceshipNotificationBus::Handler
+	{
+	public:
+		AZ_COMPONENT(AutopilotComponent, "{4CEA315D-2C5A-4547-A36C-2A7504DE19FB}");
+		static void Reflect(AZ::ReflectContext* io_context);
+
+		static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided);
+		static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible);
+		static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& io_required);
+		static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& io_dependent);
+
+		enum class Policy : AZ::u8
+		{
+			SCRIPTED = 0,
+			RANDOM_WALK,
+			GREEDY
+		};
+
+		enum class Command : AZ::u8
+		{
+			WAIT = 0,
+			MOVE,
+			TURN,
+			TOGGLE_LANDING,
+			TOGGLE_BEAM
+		};
+
+		struct ScriptStep
+		{
+			AZ_TYPE_INFO(ScriptStep, "{5A2207AD-A775-41A9-AEC4-E15F5388552D}");
+
+			Command m_command { Command::WAIT };
+			float m_value { 0.f };
+			float m_duration { 1.f };
+		};
+
+	protected:
+		// AZ::Component
+		void Activate() override;
+		void Deactivate() override;
+
+		// GameplayStageNotificationBus
+		void OnStageTick(float i_deltaTime) override;
+
+		// GameNotificationBus
+		void OnGameCreated() override;
+		void OnGameLoading() override;
+		void OnGameStarted() override;
+		void OnGamePaused() override;
+		void OnGameResumed() override;
+		void OnGameEnded() override;
+		void OnGameDestroyed() override;
+
+		// SpaceshipNotificationBus
+		void OnLandingStarted() override;
+		void OnTakeOffStarted() override;
+
+	private:
+		enum class State : AZ::u8
+		{
+			MENU = 0,
+			LOADING,
+			PLAYING,
+			PAUSED,
+			ENDED
+		};
+
+		bool IsEnabled() const;
+
+		void RequestGame(float i_deltaTime);
+
+		void UpdateScripted(float i_deltaTime);
+		void UpdateRandomWalk(float i_deltaTime, const AZ::Transform& i_transform);
+		void UpdateGreedy(float i_deltaTime, const AZ::Transform& i_transform);
+
+		bool ManageEnergy(const AZ::Transform& i_transform);
+		bool FollowFlow(const AZ::Transform& i_transform, const AZ::Vector3& i_flowDirection, const AZ::Vector3& i_target) const;
+		bool SteerTowards(const AZ::Transform& i_transform, const AZ::Vector3& i_target) const;
+
+		void ExecuteCommand(Command i_command, float i_value) const;
+		void SetBeamEnabled(bool i_isEnabled) const;
+
+		void ResetControls();
+
+		bool m_isEnabled { false };
+		bool m_isAutoRestartEnabled { true };
+		Policy m_policy { Policy::GREEDY };
+
+		AZStd::vector<ScriptStep> m_script {};
+
+		float m_decisionInterval { 0.5f };
+		float m_restartDelay { 3.f };
+
+		float m_returnEnergyThreshold { 0.3f };
+		float m_resumeEnergyThreshold { 0.95f };
+
+		float m_arrivalRadius { 0.5f };
+		float m_turnTolerance { 5.f };
+		float m_moveTolerance { 45.f };
+
+		AZ::u64 m_randomSeed { 1234 };
+		AZ::SimpleLcgRandom m_randomGenerator {};
+
+		State m_state { State::MENU };
+		bool m_wasEnabled { false };
+		bool m_isReturning { false };
+		bool m_isLanding { false };
+
+		float m_timer { 0.f };
+		AZStd::size_t m_scriptIndex { 0 };
+		TileId m_targetTileId { INVALID_TILE_ID };
+
+		AZ::u32 m_nSessions { 0 };
+
+		static constexpr float RANDOM_WALK_MOVE_PROBABILITY = 0.75f;
+		static constexpr float RANDOM_WALK_BEAM_PROBABILITY = 0.25f;
+	};
+
+} // Loherangrin::Games::O3DEJam2305
+
+namespace AZ
+{
+	AZ_TYPE_INFO_SPECIALIZE(Loherangrin::Games::O3DEJam2305::AutopilotComponent::Policy, "{57CF783B-70B8-406C-A792-53A213A8FD3B}");
+	AZ_TYPE_INFO_SPECIALIZE(Loherangrin::Games::O3DEJam2305::AutopilotComponent::Command, "{CFF7CF20-29D1-4648-9F4B-BD91E30A80A4}");
+
+} // AZ
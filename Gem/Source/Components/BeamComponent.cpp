@@ -20,6 +20,7 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 
 #include <AzFramework/Input/Devices/Keyboard/InputDeviceKeyboard.h>
 #include <AzFramework/Physics/Common/PhysicsTypes.h>
@@ -27,10 +28,17 @@
 #include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
 
+#include "../Core/BeamRules.hpp"
 #include "../EBuses/TileBus.hpp"
+#include "../Utils/GameMetrics.hpp"
 #include "BeamComponent.hpp"
 
 using Loherangrin::Games::O3DEJam2305::BeamComponent;
+using Loherangrin::Games::O3DEJam2305::BeamRules;
+using Loherangrin::Games::O3DEJam2305::BeamTransfer;
+using Loherangrin::Games::O3DEJam2305::GameSubsystem;
+using Loherangrin::Games::O3DEJam2305::SessionStdAllocator;
+using Loherangrin::Games::O3DEJam2305::SessionVector;
 
 
 void BeamComponent::Reflect(AZ::ReflectContext* io_context)
@@ -39,6 +47,7 @@ void BeamComponent::Reflect(AZ::ReflectContext* io_context)
 	{
 		serializeContext->Class<BeamComponent, AZ::Component>()
 			->Version(0)
+			->Field("Spaceship", &BeamComponent::m_spaceshipEntityId)
 			->Field("Transfer", &BeamComponent::m_transferSpeed)
 		;
 
@@ -49,6 +58,7 @@ void BeamComponent::Reflect(AZ::ReflectContext* io_context)
 					->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
 					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
 
+				->DataElement(AZ::Edit::UIHandlers::Default, &BeamComponent::m_spaceshipEntityId, "Spaceship", "Spaceship powering this beam. If empty, the parent entity is used")
 				->DataElement(AZ::Edit::UIHandlers::Default, &BeamComponent::m_transferSpeed, "Transfer", "")
 			;
 		}
@@ -79,17 +89,26 @@ void BeamComponent::Init()
 {
 	m_triggerEnterHandler = AzPhysics::SimulatedBodyEvents::OnTriggerEnter::Handler([this]([[maybe_unused]] AzPhysics::SimulatedBodyHandle i_bodyHandle, const AzPhysics::TriggerEvent& i_trigger)
 	{
+		GAME_PROFILE_SCOPE(BEAM, "BeamComponent::OnTriggerEnter");
+
 		if(!i_trigger.m_otherBody)
 		{
 			return;
 		}
 
 		const AZ::EntityId otherEntityId = i_trigger.m_otherBody->GetEntityId();
+		if(!TileRequestBus::HasHandlers(otherEntityId))
+		{
+			return;
+		}
+
 		SelectTile(otherEntityId);
 	});
 
 	m_triggerExitHandler = AzPhysics::SimulatedBodyEvents::OnTriggerExit::Handler([this]([[maybe_unused]] AzPhysics::SimulatedBodyHandle i_bodyHandle, const AzPhysics::TriggerEvent& i_trigger)
 	{
+		GAME_PROFILE_SCOPE(BEAM, "BeamComponent::OnTriggerExit");
+
 		if(!i_trigger.m_otherBody)
 		{
 			return;
@@ -102,10 +121,20 @@ void BeamComponent::Init()
 
 void BeamComponent::Activate()
 {
-	Physics::RigidBodyNotificationBus::Handler::BusConnect(GetEntityId());
+	const AZ::EntityId thisEntityId = GetEntityId();
+
+	if(!m_spaceshipEntityId.IsValid())
+	{
+		EBUS_EVENT_ID_RESULT(m_spaceshipEntityId, thisEntityId, AZ::TransformBus, GetParentId);
+	}
+
+	AZ_Error("Beam", m_spaceshipEntityId.IsValid(), "No spaceship was found for this beam. Please assign one or attach the beam to a spaceship entity");
+
+	Physics::RigidBodyNotificationBus::Handler::BusConnect(thisEntityId);
 
-	SpaceshipNotificationBus::Handler::BusConnect();
+	SpaceshipNotificationBus::Handler::BusConnect(m_spaceshipEntityId);
 	GameNotificationBus::Handler::BusConnect();
+	BeamRequestBus::Handler::BusConnect(m_spaceshipEntityId);
 
 	if(m_isEnabled)
 	{
@@ -119,16 +148,21 @@ void BeamComponent::Activate()
 
 void BeamComponent::Deactivate()
 {
+	BeamRequestBus::Handler::BusDisconnect();
 	GameNotificationBus::Handler::BusDisconnect();
 
+	ReplayInputNotificationBus::Handler::BusDisconnect();
 	InputChannelEventListener::Disconnect();
-	AZ::TickBus::Handler::BusDisconnect();
+	GameplayStageNotificationBus::Handler::BusDisconnect();
 
 	SpaceshipNotificationBus::Handler::BusDisconnect();
 
 	DisconnectTriggerHandlers();
 
 	Physics::RigidBodyNotificationBus::Handler::BusDisconnect();
+
+	// the component may outlive the game, so its selection can't wait for the next one to be released
+	DropSelectedTiles();
 }
 
 void BeamComponent::OnGameLoading()
@@ -139,28 +173,37 @@ void BeamComponent::OnGameLoading()
 	}
 
 	m_isLocked = false;
-	m_selectedTiles.clear();
+
+	DropSelectedTiles();
 }
 
 void BeamComponent::OnGameStarted()
 {
+	m_isPlayer = false;
+	EBUS_EVENT_ID_RESULT(m_isPlayer, m_spaceshipEntityId, SpaceshipRequestBus, IsPlayer);
+
 	OnGameResumed();
 }
 
 void BeamComponent::OnGamePaused()
 {
 	InputChannelEventListener::Disconnect();
-	AZ::TickBus::Handler::BusDisconnect();
+	ReplayInputNotificationBus::Handler::BusDisconnect();
+	GameplayStageNotificationBus::Handler::BusDisconnect();
 }
 
 void BeamComponent::OnGameResumed()
 {
 	if(m_isEnabled)
 	{
-		AZ::TickBus::Handler::BusConnect();
+		GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::TRANSFERS);
 	}
 
-	InputChannelEventListener::Connect();
+	if(m_isPlayer)
+	{
+		InputChannelEventListener::Connect();
+		ReplayInputNotificationBus::Handler::BusConnect();
+	}
 }
 
 void BeamComponent::OnGameEnded()
@@ -190,20 +233,47 @@ void BeamComponent::OnPhysicsEnabled(const AZ::EntityId& i_entityId)
 	ConnectTriggerHandlers();
 }
 
-void BeamComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint i_time)
+void BeamComponent::OnStageTick(float i_deltaTime)
 {
+	GAME_PROFILE_SCOPE(BEAM, "BeamComponent::OnStageTick");
+
 	TransferEnergyToTiles(i_deltaTime);
 }
 
 bool BeamComponent::OnInputChannelEventFiltered(const AzFramework::InputChannel& i_inputChannel)
 {
-	const AzFramework::InputChannelId& channelId = i_inputChannel.GetInputChannelId();
+	bool isReplayPlaying { false };
+	EBUS_EVENT_RESULT(isReplayPlaying, ReplayRequestBus, IsPlaying);
+
+	if(isReplayPlaying)
+	{
+		return false;
+	}
+
+	const AZ::Crc32 channel = i_inputChannel.GetInputChannelId().GetNameCrc32();
+	const AzFramework::InputChannel::State state = i_inputChannel.GetState();
 
+	if(!ProcessInput(channel, state))
+	{
+		return false;
+	}
+
+	EBUS_EVENT(ReplayRequestBus, RecordInput, channel, static_cast<AZ::u8>(state), i_inputChannel.GetValue());
+
+	return true;
+}
+
+void BeamComponent::OnReplayInput(AZ::Crc32 i_channel, AZ::u8 i_state, [[maybe_unused]] float i_value)
+{
+	ProcessInput(i_channel, static_cast<AzFramework::InputChannel::State>(i_state));
+}
+
+bool BeamComponent::ProcessInput(AZ::Crc32 i_channel, AzFramework::InputChannel::State i_state)
+{
 	// TurnOn / TurnOff
-	if(channelId == AzFramework::InputDeviceKeyboard::Key::EditSpace)
+	if(i_channel == AzFramework::InputDeviceKeyboard::Key::EditSpace.GetNameCrc32())
 	{
-		const AzFramework::InputChannel::State inputState = i_inputChannel.GetState();
-		if(inputState != AzFramework::InputChannel::State::Began)
+		if(i_state != AzFramework::InputChannel::State::Began)
 		{
 			return false;
 		}
@@ -230,6 +300,11 @@ void BeamComponent::Toggle()
 	}
 }
 
+bool BeamComponent::IsEnabled() const
+{
+	return m_isEnabled;
+}
+
 void BeamComponent::TurnOn()
 {
 	if(m_isLocked)
@@ -246,7 +321,7 @@ void BeamComponent::TurnOn()
 			EBUS_EVENT_ID(tileEntityId, TileRequestBus, SetSelected, true);
 		}
 
-		AZ::TickBus::Handler::BusConnect();
+		GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::TRANSFERS);
 	}
 
 	EBUS_EVENT_ID(GetEntityId(), AZ::Render::MeshComponentRequestBus, SetVisibility, true);
@@ -256,7 +331,7 @@ void BeamComponent::TurnOff()
 {
 	m_isEnabled = false;
 
-	AZ::TickBus::Handler::BusDisconnect();
+	GameplayStageNotificationBus::Handler::BusDisconnect();
 
 	for(const AZ::EntityId& tileEntityId : m_selectedTiles)
 	{
@@ -287,16 +362,19 @@ void BeamComponent::DisconnectTriggerHandlers()
 
 void BeamComponent::SelectTile(const AZ::EntityId& i_tileEntityId)
 {
-	m_selectedTiles.emplace(i_tileEntityId);
+	if(AZStd::find(m_selectedTiles.begin(), m_selectedTiles.end(), i_tileEntityId) == m_selectedTiles.end())
+	{
+		m_selectedTiles.push_back(i_tileEntityId);
+	}
 
 	if(!m_isEnabled)
 	{
 		return;
 	}
 
-	if(!AZ::TickBus::Handler::BusIsConnected())
+	if(!GameplayStageNotificationBus::Handler::BusIsConnected())
 	{
-		AZ::TickBus::Handler::BusConnect();
+		GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::TRANSFERS);
 	}
 
 	EBUS_EVENT_ID(i_tileEntityId, TileRequestBus, SetSelected, true);
@@ -304,7 +382,12 @@ void BeamComponent::SelectTile(const AZ::EntityId& i_tileEntityId)
 
 void BeamComponent::DeselectTile(const AZ::EntityId& i_tileEntityId)
 {
-	m_selectedTiles.extract(i_tileEntityId);
+	auto it = AZStd::find(m_selectedTiles.begin(), m_selectedTiles.end(), i_tileEntityId);
+	if(it != m_selectedTiles.end())
+	{
+		*it = m_selectedTiles.back();
+		m_selectedTiles.pop_back();
+	}
 
 	if(!m_isEnabled)
 	{
@@ -313,12 +396,18 @@ void BeamComponent::DeselectTile(const AZ::EntityId& i_tileEntityId)
 
 	if(m_selectedTiles.empty())
 	{
-		AZ::TickBus::Handler::BusDisconnect();
+		GameplayStageNotificationBus::Handler::BusDisconnect();
 	}
 
 	EBUS_EVENT_ID(i_tileEntityId, TileRequestBus, SetSelected, false);
 }
 
+void BeamComponent::DropSelectedTiles()
+{
+	// the memory goes back to the session arena, which is reset for each game, so the selection is swapped out rather than cleared
+	SessionVector<AZ::EntityId> { SessionStdAllocator { GameSubsystem::BEAM } }.swap(m_selectedTiles);
+}
+
 void BeamComponent::TransferEnergyToTiles(float i_deltaTime)
 {
 	if(m_selectedTiles.empty())
@@ -326,15 +415,14 @@ void BeamComponent::TransferEnergyToTiles(float i_deltaTime)
 		return;
 	}
 
-	const float sentEnergy = m_transferSpeed * i_deltaTime;
-	const float tileEnergy = sentEnergy / static_cast<float>(m_selectedTiles.size());
+	const BeamTransfer transfer = BeamRules::CalculateTransfer(m_transferSpeed, m_selectedTiles.size(), i_deltaTime);
 
 	for(const AZ::EntityId& tileEntityId : m_selectedTiles)
 	{
-		EBUS_EVENT_ID(tileEntityId, TileRequestBus, AddEnergy, tileEnergy);
+		EBUS_EVENT_ID(tileEntityId, TileRequestBus, AddEnergy, transfer.m_tileEnergy);
 	}
 
-	EBUS_EVENT(SpaceshipRequestBus, SubtractEnergy, sentEnergy);
+	EBUS_EVENT_ID(m_spaceshipEntityId, SpaceshipRequestBus, SubtractEnergy, transfer.m_sentEnergy);
 }
 
 void BeamComponent::OnEnergySavingModeActivated()
@@ -17,25 +17,29 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
-#include <AzCore/Component/TickBus.h>
-#include <AzCore/std/containers/set.h>
 
 #include <AzFramework/Input/Events/InputChannelEventListener.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBodyEvents.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
 
+#include "../EBuses/BeamBus.hpp"
 #include "../EBuses/GameBus.hpp"
+#include "../EBuses/GameplayBus.hpp"
+#include "../EBuses/ReplayBus.hpp"
 #include "../EBuses/SpaceshipBus.hpp"
+#include "../Utils/GameAllocators.hpp"
 
 
 namespace Loherangrin::Games::O3DEJam2305
 {
 	class BeamComponent
 		: public AZ::Component
-		, protected AZ::TickBus::Handler
 		, protected AzFramework::InputChannelEventListener
 		, protected Physics::RigidBodyNotificationBus::Handler
+		, protected BeamRequestBus::Handler
 		, protected GameNotificationBus::Handler
+		, protected GameplayStageNotificationBus::Handler
+		, protected ReplayInputNotificationBus::Handler
 		, protected SpaceshipNotificationBus::Handler
 	{
 	public:
@@ -53,15 +57,22 @@ namespace Loherangrin::Games::O3DEJam2305
 		void Activate() override;
 		void Deactivate() override;
 
-		// AZ::TickBus
-		void OnTick(float i_deltaTime, AZ::ScriptTimePoint i_time) override;
+		// GameplayStageNotificationBus
+		void OnStageTick(float i_deltaTime) override;
 
 		// AzFramework::InputChannelEventListener
 		bool OnInputChannelEventFiltered(const AzFramework::InputChannel& i_inputChannel) override;
 
+		// ReplayInputNotificationBus
+		void OnReplayInput(AZ::Crc32 i_channel, AZ::u8 i_state, float i_value) override;
+
 		// Physics::RigidBodyNotificationBus
 		void OnPhysicsEnabled(const AZ::EntityId& i_entityId) override;
 
+		// BeamRequestBus
+		void Toggle() override;
+		bool IsEnabled() const override;
+
 		// GameNotificationBus
 		void OnGameLoading() override;
 		void OnGameStarted() override;
@@ -77,23 +88,29 @@ namespace Loherangrin::Games::O3DEJam2305
 		void OnTakeOffEnded() override;
 
 	private:
+		bool ProcessInput(AZ::Crc32 i_channel, AzFramework::InputChannel::State i_state);
+
 		void ConnectTriggerHandlers();
 		void DisconnectTriggerHandlers();
 
 		void TransferEnergyToTiles(float i_deltaTime);
 		void SelectTile(const AZ::EntityId& i_tileEntityId);
 		void DeselectTile(const AZ::EntityId& i_tileEntityId);
+		void DropSelectedTiles();
 
-		void Toggle();
 		void TurnOn();
 		void TurnOff();
 
+		AZ::EntityId m_spaceshipEntityId {};
+		bool m_isPlayer { false };
+
 		bool m_isLocked { false };
 		bool m_isEnabled { false };
 
 		float m_transferSpeed { 4.f };
 
-		AZStd::set<AZ::EntityId> m_selectedTiles {};
+		// a handful of tiles at most, kept for one game only
+		SessionVector<AZ::EntityId> m_selectedTiles { SessionStdAllocator { GameSubsystem::BEAM } };
 
 		AzPhysics::SimulatedBodyEvents::OnTriggerEnter::Handler m_triggerEnterHandler;
 		AzPhysics::SimulatedBodyEvents::OnTriggerExit::Handler m_triggerExitHandler;
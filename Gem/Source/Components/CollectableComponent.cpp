@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <AzCore/Component/TransformBus.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -23,10 +24,18 @@
 #include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
 
+#include "../Core/SaveFile.hpp"
 #include "../EBuses/CollectableBus.hpp"
+#include "../EBuses/SpaceshipBus.hpp"
+#include "../Utils/GameMetrics.hpp"
 #include "CollectableComponent.hpp"
 
 using Loherangrin::Games::O3DEJam2305::CollectableComponent;
+using Loherangrin::Games::O3DEJam2305::CollectableEffect;
+using Loherangrin::Games::O3DEJam2305::CollectableRules;
+using Loherangrin::Games::O3DEJam2305::CollectableType;
+using Loherangrin::Games::O3DEJam2305::SaveCollectableRecord;
+using Loherangrin::Games::O3DEJam2305::SaveFile;
 
 
 void CollectableComponent::Reflect(AZ::ReflectContext* io_context)
@@ -76,37 +85,42 @@ void CollectableComponent::GetDependentServices([[maybe_unused]] AZ::ComponentDe
 
 void CollectableComponent::Init()
 {
-	m_triggerEnterHandler = AzPhysics::SimulatedBodyEvents::OnTriggerEnter::Handler([this]([[maybe_unused]] AzPhysics::SimulatedBodyHandle i_bodyHandle, [[maybe_unused]] const AzPhysics::TriggerEvent& i_trigger)
+	m_triggerEnterHandler = AzPhysics::SimulatedBodyEvents::OnTriggerEnter::Handler([this]([[maybe_unused]] AzPhysics::SimulatedBodyHandle i_bodyHandle, const AzPhysics::TriggerEvent& i_trigger)
 	{
+		GAME_PROFILE_SCOPE(COLLECTABLES, "CollectableComponent::OnTriggerEnter");
+
+		if(!i_trigger.m_otherBody)
+		{
+			return;
+		}
+
+		const AZ::EntityId spaceshipEntityId = i_trigger.m_otherBody->GetEntityId();
+		if(!SpaceshipRequestBus::HasHandlers(spaceshipEntityId))
+		{
+			return;
+		}
+
+		const CollectableEffect effect = CollectableRules::CalculateEffect(m_type, m_amount, m_duration);
+
 		switch(m_type)
 		{
 			case CollectableType::STOP_DECAY:
 			{
-				EBUS_EVENT(CollectablesNotificationBus, OnStopDecayCollected, m_duration);
+				EBUS_EVENT(CollectablesNotificationBus, OnStopDecayCollected, effect.m_stopDecayDuration);
 			}
 			break;
 
 			case CollectableType::SPACESHIP_DAMAGE:
-			{
-				EBUS_EVENT(CollectablesNotificationBus, OnSpaceshipEnergyCollected, -m_amount);
-			}
-			break;
-
 			case CollectableType::SPACESHIP_ENERGY:
 			{
-				EBUS_EVENT(CollectablesNotificationBus, OnSpaceshipEnergyCollected, m_amount);
+				EBUS_EVENT(CollectablesNotificationBus, OnSpaceshipEnergyCollected, spaceshipEntityId, effect.m_spaceshipEnergy);
 			}
 			break;
 
 			case CollectableType::TILE_DAMAGE:
-			{
-				EBUS_EVENT(CollectablesNotificationBus, OnTileEnergyCollected, -m_amount);
-			}
-			break;
-
 			case CollectableType::TILE_ENERGY:
 			{
-				EBUS_EVENT(CollectablesNotificationBus, OnTileEnergyCollected, m_amount);
+				EBUS_EVENT(CollectablesNotificationBus, OnTileEnergyCollected, effect.m_tileEnergy);
 			}
 			break;
 
@@ -114,21 +128,19 @@ void CollectableComponent::Init()
 			case CollectableType::MEDIUM_POINTS:
 			case CollectableType::LARGE_POINTS:
 			{
-				EBUS_EVENT(CollectablesNotificationBus, OnPointsCollected, static_cast<CollectablesNotifications::Points>(m_amount));
+				EBUS_EVENT(CollectablesNotificationBus, OnPointsCollected, effect.m_points);
 			}
 			break;
 
 			case CollectableType::SPEED_UP:
-			{
-				EBUS_EVENT(CollectablesNotificationBus, OnSpeedCollected, m_amount, m_duration);
-			}
-			break;
-
 			case CollectableType::SPEED_DOWN:
 			{
-				EBUS_EVENT(CollectablesNotificationBus, OnSpeedCollected, 1.f / m_amount, m_duration);
+				EBUS_EVENT(CollectablesNotificationBus, OnSpeedCollected, spaceshipEntityId, effect.m_speedMultiplier, effect.m_speedDuration);
 			}
 			break;
+
+			default:
+			{}
 		}
 
 		EBUS_EVENT(AzFramework::GameEntityContextRequestBus, DestroyGameEntityAndDescendants, GetEntityId());
@@ -138,11 +150,13 @@ void CollectableComponent::Init()
 void CollectableComponent::Activate()
 {
 	Physics::RigidBodyNotificationBus::Handler::BusConnect(GetEntityId());
+	SaveGameNotificationBus::Handler::BusConnect();
 }
 
 void CollectableComponent::Deactivate()
 {
-	AZ::TickBus::Handler::BusDisconnect();
+	SaveGameNotificationBus::Handler::BusDisconnect();
+	GameplayStageNotificationBus::Handler::BusDisconnect();
 	Physics::RigidBodyNotificationBus::Handler::BusDisconnect();
 
 	m_triggerEnterHandler.Disconnect();
@@ -166,12 +180,38 @@ void CollectableComponent::OnPhysicsEnabled(const AZ::EntityId& i_entityId)
 
 	if(m_timer > 0.f)
 	{
-		AZ::TickBus::Handler::BusConnect();
+		GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::COLLECTABLES);
+	}
+}
+
+void CollectableComponent::OnGameSaving(SaveFile& io_file)
+{
+	if(m_timer <= 0.f)
+	{
+		return;
 	}
+
+	// the pool places the root of a collectable, so that is the position it is spawned at again
+	AZ::EntityId rootEntityId {};
+	EBUS_EVENT_ID_RESULT(rootEntityId, GetEntityId(), AZ::TransformBus, GetParentId);
+
+	AZ::Vector3 position { AZ::Vector3::CreateZero() };
+	EBUS_EVENT_ID_RESULT(position, (rootEntityId.IsValid()) ? rootEntityId : GetEntityId(), AZ::TransformBus, GetWorldTranslation);
+
+	SaveCollectableRecord record;
+	record.m_type = static_cast<AZ::u8>(m_type);
+	record.m_position[0] = position.GetX();
+	record.m_position[1] = position.GetY();
+	record.m_position[2] = position.GetZ();
+	record.m_timer = m_timer;
+
+	io_file.AddCollectable(record);
 }
 
-void CollectableComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint i_time)
+void CollectableComponent::OnStageTick(float i_deltaTime)
 {
+	GAME_PROFILE_SCOPE(COLLECTABLES, "CollectableComponent::OnStageTick");
+
 	m_timer -= i_deltaTime;
 	if(m_timer > 0.f)
 	{
@@ -17,11 +17,14 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
-#include <AzCore/Component/TickBus.h>
 
 #include <AzFramework/Physics/Common/PhysicsSimulatedBodyEvents.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
 
+#include "../Core/CollectableRules.hpp"
+#include "../EBuses/GameplayBus.hpp"
+#include "../EBuses/SaveGameBus.hpp"
+
 
 namespace Loherangrin::Games::O3DEJam2305
 {
@@ -29,8 +32,9 @@ namespace Loherangrin::Games::O3DEJam2305
 
 	class CollectableComponent
 		: public AZ::Component
-		, protected AZ::TickBus::Handler
 		, protected Physics::RigidBodyNotificationBus::Handler
+		, protected GameplayStageNotificationBus::Handler
+		, protected SaveGameNotificationBus::Handler
 	{
 	public:
 		AZ_COMPONENT(CollectableComponent, "{1192D238-1E11-406C-B4D0-88A60BA5199D}");
@@ -47,28 +51,16 @@ namespace Loherangrin::Games::O3DEJam2305
 		void Activate() override;
 		void Deactivate() override;
 
-		// AZ::TickBus
-		void OnTick(float i_deltaTime, AZ::ScriptTimePoint i_time) override;
+		// GameplayStageNotificationBus
+		void OnStageTick(float i_deltaTime) override;
 
 		// Physics::RigidBodyNotificationBus
 		void OnPhysicsEnabled(const AZ::EntityId& i_entityId) override;
 
-	private:
-		enum class CollectableType : AZ::u8
-		{
-			NONE = 0,
-			STOP_DECAY,
-			SPACESHIP_DAMAGE,
-			SPACESHIP_ENERGY,
-			TILE_DAMAGE,
-			TILE_ENERGY,
-			SMALL_POINTS,
-			MEDIUM_POINTS,
-			LARGE_POINTS,
-			SPEED_UP,
-			SPEED_DOWN
-		};
+		// SaveGameNotificationBus
+		void OnGameSaving(SaveFile& io_file) override;
 
+	private:
 		CollectableType m_type { CollectableType::NONE };
 
 		float m_amount { 0.f };
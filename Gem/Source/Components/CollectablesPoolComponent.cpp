@@ -21,10 +21,18 @@
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/Serialization/SerializeContext.h>
 
+#include "../Core/SaveFile.hpp"
+#include "../Utils/GameMetrics.hpp"
 #include "CollectableComponent.hpp"
 #include "CollectablesPoolComponent.hpp"
 
+using Loherangrin::Games::O3DEJam2305::CollectableRules;
 using Loherangrin::Games::O3DEJam2305::CollectablesPoolComponent;
+using Loherangrin::Games::O3DEJam2305::CollectableType;
+using Loherangrin::Games::O3DEJam2305::SaveCollectableRecord;
+using Loherangrin::Games::O3DEJam2305::SaveFile;
+using Loherangrin::Games::O3DEJam2305::SavePool;
+using Loherangrin::Games::O3DEJam2305::SavePoolRecord;
 
 
 void CollectablesPoolComponent::Reflect(AZ::ReflectContext* io_context)
@@ -127,20 +135,32 @@ void CollectablesPoolComponent::Init()
 	m_collectableSpawnTickets[CollectableType::SPEED_UP] = AzFramework::EntitySpawnTicket { m_speedUpPrefab };
 	m_collectableSpawnTickets[CollectableType::SPEED_DOWN] = AzFramework::EntitySpawnTicket { m_speedDownPrefab };
 
-	m_randomGenerator.SetSeed(m_collectableSeed);
+	m_randomStream.SetSeed(m_collectableSeed);
 }
 
 void CollectablesPoolComponent::Activate()
 {
+	for(auto& it : m_collectableSpawnTickets)
+	{
+		GameMetrics::TrackSpawnTicket(GameSubsystem::COLLECTABLES, it.second);
+	}
+
 	GameNotificationBus::Handler::BusConnect();
+	SaveGameNotificationBus::Handler::BusConnect();
 }
 
 void CollectablesPoolComponent::Deactivate()
 {
 	TilesNotificationBus::Handler::BusDisconnect();
+	SaveGameNotificationBus::Handler::BusDisconnect();
 	GameNotificationBus::Handler::BusDisconnect();
 
 	DestroyAllCollectables();
+
+	for(const auto& it : m_collectableSpawnTickets)
+	{
+		GameMetrics::UntrackSpawnTicket(it.second);
+	}
 }
 
 void CollectablesPoolComponent::OnGameLoading()
@@ -150,6 +170,11 @@ void CollectablesPoolComponent::OnGameLoading()
 
 void CollectablesPoolComponent::OnGameStarted()
 {
+	AZ::u64 layoutSeed { 0 };
+	EBUS_EVENT_RESULT(layoutSeed, TilesRequestBus, GetLayoutSeed);
+
+	m_randomStream.SetSeed(m_collectableSeed ^ layoutSeed);
+
 	TilesNotificationBus::Handler::BusConnect();
 }
 
@@ -158,25 +183,69 @@ void CollectablesPoolComponent::OnGameEnded()
 	TilesNotificationBus::Handler::BusDisconnect();
 }
 
+void CollectablesPoolComponent::OnGameSaving(SaveFile& io_file)
+{
+	io_file.SetPool(SavePool::COLLECTABLES, m_randomStream.GetSeed(), m_randomStream.GetCounter(), 0.f);
+}
+
+void CollectablesPoolComponent::OnGameRestoring(const SaveFile& i_file)
+{
+	if(const SavePoolRecord* pool = i_file.FindPool(SavePool::COLLECTABLES))
+	{
+		m_randomStream.SetSeed(pool->m_seed);
+		m_randomStream.SetCounter(pool->m_counter);
+	}
+
+	for(const SaveCollectableRecord& collectable : i_file.GetCollectables())
+	{
+		const auto collectableType = static_cast<CollectableType>(collectable.m_type);
+		if(m_collectableSpawnTickets.find(collectableType) == m_collectableSpawnTickets.end())
+		{
+			continue;
+		}
+
+		CreateCollectable(collectableType, AZ::EntityId {}, &collectable);
+	}
+}
+
 void CollectablesPoolComponent::OnTileClaimed(const AZ::EntityId& i_tileEntityId)
 {
+	// the tiles claimed by a restored game already dropped their collectables, which are restored on their own
+	bool isRestoring { false };
+	EBUS_EVENT_RESULT(isRestoring, SaveGameRequestBus, IsRestoring);
+
+	if(isRestoring)
+	{
+		return;
+	}
+
 	TryCreateCollectable(i_tileEntityId);
 }
 
 void CollectablesPoolComponent::TryCreateCollectable(const AZ::EntityId& i_tileEntityId)
 {
-	const bool hasCollectable = (m_randomGenerator.GetRandomFloat() < m_collectableProbability);
-	if(!hasCollectable)
+	const auto nCollectableTypes = static_cast<AZ::u8>(m_collectableSpawnTickets.size());
+
+	const CollectableType collectableType = CollectableRules::SampleDrop(m_randomStream, m_collectableProbability, nCollectableTypes);
+	if(collectableType == CollectableType::NONE)
 	{
 		return;
 	}
 
-	auto collectableType = static_cast<CollectableType>((m_randomGenerator.Getu64Random() % m_collectableSpawnTickets.size()) + 1);
+	CreateCollectable(collectableType, i_tileEntityId, nullptr);
+}
+
+void CollectablesPoolComponent::CreateCollectable(CollectableType i_type, const AZ::EntityId& i_tileEntityId, const SaveCollectableRecord* i_savedCollectable)
+{
+	const bool isSaved = (i_savedCollectable != nullptr);
+	const SaveCollectableRecord savedCollectable = (isSaved) ? *i_savedCollectable : SaveCollectableRecord {};
 
 	AzFramework::SpawnAllEntitiesOptionalArgs spawnOptions;
 
-	spawnOptions.m_preInsertionCallback = [this]([[maybe_unused]] AzFramework::EntitySpawnTicket::Id i_spawnTicketId, AzFramework::SpawnableEntityContainerView i_newEntities)
+	spawnOptions.m_preInsertionCallback = [this, isSaved, savedCollectable]([[maybe_unused]] AzFramework::EntitySpawnTicket::Id i_spawnTicketId, AzFramework::SpawnableEntityContainerView i_newEntities)
 	{
+		GAME_PROFILE_SCOPE(COLLECTABLES, "CollectablesPoolComponent::TryCreateCollectable (pre-insertion)");
+
 		if(i_newEntities.empty())
 		{
 			AZ_Error("CollectablesPool", false, "Unable to spawn collectables. Please check if a prefab is assigned");
@@ -185,21 +254,28 @@ void CollectablesPoolComponent::TryCreateCollectable(const AZ::EntityId& i_tileE
 
 		AZ::Entity* newEntity = *(i_newEntities.begin() + 1);
 		auto newCollectable = newEntity->FindComponent<CollectableComponent>();
-		newCollectable->m_timer = GenerateRandomInRange(m_minCollectableExpiration, m_maxCollectableExpiration);
+		newCollectable->m_timer = (isSaved) ? savedCollectable.m_timer : GenerateRandomInRange(m_minCollectableExpiration, m_maxCollectableExpiration);
 	};
 
-	spawnOptions.m_completionCallback = [this, i_tileEntityId]([[maybe_unused]] AzFramework::EntitySpawnTicket::Id i_spawnTicketId, AzFramework::SpawnableConstEntityContainerView i_newEntities)
+	spawnOptions.m_completionCallback = [this, i_tileEntityId, isSaved, savedCollectable](AzFramework::EntitySpawnTicket::Id i_spawnTicketId, AzFramework::SpawnableConstEntityContainerView i_newEntities)
 	{
+		GAME_PROFILE_SCOPE(COLLECTABLES, "CollectablesPoolComponent::TryCreateCollectable (completion)");
+
+		GameMetrics::EndSpawn(i_spawnTicketId, i_newEntities.size());
+
 		if(i_newEntities.empty())
 		{
 			AZ_Error("TilesPool", false, "Unable to spawn tiles. Please check if a prefab is assigned");
 			return;
 		}
 
-		AZ::Vector3 worldTranslation { AZ::Vector3::CreateZero() };
-		EBUS_EVENT_ID_RESULT(worldTranslation, i_tileEntityId, AZ::TransformBus, GetWorldTranslation);
+		AZ::Vector3 worldTranslation { savedCollectable.m_position[0], savedCollectable.m_position[1], savedCollectable.m_position[2] };
+		if(!isSaved)
+		{
+			EBUS_EVENT_ID_RESULT(worldTranslation, i_tileEntityId, AZ::TransformBus, GetWorldTranslation);
 
-		worldTranslation += AZ::Vector3 { 0.f, 0.f, m_collectableHeight };
+			worldTranslation += AZ::Vector3 { 0.f, 0.f, m_collectableHeight };
+		}
 
 		const AZ::Entity* newRootEntity = *(i_newEntities.begin());
 		const AZ::EntityId newRootEntityId = newRootEntity->GetId();
@@ -210,7 +286,8 @@ void CollectablesPoolComponent::TryCreateCollectable(const AZ::EntityId& i_tileE
 	auto spawnableSystem = AzFramework::SpawnableEntitiesInterface::Get();
     AZ_Assert(spawnableSystem, "Unable to retrieve the main spawnable system");
 
-	spawnableSystem->SpawnAllEntities(m_collectableSpawnTickets[collectableType], AZStd::move(spawnOptions));
+	GameMetrics::BeginSpawn(m_collectableSpawnTickets[i_type].GetId());
+	spawnableSystem->SpawnAllEntities(m_collectableSpawnTickets[i_type], AZStd::move(spawnOptions));
 }
 
 void CollectablesPoolComponent::DestroyAllCollectables()
@@ -226,5 +303,5 @@ void CollectablesPoolComponent::DestroyAllCollectables()
 
 float CollectablesPoolComponent::GenerateRandomInRange(float i_min, float i_max)
 {
-	return (i_min + (m_randomGenerator.GetRandomFloat() * (i_max - i_min)));
+	return CollectableRules::GenerateRandomInRange(m_randomStream, i_min, i_max);
 }
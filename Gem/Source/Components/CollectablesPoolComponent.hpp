@@ -18,22 +18,27 @@
 
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Component/Component.h>
-#include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/map.h>
 
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 
+#include "../Core/CollectableRules.hpp"
+#include "../Core/RandomStream.hpp"
 #include "../EBuses/GameBus.hpp"
+#include "../EBuses/SaveGameBus.hpp"
 #include "../EBuses/TileBus.hpp"
 #include "CollectableComponent.hpp"
 
 
 namespace Loherangrin::Games::O3DEJam2305
 {
+	struct SaveCollectableRecord;
+
 	class CollectablesPoolComponent
 		: public AZ::Component
 		, protected GameNotificationBus::Handler
+		, protected SaveGameNotificationBus::Handler
 		, protected TilesNotificationBus::Handler
 	{
 	public:
@@ -56,13 +61,18 @@ namespace Loherangrin::Games::O3DEJam2305
 		void OnGameStarted() override;
 		void OnGameEnded() override;
 
+		// SaveGameNotificationBus
+		void OnGameSaving(SaveFile& io_file) override;
+		void OnGameRestoring(const SaveFile& i_file) override;
+
 		// TilesNotificationBus
 		void OnTileClaimed(const AZ::EntityId& i_tileEntityId) override;
 
 	private:
-		using CollectableType = CollectableComponent::CollectableType;
-
 		void TryCreateCollectable(const AZ::EntityId& i_tileEntityId);
+
+		// a saved collectable is spawned where it was and with its remaining time, otherwise above the given tile
+		void CreateCollectable(CollectableType i_type, const AZ::EntityId& i_tileEntityId, const SaveCollectableRecord* i_savedCollectable);
 		void DestroyAllCollectables();
 
 		float GenerateRandomInRange(float i_min, float i_max);
@@ -87,7 +97,7 @@ namespace Loherangrin::Games::O3DEJam2305
 
     	AZStd::unordered_map<CollectableType, AzFramework::EntitySpawnTicket> m_collectableSpawnTickets {};
 
-		AZ::SimpleLcgRandom m_randomGenerator {};
+		RandomStream m_randomStream { RandomStreamId::DROPS };
 	};
 
 } // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,258 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/EBus/Results.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/time.h>
+
+#include "EventRecorderComponent.hpp"
+
+using Loherangrin::Games::O3DEJam2305::EventRecorderComponent;
+using Loherangrin::Games::O3DEJam2305::SessionEventType;
+
+
+void EventRecorderComponent::Reflect(AZ::ReflectContext* io_context)
+{
+	if(auto serializeContext = azrtti_cast<AZ::SerializeContext*>(io_context))
+	{
+		serializeContext->Class<EventRecorderComponent, AZ::Component>()
+			->Version(0)
+			->Field("Folder", &EventRecorderComponent::m_folder)
+		;
+
+		if(AZ::EditContext* editContext = serializeContext->GetEditContext())
+		{
+			editContext->Class<EventRecorderComponent>("Event Recorder", "Event Recorder")
+				->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+					->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+				->DataElement(AZ::Edit::UIHandlers::Default, &EventRecorderComponent::m_folder, "Folder", "")
+			;
+		}
+	}
+}
+
+void EventRecorderComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided)
+{
+	io_provided.push_back(AZ_CRC_CE("EventRecorderService"));
+}
+
+void EventRecorderComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible)
+{
+	io_incompatible.push_back(AZ_CRC_CE("EventRecorderService"));
+}
+
+void EventRecorderComponent::GetRequiredServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_required)
+{}
+
+void EventRecorderComponent::GetDependentServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_dependent)
+{}
+
+void EventRecorderComponent::Activate()
+{
+	OpenLog();
+
+	GameNotificationBus::Handler::BusConnect();
+	TilesNotificationBus::Handler::BusConnect();
+	CollectablesNotificationBus::Handler::BusConnect();
+	ScoreNotificationBus::Handler::BusConnect();
+	StormsNotificationBus::Handler::BusConnect();
+	SpaceshipsNotificationBus::Handler::BusConnect();
+
+	ConnectAllSpaceships();
+}
+
+void EventRecorderComponent::Deactivate()
+{
+	SpaceshipNotificationBus::MultiHandler::BusDisconnect();
+	SpaceshipsNotificationBus::Handler::BusDisconnect();
+	StormsNotificationBus::Handler::BusDisconnect();
+	ScoreNotificationBus::Handler::BusDisconnect();
+	CollectablesNotificationBus::Handler::BusDisconnect();
+	TilesNotificationBus::Handler::BusDisconnect();
+	GameNotificationBus::Handler::BusDisconnect();
+
+	AZ_Warning("EventRecorder", m_log.GetDroppedRecords() == 0, "%llu session events were dropped because the log could not keep up", m_log.GetDroppedRecords());
+
+	m_log.Close();
+}
+
+void EventRecorderComponent::OnStopDecayCollected(float i_duration)
+{
+	m_log.Record(SessionEventType::STOP_DECAY_COLLECTED, 0, i_duration);
+}
+
+void EventRecorderComponent::OnSpaceshipEnergyCollected(const AZ::EntityId& i_spaceshipEntityId, float i_energy)
+{
+	m_log.Record(SessionEventType::SPACESHIP_ENERGY_COLLECTED, GetSubject(i_spaceshipEntityId), i_energy);
+}
+
+void EventRecorderComponent::OnTileEnergyCollected(float i_energy)
+{
+	m_log.Record(SessionEventType::TILE_ENERGY_COLLECTED, 0, i_energy);
+}
+
+void EventRecorderComponent::OnPointsCollected(Points i_points)
+{
+	m_log.Record(SessionEventType::POINTS_COLLECTED, i_points);
+}
+
+void EventRecorderComponent::OnSpeedCollected(const AZ::EntityId& i_spaceshipEntityId, float i_multiplier, float i_duration)
+{
+	m_log.Record(SessionEventType::SPEED_COLLECTED, GetSubject(i_spaceshipEntityId), i_multiplier, i_duration);
+}
+
+void EventRecorderComponent::OnGameLoading()
+{
+	m_log.Record(SessionEventType::GAME_LOADING, 0);
+}
+
+void EventRecorderComponent::OnGameStarted()
+{
+	m_log.Record(SessionEventType::GAME_STARTED, 0);
+}
+
+void EventRecorderComponent::OnGamePaused()
+{
+	m_log.Record(SessionEventType::GAME_PAUSED, 0);
+}
+
+void EventRecorderComponent::OnGameResumed()
+{
+	m_log.Record(SessionEventType::GAME_RESUMED, 0);
+}
+
+void EventRecorderComponent::OnGameEnded()
+{
+	m_log.Record(SessionEventType::GAME_ENDED, 0);
+}
+
+void EventRecorderComponent::OnScoreChanged(TotalPoints i_newPoints)
+{
+	m_log.Record(SessionEventType::SCORE_CHANGED, i_newPoints);
+}
+
+void EventRecorderComponent::OnClaimedTilesChanged(TileCount i_newClaimedTiles)
+{
+	m_log.Record(SessionEventType::CLAIMED_TILES_CHANGED, i_newClaimedTiles);
+}
+
+void EventRecorderComponent::OnSpaceshipEnergyChanged(float i_normalizedNewEnergy)
+{
+	RecordSpaceshipEvent(SessionEventType::SPACESHIP_ENERGY_CHANGED, i_normalizedNewEnergy);
+}
+
+void EventRecorderComponent::OnEnergySavingModeActivated()
+{
+	RecordSpaceshipEvent(SessionEventType::ENERGY_SAVING_ACTIVATED);
+}
+
+void EventRecorderComponent::OnEnergySavingModeDeactivated()
+{
+	RecordSpaceshipEvent(SessionEventType::ENERGY_SAVING_DEACTIVATED);
+}
+
+void EventRecorderComponent::OnLandingStarted()
+{
+	RecordSpaceshipEvent(SessionEventType::LANDING_STARTED);
+}
+
+void EventRecorderComponent::OnLandingEnded()
+{
+	RecordSpaceshipEvent(SessionEventType::LANDING_ENDED);
+}
+
+void EventRecorderComponent::OnTakeOffStarted()
+{
+	RecordSpaceshipEvent(SessionEventType::TAKE_OFF_STARTED);
+}
+
+void EventRecorderComponent::OnTakeOffEnded()
+{
+	RecordSpaceshipEvent(SessionEventType::TAKE_OFF_ENDED);
+}
+
+void EventRecorderComponent::OnSpaceshipRegistered(const AZ::EntityId& i_spaceshipEntityId)
+{
+	SpaceshipNotificationBus::MultiHandler::BusConnect(i_spaceshipEntityId);
+}
+
+void EventRecorderComponent::OnSpaceshipUnregistered(const AZ::EntityId& i_spaceshipEntityId)
+{
+	SpaceshipNotificationBus::MultiHandler::BusDisconnect(i_spaceshipEntityId);
+}
+
+void EventRecorderComponent::OnStormSpawned(const AZ::EntityId& i_stormEntityId, const AZ::Vector3& i_position)
+{
+	m_log.Record(SessionEventType::STORM_SPAWNED, GetSubject(i_stormEntityId), i_position.GetX(), i_position.GetY());
+}
+
+void EventRecorderComponent::OnTileClaimed(const AZ::EntityId& i_tileEntityId)
+{
+	m_log.Record(SessionEventType::TILE_CLAIMED, GetSubject(i_tileEntityId));
+}
+
+void EventRecorderComponent::OnTileLost(const AZ::EntityId& i_tileEntityId)
+{
+	m_log.Record(SessionEventType::TILE_LOST, GetSubject(i_tileEntityId));
+}
+
+void EventRecorderComponent::OpenLog()
+{
+	auto fileIO = AZ::IO::FileIOBase::GetInstance();
+	AZ_Assert(fileIO, "Unable to retrieve the file system");
+
+	const auto startTime = static_cast<AZ::u64>(AZStd::GetTimeUTCMilliSecond());
+
+	const AZStd::string fileName = AZStd::string::format("session_%llu.bin", startTime);
+	const AZ::IO::Path filePath = AZ::IO::Path { m_folder } / fileName;
+
+	AZ::IO::FixedMaxPath resolvedFilePath;
+	if(!fileIO->ResolvePath(resolvedFilePath, filePath))
+	{
+		AZ_Error("EventRecorder", false, "Unable to resolve the session log path %s", filePath.c_str());
+		return;
+	}
+
+	m_log.Open(AZ::IO::Path { resolvedFilePath }, startTime);
+}
+
+void EventRecorderComponent::ConnectAllSpaceships()
+{
+	AZ::EBusAggregateResults<AZ::EntityId> spaceshipEntityIds;
+	EBUS_EVENT_RESULT(spaceshipEntityIds, SpaceshipRequestBus, GetSpaceshipId);
+
+	for(const AZ::EntityId& spaceshipEntityId : spaceshipEntityIds.values)
+	{
+		SpaceshipNotificationBus::MultiHandler::BusConnect(spaceshipEntityId);
+	}
+}
+
+void EventRecorderComponent::RecordSpaceshipEvent(SessionEventType i_type, float i_value)
+{
+	const AZ::EntityId* spaceshipEntityId = SpaceshipNotificationBus::GetCurrentBusId();
+
+	m_log.Record(i_type, (spaceshipEntityId) ? GetSubject(*spaceshipEntityId) : 0, i_value);
+}
+
+AZ::u64 EventRecorderComponent::GetSubject(const AZ::EntityId& i_entityId)
+{
+	return static_cast<AZ::u64>(i_entityId);
+}
@@ -0,0 +1,107 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/std/string/string.h>
+
+#include "../EBuses/CollectableBus.hpp"
+#include "../EBuses/GameBus.hpp"
+#include "../EBuses/ScoreBus.hpp"
+#include "../EBuses/SpaceshipBus.hpp"
+#include "../EBuses/StormBus.hpp"
+#include "../EBuses/TileBus.hpp"
+#include "../Utils/SessionEventLog.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class EventRecorderComponent
+		: public AZ::Component
+		, protected CollectablesNotificationBus::Handler
+		, protected GameNotificationBus::Handler
+		, protected ScoreNotificationBus::Handler
+		, protected SpaceshipNotificationBus::MultiHandler
+		, protected SpaceshipsNotificationBus::Handler
+		, protected StormsNotificationBus::Handler
+		, protected TilesNotificationBus::Handler
+	{
+	public:
+		AZ_COMPONENT(EventRecorderComponent, "{9E3A41C6-7B5D-4F28-A0D3-6C1E8B247F95}");
+		static void Reflect(AZ::ReflectContext* io_context);
+
+		static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided);
+		static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible);
+		static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& io_required);
+		static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& io_dependent);
+
+	protected:
+		// AZ::Component
+		void Activate() override;
+		void Deactivate() override;
+
+		// CollectablesNotificationBus
+		void OnStopDecayCollected(float i_duration) override;
+		void OnSpaceshipEnergyCollected(const AZ::EntityId& i_spaceshipEntityId, float i_energy) override;
+		void OnTileEnergyCollected(float i_energy) override;
+		void OnPointsCollected(Points i_points) override;
+		void OnSpeedCollected(const AZ::EntityId& i_spaceshipEntityId, float i_multiplier, float i_duration) override;
+
+		// GameNotificationBus
+		void OnGameLoading() override;
+		void OnGameStarted() override;
+		void OnGamePaused() override;
+		void OnGameResumed() override;
+		void OnGameEnded() override;
+
+		// ScoreNotificationBus
+		void OnScoreChanged(TotalPoints i_newPoints) override;
+		void OnClaimedTilesChanged(TileCount i_newClaimedTiles) override;
+
+		// SpaceshipNotificationBus
+		void OnSpaceshipEnergyChanged(float i_normalizedNewEnergy) override;
+		void OnEnergySavingModeActivated() override;
+		void OnEnergySavingModeDeactivated() override;
+		void OnLandingStarted() override;
+		void OnLandingEnded() override;
+		void OnTakeOffStarted() override;
+		void OnTakeOffEnded() override;
+
+		// SpaceshipsNotificationBus
+		void OnSpaceshipRegistered(const AZ::EntityId& i_spaceshipEntityId) override;
+		void OnSpaceshipUnregistered(const AZ::EntityId& i_spaceshipEntityId) override;
+
+		// StormsNotificationBus
+		void OnStormSpawned(const AZ::EntityId& i_stormEntityId, const AZ::Vector3& i_position) override;
+
+		// TilesNotificationBus
+		void OnTileClaimed(const AZ::EntityId& i_tileEntityId) override;
+		void OnTileLost(const AZ::EntityId& i_tileEntityId) override;
+
+	private:
+		void OpenLog();
+		void ConnectAllSpaceships();
+
+		void RecordSpaceshipEvent(SessionEventType i_type, float i_value = 0.f);
+		static AZ::u64 GetSubject(const AZ::EntityId& i_entityId);
+
+		AZStd::string m_folder { "@user@/SessionLogs" };
+
+		SessionEventLog m_log {};
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,313 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/SerializeContext.h>
+
+#include "../Utils/EnergyNotifier.hpp"
+#include "../Utils/GameAllocators.hpp"
+#include "../Utils/GameMetrics.hpp"
+#include "GameplaySchedulerSystemComponent.hpp"
+
+using Loherangrin::Games::O3DEJam2305::EnergyNotifier;
+using Loherangrin::Games::O3DEJam2305::GameArena;
+using Loherangrin::Games::O3DEJam2305::GameArenas;
+using Loherangrin::Games::O3DEJam2305::GameMetrics;
+using Loherangrin::Games::O3DEJam2305::GameplaySchedulerSystemComponent;
+using Loherangrin::Games::O3DEJam2305::GameplayStage;
+using Loherangrin::Games::O3DEJam2305::GameplayStageStats;
+using Loherangrin::Games::O3DEJam2305::GameSubsystem;
+using Loherangrin::Games::O3DEJam2305::ScopedSubsystemTimer;
+using Loherangrin::Games::O3DEJam2305::ScopedTraceEvent;
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// subsystem of the handlers that are not marked on their own, such as the tiles
+	static GameSubsystem GetStageSubsystem(GameplayStage i_stage)
+	{
+		switch(i_stage)
+		{
+			case GameplayStage::TRANSFERS:
+				return GameSubsystem::BEAM;
+
+			case GameplayStage::TILES:
+				return GameSubsystem::TILES;
+
+			case GameplayStage::COLLECTABLES:
+				return GameSubsystem::COLLECTABLES;
+
+			case GameplayStage::SCORE:
+				return GameSubsystem::SCORE;
+
+			case GameplayStage::UI:
+				return GameSubsystem::UI;
+
+			default:
+				return GameSubsystem::SPACESHIPS;
+		}
+	}
+
+	static void DumpStages([[maybe_unused]] const AZ::ConsoleCommandContainer& i_arguments)
+	{
+		AZStd::string text = AZStd::string::format("%-14s %8s %8s %8s\n", "Stage", "Avg ms", "Max ms", "Handlers");
+
+		for(AZ::u8 i = 0; i < static_cast<AZ::u8>(GameplayStage::COUNT); ++i)
+		{
+			const auto stage = static_cast<GameplayStage>(i);
+
+			GameplayStageStats stats {};
+			EBUS_EVENT_RESULT(stats, GameplaySchedulerRequestBus, GetStageStats, stage);
+
+			text += AZStd::string::format("%-14s %8.3f %8.3f %8.1f\n", GameplaySchedulerSystemComponent::GetStageName(stage), stats.m_averageMs, stats.m_maxMs, stats.m_handlersPerFrame);
+		}
+
+		AZ_Printf("Performance", "%s", text.c_str());
+	}
+
+	AZ_CONSOLEFREEFUNC("game_dumpStages", DumpStages, AZ::ConsoleFunctorFlags::Null, "Print the average cost per frame of each gameplay stage");
+
+} // Loherangrin::Games::O3DEJam2305
+
+
+void GameplaySchedulerSystemComponent::Reflect(AZ::ReflectContext* io_context)
+{
+	if(auto serializeContext = azrtti_cast<AZ::SerializeContext*>(io_context))
+	{
+		serializeContext->Class<GameplaySchedulerSystemComponent, AZ::Component>()
+			->Version(0)
+		;
+
+		if(AZ::EditContext* editContext = serializeContext->GetEditContext())
+		{
+			editContext->Class<GameplaySchedulerSystemComponent>("Gameplay Scheduler", "Gameplay Scheduler")
+				->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+					->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("System"))
+					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+			;
+		}
+	}
+}
+
+void GameplaySchedulerSystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided)
+{
+	io_provided.push_back(AZ_CRC_CE("GameplaySchedulerService"));
+}
+
+void GameplaySchedulerSystemComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible)
+{
+	io_incompatible.push_back(AZ_CRC_CE("GameplaySchedulerService"));
+}
+
+void GameplaySchedulerSystemComponent::GetRequiredServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_required)
+{}
+
+void GameplaySchedulerSystemComponent::GetDependentServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_dependent)
+{}
+
+void GameplaySchedulerSystemComponent::Activate()
+{
+	GameplaySchedulerRequestBus::Handler::BusConnect();
+	GameNotificationBus::Handler::BusConnect();
+	AZ::TickBus::Handler::BusConnect();
+}
+
+void GameplaySchedulerSystemComponent::Deactivate()
+{
+	AZ::TickBus::Handler::BusDisconnect();
+	GameNotificationBus::Handler::BusDisconnect();
+	GameplaySchedulerRequestBus::Handler::BusDisconnect();
+
+	GameArenas::ReleaseAll();
+}
+
+void GameplaySchedulerSystemComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint i_time)
+{
+	// the metrics of the previous frame are closed here, so that they include the handlers ticking after the stages,
+	// and so that headless runs without the overlay sample them as well
+	GameMetrics::EndFrame();
+
+	// scratch memory never survives the frame that asked for it
+	GameArenas::Reset(GameArena::FRAME);
+
+	if(m_fixedTimeStep > 0.f)
+	{
+		m_pendingTime += i_deltaTime;
+
+		AZ::u32 nTicks = 0;
+
+		// a stage can turn the fixed time step off, as a playback does when its game ends
+		while(m_fixedTimeStep > 0.f && m_pendingTime >= m_fixedTimeStep && nTicks < MAX_TICKS_PER_FRAME)
+		{
+			RunAllStages(m_fixedTimeStep);
+
+			m_pendingTime -= m_fixedTimeStep;
+			++nTicks;
+		}
+
+		if(nTicks == MAX_TICKS_PER_FRAME)
+		{
+			m_pendingTime = 0.f;
+		}
+	}
+	else
+	{
+		RunAllStages(i_deltaTime);
+	}
+
+	if(++m_nSampleFrames < FRAMES_PER_SAMPLE)
+	{
+		return;
+	}
+
+	PublishStageStats();
+}
+
+int GameplaySchedulerSystemComponent::GetTickOrder()
+{
+	// gameplay used to tick at the default order, after the physics simulation
+	return AZ::ComponentTickBus::TICK_DEFAULT;
+}
+
+void GameplaySchedulerSystemComponent::RunAllStages(float i_deltaTime)
+{
+	for(AZ::u8 i = 0; i < static_cast<AZ::u8>(GameplayStage::COUNT); ++i)
+	{
+		RunStage(static_cast<GameplayStage>(i), i_deltaTime);
+	}
+
+	// energy changes are notified per tick rather than per frame, so that a playback sees them at the same ticks
+	{
+		AZ_PROFILE_SCOPE(O3DEJam2305, "EnergyNotifier::FlushAll");
+		EnergyNotifier::FlushAll();
+	}
+
+	++m_tick;
+	m_gameTime += i_deltaTime;
+}
+
+void GameplaySchedulerSystemComponent::RunStage(GameplayStage i_stage, float i_deltaTime)
+{
+	StageAccumulator& accumulator = m_stageAccumulators[static_cast<AZStd::size_t>(i_stage)];
+
+	const AZStd::size_t nHandlers = GameplayStageNotificationBus::GetNumOfEventHandlers(i_stage);
+	if(nHandlers == 0)
+	{
+		return;
+	}
+
+	// the handlers with scopes of their own take their time out of the one of the stage, which only keeps the rest
+	AZ_PROFILE_SCOPE(O3DEJam2305, "GameplayStage %s", GetStageName(i_stage));
+	const ScopedTraceEvent traceEvent { GameMetrics::GetTraceRecorder(), "Gameplay", GetStageName(i_stage) };
+	const ScopedSubsystemTimer subsystemTimer { GetStageSubsystem(i_stage), GetStageName(i_stage) };
+
+	const AZStd::chrono::steady_clock::time_point start = AZStd::chrono::steady_clock::now();
+
+	EBUS_EVENT_ID(i_stage, GameplayStageNotificationBus, OnStageTick, i_deltaTime);
+
+	const AZStd::chrono::steady_clock::duration frameTime = AZStd::chrono::steady_clock::now() - start;
+
+	accumulator.m_sampleTime += frameTime;
+	accumulator.m_maxFrameTime = AZStd::max(accumulator.m_maxFrameTime, frameTime);
+	accumulator.m_nSampleHandlers += nHandlers;
+}
+
+void GameplaySchedulerSystemComponent::PublishStageStats()
+{
+	using Milliseconds = AZStd::chrono::duration<float, AZStd::milli>;
+	const float nFrames = static_cast<float>(m_nSampleFrames);
+
+	for(AZStd::size_t i = 0; i < N_STAGES; ++i)
+	{
+		StageAccumulator& accumulator = m_stageAccumulators[i];
+		GameplayStageStats& stats = m_stageStats[i];
+
+		stats.m_averageMs = AZStd::chrono::duration_cast<Milliseconds>(accumulator.m_sampleTime).count() / nFrames;
+		stats.m_maxMs = AZStd::chrono::duration_cast<Milliseconds>(accumulator.m_maxFrameTime).count();
+		stats.m_handlersPerFrame = accumulator.m_nSampleHandlers / nFrames;
+
+		accumulator = {};
+	}
+
+	m_nSampleFrames = 0;
+}
+
+void GameplaySchedulerSystemComponent::OnGameLoading()
+{
+	// the other handlers only drop their session containers here, so the arena can be rewound before or after them
+	GameArenas::Reset(GameArena::SESSION);
+
+	m_tick = 0;
+	m_gameTime = 0.0;
+}
+
+GameplayStageStats GameplaySchedulerSystemComponent::GetStageStats(GameplayStage i_stage) const
+{
+	if(i_stage >= GameplayStage::COUNT)
+	{
+		return {};
+	}
+
+	return m_stageStats[static_cast<AZStd::size_t>(i_stage)];
+}
+
+void GameplaySchedulerSystemComponent::SetFixedTimeStep(float i_timeStep)
+{
+	m_fixedTimeStep = AZStd::max(i_timeStep, 0.f);
+	m_pendingTime = 0.f;
+}
+
+AZ::u32 GameplaySchedulerSystemComponent::GetTick() const
+{
+	return m_tick;
+}
+
+double GameplaySchedulerSystemComponent::GetGameTime() const
+{
+	return m_gameTime;
+}
+
+const char* GameplaySchedulerSystemComponent::GetStageName(GameplayStage i_stage)
+{
+	switch(i_stage)
+	{
+		case GameplayStage::INPUT:
+			return "Input";
+
+		case GameplayStage::SPACESHIPS:
+			return "Spaceships";
+
+		case GameplayStage::TRANSFERS:
+			return "Transfers";
+
+		case GameplayStage::TILES:
+			return "Tiles";
+
+		case GameplayStage::COLLECTABLES:
+			return "Collectables";
+
+		case GameplayStage::SCORE:
+			return "Score";
+
+		case GameplayStage::UI:
+			return "UI";
+
+		default:
+			return "Unknown";
+	}
+}
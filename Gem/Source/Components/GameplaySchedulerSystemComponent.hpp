@@ -0,0 +1,97 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/string/string.h>
+
+#include "../EBuses/GameBus.hpp"
+#include "../EBuses/GameplayBus.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Runs the gameplay stages once per frame in a fixed order, so that the result of a frame
+	// doesn't depend on the order in which the handlers happened to connect to the tick bus.
+	// It also owns the lifetime of the game arenas, which follow the frames and the games it runs.
+	class GameplaySchedulerSystemComponent
+		: public AZ::Component
+		, protected AZ::TickBus::Handler
+		, protected GameNotificationBus::Handler
+		, protected GameplaySchedulerRequestBus::Handler
+	{
+	public:
+		AZ_COMPONENT(GameplaySchedulerSystemComponent, "{6A4F1C83-2E9D-4B57-8D06-F3C72A1B5E94}");
+		static void Reflect(AZ::ReflectContext* io_context);
+
+		static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided);
+		static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible);
+		static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& io_required);
+		static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& io_dependent);
+
+		static const char* GetStageName(GameplayStage i_stage);
+
+	protected:
+		// AZ::Component
+		void Activate() override;
+		void Deactivate() override;
+
+		// AZ::TickBus
+		void OnTick(float i_deltaTime, AZ::ScriptTimePoint i_time) override;
+		int GetTickOrder() override;
+
+		// GameNotificationBus
+		void OnGameLoading() override;
+
+		// GameplaySchedulerRequestBus
+		GameplayStageStats GetStageStats(GameplayStage i_stage) const override;
+		void SetFixedTimeStep(float i_timeStep) override;
+		AZ::u32 GetTick() const override;
+		double GetGameTime() const override;
+
+	private:
+		static constexpr AZStd::size_t N_STAGES = static_cast<AZStd::size_t>(GameplayStage::COUNT);
+		static constexpr AZ::u32 FRAMES_PER_SAMPLE = 60;
+
+		// past this, a slow frame drops the remaining time rather than falling further behind
+		static constexpr AZ::u32 MAX_TICKS_PER_FRAME = 4;
+
+		struct StageAccumulator
+		{
+			AZStd::chrono::steady_clock::duration m_sampleTime {};
+			AZStd::chrono::steady_clock::duration m_maxFrameTime {};
+			AZStd::size_t m_nSampleHandlers { 0 };
+		};
+
+		void RunAllStages(float i_deltaTime);
+		void RunStage(GameplayStage i_stage, float i_deltaTime);
+		void PublishStageStats();
+
+		AZStd::array<StageAccumulator, N_STAGES> m_stageAccumulators {};
+		AZStd::array<GameplayStageStats, N_STAGES> m_stageStats {};
+		AZ::u32 m_nSampleFrames { 0 };
+
+		float m_fixedTimeStep { 0.f };
+		float m_pendingTime { 0.f };
+		AZ::u32 m_tick { 0 };
+		double m_gameTime { 0.0 };
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,411 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/SerializeContext.h>
+
+#include "GridReplicationComponent.hpp"
+
+using Loherangrin::Games::O3DEJam2305::BandwidthCounter;
+using Loherangrin::Games::O3DEJam2305::GridAckPacket;
+using Loherangrin::Games::O3DEJam2305::GridPacketType;
+using Loherangrin::Games::O3DEJam2305::GridReplicationComponent;
+using Loherangrin::Games::O3DEJam2305::PackedGrid;
+using Loherangrin::Games::O3DEJam2305::PackedTile;
+using Loherangrin::Games::O3DEJam2305::ReplicationStats;
+using Loherangrin::Games::O3DEJam2305::TileId;
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	static void StartReplicationServer([[maybe_unused]] const AZ::ConsoleCommandContainer& i_arguments)
+	{
+		bool isStarted { false };
+		EBUS_EVENT_RESULT(isStarted, ReplicationRequestBus, StartServer);
+
+		AZ_Warning("Replication", isStarted, "Unable to start replicating the tiles");
+	}
+
+	static void StartReplicationClient([[maybe_unused]] const AZ::ConsoleCommandContainer& i_arguments)
+	{
+		bool isStarted { false };
+		EBUS_EVENT_RESULT(isStarted, ReplicationRequestBus, StartClient);
+
+		AZ_Warning("Replication", isStarted, "Unable to start receiving the replicated tiles");
+	}
+
+	static void StopReplication([[maybe_unused]] const AZ::ConsoleCommandContainer& i_arguments)
+	{
+		EBUS_EVENT(ReplicationRequestBus, Stop);
+	}
+
+	static void DumpReplicationStats([[maybe_unused]] const AZ::ConsoleCommandContainer& i_arguments)
+	{
+		ReplicationStats stats;
+		EBUS_EVENT_RESULT(stats, ReplicationRequestBus, GetStats);
+
+		AZ_Printf("Replication", "Sent %.2f KB/s in %.1f packets/s, received %.2f KB/s, %llu bytes sent and %llu received in total, snapshot %u\n",
+			stats.m_sentBytesPerSecond / 1024.f, stats.m_sentPacketsPerSecond, stats.m_receivedBytesPerSecond / 1024.f,
+			static_cast<unsigned long long>(stats.m_totalSentBytes), static_cast<unsigned long long>(stats.m_totalReceivedBytes), stats.m_sequence);
+	}
+
+	AZ_CONSOLEFREEFUNC("game_replicationServer", StartReplicationServer, AZ::ConsoleFunctorFlags::Null, "Replicate the tiles of the next layout to a client on this machine");
+	AZ_CONSOLEFREEFUNC("game_replicationClient", StartReplicationClient, AZ::ConsoleFunctorFlags::Null, "Receive the tiles replicated by a server on this machine, in place of simulating them");
+	AZ_CONSOLEFREEFUNC("game_replicationStop", StopReplication, AZ::ConsoleFunctorFlags::Null, "Stop replicating the tiles");
+	AZ_CONSOLEFREEFUNC("game_dumpReplication", DumpReplicationStats, AZ::ConsoleFunctorFlags::Null, "Print the bandwidth used by the replication of the tiles over the last second");
+
+} // Loherangrin::Games::O3DEJam2305
+
+
+void GridReplicationComponent::Reflect(AZ::ReflectContext* io_context)
+{
+	if(auto serializeContext = azrtti_cast<AZ::SerializeContext*>(io_context))
+	{
+		serializeContext->Class<GridReplicationComponent, AZ::Component>()
+			->Version(0)
+			->Field("ServerPort", &GridReplicationComponent::m_serverPort)
+			->Field("ClientPort", &GridReplicationComponent::m_clientPort)
+			->Field("SendRate", &GridReplicationComponent::m_sendRate)
+		;
+
+		if(AZ::EditContext* editContext = serializeContext->GetEditContext())
+		{
+			editContext->Class<GridReplicationComponent>("Grid Replication", "Grid Replication")
+				->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+					->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+				->DataElement(AZ::Edit::UIHandlers::Default, &GridReplicationComponent::m_serverPort, "Server Port", "")
+				->DataElement(AZ::Edit::UIHandlers::Default, &GridReplicationComponent::m_clientPort, "Client Port", "")
+				->DataElement(AZ::Edit::UIHandlers::Default, &GridReplicationComponent::m_sendRate, "Send Rate", "Packets sent by the server per second, each one being at most 1200 bytes long")
+			;
+		}
+	}
+}
+
+void GridReplicationComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided)
+{
+	io_provided.push_back(AZ_CRC_CE("GridReplicationService"));
+}
+
+void GridReplicationComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible)
+{
+	io_incompatible.push_back(AZ_CRC_CE("GridReplicationService"));
+}
+
+void GridReplicationComponent::GetRequiredServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_required)
+{}
+
+void GridReplicationComponent::GetDependentServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_dependent)
+{}
+
+void GridReplicationComponent::Activate()
+{
+	m_packet.resize(MAX_REPLICATION_PACKET_SIZE);
+
+	ReplicationRequestBus::Handler::BusConnect();
+}
+
+void GridReplicationComponent::Deactivate()
+{
+	Stop();
+
+	ReplicationRequestBus::Handler::BusDisconnect();
+}
+
+bool GridReplicationComponent::StartServer()
+{
+	return Start(Role::SERVER, m_serverPort, m_clientPort);
+}
+
+bool GridReplicationComponent::StartClient()
+{
+	return Start(Role::CLIENT, m_clientPort, m_serverPort);
+}
+
+bool GridReplicationComponent::Start(Role i_role, AZ::u16 i_localPort, AZ::u16 i_remotePort)
+{
+	Stop();
+
+	if(!m_socket.Open(i_localPort, i_remotePort))
+	{
+		return false;
+	}
+
+	m_role = i_role;
+
+	m_encoder.Reset(0, 0);
+	m_decoder.Reset();
+	m_sendTimer = 0.f;
+	m_requestedLayoutSeed = 0;
+	m_hasPendingSnapshot = false;
+
+	TilesNotificationBus::Handler::BusConnect();
+	AZ::TickBus::Handler::BusConnect();
+
+	AZ_Printf("Replication", "Started the %s from port %u to port %u\n", (i_role == Role::SERVER) ? "server" : "client", i_localPort, i_remotePort);
+	return true;
+}
+
+void GridReplicationComponent::Stop()
+{
+	if(m_role == Role::NONE)
+	{
+		return;
+	}
+
+	AZ::TickBus::Handler::BusDisconnect();
+	TilesNotificationBus::Handler::BusDisconnect();
+
+	// the tiles of a client are simulated locally again, instead of freezing at their last replicated state
+	if(m_role == Role::CLIENT)
+	{
+		for(const AZ::EntityId& tileEntityId : m_tileEntityIds)
+		{
+			if(tileEntityId.IsValid())
+			{
+				EBUS_EVENT_ID(tileEntityId, TileRequestBus, StopReplication);
+			}
+		}
+	}
+
+	m_socket.Close();
+	m_role = Role::NONE;
+
+	m_gridLength = 0;
+	m_grid.clear();
+	m_replica.Reset(0);
+	m_tileIds.clear();
+	m_tileEntityIds.clear();
+}
+
+ReplicationStats GridReplicationComponent::GetStats() const
+{
+	const BandwidthCounter& sentBandwidth = m_socket.GetSentBandwidth();
+	const BandwidthCounter& receivedBandwidth = m_socket.GetReceivedBandwidth();
+
+	ReplicationStats stats;
+	stats.m_sentBytesPerSecond = sentBandwidth.GetBytesPerSecond();
+	stats.m_receivedBytesPerSecond = receivedBandwidth.GetBytesPerSecond();
+	stats.m_sentPacketsPerSecond = sentBandwidth.GetPacketsPerSecond();
+	stats.m_totalSentBytes = sentBandwidth.GetTotalBytes();
+	stats.m_totalReceivedBytes = receivedBandwidth.GetTotalBytes();
+	stats.m_sequence = (m_role == Role::SERVER) ? m_encoder.GetAcknowledgedSequence() : m_decoder.GetSequence();
+
+	return stats;
+}
+
+void GridReplicationComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint i_time)
+{
+	if(m_role == Role::SERVER)
+	{
+		UpdateServer(i_deltaTime);
+	}
+	else
+	{
+		UpdateClient();
+	}
+
+	m_socket.Update(i_deltaTime);
+}
+
+void GridReplicationComponent::UpdateServer(float i_deltaTime)
+{
+	for(AZStd::size_t packetSize = m_socket.Receive(m_packet.data(), m_packet.size()); packetSize > 0; packetSize = m_socket.Receive(m_packet.data(), m_packet.size()))
+	{
+		if(packetSize != sizeof(GridAckPacket))
+		{
+			continue;
+		}
+
+		GridAckPacket ack;
+		memcpy(&ack, m_packet.data(), sizeof(GridAckPacket));
+
+		if(ack.m_type == GridPacketType::ACK)
+		{
+			m_encoder.Acknowledge(ack.m_sequence);
+		}
+	}
+
+	m_sendTimer += i_deltaTime;
+	if(m_sendTimer < 1.f / m_sendRate || m_grid.empty())
+	{
+		return;
+	}
+
+	m_sendTimer = 0.f;
+
+	const AZStd::size_t packetSize = m_encoder.Encode(m_grid, m_packet.data(), m_packet.size());
+	if(packetSize > 0)
+	{
+		m_socket.Send(m_packet.data(), packetSize);
+	}
+}
+
+void GridReplicationComponent::UpdateClient()
+{
+	for(AZStd::size_t packetSize = m_socket.Receive(m_packet.data(), m_packet.size()); packetSize > 0; packetSize = m_socket.Receive(m_packet.data(), m_packet.size()))
+	{
+		GridAckPacket ack;
+		ack.m_sequence = m_decoder.Decode(m_packet.data(), packetSize);
+
+		if(ack.m_sequence == 0)
+		{
+			continue;
+		}
+
+		m_socket.Send(reinterpret_cast<const AZ::u8*>(&ack), sizeof(GridAckPacket));
+		m_hasPendingSnapshot = true;
+	}
+
+	if(m_hasPendingSnapshot)
+	{
+		ApplyReplicatedGrid();
+	}
+}
+
+void GridReplicationComponent::ApplyReplicatedGrid()
+{
+	if(m_decoder.GetSequence() == 0)
+	{
+		return;
+	}
+
+	// the server is playing another layout, which this client will load in the next game
+	if(m_decoder.GetLayoutSeed() != m_layoutSeed || m_decoder.GetGridLength() != m_gridLength)
+	{
+		if(m_decoder.GetLayoutSeed() != m_requestedLayoutSeed)
+		{
+			m_requestedLayoutSeed = m_decoder.GetLayoutSeed();
+
+			EBUS_EVENT(TilesRequestBus, SetNextLayoutSeed, m_requestedLayoutSeed);
+		}
+
+		return;
+	}
+
+	m_replica.Apply(m_decoder.GetGrid(), [this](TileId i_tileId, const PackedTile& i_replicatedTile)
+	{
+		if(!m_tileEntityIds[i_tileId].IsValid())
+		{
+			return false;
+		}
+
+		EBUS_EVENT_ID(m_tileEntityIds[i_tileId], TileRequestBus, ApplyReplicatedState, i_replicatedTile.GetNormalizedEnergy(), i_replicatedTile.IsClaimed(), i_replicatedTile.IsLocked());
+		return true;
+	});
+
+	m_hasPendingSnapshot = false;
+}
+
+void GridReplicationComponent::OnAllTilesCreated()
+{
+	EBUS_EVENT_RESULT(m_gridLength, TilesRequestBus, GetGridLength);
+	EBUS_EVENT_RESULT(m_layoutSeed, TilesRequestBus, GetLayoutSeed);
+
+	const TileId nTiles = static_cast<TileId>(m_gridLength) * m_gridLength;
+
+	m_tileIds.clear();
+	m_tileEntityIds.assign(nTiles, AZ::EntityId {});
+
+	if(m_role == Role::SERVER)
+	{
+		m_grid.assign(nTiles, PackedTile {});
+
+		m_encoder.Reset(m_gridLength, m_layoutSeed);
+		m_sendTimer = 0.f;
+	}
+	else
+	{
+		m_replica.Reset(nTiles);
+	}
+}
+
+void GridReplicationComponent::OnTileCreated(const AZ::EntityId& i_tileEntityId)
+{
+	TileId tileId { INVALID_TILE_ID };
+	EBUS_EVENT_ID_RESULT(tileId, i_tileEntityId, TileRequestBus, GetTileId);
+
+	if(tileId >= m_tileEntityIds.size())
+	{
+		return;
+	}
+
+	m_tileIds[i_tileEntityId] = tileId;
+	m_tileEntityIds[tileId] = i_tileEntityId;
+
+	if(m_role == Role::SERVER)
+	{
+		bool isClaimed { false };
+		EBUS_EVENT_ID_RESULT(isClaimed, i_tileEntityId, TileRequestBus, IsClaimed);
+
+		bool isLocked { false };
+		EBUS_EVENT_ID_RESULT(isLocked, i_tileEntityId, TileRequestBus, IsLocked);
+
+		m_grid[tileId] = PackedTile::Pack(0.f, isClaimed, isLocked);
+	}
+	else
+	{
+		// a new tile has its default state, whatever was applied to the one it replaces
+		m_replica.InvalidateTile(tileId);
+
+		// tiles are created over several frames, and the snapshot may not change anymore meanwhile
+		m_hasPendingSnapshot = true;
+	}
+}
+
+void GridReplicationComponent::OnTileEnergyChanged(const AZ::EntityId& i_tileEntityId, float i_normalizedNewEnergy)
+{
+	if(PackedTile* tile = FindPackedTile(i_tileEntityId))
+	{
+		tile->m_energy = PackedTile::Pack(i_normalizedNewEnergy, false, false).m_energy;
+	}
+}
+
+void GridReplicationComponent::OnTileClaimed(const AZ::EntityId& i_tileEntityId)
+{
+	if(PackedTile* tile = FindPackedTile(i_tileEntityId))
+	{
+		tile->m_flags |= PackedTile::FLAG_CLAIMED;
+	}
+}
+
+void GridReplicationComponent::OnTileLost(const AZ::EntityId& i_tileEntityId)
+{
+	if(PackedTile* tile = FindPackedTile(i_tileEntityId))
+	{
+		tile->m_flags &= ~PackedTile::FLAG_CLAIMED;
+	}
+}
+
+PackedTile* GridReplicationComponent::FindPackedTile(const AZ::EntityId& i_tileEntityId)
+{
+	// clients only change their tiles from the replicated snapshots
+	if(m_role != Role::SERVER)
+	{
+		return nullptr;
+	}
+
+	auto tileIt = m_tileIds.find(i_tileEntityId);
+	if(tileIt == m_tileIds.end())
+	{
+		return nullptr;
+	}
+
+	return &m_grid[tileIt->second];
+}
@@ -0,0 +1,115 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+#include "../Core/GridReplication.hpp"
+#include "../Core/ReplicationSocket.hpp"
+#include "../EBuses/ReplicationBus.hpp"
+#include "../EBuses/TileBus.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Replicates the energy and the claimed state of all tiles from a server to a client on the same machine.
+	// The server sends at a fixed rate the tiles changed since the last snapshot acknowledged by the client,
+	// in packets of bounded size, while the client applies them to its own tiles instead of simulating them.
+	class GridReplicationComponent
+		: public AZ::Component
+		, protected AZ::TickBus::Handler
+		, protected ReplicationRequestBus::Handler
+		, protected TilesNotificationBus::Handler
+	{
+	public:
+		AZ_COMPONENT(GridReplicationComponent, "{2B7C94E0-5D13-4A8F-9E62-C1F0A83D7B45}");
+		static void Reflect(AZ::ReflectContext* io_context);
+
+		static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided);
+		static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible);
+		static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& io_required);
+		static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& io_dependent);
+
+	protected:
+		// AZ::Component
+		void Activate() override;
+		void Deactivate() override;
+
+		// AZ::TickBus
+		void OnTick(float i_deltaTime, AZ::ScriptTimePoint i_time) override;
+
+		// ReplicationRequestBus
+		bool StartServer() override;
+		bool StartClient() override;
+		void Stop() override;
+
+		ReplicationStats GetStats() const override;
+
+		// TilesNotificationBus
+		void OnAllTilesCreated() override;
+		void OnTileCreated(const AZ::EntityId& i_tileEntityId) override;
+
+		void OnTileEnergyChanged(const AZ::EntityId& i_tileEntityId, float i_normalizedNewEnergy) override;
+		void OnTileClaimed(const AZ::EntityId& i_tileEntityId) override;
+		void OnTileLost(const AZ::EntityId& i_tileEntityId) override;
+
+	private:
+		enum class Role : AZ::u8
+		{
+			NONE = 0,
+			SERVER,
+			CLIENT
+		};
+
+		bool Start(Role i_role, AZ::u16 i_localPort, AZ::u16 i_remotePort);
+
+		void UpdateServer(float i_deltaTime);
+		void UpdateClient();
+
+		void ApplyReplicatedGrid();
+
+		PackedTile* FindPackedTile(const AZ::EntityId& i_tileEntityId);
+
+		AZ::u16 m_serverPort { 47230 };
+		AZ::u16 m_clientPort { 47231 };
+		float m_sendRate { 20.f };
+
+		Role m_role { Role::NONE };
+		ReplicationSocket m_socket {};
+		AZStd::vector<AZ::u8> m_packet {};
+
+		AZ::u16 m_gridLength { 0 };
+		AZ::u64 m_layoutSeed { 0 };
+		AZStd::unordered_map<AZ::EntityId, TileId> m_tileIds {};
+		AZStd::vector<AZ::EntityId> m_tileEntityIds {};
+
+		// server
+		GridDeltaEncoder m_encoder {};
+		PackedGrid m_grid {};
+		float m_sendTimer { 0.f };
+
+		// client
+		GridDeltaDecoder m_decoder {};
+		GridReplica m_replica {};
+		AZ::u64 m_requestedLayoutSeed { 0 };
+		bool m_hasPendingSnapshot { false };
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,169 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/time.h>
+
+#include "../EBuses/TileBus.hpp"
+#include "LeaderboardComponent.hpp"
+
+using Loherangrin::Games::O3DEJam2305::LeaderboardComponent;
+using Loherangrin::Games::O3DEJam2305::LeaderboardEntry;
+using Loherangrin::Games::O3DEJam2305::LeaderboardRank;
+
+
+void LeaderboardComponent::Reflect(AZ::ReflectContext* io_context)
+{
+	if(auto serializeContext = azrtti_cast<AZ::SerializeContext*>(io_context))
+	{
+		serializeContext->Class<LeaderboardComponent, AZ::Component>()
+			->Version(0)
+			->Field("File", &LeaderboardComponent::m_filePath)
+		;
+
+		if(AZ::EditContext* editContext = serializeContext->GetEditContext())
+		{
+			editContext->Class<LeaderboardComponent>("Leaderboard", "Leaderboard")
+				->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+					->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+				->DataElement(AZ::Edit::UIHandlers::Default, &LeaderboardComponent::m_filePath, "File", "")
+			;
+		}
+	}
+}
+
+void LeaderboardComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided)
+{
+	io_provided.push_back(AZ_CRC_CE("LeaderboardService"));
+}
+
+void LeaderboardComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible)
+{
+	io_incompatible.push_back(AZ_CRC_CE("LeaderboardService"));
+}
+
+void LeaderboardComponent::GetRequiredServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_required)
+{}
+
+void LeaderboardComponent::GetDependentServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_dependent)
+{}
+
+void LeaderboardComponent::Activate()
+{
+	OpenStore();
+
+	GameNotificationBus::Handler::BusConnect();
+	ScoreNotificationBus::Handler::BusConnect();
+	LeaderboardRequestBus::Handler::BusConnect();
+}
+
+void LeaderboardComponent::Deactivate()
+{
+	LeaderboardRequestBus::Handler::BusDisconnect();
+	ScoreNotificationBus::Handler::BusDisconnect();
+	GameNotificationBus::Handler::BusDisconnect();
+
+	m_store.Close();
+}
+
+void LeaderboardComponent::OnGameLoading()
+{
+	m_currentEntry = LeaderboardEntry {};
+	EBUS_EVENT_RESULT(m_currentEntry.m_seed, TilesRequestBus, GetLayoutSeed);
+
+	m_isRunning = true;
+}
+
+void LeaderboardComponent::OnGameEnded()
+{
+	if(!m_isRunning)
+	{
+		return;
+	}
+
+	m_isRunning = false;
+
+	// the score engine settles its pending points on the same notification, so the total is queried directly
+	EBUS_EVENT_RESULT(m_currentEntry.m_points, ScoreRequestBus, GetTotalPoints);
+	m_currentEntry.m_time = static_cast<AZ::u64>(AZStd::GetTimeUTCMilliSecond());
+
+	if(!m_store.AddEntry(m_currentEntry))
+	{
+		return;
+	}
+
+	const LeaderboardRank rank = m_store.GetRank(m_currentEntry.m_points);
+	const LeaderboardRank seedRank = m_store.GetSeedRank(m_currentEntry.m_seed, m_currentEntry.m_points);
+
+	EBUS_EVENT(LeaderboardNotificationBus, OnRunRecorded, m_currentEntry, rank, seedRank);
+}
+
+AZ::u32 LeaderboardComponent::GetRunCount() const
+{
+	return m_store.GetEntryCount();
+}
+
+LeaderboardRank LeaderboardComponent::GetRank(TotalPoints i_points) const
+{
+	return m_store.GetRank(i_points);
+}
+
+LeaderboardRank LeaderboardComponent::GetSeedRank(LeaderboardSeed i_seed, TotalPoints i_points) const
+{
+	return m_store.GetSeedRank(i_seed, i_points);
+}
+
+AZStd::vector<LeaderboardEntry> LeaderboardComponent::GetTopEntries(AZ::u32 i_count) const
+{
+	return m_store.GetTopEntries(i_count);
+}
+
+AZStd::vector<LeaderboardEntry> LeaderboardComponent::GetSeedTopEntries(LeaderboardSeed i_seed, AZ::u32 i_count) const
+{
+	return m_store.GetSeedTopEntries(i_seed, i_count);
+}
+
+void LeaderboardComponent::OnScoreChanged(TotalPoints i_newPoints)
+{
+	m_currentEntry.m_points = i_newPoints;
+}
+
+void LeaderboardComponent::OnClaimedTilesChanged(TileCount i_newClaimedTiles)
+{
+	m_currentEntry.m_claimedTiles = i_newClaimedTiles;
+}
+
+void LeaderboardComponent::OpenStore()
+{
+	auto fileIO = AZ::IO::FileIOBase::GetInstance();
+	AZ_Assert(fileIO, "Unable to retrieve the file system");
+
+	AZ::IO::FixedMaxPath resolvedFilePath;
+	if(!fileIO->ResolvePath(resolvedFilePath, AZ::IO::PathView { m_filePath }))
+	{
+		AZ_Error("Leaderboard", false, "Unable to resolve the leaderboard path %s", m_filePath.c_str());
+		return;
+	}
+
+	fileIO->CreatePath(resolvedFilePath.ParentPath().c_str());
+
+	m_store.Open(resolvedFilePath.c_str());
+}
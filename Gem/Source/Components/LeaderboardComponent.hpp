@@ -0,0 +1,77 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/std/string/string.h>
+
+#include "../EBuses/GameBus.hpp"
+#include "../EBuses/LeaderboardBus.hpp"
+#include "../EBuses/ScoreBus.hpp"
+#include "../Utils/LeaderboardStore.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class LeaderboardComponent
+		: public AZ::Component
+		, protected GameNotificationBus::Handler
+		, protected LeaderboardRequestBus::Handler
+		, protected ScoreNotificationBus::Handler
+	{
+	public:
+		AZ_COMPONENT(LeaderboardComponent, "{6C2D95E8-3A17-4B40-8F5C-D7E1A0B93F64}");
+		static void Reflect(AZ::ReflectContext* io_context);
+
+		static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided);
+		static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible);
+		static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& io_required);
+		static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& io_dependent);
+
+	protected:
+		using TotalPoints = ScoreNotifications::TotalPoints;
+
+		// AZ::Component
+		void Activate() override;
+		void Deactivate() override;
+
+		// GameNotificationBus
+		void OnGameLoading() override;
+		void OnGameEnded() override;
+
+		// LeaderboardRequestBus
+		AZ::u32 GetRunCount() const override;
+		LeaderboardRank GetRank(TotalPoints i_points) const override;
+		LeaderboardRank GetSeedRank(LeaderboardSeed i_seed, TotalPoints i_points) const override;
+		AZStd::vector<LeaderboardEntry> GetTopEntries(AZ::u32 i_count) const override;
+		AZStd::vector<LeaderboardEntry> GetSeedTopEntries(LeaderboardSeed i_seed, AZ::u32 i_count) const override;
+
+		// ScoreNotificationBus
+		void OnScoreChanged(TotalPoints i_newPoints) override;
+		void OnClaimedTilesChanged(TileCount i_newClaimedTiles) override;
+
+	private:
+		void OpenStore();
+
+		AZStd::string m_filePath { "@user@/Leaderboard.bin" };
+
+		LeaderboardStore m_store {};
+		LeaderboardEntry m_currentEntry {};
+		bool m_isRunning { false };
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,320 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/SerializeContext.h>
+
+#include <Atom/RHI/ImageUpdateRequest.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
+
+#include "../Utils/GameMetrics.hpp"
+#include "MinimapComponent.hpp"
+
+using Loherangrin::Games::O3DEJam2305::MinimapComponent;
+using Loherangrin::Games::O3DEJam2305::MinimapImage;
+
+
+void MinimapComponent::Reflect(AZ::ReflectContext* io_context)
+{
+	if(auto serializeContext = azrtti_cast<AZ::SerializeContext*>(io_context))
+	{
+		serializeContext->Class<MinimapComponent, AZ::Component>()
+			->Version(0)
+			->Field("TexelsPerTile", &MinimapComponent::m_texelsPerTile)
+			->Field("EnergyBands", &MinimapComponent::m_nEnergyBands)
+			->Field("Background", &MinimapComponent::m_backgroundColor)
+			->Field("Unclaimed", &MinimapComponent::m_unclaimedColor)
+			->Field("Claimed", &MinimapComponent::m_claimedColor)
+			->Field("LandingArea", &MinimapComponent::m_landingAreaColor)
+		;
+
+		if(AZ::EditContext* editContext = serializeContext->GetEditContext())
+		{
+			editContext->Class<MinimapComponent>("Minimap", "Minimap")
+				->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+					->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+				->ClassElement(AZ::Edit::ClassElements::Group, "Image")
+					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+					->DataElement(AZ::Edit::UIHandlers::Default, &MinimapComponent::m_texelsPerTile, "Texels per Tile", "")
+						->Attribute(AZ::Edit::Attributes::Min, 1)
+					->DataElement(AZ::Edit::UIHandlers::Default, &MinimapComponent::m_nEnergyBands, "Energy Bands", "")
+						->Attribute(AZ::Edit::Attributes::Min, 1)
+
+				->ClassElement(AZ::Edit::ClassElements::Group, "Colors")
+					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+					->DataElement(AZ::Edit::UIHandlers::Color, &MinimapComponent::m_backgroundColor, "Background", "")
+					->DataElement(AZ::Edit::UIHandlers::Color, &MinimapComponent::m_unclaimedColor, "Unclaimed", "")
+					->DataElement(AZ::Edit::UIHandlers::Color, &MinimapComponent::m_claimedColor, "Claimed", "")
+					->DataElement(AZ::Edit::UIHandlers::Color, &MinimapComponent::m_landingAreaColor, "Landing Area", "")
+			;
+		}
+	}
+}
+
+void MinimapComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided)
+{
+	io_provided.push_back(AZ_CRC_CE("MinimapService"));
+}
+
+void MinimapComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible)
+{
+	io_incompatible.push_back(AZ_CRC_CE("MinimapService"));
+}
+
+void MinimapComponent::GetRequiredServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_required)
+{}
+
+void MinimapComponent::GetDependentServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_dependent)
+{}
+
+void MinimapComponent::Activate()
+{
+	MinimapRequestBus::Handler::BusConnect();
+	TilesNotificationBus::Handler::BusConnect();
+}
+
+void MinimapComponent::Deactivate()
+{
+	AZ::TickBus::Handler::BusDisconnect();
+	TilesNotificationBus::Handler::BusDisconnect();
+	MinimapRequestBus::Handler::BusDisconnect();
+
+	m_gpuImage.reset();
+	m_tileStatuses.clear();
+}
+
+void MinimapComponent::OnTick([[maybe_unused]] float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint i_time)
+{
+	GAME_PROFILE_SCOPE(UI, "MinimapComponent::OnTick");
+
+	if(m_image.IsDirty())
+	{
+		if(m_gpuImage)
+		{
+			UploadDirtyRects();
+		}
+		else
+		{
+			UploadImage();
+		}
+
+		m_image.ClearDirtyRects();
+	}
+
+	AZ::TickBus::Handler::BusDisconnect();
+}
+
+int MinimapComponent::GetTickOrder()
+{
+	return AZ::ComponentTickBus::TICK_UI;
+}
+
+AZ::Data::Instance<AZ::RPI::StreamingImage> MinimapComponent::GetMinimapImage() const
+{
+	return m_gpuImage;
+}
+
+void MinimapComponent::OnAllTilesCreated()
+{
+	AZ::u16 gridLength { 0 };
+	EBUS_EVENT_RESULT(gridLength, TilesRequestBus, GetGridLength);
+
+	const AZ::u32 nTiles = static_cast<AZ::u32>(gridLength) * gridLength;
+	const AZ::u32 imageLength = static_cast<AZ::u32>(gridLength) * m_texelsPerTile;
+
+	if(m_gpuImage && (m_image.GetWidth() != imageLength || m_image.GetHeight() != imageLength))
+	{
+		m_gpuImage.reset();
+	}
+
+	m_tileStatuses.assign(nTiles, TileStatus {});
+	m_image.Reset(gridLength, m_texelsPerTile, ConvertColor(m_backgroundColor));
+
+	AZ::TickBus::Handler::BusConnect();
+}
+
+void MinimapComponent::OnTileCreated(const AZ::EntityId& i_tileEntityId)
+{
+	TileId tileId { INVALID_TILE_ID };
+	EBUS_EVENT_ID_RESULT(tileId, i_tileEntityId, TileRequestBus, GetTileId);
+
+	if(tileId == INVALID_TILE_ID)
+	{
+		return;
+	}
+
+	if(tileId >= m_tileStatuses.size())
+	{
+		m_tileStatuses.resize(tileId + 1);
+	}
+
+	TileStatus status {};
+	status.m_isCreated = true;
+	status.m_energyBand = m_nEnergyBands - 1;
+
+	EBUS_EVENT_ID_RESULT(status.m_isClaimed, i_tileEntityId, TileRequestBus, IsClaimed);
+	EBUS_EVENT_ID_RESULT(status.m_isLandingArea, i_tileEntityId, TileRequestBus, IsLandingArea);
+
+	m_tileStatuses[tileId] = status;
+	UpdateTile(i_tileEntityId, status);
+}
+
+void MinimapComponent::OnTileEnergyChanged(const AZ::EntityId& i_tileEntityId, float i_normalizedNewEnergy)
+{
+	TileStatus* status = FindTileStatus(i_tileEntityId);
+	if(!status)
+	{
+		return;
+	}
+
+	const AZ::u8 energyBand = CalculateEnergyBand(i_normalizedNewEnergy);
+	if(energyBand == status->m_energyBand)
+	{
+		return;
+	}
+
+	status->m_energyBand = energyBand;
+	UpdateTile(i_tileEntityId, *status);
+}
+
+void MinimapComponent::OnTileClaimed(const AZ::EntityId& i_tileEntityId)
+{
+	TileStatus* status = FindTileStatus(i_tileEntityId);
+	if(!status)
+	{
+		return;
+	}
+
+	status->m_isClaimed = true;
+	UpdateTile(i_tileEntityId, *status);
+}
+
+void MinimapComponent::OnTileLost(const AZ::EntityId& i_tileEntityId)
+{
+	TileStatus* status = FindTileStatus(i_tileEntityId);
+	if(!status)
+	{
+		return;
+	}
+
+	status->m_isClaimed = false;
+	UpdateTile(i_tileEntityId, *status);
+}
+
+MinimapComponent::TileStatus* MinimapComponent::FindTileStatus(const AZ::EntityId& i_tileEntityId)
+{
+	TileId tileId { INVALID_TILE_ID };
+	EBUS_EVENT_ID_RESULT(tileId, i_tileEntityId, TileRequestBus, GetTileId);
+
+	if(tileId >= m_tileStatuses.size() || !m_tileStatuses[tileId].m_isCreated)
+	{
+		return nullptr;
+	}
+
+	return &m_tileStatuses[tileId];
+}
+
+void MinimapComponent::UpdateTile(const AZ::EntityId& i_tileEntityId, const TileStatus& i_status)
+{
+	TileId tileId { INVALID_TILE_ID };
+	EBUS_EVENT_ID_RESULT(tileId, i_tileEntityId, TileRequestBus, GetTileId);
+
+	if(tileId == INVALID_TILE_ID || m_image.GetWidth() == 0)
+	{
+		return;
+	}
+
+	if(m_image.SetTile(tileId, CalculateTexel(i_status)))
+	{
+		AZ::TickBus::Handler::BusConnect();
+	}
+}
+
+MinimapImage::Texel MinimapComponent::CalculateTexel(const TileStatus& i_status) const
+{
+	AZ::Color color = m_unclaimedColor;
+	if(i_status.m_isLandingArea)
+	{
+		color = m_landingAreaColor;
+	}
+	else if(i_status.m_isClaimed)
+	{
+		color = m_claimedColor;
+	}
+
+	// Fade towards the background while the tile energy decreases
+	const float brightness = static_cast<float>(i_status.m_energyBand + 1) / m_nEnergyBands;
+	color = m_backgroundColor.Lerp(color, brightness);
+
+	return ConvertColor(color);
+}
+
+AZ::u8 MinimapComponent::CalculateEnergyBand(float i_normalizedEnergy) const
+{
+	const float clampedEnergy = AZ::GetClamp(i_normalizedEnergy, 0.f, 1.f);
+	const AZ::u8 energyBand = static_cast<AZ::u8>(clampedEnergy * m_nEnergyBands);
+
+	return AZ::GetMin<AZ::u8>(energyBand, m_nEnergyBands - 1);
+}
+
+void MinimapComponent::UploadImage()
+{
+	AZ::RPI::ImageSystemInterface* imageSystem = AZ::RPI::ImageSystemInterface::Get();
+	if(!imageSystem)
+	{
+		return;
+	}
+
+	const AZ::u32 width = m_image.GetWidth();
+	const AZ::u32 height = m_image.GetHeight();
+
+	m_gpuImage = AZ::RPI::StreamingImage::CreateFromCpuData(*imageSystem->GetSystemStreamingPool(),
+		AZ::RHI::ImageDimension::Image2D, AZ::RHI::Size(width, height, 1), AZ::RHI::Format::R8G8B8A8_UNORM,
+		m_image.GetData(), m_image.GetRowPitch() * height);
+
+	AZ_Error("Minimap", m_gpuImage, "Unable to create the minimap image");
+
+	if(m_gpuImage)
+	{
+		EBUS_EVENT(MinimapNotificationBus, OnMinimapImageCreated, m_gpuImage);
+	}
+}
+
+void MinimapComponent::UploadDirtyRects()
+{
+	const AZ::u32 rowPitch = m_image.GetRowPitch();
+
+	for(const MinimapImage::Rect& rect : m_image.GetDirtyRects())
+	{
+		AZ::RHI::ImageUpdateRequest request;
+		request.m_image = m_gpuImage->GetRHIImage();
+		request.m_imageSubresourcePixelOffset = AZ::RHI::Origin(rect.m_left, rect.m_top, 0);
+		request.m_sourceData = m_image.GetData(rect);
+		request.m_sourceSubresourceLayout = AZ::RHI::ImageSubresourceLayout(AZ::RHI::Size(rect.m_width, rect.m_height, 1), rect.m_height, rowPitch, rowPitch * rect.m_height, 1, 1);
+
+		m_gpuImage->UpdateImageContents(request);
+	}
+}
+
+MinimapImage::Texel MinimapComponent::ConvertColor(const AZ::Color& i_color)
+{
+	return MinimapImage::PackTexel(i_color.GetR8(), i_color.GetG8(), i_color.GetB8(), i_color.GetA8());
+}
@@ -0,0 +1,99 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Math/Color.h>
+#include <AzCore/std/containers/vector.h>
+
+#include "../EBuses/MinimapBus.hpp"
+#include "../EBuses/TileBus.hpp"
+#include "../Utils/MinimapImage.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class MinimapComponent
+		: public AZ::Component
+		, protected AZ::TickBus::Handler
+		, protected MinimapRequestBus::Handler
+		, protected TilesNotificationBus::Handler
+	{
+	public:
+		AZ_COMPONENT(MinimapComponent, "{E1A7C35B-28F4-4D9E-B60A-9F3D2C81E4B7}");
+		static void Reflect(AZ::ReflectContext* io_context);
+
+		static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided);
+		static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible);
+		static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& io_required);
+		static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& io_dependent);
+
+	protected:
+		// AZ::Component
+		void Activate() override;
+		void Deactivate() override;
+
+		// AZ::TickBus
+		void OnTick(float i_deltaTime, AZ::ScriptTimePoint i_time) override;
+		int GetTickOrder() override;
+
+		// MinimapRequestBus
+		AZ::Data::Instance<AZ::RPI::StreamingImage> GetMinimapImage() const override;
+
+		// TilesNotificationBus
+		void OnAllTilesCreated() override;
+		void OnTileCreated(const AZ::EntityId& i_tileEntityId) override;
+		void OnTileEnergyChanged(const AZ::EntityId& i_tileEntityId, float i_normalizedNewEnergy) override;
+		void OnTileClaimed(const AZ::EntityId& i_tileEntityId) override;
+		void OnTileLost(const AZ::EntityId& i_tileEntityId) override;
+
+	private:
+		struct TileStatus
+		{
+			AZ::u8 m_energyBand { 0 };
+			bool m_isClaimed { false };
+			bool m_isLandingArea { false };
+			bool m_isCreated { false };
+		};
+
+		TileStatus* FindTileStatus(const AZ::EntityId& i_tileEntityId);
+		void UpdateTile(const AZ::EntityId& i_tileEntityId, const TileStatus& i_status);
+
+		MinimapImage::Texel CalculateTexel(const TileStatus& i_status) const;
+		AZ::u8 CalculateEnergyBand(float i_normalizedEnergy) const;
+
+		void UploadImage();
+		void UploadDirtyRects();
+
+		static MinimapImage::Texel ConvertColor(const AZ::Color& i_color);
+
+		AZ::u16 m_texelsPerTile { 4 };
+		AZ::u8 m_nEnergyBands { 4 };
+
+		AZ::Color m_backgroundColor { 0.f, 0.f, 0.f, 0.f };
+		AZ::Color m_unclaimedColor { 0.6f, 0.6f, 0.6f, 1.f };
+		AZ::Color m_claimedColor { 0.2f, 0.6f, 1.f, 1.f };
+		AZ::Color m_landingAreaColor { 1.f, 0.8f, 0.2f, 1.f };
+
+		MinimapImage m_image {};
+		AZStd::vector<TileStatus> m_tileStatuses {};
+
+		AZ::Data::Instance<AZ::RPI::StreamingImage> m_gpuImage {};
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,137 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/SerializeContext.h>
+
+#include <LyShine/Bus/UiElementBus.h>
+#include <LyShine/Bus/UiTextBus.h>
+
+#include "../Utils/GameMetrics.hpp"
+#include "PerformanceOverlayComponent.hpp"
+
+using Loherangrin::Games::O3DEJam2305::PerformanceOverlayComponent;
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	AZ_CVAR(bool, game_showPerformance, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Show the costs of the gameplay subsystems in an overlay");
+
+} // Loherangrin::Games::O3DEJam2305
+
+void PerformanceOverlayComponent::Reflect(AZ::ReflectContext* io_context)
+{
+	if(auto serializeContext = azrtti_cast<AZ::SerializeContext*>(io_context))
+	{
+		serializeContext->Class<PerformanceOverlayComponent, AZ::Component>()
+			->Version(0)
+			->Field("Text", &PerformanceOverlayComponent::m_textEntityId)
+			->Field("Refresh", &PerformanceOverlayComponent::m_refreshInterval)
+		;
+
+		if(AZ::EditContext* editContext = serializeContext->GetEditContext())
+		{
+			editContext->Class<PerformanceOverlayComponent>("Performance Overlay", "Performance Overlay")
+				->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+					->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+				->DataElement(AZ::Edit::UIHandlers::Default, &PerformanceOverlayComponent::m_textEntityId, "Text", "UI text element to fill when the game_showPerformance console variable is set")
+				->DataElement(AZ::Edit::UIHandlers::Default, &PerformanceOverlayComponent::m_refreshInterval, "Refresh", "")
+					->Attribute(AZ::Edit::Attributes::Min, 0.f)
+			;
+		}
+	}
+}
+
+void PerformanceOverlayComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided)
+{
+	io_provided.push_back(AZ_CRC_CE("PerformanceOverlayService"));
+}
+
+void PerformanceOverlayComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible)
+{
+	io_incompatible.push_back(AZ_CRC_CE("PerformanceOverlayService"));
+}
+
+void PerformanceOverlayComponent::GetRequiredServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_required)
+{}
+
+void PerformanceOverlayComponent::GetDependentServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_dependent)
+{}
+
+void PerformanceOverlayComponent::Activate()
+{
+	m_isVisible = false;
+	EBUS_EVENT_ID(m_textEntityId, UiElementBus, SetIsEnabled, false);
+
+	AZ::TickBus::Handler::BusConnect();
+}
+
+void PerformanceOverlayComponent::Deactivate()
+{
+	AZ::TickBus::Handler::BusDisconnect();
+}
+
+void PerformanceOverlayComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint i_time)
+{
+	AZ_PROFILE_SCOPE(O3DEJam2305, "PerformanceOverlayComponent::OnTick");
+
+	SetOverlayVisible(static_cast<bool>(game_showPerformance));
+	if(!m_isVisible)
+	{
+		return;
+	}
+
+	m_refreshTimer -= i_deltaTime;
+	if(m_refreshTimer > 0.f)
+	{
+		return;
+	}
+
+	m_refreshTimer = m_refreshInterval;
+	RefreshOverlay();
+}
+
+int PerformanceOverlayComponent::GetTickOrder()
+{
+	return AZ::ComponentTickBus::TICK_LAST;
+}
+
+void PerformanceOverlayComponent::SetOverlayVisible(bool i_isVisible)
+{
+	if(i_isVisible == m_isVisible || !m_textEntityId.IsValid())
+	{
+		return;
+	}
+
+	m_isVisible = i_isVisible;
+	m_refreshTimer = 0.f;
+
+	EBUS_EVENT_ID(m_textEntityId, UiElementBus, SetIsEnabled, i_isVisible);
+}
+
+void PerformanceOverlayComponent::RefreshOverlay()
+{
+	m_text.clear();
+
+	GameMetrics::PrintFrameStats(m_text);
+	GameMetrics::PrintSpawnTickets(m_text);
+
+	EBUS_EVENT_ID(m_textEntityId, UiTextBus, SetText, m_text);
+}
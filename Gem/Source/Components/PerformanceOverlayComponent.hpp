@@ -0,0 +1,60 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/string/string.h>
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class PerformanceOverlayComponent
+		: public AZ::Component
+		, protected AZ::TickBus::Handler
+	{
+	public:
+		AZ_COMPONENT(PerformanceOverlayComponent, "{5D2B9E47-A1C3-4F68-9E0B-7C84D13F2A65}");
+		static void Reflect(AZ::ReflectContext* io_context);
+
+		static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided);
+		static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible);
+		static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& io_required);
+		static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& io_dependent);
+
+	protected:
+		// AZ::Component
+		void Activate() override;
+		void Deactivate() override;
+
+		// AZ::TickBus
+		void OnTick(float i_deltaTime, AZ::ScriptTimePoint i_time) override;
+		int GetTickOrder() override;
+
+	private:
+		void SetOverlayVisible(bool i_isVisible);
+		void RefreshOverlay();
+
+		AZ::EntityId m_textEntityId {};
+		float m_refreshInterval { 0.5f };
+
+		AZStd::string m_text {};
+		float m_refreshTimer { 0.f };
+		bool m_isVisible { false };
+	};
+
+} // Loherangrin::Games::O3DEJam2305
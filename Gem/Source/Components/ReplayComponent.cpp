@@ -0,0 +1,499 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/EBus/Results.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/sort.h>
+
+#include "../Utils/GameMetrics.hpp"
+#include "ReplayComponent.hpp"
+
+using Loherangrin::Games::O3DEJam2305::ReplayComponent;
+using Loherangrin::Games::O3DEJam2305::ReplayHeader;
+using Loherangrin::Games::O3DEJam2305::ReplayInputRecord;
+using Loherangrin::Games::O3DEJam2305::StateHasher;
+using Loherangrin::Games::O3DEJam2305::TileId;
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	static bool ResolveReplayFilePath(const AZ::ConsoleCommandContainer& i_arguments, AZStd::string& o_filePath)
+	{
+		auto fileIO = AZ::IO::FileIOBase::GetInstance();
+		AZ_Assert(fileIO, "Unable to retrieve the file system");
+
+		const AZ::IO::PathView filePath = (i_arguments.empty()) ? AZ::IO::PathView { "@user@/Replays/last.rply" } : AZ::IO::PathView { i_arguments.front() };
+
+		AZ::IO::FixedMaxPath resolvedFilePath;
+		if(!fileIO->ResolvePath(resolvedFilePath, filePath))
+		{
+			AZ_Error("Replay", false, "Unable to resolve the replay path %.*s", AZ_STRING_ARG(filePath.Native()));
+			return false;
+		}
+
+		o_filePath = resolvedFilePath.c_str();
+		return true;
+	}
+
+	static void RecordReplay(const AZ::ConsoleCommandContainer& i_arguments)
+	{
+		AZStd::string filePath;
+		if(!ResolveReplayFilePath(i_arguments, filePath))
+		{
+			return;
+		}
+
+		bool isStarted { false };
+		EBUS_EVENT_RESULT(isStarted, ReplayRequestBus, StartRecording, filePath);
+
+		AZ_Warning("Replay", isStarted, "No replay component is active in this level");
+	}
+
+	static void PlayReplay(const AZ::ConsoleCommandContainer& i_arguments)
+	{
+		AZStd::string filePath;
+		if(!ResolveReplayFilePath(i_arguments, filePath))
+		{
+			return;
+		}
+
+		EBUS_EVENT(ReplayRequestBus, StartPlayback, filePath);
+	}
+
+	static void StopReplay([[maybe_unused]] const AZ::ConsoleCommandContainer& i_arguments)
+	{
+		EBUS_EVENT(ReplayRequestBus, Stop);
+	}
+
+	AZ_CONSOLEFREEFUNC("game_replayRecord", RecordReplay, AZ::ConsoleFunctorFlags::Null, "Record the next game to the given file, which is written when the game ends");
+	AZ_CONSOLEFREEFUNC("game_replayPlay", PlayReplay, AZ::ConsoleFunctorFlags::Null, "Play the given file back in the next game, reporting the first tick where it diverges");
+	AZ_CONSOLEFREEFUNC("game_replayStop", StopReplay, AZ::ConsoleFunctorFlags::Null, "Stop recording or playing back, without writing anything");
+
+} // Loherangrin::Games::O3DEJam2305
+
+
+void ReplayComponent::Reflect(AZ::ReflectContext* io_context)
+{
+	if(auto serializeContext = azrtti_cast<AZ::SerializeContext*>(io_context))
+	{
+		serializeContext->Class<ReplayComponent, AZ::Component>()
+			->Version(0)
+			->Field("TimeStep", &ReplayComponent::m_timeStep)
+			->Field("ChecksumInterval", &ReplayComponent::m_checksumInterval)
+		;
+
+		if(AZ::EditContext* editContext = serializeContext->GetEditContext())
+		{
+			editContext->Class<ReplayComponent>("Replay", "Replay")
+				->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+					->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+				->DataElement(AZ::Edit::UIHandlers::Default, &ReplayComponent::m_timeStep, "Time Step", "")
+				->DataElement(AZ::Edit::UIHandlers::Default, &ReplayComponent::m_checksumInterval, "Checksum Interval", "")
+			;
+		}
+	}
+}
+
+void ReplayComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided)
+{
+	io_provided.push_back(AZ_CRC_CE("ReplayService"));
+}
+
+void ReplayComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible)
+{
+	io_incompatible.push_back(AZ_CRC_CE("ReplayService"));
+}
+
+void ReplayComponent::GetRequiredServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_required)
+{}
+
+void ReplayComponent::GetDependentServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_dependent)
+{}
+
+void ReplayComponent::Activate()
+{
+	AZ::EBusAggregateResults<AZ::EntityId> spaceshipEntityIds;
+	EBUS_EVENT_RESULT(spaceshipEntityIds, SpaceshipRequestBus, GetSpaceshipId);
+
+	m_spaceshipEntityIds.insert(spaceshipEntityIds.values.begin(), spaceshipEntityIds.values.end());
+
+	GameNotificationBus::Handler::BusConnect();
+	ScoreNotificationBus::Handler::BusConnect();
+	SpaceshipsNotificationBus::Handler::BusConnect();
+	TilesNotificationBus::Handler::BusConnect();
+	ReplayRequestBus::Handler::BusConnect();
+}
+
+void ReplayComponent::Deactivate()
+{
+	Stop();
+
+	ReplayRequestBus::Handler::BusDisconnect();
+	TilesNotificationBus::Handler::BusDisconnect();
+	SpaceshipsNotificationBus::Handler::BusDisconnect();
+	ScoreNotificationBus::Handler::BusDisconnect();
+	GameNotificationBus::Handler::BusDisconnect();
+
+	m_spaceshipEntityIds.clear();
+}
+
+void ReplayComponent::OnGameStarted()
+{
+	if(m_mode == Mode::NONE)
+	{
+		return;
+	}
+
+	StartSession();
+}
+
+void ReplayComponent::OnGameResumed()
+{
+	if(m_mode != Mode::RECORDING || !m_isSessionActive)
+	{
+		return;
+	}
+
+	ReplayInputRecord input;
+	input.m_tick = GetTick();
+	input.m_channel = RESUME_CHANNEL;
+
+	m_replay.AddInput(input);
+}
+
+void ReplayComponent::OnGameEnded()
+{
+	if(!m_isSessionActive)
+	{
+		return;
+	}
+
+	EndSession();
+}
+
+void ReplayComponent::OnStageTick([[maybe_unused]] float i_deltaTime)
+{
+	GAME_PROFILE_SCOPE(SPACESHIPS, "ReplayComponent::OnStageTick");
+
+	const AZ::u32 tick = GetTick();
+
+	if(m_mode == Mode::PLAYING)
+	{
+		PlayInputs(tick);
+	}
+
+	if(m_replay.IsChecksumTick(tick))
+	{
+		CheckState(tick);
+	}
+}
+
+bool ReplayComponent::StartRecording(const AZStd::string& i_filePath)
+{
+	Stop();
+
+	ReplayHeader header;
+	header.m_checksumInterval = m_checksumInterval;
+	header.m_timeStep = m_timeStep;
+
+	m_replay.Reset(header);
+
+	m_mode = Mode::RECORDING;
+	m_filePath = i_filePath;
+
+	AZ_Printf("Replay", "The next game will be recorded to %s\n", m_filePath.c_str());
+	return true;
+}
+
+bool ReplayComponent::StartPlayback(const AZStd::string& i_filePath)
+{
+	Stop();
+
+	if(!m_replay.Read(i_filePath.c_str()))
+	{
+		return false;
+	}
+
+	const ReplayHeader& header = m_replay.GetHeader();
+	AZ_Warning("Replay", header.m_timeStep == m_timeStep, "%s was recorded at a different time step, the playback is going to diverge", i_filePath.c_str());
+
+	EBUS_EVENT(TilesRequestBus, SetNextLayoutSeed, header.m_seed);
+
+	m_mode = Mode::PLAYING;
+	m_filePath = i_filePath;
+
+	AZ_Printf("Replay", "The next game will play back %s (%u ticks, %u inputs)\n", m_filePath.c_str(), header.m_nTicks, header.m_nInputs);
+	return true;
+}
+
+void ReplayComponent::Stop()
+{
+	GameplayStageNotificationBus::Handler::BusDisconnect();
+
+	if(m_isSessionActive)
+	{
+		EBUS_EVENT(GameplaySchedulerRequestBus, SetFixedTimeStep, 0.f);
+	}
+
+	m_mode = Mode::NONE;
+	m_isSessionActive = false;
+}
+
+bool ReplayComponent::IsPlaying() const
+{
+	return (m_mode == Mode::PLAYING && m_isSessionActive);
+}
+
+AZ::u32 ReplayComponent::GetDivergencesCount() const
+{
+	return m_nDivergences;
+}
+
+void ReplayComponent::RecordInput(AZ::Crc32 i_channel, AZ::u8 i_state, float i_value)
+{
+	if(m_mode != Mode::RECORDING || !m_isSessionActive)
+	{
+		return;
+	}
+
+	// live inputs are received between two ticks, so they are played back before the next one
+	ReplayInputRecord input;
+	input.m_tick = GetTick();
+	input.m_channel = i_channel;
+	input.m_value = i_value;
+	input.m_state = i_state;
+
+	m_replay.AddInput(input);
+}
+
+void ReplayComponent::OnScoreChanged(TotalPoints i_newPoints)
+{
+	m_totalPoints = i_newPoints;
+}
+
+void ReplayComponent::OnClaimedTilesChanged(TileCount i_newClaimedTiles)
+{
+	m_claimedTiles = i_newClaimedTiles;
+}
+
+void ReplayComponent::OnSpaceshipRegistered(const AZ::EntityId& i_spaceshipEntityId)
+{
+	m_spaceshipEntityIds.insert(i_spaceshipEntityId);
+}
+
+void ReplayComponent::OnSpaceshipUnregistered(const AZ::EntityId& i_spaceshipEntityId)
+{
+	m_spaceshipEntityIds.erase(i_spaceshipEntityId);
+}
+
+void ReplayComponent::OnTileEnergyChanged(const AZ::EntityId& i_tileEntityId, float i_normalizedNewEnergy)
+{
+	if(TileSnapshot* tile = FindTileSnapshot(i_tileEntityId))
+	{
+		tile->m_energy = i_normalizedNewEnergy;
+	}
+}
+
+void ReplayComponent::OnTileClaimed(const AZ::EntityId& i_tileEntityId)
+{
+	if(TileSnapshot* tile = FindTileSnapshot(i_tileEntityId))
+	{
+		tile->m_isClaimed = true;
+	}
+}
+
+void ReplayComponent::OnTileLost(const AZ::EntityId& i_tileEntityId)
+{
+	if(TileSnapshot* tile = FindTileSnapshot(i_tileEntityId))
+	{
+		tile->m_isClaimed = false;
+	}
+}
+
+void ReplayComponent::StartSession()
+{
+	m_startTick = 0;
+	EBUS_EVENT_RESULT(m_startTick, GameplaySchedulerRequestBus, GetTick);
+
+	AZ::u16 gridLength { 0 };
+	EBUS_EVENT_RESULT(gridLength, TilesRequestBus, GetGridLength);
+
+	// tiles are reset in the same way by every loading, so only the changes from now on are tracked
+	m_tiles.assign(gridLength * gridLength, TileSnapshot {});
+
+	if(m_mode == Mode::RECORDING)
+	{
+		ReplayHeader header = m_replay.GetHeader();
+		EBUS_EVENT_RESULT(header.m_seed, TilesRequestBus, GetLayoutSeed);
+		header.m_gridLength = gridLength;
+		header.m_nSpaceships = static_cast<AZ::u8>(m_spaceshipEntityIds.size());
+
+		m_replay.Reset(header);
+	}
+	else
+	{
+		AZ_Warning("Replay", m_replay.GetHeader().m_gridLength == gridLength, "The replay was recorded on a grid of a different size, the playback is going to diverge");
+	}
+
+	m_nDivergences = 0;
+	m_isSessionActive = true;
+
+	EBUS_EVENT(GameplaySchedulerRequestBus, SetFixedTimeStep, m_timeStep);
+	GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::INPUT);
+}
+
+void ReplayComponent::EndSession()
+{
+	const AZ::u32 nTicks = GetTick();
+
+	if(m_mode == Mode::RECORDING)
+	{
+		m_replay.SetTicksCount(nTicks);
+
+		if(m_replay.Write(m_filePath.c_str()))
+		{
+			AZ_Printf("Replay", "Recorded %u ticks and %u inputs to %s\n", nTicks, m_replay.GetHeader().m_nInputs, m_filePath.c_str());
+		}
+	}
+	else
+	{
+		const AZ::u32 nRecordedTicks = m_replay.GetHeader().m_nTicks;
+
+		AZ_Warning("Replay", nTicks == nRecordedTicks, "The playback ended at tick %u, while the recording lasted %u ticks", nTicks, nRecordedTicks);
+		AZ_Printf("Replay", "Played back %u ticks of %s, %u checksums did not match\n", nTicks, m_filePath.c_str(), m_nDivergences);
+	}
+
+	Stop();
+}
+
+void ReplayComponent::PlayInputs(AZ::u32 i_tick) const
+{
+	for(const ReplayInputRecord& input : m_replay.GetInputs(i_tick))
+	{
+		if(input.m_channel == RESUME_CHANNEL)
+		{
+			EBUS_EVENT(GameRequestBus, ResumeGame);
+			continue;
+		}
+
+		EBUS_EVENT(ReplayInputNotificationBus, OnReplayInput, AZ::Crc32 { input.m_channel }, input.m_state, input.m_value);
+	}
+}
+
+void ReplayComponent::CheckState(AZ::u32 i_tick)
+{
+	const AZ::u64 checksum = CalculateChecksum();
+
+	if(m_mode == Mode::RECORDING)
+	{
+		m_replay.AddChecksum(i_tick, checksum);
+		return;
+	}
+
+	AZ::u64 expectedChecksum { 0 };
+	if(!m_replay.FindChecksum(i_tick, expectedChecksum) || checksum == expectedChecksum)
+	{
+		return;
+	}
+
+	// once diverged, every following checksum is going to differ as well
+	AZ_Warning("Replay", m_nDivergences > 0, "The playback diverged at tick %u: checksum %016llx, expected %016llx",
+		i_tick,
+		static_cast<unsigned long long>(checksum),
+		static_cast<unsigned long long>(expectedChecksum)
+	);
+
+	++m_nDivergences;
+}
+
+AZ::u64 ReplayComponent::CalculateChecksum() const
+{
+	StateHasher hasher;
+
+	for(const TileSnapshot& tile : m_tiles)
+	{
+		hasher.AddQuantized(tile.m_energy, ENERGY_STEP);
+		hasher.AddValue(tile.m_isClaimed);
+	}
+
+	// entity ids change from a run to another, so the spaceships are identified by their own state only
+	AZStd::vector<AZ::u64> spaceshipHashes;
+	spaceshipHashes.reserve(m_spaceshipEntityIds.size());
+
+	for(const AZ::EntityId& spaceshipEntityId : m_spaceshipEntityIds)
+	{
+		float energy { 0.f };
+		EBUS_EVENT_ID_RESULT(energy, spaceshipEntityId, SpaceshipRequestBus, GetNormalizedEnergy);
+
+		bool isLanded { false };
+		EBUS_EVENT_ID_RESULT(isLanded, spaceshipEntityId, SpaceshipRequestBus, IsLanded);
+
+		AZ::Vector3 position { AZ::Vector3::CreateZero() };
+		EBUS_EVENT_ID_RESULT(position, spaceshipEntityId, AZ::TransformBus, GetWorldTranslation);
+
+		StateHasher spaceshipHasher;
+		spaceshipHasher.AddQuantized(energy, ENERGY_STEP);
+		spaceshipHasher.AddValue(isLanded);
+		spaceshipHasher.AddQuantized(position.GetX(), POSITION_STEP);
+		spaceshipHasher.AddQuantized(position.GetY(), POSITION_STEP);
+
+		spaceshipHashes.push_back(spaceshipHasher.GetHash());
+	}
+
+	AZStd::sort(spaceshipHashes.begin(), spaceshipHashes.end());
+	for(AZ::u64 spaceshipHash : spaceshipHashes)
+	{
+		hasher.AddValue(spaceshipHash);
+	}
+
+	hasher.AddValue(m_totalPoints);
+	hasher.AddValue(m_claimedTiles);
+
+	return hasher.GetHash();
+}
+
+AZ::u32 ReplayComponent::GetTick() const
+{
+	AZ::u32 tick { 0 };
+	EBUS_EVENT_RESULT(tick, GameplaySchedulerRequestBus, GetTick);
+
+	return (tick - m_startTick);
+}
+
+ReplayComponent::TileSnapshot* ReplayComponent::FindTileSnapshot(const AZ::EntityId& i_tileEntityId)
+{
+	if(!m_isSessionActive)
+	{
+		return nullptr;
+	}
+
+	TileId tileId { INVALID_TILE_ID };
+	EBUS_EVENT_ID_RESULT(tileId, i_tileEntityId, TileRequestBus, GetTileId);
+
+	if(tileId >= m_tiles.size())
+	{
+		return nullptr;
+	}
+
+	return &m_tiles[tileId];
+}
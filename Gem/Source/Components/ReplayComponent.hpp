@@ -0,0 +1,141 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+#include "../Core/ReplayFile.hpp"
+#include "../EBuses/GameBus.hpp"
+#include "../EBuses/GameplayBus.hpp"
+#include "../EBuses/ReplayBus.hpp"
+#include "../EBuses/ScoreBus.hpp"
+#include "../EBuses/SpaceshipBus.hpp"
+#include "../EBuses/TileBus.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Records a game as its layout seed and the player inputs received at each gameplay tick, then plays it back in real time.
+	// The scheduler runs at a fixed time step meanwhile, and a checksum of the tiles, spaceships and score
+	// is compared every few ticks, so that the first tick where the playback diverged is reported.
+	// Playbacks can't run faster than real time, since spaceships are moved by physics once per frame rather than once per tick.
+	class ReplayComponent
+		: public AZ::Component
+		, protected GameNotificationBus::Handler
+		, protected GameplayStageNotificationBus::Handler
+		, protected ReplayRequestBus::Handler
+		, protected ScoreNotificationBus::Handler
+		, protected SpaceshipsNotificationBus::Handler
+		, protected TilesNotificationBus::Handler
+	{
+	public:
+		AZ_COMPONENT(ReplayComponent, "{E81B6D24-4A9C-4F37-B0E5-7C23D9A1F6B0}");
+		static void Reflect(AZ::ReflectContext* io_context);
+
+		static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided);
+		static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible);
+		static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& io_required);
+		static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& io_dependent);
+
+	protected:
+		// AZ::Component
+		void Activate() override;
+		void Deactivate() override;
+
+		// GameNotificationBus
+		void OnGameStarted() override;
+		void OnGameResumed() override;
+		void OnGameEnded() override;
+
+		// GameplayStageNotificationBus
+		void OnStageTick(float i_deltaTime) override;
+
+		// ReplayRequestBus
+		bool StartRecording(const AZStd::string& i_filePath) override;
+		bool StartPlayback(const AZStd::string& i_filePath) override;
+		void Stop() override;
+
+		bool IsPlaying() const override;
+		AZ::u32 GetDivergencesCount() const override;
+
+		void RecordInput(AZ::Crc32 i_channel, AZ::u8 i_state, float i_value) override;
+
+		// ScoreNotificationBus
+		void OnScoreChanged(TotalPoints i_newPoints) override;
+		void OnClaimedTilesChanged(TileCount i_newClaimedTiles) override;
+
+		// SpaceshipsNotificationBus
+		void OnSpaceshipRegistered(const AZ::EntityId& i_spaceshipEntityId) override;
+		void OnSpaceshipUnregistered(const AZ::EntityId& i_spaceshipEntityId) override;
+
+		// TilesNotificationBus
+		void OnTileEnergyChanged(const AZ::EntityId& i_tileEntityId, float i_normalizedNewEnergy) override;
+		void OnTileClaimed(const AZ::EntityId& i_tileEntityId) override;
+		void OnTileLost(const AZ::EntityId& i_tileEntityId) override;
+
+	private:
+		enum class Mode : AZ::u8
+		{
+			NONE = 0,
+			RECORDING,
+			PLAYING
+		};
+
+		struct TileSnapshot
+		{
+			float m_energy { 0.f };
+			bool m_isClaimed { false };
+		};
+
+		void StartSession();
+		void EndSession();
+
+		void PlayInputs(AZ::u32 i_tick) const;
+		void CheckState(AZ::u32 i_tick);
+
+		AZ::u64 CalculateChecksum() const;
+		AZ::u32 GetTick() const;
+
+		TileSnapshot* FindTileSnapshot(const AZ::EntityId& i_tileEntityId);
+
+		AZ::u16 m_checksumInterval { 30 };
+		float m_timeStep { 1.f / 60.f };
+
+		Mode m_mode { Mode::NONE };
+		bool m_isSessionActive { false };
+		AZStd::string m_filePath {};
+
+		ReplayFile m_replay {};
+		AZ::u32 m_startTick { 0 };
+		AZ::u32 m_nDivergences { 0 };
+
+		AZStd::vector<TileSnapshot> m_tiles {};
+		AZStd::unordered_set<AZ::EntityId> m_spaceshipEntityIds {};
+		TotalPoints m_totalPoints { 0 };
+		TileCount m_claimedTiles { 0 };
+
+		// the game is resumed from the pause menu, which is not a gameplay input but must be played back as well
+		static constexpr AZ::Crc32 RESUME_CHANNEL = AZ_CRC_CE("game_resume");
+
+		static constexpr float ENERGY_STEP = 1.f / 256.f;
+		static constexpr float POSITION_STEP = 0.05f;
+	};
+
+} // Loherangrin::Games::O3DEJam2305
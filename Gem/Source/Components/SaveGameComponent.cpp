@@ -0,0 +1,246 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/SerializeContext.h>
+
+#include "../EBuses/TileBus.hpp"
+#include "SaveGameComponent.hpp"
+
+using Loherangrin::Games::O3DEJam2305::SaveGameComponent;
+using Loherangrin::Games::O3DEJam2305::SaveHeader;
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	static bool ResolveSaveFilePath(const AZ::ConsoleCommandContainer& i_arguments, AZStd::string& o_filePath)
+	{
+		auto fileIO = AZ::IO::FileIOBase::GetInstance();
+		AZ_Assert(fileIO, "Unable to retrieve the file system");
+
+		const AZ::IO::PathView filePath = (i_arguments.empty()) ? AZ::IO::PathView { "@user@/Saves/last.save" } : AZ::IO::PathView { i_arguments.front() };
+
+		AZ::IO::FixedMaxPath resolvedFilePath;
+		if(!fileIO->ResolvePath(resolvedFilePath, filePath))
+		{
+			AZ_Error("SaveGame", false, "Unable to resolve the save path %.*s", AZ_STRING_ARG(filePath.Native()));
+			return false;
+		}
+
+		o_filePath = resolvedFilePath.c_str();
+		return true;
+	}
+
+	static void SaveGame(const AZ::ConsoleCommandContainer& i_arguments)
+	{
+		AZStd::string filePath;
+		if(!ResolveSaveFilePath(i_arguments, filePath))
+		{
+			return;
+		}
+
+		EBUS_EVENT(SaveGameRequestBus, SaveGame, filePath);
+	}
+
+	static void LoadGame(const AZ::ConsoleCommandContainer& i_arguments)
+	{
+		AZStd::string filePath;
+		if(!ResolveSaveFilePath(i_arguments, filePath))
+		{
+			return;
+		}
+
+		bool isLoaded { false };
+		EBUS_EVENT_RESULT(isLoaded, SaveGameRequestBus, LoadGame, filePath);
+
+		AZ_Warning("SaveGame", isLoaded, "Unable to load %s", filePath.c_str());
+	}
+
+	AZ_CONSOLEFREEFUNC("game_save", SaveGame, AZ::ConsoleFunctorFlags::Null, "Save the game in progress to the given file");
+	AZ_CONSOLEFREEFUNC("game_load", LoadGame, AZ::ConsoleFunctorFlags::Null, "Restore the given file in place of the next game that is started");
+
+} // Loherangrin::Games::O3DEJam2305
+
+
+void SaveGameComponent::Reflect(AZ::ReflectContext* io_context)
+{
+	if(auto serializeContext = azrtti_cast<AZ::SerializeContext*>(io_context))
+	{
+		serializeContext->Class<SaveGameComponent, AZ::Component>()
+			->Version(0)
+		;
+
+		if(AZ::EditContext* editContext = serializeContext->GetEditContext())
+		{
+			editContext->Class<SaveGameComponent>("Save Game", "Save Game")
+				->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+					->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+			;
+		}
+	}
+}
+
+void SaveGameComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided)
+{
+	io_provided.push_back(AZ_CRC_CE("SaveGameService"));
+}
+
+void SaveGameComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible)
+{
+	io_incompatible.push_back(AZ_CRC_CE("SaveGameService"));
+}
+
+void SaveGameComponent::GetRequiredServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_required)
+{}
+
+void SaveGameComponent::GetDependentServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_dependent)
+{}
+
+void SaveGameComponent::Activate()
+{
+	GameNotificationBus::Handler::BusConnect();
+	SaveGameRequestBus::Handler::BusConnect();
+}
+
+void SaveGameComponent::Deactivate()
+{
+	SaveGameRequestBus::Handler::BusDisconnect();
+	GameplayStageNotificationBus::Handler::BusDisconnect();
+	GameNotificationBus::Handler::BusDisconnect();
+
+	m_isGameActive = false;
+	m_hasPendingRestore = false;
+}
+
+void SaveGameComponent::OnGameStarted()
+{
+	m_startTick = 0;
+	EBUS_EVENT_RESULT(m_startTick, GameplaySchedulerRequestBus, GetTick);
+
+	m_time = 0.f;
+	m_isGameActive = true;
+
+	GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::INPUT);
+}
+
+void SaveGameComponent::OnGameEnded()
+{
+	GameplayStageNotificationBus::Handler::BusDisconnect();
+
+	m_isGameActive = false;
+}
+
+void SaveGameComponent::OnStageTick(float i_deltaTime)
+{
+	if(m_hasPendingRestore)
+	{
+		m_hasPendingRestore = false;
+		RestoreGame();
+
+		return;
+	}
+
+	m_time += i_deltaTime;
+}
+
+bool SaveGameComponent::SaveGame(const AZStd::string& i_filePath)
+{
+	if(!m_isGameActive || m_hasPendingRestore)
+	{
+		AZ_Warning("SaveGame", false, "There is no game in progress to save");
+		return false;
+	}
+
+	AZ::u32 tick { 0 };
+	EBUS_EVENT_RESULT(tick, GameplaySchedulerRequestBus, GetTick);
+
+	SaveHeader header;
+	EBUS_EVENT_RESULT(header.m_gridLength, TilesRequestBus, GetGridLength);
+	EBUS_EVENT_RESULT(header.m_layoutSeed, TilesRequestBus, GetLayoutSeed);
+	header.m_time = m_time;
+	header.m_tick = tick - m_startTick;
+
+	m_file.Reset(header);
+
+	EBUS_EVENT(SaveGameNotificationBus, OnGameSaving, m_file);
+
+	if(!m_file.Write(i_filePath.c_str()))
+	{
+		return false;
+	}
+
+	AZ_Printf("SaveGame", "Saved tick %u of layout %llu to %s\n", header.m_tick, static_cast<unsigned long long>(header.m_layoutSeed), i_filePath.c_str());
+	return true;
+}
+
+bool SaveGameComponent::LoadGame(const AZStd::string& i_filePath)
+{
+	if(!m_file.Read(i_filePath.c_str()))
+	{
+		m_hasPendingRestore = false;
+		return false;
+	}
+
+	EBUS_EVENT(TilesRequestBus, SetNextLayoutSeed, m_file.GetHeader().m_layoutSeed);
+
+	m_filePath = i_filePath;
+	m_hasPendingRestore = true;
+
+	AZ_Printf("SaveGame", "The next game will be restored from %s\n", m_filePath.c_str());
+	return true;
+}
+
+bool SaveGameComponent::IsRestoring() const
+{
+	return m_isRestoring;
+}
+
+void SaveGameComponent::RestoreGame()
+{
+	const SaveHeader& header = m_file.GetHeader();
+
+	AZ::u16 gridLength { 0 };
+	EBUS_EVENT_RESULT(gridLength, TilesRequestBus, GetGridLength);
+
+	AZ::u64 layoutSeed { 0 };
+	EBUS_EVENT_RESULT(layoutSeed, TilesRequestBus, GetLayoutSeed);
+
+	if(gridLength != header.m_gridLength || layoutSeed != header.m_layoutSeed)
+	{
+		AZ_Error("SaveGame", false, "The game started from %s does not have the saved layout, it is played from the beginning instead", m_filePath.c_str());
+		return;
+	}
+
+	m_isRestoring = true;
+
+	EBUS_EVENT(SaveGameNotificationBus, OnGameRestoring, m_file);
+	EBUS_EVENT(SaveGameNotificationBus, OnGameRestored, m_file);
+
+	m_isRestoring = false;
+
+	// the restored game goes on counting from the saved tick, so that it can be saved again
+	AZ::u32 tick { 0 };
+	EBUS_EVENT_RESULT(tick, GameplaySchedulerRequestBus, GetTick);
+
+	m_startTick = tick - header.m_tick;
+	m_time = header.m_time;
+
+	AZ_Printf("SaveGame", "Restored tick %u of %s\n", header.m_tick, m_filePath.c_str());
+}
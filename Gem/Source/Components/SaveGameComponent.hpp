@@ -0,0 +1,79 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/std/string/string.h>
+
+#include "../Core/SaveFile.hpp"
+#include "../EBuses/GameBus.hpp"
+#include "../EBuses/GameplayBus.hpp"
+#include "../EBuses/SaveGameBus.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Saves a game in progress to a file, and restores it in place of the next game that is started.
+	// The layout is generated again from the saved seed by the usual spawning path, then every component
+	// takes its own records back from the file at the first gameplay tick, before anything else is updated.
+	class SaveGameComponent
+		: public AZ::Component
+		, protected GameNotificationBus::Handler
+		, protected GameplayStageNotificationBus::Handler
+		, protected SaveGameRequestBus::Handler
+	{
+	public:
+		AZ_COMPONENT(SaveGameComponent, "{6C1F4E82-B7D3-4A59-9E06-D38A2B5C71F4}");
+		static void Reflect(AZ::ReflectContext* io_context);
+
+		static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided);
+		static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible);
+		static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& io_required);
+		static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& io_dependent);
+
+	protected:
+		// AZ::Component
+		void Activate() override;
+		void Deactivate() override;
+
+		// GameNotificationBus
+		void OnGameStarted() override;
+		void OnGameEnded() override;
+
+		// GameplayStageNotificationBus
+		void OnStageTick(float i_deltaTime) override;
+
+		// SaveGameRequestBus
+		bool SaveGame(const AZStd::string& i_filePath) override;
+		bool LoadGame(const AZStd::string& i_filePath) override;
+		bool IsRestoring() const override;
+
+	private:
+		void RestoreGame();
+
+		SaveFile m_file {};
+		AZStd::string m_filePath {};
+
+		bool m_isGameActive { false };
+		bool m_hasPendingRestore { false };
+		bool m_isRestoring { false };
+
+		AZ::u32 m_startTick { 0 };
+		float m_time { 0.f };
+	};
+
+} // Loherangrin::Games::O3DEJam2305
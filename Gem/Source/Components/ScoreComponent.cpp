@@ -17,10 +17,16 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 
+#include "../Core/SaveFile.hpp"
+#include "../Utils/GameMetrics.hpp"
 #include "ScoreComponent.hpp"
 
+using Loherangrin::Games::O3DEJam2305::SaveFile;
+using Loherangrin::Games::O3DEJam2305::SaveScoreRecord;
 using Loherangrin::Games::O3DEJam2305::ScoreComponent;
+using Loherangrin::Games::O3DEJam2305::ScoreLedger;
 
 
 void ScoreComponent::Reflect(AZ::ReflectContext* io_context)
@@ -70,78 +76,144 @@ void ScoreComponent::Activate()
 {
 	GameNotificationBus::Handler::BusConnect();
 	CollectablesNotificationBus::Handler::BusConnect();
+	SaveGameNotificationBus::Handler::BusConnect();
 	TilesNotificationBus::Handler::BusConnect();
+	ScoreRequestBus::Handler::BusConnect();
 }
 
 void ScoreComponent::Deactivate()
 {
-	TilesNotificationBus::Handler::BusConnect();
+	CancelPayout();
+	m_isPayoutPaused = false;
+
+	ScoreRequestBus::Handler::BusDisconnect();
+	TilesNotificationBus::Handler::BusDisconnect();
+	SaveGameNotificationBus::Handler::BusDisconnect();
 	CollectablesNotificationBus::Handler::BusDisconnect();
 	GameNotificationBus::Handler::BusDisconnect();
 }
 
-void ScoreComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint i_time)
+ScoreComponent::TotalPoints ScoreComponent::GetTotalPoints()
 {
-	m_timer -= i_deltaTime;
-	if(m_timer > 0.f)
-	{
-		return;
-	}
-
-	while(m_timer < 0.f)
-	{
-		m_timer += m_tileTimerPeriod;
-	}
+	m_ledger.Settle(GetNow());
 
-	m_totalPoints += CalculateAllTilePoints();
-
-	EBUS_EVENT(ScoreNotificationBus, OnScoreChanged, m_totalPoints);
+	return m_ledger.GetTotalPoints();
 }
 
 void ScoreComponent::OnGameLoading()
 {
-	AZ::TickBus::Handler::BusDisconnect();
+	CancelPayout();
+	m_isPayoutPaused = false;
 
-	m_totalPoints = 0;
-	m_nClaimedTiles = 0;
+	m_ledger.Configure(m_claimedTilePoints, static_cast<ScoreLedger::TimeMs>(m_tileTimerPeriod * 1000.f));
+	m_ledger.Start(GetNow());
 
-	EBUS_EVENT(ScoreNotificationBus, OnScoreChanged, m_totalPoints);
+	EBUS_EVENT(ScoreNotificationBus, OnScoreChanged, m_ledger.GetTotalPoints());
 	NotifyClaimedTiles();
 }
 
 void ScoreComponent::OnGamePaused()
 {
-	AZ::TickBus::Handler::BusDisconnect();
+	const ScoreLedger::TimeMs now = GetNow();
+
+	m_ledger.Pause(now);
+
+	// the game clock goes on during the pause, so the pending payout keeps the time it had left instead
+	if(m_isPayoutScheduled)
+	{
+		m_pausedPayoutDelay = (m_nextPayoutTime > now) ? (m_nextPayoutTime - now) : 0;
+		m_isPayoutPaused = true;
+
+		CancelPayout();
+	}
 }
 
 void ScoreComponent::OnGameResumed()
 {
-	if(m_nClaimedTiles > 0)
+	m_ledger.Resume(GetNow());
+
+	if(m_isPayoutPaused)
 	{
-		AZ::TickBus::Handler::BusConnect();
+		m_isPayoutPaused = false;
+		SchedulePayout(m_pausedPayoutDelay);
+	}
+	else if(!m_isPayoutScheduled && m_ledger.GetClaimedTiles() > 0)
+	{
+		SchedulePayout(m_ledger.GetTilePeriod());
 	}
 }
 
 void ScoreComponent::OnGameEnded()
 {
-	AZ::TickBus::Handler::BusDisconnect();
+	CancelPayout();
+	m_isPayoutPaused = false;
+
+	m_ledger.Stop(GetNow());
+
+	EBUS_EVENT(ScoreNotificationBus, OnScoreChanged, m_ledger.GetTotalPoints());
+}
+
+void ScoreComponent::OnStageTick([[maybe_unused]] float i_deltaTime)
+{
+	if(m_isPayoutScheduled && GetNow() >= m_nextPayoutTime)
+	{
+		m_isPayoutScheduled = false;
+		OnPayout();
+	}
+
+	if(!m_isPayoutScheduled)
+	{
+		GameplayStageNotificationBus::Handler::BusDisconnect();
+	}
+}
+
+void ScoreComponent::OnGameSaving(SaveFile& io_file)
+{
+	SaveScoreRecord score;
+	m_ledger.Save(GetNow(), score);
+
+	io_file.SetScore(score);
+}
+
+void ScoreComponent::OnGameRestored(const SaveFile& i_file)
+{
+	// the tiles claimed while restoring went through the ledger as well, so it is replaced only once they all are
+	CancelPayout();
+	m_isPayoutPaused = false;
+
+	m_ledger.Restore(i_file.GetScore(), GetNow());
+
+	// a game saved from the pause menu is restored running
+	if(!m_ledger.IsIntegrating())
+	{
+		m_ledger.Resume(GetNow());
+	}
+
+	if(m_ledger.GetClaimedTiles() > 0)
+	{
+		SchedulePayout(m_ledger.GetTilePeriod());
+	}
+
+	EBUS_EVENT(ScoreNotificationBus, OnScoreChanged, m_ledger.GetTotalPoints());
+	NotifyClaimedTiles();
 }
 
 void ScoreComponent::OnPointsCollected(Points i_points)
 {
-	m_totalPoints += i_points;
+	m_ledger.AddPoints(i_points);
 
-	EBUS_EVENT(ScoreNotificationBus, OnScoreChanged, m_totalPoints);
+	EBUS_EVENT(ScoreNotificationBus, OnScoreChanged, m_ledger.GetTotalPoints());
 }
 
 void ScoreComponent::OnTileClaimed([[maybe_unused]] const AZ::EntityId& i_tileEntityId)
 {
-	++m_nClaimedTiles;
+	GAME_PROFILE_SCOPE(SCORE, "ScoreComponent::OnTileClaimed");
 
-	if(!AZ::TickBus::Handler::BusIsConnected())
+	m_ledger.ClaimTile(GetNow());
+
+	if(m_ledger.IsIntegrating() && !m_isPayoutScheduled)
 	{
-		AZ::TickBus::Handler::BusConnect();
-		m_timer = m_tileTimerPeriod;
+		SchedulePayout(m_ledger.GetTilePeriod());
 	}
 
 	NotifyClaimedTiles();
@@ -149,27 +221,60 @@ void ScoreComponent::OnTileClaimed([[maybe_unused]] const AZ::EntityId& i_tileEn
 
 void ScoreComponent::OnTileLost([[maybe_unused]] const AZ::EntityId& i_tileEntityId)
 {
-	if(m_nClaimedTiles == 0)
+	GAME_PROFILE_SCOPE(SCORE, "ScoreComponent::OnTileLost");
+
+	if(!m_ledger.LoseTile(GetNow()))
 	{
 		return;
 	}
 
-	--m_nClaimedTiles;
+	NotifyClaimedTiles();
+}
 
-	if(m_nClaimedTiles == 0)
+void ScoreComponent::SchedulePayout(ScoreLedger::TimeMs i_delay)
+{
+	m_nextPayoutTime = GetNow() + i_delay;
+	m_isPayoutScheduled = true;
+
+	// the stage only runs while a payout is pending
+	if(!GameplayStageNotificationBus::Handler::BusIsConnected())
 	{
-		AZ::TickBus::Handler::BusDisconnect();
+		GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::SCORE);
 	}
+}
 
-	NotifyClaimedTiles();
+void ScoreComponent::CancelPayout()
+{
+	m_isPayoutScheduled = false;
+
+	GameplayStageNotificationBus::Handler::BusDisconnect();
 }
 
-ScoreComponent::Points ScoreComponent::CalculateAllTilePoints() const
+void ScoreComponent::OnPayout()
 {
-	return (static_cast<Points>(m_nClaimedTiles) * m_claimedTilePoints);
+	GAME_PROFILE_SCOPE(SCORE, "ScoreComponent::OnPayout");
+
+	m_ledger.Settle(GetNow());
+
+	EBUS_EVENT(ScoreNotificationBus, OnScoreChanged, m_ledger.GetTotalPoints());
+
+	// the last payout settles the fraction earned after the final tile was lost
+	if(m_ledger.GetClaimedTiles() > 0)
+	{
+		SchedulePayout(m_ledger.GetTilePeriod());
+	}
+}
+
+ScoreLedger::TimeMs ScoreComponent::GetNow() const
+{
+	// the game clock only moves with the stage ticks, so a playback at a fixed time step pays out at the same ticks
+	double gameTime { 0.0 };
+	EBUS_EVENT_RESULT(gameTime, GameplaySchedulerRequestBus, GetGameTime);
+
+	return static_cast<ScoreLedger::TimeMs>(gameTime * 1000.0);
 }
 
 void ScoreComponent::NotifyClaimedTiles() const
 {
-	EBUS_EVENT(ScoreNotificationBus, OnClaimedTilesChanged, m_nClaimedTiles + 1);
+	EBUS_EVENT(ScoreNotificationBus, OnClaimedTilesChanged, m_ledger.GetClaimedTiles() + 1);
 }
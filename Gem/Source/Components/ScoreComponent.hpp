@@ -17,10 +17,12 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
-#include <AzCore/Component/TickBus.h>
 
+#include "../Core/ScoreLedger.hpp"
 #include "../EBuses/CollectableBus.hpp"
 #include "../EBuses/GameBus.hpp"
+#include "../EBuses/GameplayBus.hpp"
+#include "../EBuses/SaveGameBus.hpp"
 #include "../EBuses/ScoreBus.hpp"
 #include "../EBuses/TileBus.hpp"
 
@@ -29,9 +31,11 @@ namespace Loherangrin::Games::O3DEJam2305
 {
 	class ScoreComponent
 		: public AZ::Component
-		, protected AZ::TickBus::Handler
+		, protected ScoreRequestBus::Handler
 		, protected CollectablesNotificationBus::Handler
 		, protected GameNotificationBus::Handler
+		, protected GameplayStageNotificationBus::Handler
+		, protected SaveGameNotificationBus::Handler
 		, protected TilesNotificationBus::Handler
 	{
 	public:
@@ -48,8 +52,8 @@ namespace Loherangrin::Games::O3DEJam2305
 		void Activate() override;
 		void Deactivate() override;
 
-		// AZ::TickBus
-		void OnTick(float i_deltaTime, AZ::ScriptTimePoint i_time) override;
+		// ScoreRequestBus
+		TotalPoints GetTotalPoints() override;
 
 		// CollectablesNotificationBus
 		void OnPointsCollected(Points i_points) override;
@@ -60,24 +64,38 @@ namespace Loherangrin::Games::O3DEJam2305
 		void OnGameResumed() override;
 		void OnGameEnded() override;
 
+		// GameplayStageNotificationBus
+		void OnStageTick(float i_deltaTime) override;
+
+		// SaveGameNotificationBus
+		void OnGameSaving(SaveFile& io_file) override;
+		void OnGameRestored(const SaveFile& i_file) override;
+
 		// TilesNotificationBus
 		void OnTileClaimed(const AZ::EntityId& i_tileEntityId) override;
 		void OnTileLost(const AZ::EntityId& i_tileEntityId) override;
 
 	private:
 		using Points = CollectablesNotifications::Points;
-		using TotalPoints = ScoreNotifications::TotalPoints;
 
-		Points CalculateAllTilePoints() const;
+		void SchedulePayout(ScoreLedger::TimeMs i_delay);
+		void CancelPayout();
+		void OnPayout();
+
+		ScoreLedger::TimeMs GetNow() const;
+
 		void NotifyClaimedTiles() const;
 
-		TotalPoints m_totalPoints { 0 };
+		ScoreLedger m_ledger {};
 
 		Points m_claimedTilePoints { 1 };
-		TileCount m_nClaimedTiles { 0 };
-
 		float m_tileTimerPeriod { 5.f };
-		float m_timer { -1.f };
+
+		ScoreLedger::TimeMs m_nextPayoutTime { 0 };
+		bool m_isPayoutScheduled { false };
+
+		ScoreLedger::TimeMs m_pausedPayoutDelay { 0 };
+		bool m_isPayoutPaused { false };
 	};
 
 } // Loherangrin::Games::O3DEJam2305
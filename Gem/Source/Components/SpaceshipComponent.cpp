@@ -16,21 +16,26 @@
 
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Math/Crc.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/Serialization/SerializeContext.h>
 
 #include <AzFramework/Input/Devices/Keyboard/InputDeviceKeyboard.h>
-#include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 #include <AzFramework/Physics/CharacterBus.h>
-#include <AzFramework/Physics/Character.h>
-#include <AzFramework/Physics/CollisionBus.h>
-#include <AzFramework/Physics/PhysicsScene.h>
 
+#include "../Core/SaveFile.hpp"
 #include "../EBuses/GameBus.hpp"
+#include "../Utils/GameMetrics.hpp"
 #include "SpaceshipComponent.hpp"
 
+using Loherangrin::Games::O3DEJam2305::SaveFile;
+using Loherangrin::Games::O3DEJam2305::SaveSpaceshipRecord;
 using Loherangrin::Games::O3DEJam2305::SpaceshipComponent;
+using Loherangrin::Games::O3DEJam2305::SpaceshipRules;
+using Loherangrin::Games::O3DEJam2305::SpaceshipSettings;
+using Loherangrin::Games::O3DEJam2305::SpaceshipTransition;
 using Loherangrin::Games::O3DEJam2305::TileId;
 
 
@@ -41,6 +46,7 @@ void SpaceshipComponent::Reflect(AZ::ReflectContext* io_context)
 		serializeContext->Class<SpaceshipComponent, AZ::Component>()
 			->Version(0)
 			->Field("Mesh", &SpaceshipComponent::m_meshEntityId)
+			->Field("Player", &SpaceshipComponent::m_isPlayer)
 			->Field("SpeedMove", &SpaceshipComponent::m_moveSpeed)
 			->Field("SpeedTurn", &SpaceshipComponent::m_turnSpeed)
 			->Field("SpeedLift", &SpaceshipComponent::m_liftSpeed)
@@ -49,6 +55,7 @@ void SpaceshipComponent::Reflect(AZ::ReflectContext* io_context)
 			->Field("EnergyMax", &SpaceshipComponent::m_maxEnergy)
 			->Field("EnergyConsumption", &SpaceshipComponent::m_consumptionRate)
 			->Field("EnergyRecharge", &SpaceshipComponent::m_rechargeRate)
+			->Field("EnergyNotification", &SpaceshipComponent::m_energyNotificationQuantum)
 			->Field("EnergyMin", &SpaceshipComponent::m_lowEnergyThreshold)
 			->Field("SpeedLow", &SpaceshipComponent::m_lowEnergySpeedMultiplier)
 		;
@@ -61,6 +68,7 @@ void SpaceshipComponent::Reflect(AZ::ReflectContext* io_context)
 					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
 
 				->DataElement(AZ::Edit::UIHandlers::Default, &SpaceshipComponent::m_meshEntityId, "Mesh", "")
+				->DataElement(AZ::Edit::UIHandlers::Default, &SpaceshipComponent::m_isPlayer, "Player", "Controlled by keyboard and bound to the HUD. Game ends when its energy runs out")
 
 				->ClassElement(AZ::Edit::ClassElements::Group, "Speed")
 					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
@@ -81,6 +89,7 @@ void SpaceshipComponent::Reflect(AZ::ReflectContext* io_context)
 					->DataElement(AZ::Edit::UIHandlers::Default, &SpaceshipComponent::m_maxEnergy, "Max", "")
 					->DataElement(AZ::Edit::UIHandlers::Default, &SpaceshipComponent::m_consumptionRate, "Consumption", "")
 					->DataElement(AZ::Edit::UIHandlers::Default, &SpaceshipComponent::m_rechargeRate, "Recharge", "")
+					->DataElement(AZ::Edit::UIHandlers::Default, &SpaceshipComponent::m_energyNotificationQuantum, "Notification", "Minimum change of normalized energy before listeners are notified")
 
 				->ClassElement(AZ::Edit::ClassElements::Group, "Energy Saving Mode")
 					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
@@ -118,28 +127,44 @@ void SpaceshipComponent::Init()
 
 void SpaceshipComponent::Activate()
 {
-	EBUS_EVENT_RESULT(m_tileCollisionGroup, Physics::CollisionRequestBus, GetCollisionGroupByName, AZStd::string { COLLISION_GROUPS_ALL_TILES });
+	const AZ::EntityId thisEntityId = GetEntityId();
+
+	EBUS_EVENT_ID_RESULT(m_startTranslation, thisEntityId, AZ::TransformBus, GetWorldTranslation);
+
+	m_energyNotifier.Configure(GameSubsystem::SPACESHIPS, m_energyNotificationQuantum, { m_lowEnergyThreshold / m_maxEnergy }, [thisEntityId](float i_normalizedEnergy)
+	{
+		EBUS_EVENT_ID(thisEntityId, SpaceshipNotificationBus, OnSpaceshipEnergyChanged, i_normalizedEnergy);
+	});
 
 	AZ::EntityBus::Handler::BusConnect(m_meshEntityId);
 
 	GameNotificationBus::Handler::BusConnect();
+	SaveGameNotificationBus::Handler::BusConnect();
 
 	CollectablesNotificationBus::Handler::BusConnect();
-	SpaceshipRequestBus::Handler::BusConnect();
+	SpaceshipRequestBus::Handler::BusConnect(thisEntityId);
+
+	EBUS_EVENT(SpaceshipsNotificationBus, OnSpaceshipRegistered, thisEntityId);
 }
 
 void SpaceshipComponent::Deactivate()
 {
+	EBUS_EVENT(SpaceshipsNotificationBus, OnSpaceshipUnregistered, GetEntityId());
+
 	SpaceshipRequestBus::Handler::BusDisconnect();
 
-	CollectablesNotificationBus::Handler::BusConnect();
+	CollectablesNotificationBus::Handler::BusDisconnect();
 	TileNotificationBus::Handler::BusDisconnect();
 
+	SaveGameNotificationBus::Handler::BusDisconnect();
 	GameNotificationBus::Handler::BusDisconnect();
 
+	ReplayInputNotificationBus::Handler::BusDisconnect();
 	InputChannelEventListener::Disconnect();
 	AZ::EntityBus::Handler::BusDisconnect();
-	AZ::TickBus::Handler::BusDisconnect();
+	GameplayStageNotificationBus::Handler::BusDisconnect();
+
+	m_energyNotifier.Cancel();
 }
 
 void SpaceshipComponent::OnEntityActivated(const AZ::EntityId& i_entityId)
@@ -156,10 +181,10 @@ void SpaceshipComponent::OnEntityActivated(const AZ::EntityId& i_entityId)
 
 void SpaceshipComponent::OnGameCreated()
 {
-	m_speedMultiplier = SPEEDS_MENU_LIFT_ANIMATION;
+	m_state.m_speedMultiplier = SPEEDS_MENU_LIFT_ANIMATION;
 	m_liftDirection = 1.f;
 
-	AZ::TickBus::Handler::BusConnect();
+	GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::SPACESHIPS);
 }
 
 void SpaceshipComponent::OnGameLoading()
@@ -168,11 +193,13 @@ void SpaceshipComponent::OnGameLoading()
 	ResetPosition();
 	ResetState();
 
-	EBUS_EVENT(SpaceshipNotificationBus, OnTakeOffStarted);
-	EBUS_EVENT(SpaceshipNotificationBus, OnTakeOffEnded);
+	const AZ::EntityId thisEntityId = GetEntityId();
+
+	EBUS_EVENT_ID(thisEntityId, SpaceshipNotificationBus, OnTakeOffStarted);
+	EBUS_EVENT_ID(thisEntityId, SpaceshipNotificationBus, OnTakeOffEnded);
 
-	EBUS_EVENT(SpaceshipNotificationBus, OnEnergySavingModeDeactivated);
-	EBUS_EVENT(SpaceshipNotificationBus, OnSpaceshipEnergyChanged, m_energy / m_maxEnergy);
+	EBUS_EVENT_ID(thisEntityId, SpaceshipNotificationBus, OnEnergySavingModeDeactivated);
+	m_energyNotifier.Publish(m_state.m_energy / m_maxEnergy);
 }
 
 void SpaceshipComponent::OnGameStarted()
@@ -183,13 +210,19 @@ void SpaceshipComponent::OnGameStarted()
 void SpaceshipComponent::OnGamePaused()
 {
 	InputChannelEventListener::Disconnect();
-	AZ::TickBus::Handler::BusDisconnect();
+	ReplayInputNotificationBus::Handler::BusDisconnect();
+	GameplayStageNotificationBus::Handler::BusDisconnect();
 }
 
 void SpaceshipComponent::OnGameResumed()
 {
-	AZ::TickBus::Handler::BusConnect();
-	InputChannelEventListener::Connect();
+	GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::SPACESHIPS);
+
+	if(m_isPlayer)
+	{
+		InputChannelEventListener::Connect();
+		ReplayInputNotificationBus::Handler::BusConnect();
+	}
 }
 		
 void SpaceshipComponent::OnGameEnded()
@@ -203,14 +236,110 @@ void SpaceshipComponent::OnGameDestroyed()
 	ResetPosition();
 	ResetState();
 
-	m_speedMultiplier = SPEEDS_MENU_LIFT_ANIMATION;
+	m_state.m_speedMultiplier = SPEEDS_MENU_LIFT_ANIMATION;
 	m_liftDirection = -1.f;
 
-	AZ::TickBus::Handler::BusConnect();
+	GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::SPACESHIPS);
 }
 
-void SpaceshipComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint i_time)
+void SpaceshipComponent::OnGameSaving(SaveFile& io_file)
 {
+	const AZ::EntityId thisEntityId = GetEntityId();
+
+	AZ::Transform thisTransform { AZ::Transform::CreateIdentity() };
+	EBUS_EVENT_ID_RESULT(thisTransform, thisEntityId, AZ::TransformBus, GetWorldTM);
+
+	const AZ::Vector3 position = thisTransform.GetTranslation();
+	const AZ::Quaternion rotation = thisTransform.GetRotation();
+
+	SaveSpaceshipRecord record;
+	record.m_nameCrc = GetNameCrc();
+	record.m_targetTileId = static_cast<AZ::u32>(GetTileIdIfClaimed());
+	record.m_position[0] = position.GetX();
+	record.m_position[1] = position.GetY();
+	record.m_position[2] = position.GetZ();
+	record.m_rotation[0] = rotation.GetX();
+	record.m_rotation[1] = rotation.GetY();
+	record.m_rotation[2] = rotation.GetZ();
+	record.m_rotation[3] = rotation.GetW();
+	record.m_energy = m_state.m_energy;
+	record.m_speedMultiplier = m_state.m_speedMultiplier;
+	record.m_speedTimer = m_state.m_speedTimer;
+	record.m_flags =
+		((IsGrounded() || m_liftDirection < 0.f) ? SaveSpaceshipRecord::FLAG_LANDED : 0) |
+		((m_isPlayer) ? SaveSpaceshipRecord::FLAG_PLAYER : 0) |
+		((!SpaceshipRules::IsDepleted(m_state)) ? SaveSpaceshipRecord::FLAG_ACTIVE : 0)
+	;
+
+	io_file.AddSpaceship(record);
+}
+
+void SpaceshipComponent::OnGameRestoring(const SaveFile& i_file)
+{
+	const SaveSpaceshipRecord* record = i_file.FindSpaceship(GetNameCrc());
+	if(!record)
+	{
+		AZ_Warning("Spaceship", false, "Spaceship %s was not saved, it starts from the beginning", GetEntity()->GetName().c_str());
+		return;
+	}
+
+	const AZ::EntityId thisEntityId = GetEntityId();
+
+	const AZ::Vector3 position { record->m_position[0], record->m_position[1], record->m_position[2] };
+	const AZ::Quaternion rotation { record->m_rotation[0], record->m_rotation[1], record->m_rotation[2], record->m_rotation[3] };
+
+	EBUS_EVENT_ID(thisEntityId, Physics::CharacterRequestBus, SetBasePosition, position);
+	EBUS_EVENT_ID(thisEntityId, AZ::TransformBus, SetWorldRotationQuaternion, rotation.GetNormalized());
+
+	m_state.m_energy = record->m_energy;
+	m_state.m_speedMultiplier = record->m_speedMultiplier;
+	m_state.m_speedTimer = record->m_speedTimer;
+
+	if(IsLowEnergy())
+	{
+		EBUS_EVENT_ID(thisEntityId, SpaceshipNotificationBus, OnEnergySavingModeActivated);
+	}
+
+	m_energyNotifier.Publish(m_state.m_energy / m_maxEnergy);
+
+	if((record->m_flags & SaveSpaceshipRecord::FLAG_ACTIVE) == 0)
+	{
+		ResetInput();
+
+		GameplayStageNotificationBus::Handler::BusDisconnect();
+	}
+}
+
+void SpaceshipComponent::OnGameRestored(const SaveFile& i_file)
+{
+	const SaveSpaceshipRecord* record = i_file.FindSpaceship(GetNameCrc());
+	if(!record || (record->m_flags & SaveSpaceshipRecord::FLAG_ACTIVE) == 0 || (record->m_flags & SaveSpaceshipRecord::FLAG_LANDED) == 0)
+	{
+		return;
+	}
+
+	// landing areas are known to be claimed only once every tile is restored
+	const TileId landingTileId = GetTileIdIfClaimed();
+	if(landingTileId == INVALID_TILE_ID)
+	{
+		return;
+	}
+
+	// the spaceship is put down at once, as the tile it was landed on might be lost before any landing ends
+
+	Land(landingTileId);
+
+	m_liftParameter = 0.f;
+	m_liftDirection = 0.f;
+
+	EBUS_EVENT_ID(m_meshEntityId, AZ::TransformBus, SetLocalZ, m_minHeight);
+	EBUS_EVENT_ID(GetEntityId(), SpaceshipNotificationBus, OnLandingEnded);
+}
+
+void SpaceshipComponent::OnStageTick(float i_deltaTime)
+{
+	GAME_PROFILE_SCOPE(SPACESHIPS, "SpaceshipComponent::OnStageTick");
+
 	if(IsGrounded())
 	{
 		RechargeEnergy(i_deltaTime);
@@ -234,26 +363,52 @@ void SpaceshipComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTi
 
 bool SpaceshipComponent::OnInputChannelEventFiltered(const AzFramework::InputChannel& i_inputChannel)
 {
-	const AzFramework::InputChannelId& channelId = i_inputChannel.GetInputChannelId();
-	const float channelValue = i_inputChannel.GetValue();
+	// a replayed game is only driven by the recorded inputs
+	bool isReplayPlaying { false };
+	EBUS_EVENT_RESULT(isReplayPlaying, ReplayRequestBus, IsPlaying);
+
+	if(isReplayPlaying)
+	{
+		return false;
+	}
+
+	const AZ::Crc32 channel = i_inputChannel.GetInputChannelId().GetNameCrc32();
+	const AzFramework::InputChannel::State state = i_inputChannel.GetState();
+	const float value = i_inputChannel.GetValue();
+
+	if(!ProcessInput(channel, state, value))
+	{
+		return false;
+	}
+
+	EBUS_EVENT(ReplayRequestBus, RecordInput, channel, static_cast<AZ::u8>(state), value);
+
+	return true;
+}
+
+void SpaceshipComponent::OnReplayInput(AZ::Crc32 i_channel, AZ::u8 i_state, float i_value)
+{
+	ProcessInput(i_channel, static_cast<AzFramework::InputChannel::State>(i_state), i_value);
+}
 
+bool SpaceshipComponent::ProcessInput(AZ::Crc32 i_channel, AzFramework::InputChannel::State i_state, float i_value)
+{
 	// MoveBackward
-	if(channelId == AzFramework::InputDeviceKeyboard::Key::AlphanumericS)
+	if(i_channel == AzFramework::InputDeviceKeyboard::Key::AlphanumericS.GetNameCrc32())
 	{
 		if(IsGrounded())
 		{
 			return false;
 		}
 
-		m_moveDirection = -channelValue;
+		m_moveDirection = -i_value;
 	}
 	// MoveForward
-	else if(channelId == AzFramework::InputDeviceKeyboard::Key::AlphanumericW)
+	else if(i_channel == AzFramework::InputDeviceKeyboard::Key::AlphanumericW.GetNameCrc32())
 	{
 		if(IsGrounded())
 		{
-			const AzFramework::InputChannel::State inputState = i_inputChannel.GetState();
-			if(inputState != AzFramework::InputChannel::State::Began)
+			if(i_state != AzFramework::InputChannel::State::Began)
 			{
 				return false;
 			}
@@ -261,40 +416,28 @@ bool SpaceshipComponent::OnInputChannelEventFiltered(const AzFramework::InputCha
 			m_liftDirection = 1.f;
 		}
 
-		m_moveDirection = channelValue;
+		m_moveDirection = i_value;
 	}
 	// TurnLeft
-	else if(channelId == AzFramework::InputDeviceKeyboard::Key::AlphanumericA)
+	else if(i_channel == AzFramework::InputDeviceKeyboard::Key::AlphanumericA.GetNameCrc32())
 	{
-		m_turnDirection = channelValue;
+		m_turnDirection = i_value;
 	}
 	// TurnRight
-	else if(channelId == AzFramework::InputDeviceKeyboard::Key::AlphanumericD)
+	else if(i_channel == AzFramework::InputDeviceKeyboard::Key::AlphanumericD.GetNameCrc32())
 	{
-		m_turnDirection = -channelValue;
+		m_turnDirection = -i_value;
 	}
 	// TakeOff / Land
-	else if(channelId == AzFramework::InputDeviceKeyboard::Key::AlphanumericE)
+	else if(i_channel == AzFramework::InputDeviceKeyboard::Key::AlphanumericE.GetNameCrc32())
 	{
-		const AzFramework::InputChannel::State inputState = i_inputChannel.GetState();
-		if(inputState == AzFramework::InputChannel::State::Began)
+		if(i_state == AzFramework::InputChannel::State::Began)
 		{
-			if(IsGrounded())
-			{
-				TakeOff();
-			}
-			else
-			{
-				const TileId overedTileId = GetTileIdIfClaimed();
-				if(overedTileId != INVALID_TILE_ID)
-				{
-					Land(overedTileId);
-				}
-			}
+			ToggleLanding();
 		}		
 	}
 	// Pause
-	else if(channelId == AzFramework::InputDeviceKeyboard::Key::AlphanumericP)
+	else if(i_channel == AzFramework::InputDeviceKeyboard::Key::AlphanumericP.GetNameCrc32())
 	{
 		EBUS_EVENT(GameNotificationBus, OnGamePaused);
 	}
@@ -314,7 +457,7 @@ bool SpaceshipComponent::ApplyHorizontalTranslation(const AZ::Transform& i_trans
 	}
 
 	const AZ::Vector3& forwardAxis = i_transform.GetBasisY();
-	const AZ::Vector3 linearVelocity = forwardAxis * (m_moveDirection * m_speedMultiplier * m_moveSpeed);
+	const AZ::Vector3 linearVelocity = forwardAxis * (m_moveDirection * m_state.m_speedMultiplier * m_moveSpeed);
 
 	EBUS_EVENT_ID(GetEntityId(), Physics::CharacterRequestBus, AddVelocityForTick, linearVelocity);
 
@@ -328,21 +471,21 @@ void SpaceshipComponent::ApplyVerticalTranslation(float i_deltaTime)
 		return;
 	}
 	
-	m_liftParameter += m_liftDirection * m_speedMultiplier * m_liftSpeed * i_deltaTime;
+	m_liftParameter += m_liftDirection * m_state.m_speedMultiplier * m_liftSpeed * i_deltaTime;
 
 	if(m_liftParameter < 0.f)
 	{
 		m_liftParameter = 0.f;
 		m_liftDirection = 0.f;
 
-		EBUS_EVENT(SpaceshipNotificationBus, OnLandingEnded);
+		EBUS_EVENT_ID(GetEntityId(), SpaceshipNotificationBus, OnLandingEnded);
 	}
 	else if(m_liftParameter > 1.f)
 	{
 		m_liftParameter = 1.f;
 		m_liftDirection = 0.f;
 
-		EBUS_EVENT(SpaceshipNotificationBus, OnTakeOffEnded);
+		EBUS_EVENT_ID(GetEntityId(), SpaceshipNotificationBus, OnTakeOffEnded);
 	}
 
 	const float height = AZ::Lerp(m_minHeight, m_maxHeight, m_liftParameter);
@@ -364,43 +507,13 @@ void SpaceshipComponent::ApplyRotation(const AZ::Transform& i_transform, float i
 
 TileId SpaceshipComponent::GetTileIdIfClaimed() const
 {
-	Physics::Character* character { nullptr };
-	EBUS_EVENT_ID_RESULT(character, GetEntityId(), Physics::CharacterRequestBus, GetCharacter);
-	
-	AZ_Assert(character, "Collider cannot be null");
-
-	AzPhysics::OverlapRequest overlapRequest = AzPhysics::OverlapRequestHelpers::CreateSphereOverlapRequest
-	(
-		character->GetAabb().GetXExtent(),
-		AZ::Transform::CreateTranslation(character->GetBasePosition())
-	);
-	overlapRequest.m_collisionGroup = m_tileCollisionGroup;
-	overlapRequest.m_queryType = AzPhysics::SceneQuery::QueryType::Static;
-
-	AzPhysics::Scene* physicsScene = character->GetScene();
-	const AzPhysics::SceneQueryHits result = physicsScene->QueryScene(&overlapRequest);
-
-	for(const AzPhysics::SceneQueryHit& hit : result.m_hits)
-	{
-		bool isClaimed { false };
-		EBUS_EVENT_ID_RESULT(isClaimed, hit.m_entityId, TileRequestBus, IsClaimed);
+	AZ::Vector3 position { AZ::Vector3::CreateZero() };
+	EBUS_EVENT_ID_RESULT(position, GetEntityId(), AZ::TransformBus, GetWorldTranslation);
 
-		if(isClaimed)
-		{
-			bool isLandingArea { false };
-			EBUS_EVENT_ID_RESULT(isLandingArea, hit.m_entityId, TileRequestBus, IsLandingArea);
+	TileId tileId { INVALID_TILE_ID };
+	EBUS_EVENT_RESULT(tileId, TilesRequestBus, FindLandingAreaAt, position, true);
 
-			if(isLandingArea)
-			{
-				TileId tileId { 0 };
-				EBUS_EVENT_ID_RESULT(tileId, hit.m_entityId, TileRequestBus, GetTileId);
-
-				return tileId;
-			}
-		}
-	}
-
-	return INVALID_TILE_ID;
+	return tileId;
 }
 
 void SpaceshipComponent::TakeOff()
@@ -409,7 +522,7 @@ void SpaceshipComponent::TakeOff()
 
 	m_liftDirection = 1.f;
 
-	EBUS_EVENT(SpaceshipNotificationBus, OnTakeOffStarted);
+	EBUS_EVENT_ID(GetEntityId(), SpaceshipNotificationBus, OnTakeOffStarted);
 }
 
 void SpaceshipComponent::Land(TileId i_tileId)
@@ -418,7 +531,42 @@ void SpaceshipComponent::Land(TileId i_tileId)
 
 	TileNotificationBus::Handler::BusConnect(i_tileId);
 
-	EBUS_EVENT(SpaceshipNotificationBus, OnLandingStarted);
+	EBUS_EVENT_ID(GetEntityId(), SpaceshipNotificationBus, OnLandingStarted);
+}
+
+bool SpaceshipComponent::ToggleLanding()
+{
+	if(IsGrounded())
+	{
+		TakeOff();
+
+		return true;
+	}
+
+	const TileId overedTileId = GetTileIdIfClaimed();
+	if(overedTileId == INVALID_TILE_ID)
+	{
+		return false;
+	}
+
+	Land(overedTileId);
+
+	return true;
+}
+
+void SpaceshipComponent::Move(float i_direction)
+{
+	if(IsGrounded())
+	{
+		return;
+	}
+
+	m_moveDirection = AZStd::clamp(i_direction, -1.f, 1.f);
+}
+
+void SpaceshipComponent::Turn(float i_direction)
+{
+	m_turnDirection = AZStd::clamp(i_direction, -1.f, 1.f);
 }
 
 void SpaceshipComponent::OnTileLost()
@@ -431,9 +579,29 @@ bool SpaceshipComponent::IsGrounded() const
 	return (m_liftParameter < AZ::Constants::FloatEpsilon);
 }
 
+AZ::EntityId SpaceshipComponent::GetSpaceshipId() const
+{
+	return GetEntityId();
+}
+
+bool SpaceshipComponent::IsPlayer() const
+{
+	return m_isPlayer;
+}
+
+bool SpaceshipComponent::IsLanded() const
+{
+	return IsGrounded();
+}
+
+float SpaceshipComponent::GetNormalizedEnergy() const
+{
+	return (m_state.m_energy / m_maxEnergy);
+}
+
 bool SpaceshipComponent::IsLowEnergy() const
 {
-	return (m_energy > 0.f && m_energy < m_lowEnergyThreshold);
+	return SpaceshipRules::IsLowEnergy(GetSettings(), m_state);
 }
 
 void SpaceshipComponent::SubtractEnergy(float i_energy)
@@ -443,83 +611,89 @@ void SpaceshipComponent::SubtractEnergy(float i_energy)
 
 void SpaceshipComponent::AddEnergy(float i_energy)
 {
-	const bool wasLowEnergy = IsLowEnergy();
+	const SpaceshipTransition transition = SpaceshipRules::AddEnergy(GetSettings(), m_state, i_energy);
+	if(transition == SpaceshipTransition::ENERGY_SAVING_ACTIVATED)
+	{
+		EBUS_EVENT_ID(GetEntityId(), SpaceshipNotificationBus, OnEnergySavingModeActivated);
+	}
+	else if(transition == SpaceshipTransition::ENERGY_SAVING_DEACTIVATED)
+	{
+		EBUS_EVENT_ID(GetEntityId(), SpaceshipNotificationBus, OnEnergySavingModeDeactivated);
+	}
 
-	m_energy = AZStd::clamp(m_energy + i_energy, -1.f, m_maxEnergy);
+	m_energyNotifier.Update(m_state.m_energy / m_maxEnergy);
 
-	const bool isLowEnergy = IsLowEnergy();
-	if(isLowEnergy != wasLowEnergy)
+	if(SpaceshipRules::IsDepleted(m_state))
 	{
-		if(isLowEnergy)
+		if(m_isPlayer)
 		{
-			m_speedMultiplier = AZStd::min(m_lowEnergySpeedMultiplier, m_speedMultiplier);
-
-			EBUS_EVENT(SpaceshipNotificationBus, OnEnergySavingModeActivated);
+			EBUS_EVENT(GameNotificationBus, OnGameEnded);
 		}
 		else
 		{
-			m_speedMultiplier = 1.f;
+			ResetInput();
 
-			EBUS_EVENT(SpaceshipNotificationBus, OnEnergySavingModeDeactivated);
+			GameplayStageNotificationBus::Handler::BusDisconnect();
 		}
 	}
-
-	EBUS_EVENT(SpaceshipNotificationBus, OnSpaceshipEnergyChanged, m_energy / m_maxEnergy);
-
-	if(m_energy < 0.f)
-	{
-		EBUS_EVENT(GameNotificationBus, OnGameEnded);
-	}
 }
 
 void SpaceshipComponent::ConsumeEnergy(float i_deltaTime)
 {
-	if(IsLowEnergy())
+	const float consumption = SpaceshipRules::CalculateConsumption(GetSettings(), m_state, i_deltaTime);
+	if(consumption <= 0.f)
 	{
 		return;
 	}
 
-	const float consumption = m_consumptionRate * i_deltaTime;
 	SubtractEnergy(consumption);
 }
 
 void SpaceshipComponent::RechargeEnergy(float i_deltaTime)
 {
-	if(AZ::IsClose(m_energy, m_maxEnergy, AZ::Constants::FloatEpsilon))
+	const float recharge = SpaceshipRules::CalculateRecharge(GetSettings(), m_state, i_deltaTime);
+	if(recharge <= 0.f)
 	{
 		return;
 	}
 
-	AddEnergy(m_rechargeRate * i_deltaTime);
+	AddEnergy(recharge);
 }
 
-void SpaceshipComponent::OnSpaceshipEnergyCollected(float i_energy)
+AZ::u32 SpaceshipComponent::GetNameCrc() const
 {
-	AddEnergy(i_energy);
+	// entity ids change from a session to another, while names are kept by the prefabs
+	return AZ::Crc32 { GetEntity()->GetName() };
 }
 
-void SpaceshipComponent::OnSpeedCollected(float i_multiplier, float i_duration)
+SpaceshipSettings SpaceshipComponent::GetSettings() const
 {
-	m_speedMultiplier = i_multiplier;
-	m_speedTimer = i_duration;
+	return SpaceshipSettings { m_maxEnergy, m_consumptionRate, m_rechargeRate, m_lowEnergyThreshold, m_lowEnergySpeedMultiplier };
 }
 
-void SpaceshipComponent::ResetSpeedMultiplierOnTimerEnd(float i_deltaTime)
+void SpaceshipComponent::OnSpaceshipEnergyCollected(const AZ::EntityId& i_spaceshipEntityId, float i_energy)
 {
-	if(m_speedTimer < 0.f)
+	if(i_spaceshipEntityId != GetEntityId())
 	{
 		return;
 	}
 
-	m_speedTimer -= i_deltaTime;
+	AddEnergy(i_energy);
+}
 
-	if(m_speedTimer < 0.f)
+void SpaceshipComponent::OnSpeedCollected(const AZ::EntityId& i_spaceshipEntityId, float i_multiplier, float i_duration)
+{
+	if(i_spaceshipEntityId != GetEntityId())
 	{
-		m_speedMultiplier = (IsLowEnergy())
-			? m_lowEnergySpeedMultiplier
-			: 1.f
-		;
+		return;
 	}
+
+	SpaceshipRules::ApplySpeedModifier(m_state, i_multiplier, i_duration);
+}
+
+void SpaceshipComponent::ResetSpeedMultiplierOnTimerEnd(float i_deltaTime)
+{
+	SpaceshipRules::UpdateSpeedModifier(GetSettings(), m_state, i_deltaTime);
 }
 
 void SpaceshipComponent::ResetInput()
@@ -533,13 +707,13 @@ void SpaceshipComponent::ResetPosition()
 {
 	const AZ::EntityId thisEntityId = GetEntityId();
 
-	EBUS_EVENT_ID(thisEntityId, Physics::CharacterRequestBus, SetBasePosition, AZ::Vector3::CreateZero());
+	EBUS_EVENT_ID(thisEntityId, Physics::CharacterRequestBus, SetBasePosition, m_startTranslation);
 	EBUS_EVENT_ID(thisEntityId, AZ::TransformBus, SetWorldRotationQuaternion, AZ::Quaternion::CreateIdentity());
 }
 
 void SpaceshipComponent::ResetState()
 {
-	m_energy = m_maxEnergy;
+	SpaceshipRules::Reset(GetSettings(), m_state);
 
 	if(m_liftParameter < 1.f)
 	{
@@ -547,7 +721,4 @@ void SpaceshipComponent::ResetState()
 
 		EBUS_EVENT_ID(m_meshEntityId, AZ::TransformBus, SetLocalZ, m_maxHeight);
 	}
-
-	m_speedMultiplier = 1.f;
-	m_speedTimer = -1.f;
 }
@@ -18,26 +18,31 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/EntityBus.h>
-#include <AzCore/Component/TickBus.h>
 
 #include <AzFramework/Input/Events/InputChannelEventListener.h>
-#include <AzFramework/Physics/Collision/CollisionGroups.h>
 
+#include "../Core/SpaceshipRules.hpp"
 #include "../EBuses/CollectableBus.hpp"
 #include "../EBuses/GameBus.hpp"
+#include "../EBuses/GameplayBus.hpp"
+#include "../EBuses/ReplayBus.hpp"
+#include "../EBuses/SaveGameBus.hpp"
 #include "../EBuses/SpaceshipBus.hpp"
 #include "../EBuses/TileBus.hpp"
+#include "../Utils/EnergyNotifier.hpp"
 
 
 namespace Loherangrin::Games::O3DEJam2305
 {
 	class SpaceshipComponent
 		: public AZ::Component
-		, protected AZ::TickBus::Handler
 		, protected AZ::EntityBus::Handler
 		, protected AzFramework::InputChannelEventListener
 		, protected CollectablesNotificationBus::Handler
 		, protected GameNotificationBus::Handler
+		, protected GameplayStageNotificationBus::Handler
+		, protected ReplayInputNotificationBus::Handler
+		, protected SaveGameNotificationBus::Handler
 		, protected SpaceshipRequestBus::Handler
 		, protected TileNotificationBus::Handler
 	{
@@ -59,18 +64,31 @@ namespace Loherangrin::Games::O3DEJam2305
 		// AZ::EntityBus
 		void OnEntityActivated(const AZ::EntityId& i_entityId) override;
 
-		// AZ::TickBus
-		void OnTick(float i_deltaTime, AZ::ScriptTimePoint i_time) override;
+		// GameplayStageNotificationBus
+		void OnStageTick(float i_deltaTime) override;
 
 		// AzFramework::InputChannelEventListener
 		bool OnInputChannelEventFiltered(const AzFramework::InputChannel& i_inputChannel) override;
 
+		// ReplayInputNotificationBus
+		void OnReplayInput(AZ::Crc32 i_channel, AZ::u8 i_state, float i_value) override;
+
 		// SpaceshipRequestBus
+		AZ::EntityId GetSpaceshipId() const override;
+		bool IsPlayer() const override;
+
 		void SubtractEnergy(float i_energy) override;
 
+		void Move(float i_direction) override;
+		void Turn(float i_direction) override;
+		bool ToggleLanding() override;
+
+		bool IsLanded() const override;
+		float GetNormalizedEnergy() const override;
+
 		// CollectablesNotificationBus
-		void OnSpaceshipEnergyCollected(float i_energy) override;
-		void OnSpeedCollected(float i_multiplier, float i_duration) override;
+		void OnSpaceshipEnergyCollected(const AZ::EntityId& i_spaceshipEntityId, float i_energy) override;
+		void OnSpeedCollected(const AZ::EntityId& i_spaceshipEntityId, float i_multiplier, float i_duration) override;
 
 		// GameBus
 		void OnGameCreated() override;
@@ -81,6 +99,11 @@ namespace Loherangrin::Games::O3DEJam2305
 		void OnGameEnded() override;
 		void OnGameDestroyed() override;
 
+		// SaveGameNotificationBus
+		void OnGameSaving(SaveFile& io_file) override;
+		void OnGameRestoring(const SaveFile& i_file) override;
+		void OnGameRestored(const SaveFile& i_file) override;
+
 		// TileNotificationBus
 		void OnTileLost() override;
 
@@ -101,8 +124,12 @@ namespace Loherangrin::Games::O3DEJam2305
 		void ConsumeEnergy(float i_deltaTime);
 		void RechargeEnergy(float i_deltaTime);
 
+		SpaceshipSettings GetSettings() const;
+		AZ::u32 GetNameCrc() const;
+
 		void ResetSpeedMultiplierOnTimerEnd(float i_deltaTime);
 
+		bool ProcessInput(AZ::Crc32 i_channel, AzFramework::InputChannel::State i_state, float i_value);
 		void ResetInput();
 		void ResetPosition();
 		void ResetState();
@@ -120,20 +147,20 @@ namespace Loherangrin::Games::O3DEJam2305
 		float m_maxHeight { 2.5f };
 
 		float m_maxEnergy { 100.f };
-		float m_energy { 0.f };
 		float m_consumptionRate { 0.5f };
 		float m_rechargeRate { 5.f };
+		float m_energyNotificationQuantum { 1.f / 256.f };
+		EnergyNotifier m_energyNotifier {};
 
 		float m_lowEnergyThreshold { 15.f };
 		float m_lowEnergySpeedMultiplier { 0.2f };
 
-		float m_speedMultiplier { 1.f };
-		float m_speedTimer { -1.f };
+		SpaceshipState m_state {};
 
-		AZ::EntityId m_meshEntityId {};
-		AzPhysics::CollisionGroup m_tileCollisionGroup {};
+		bool m_isPlayer { true };
+		AZ::Vector3 m_startTranslation { AZ::Vector3::CreateZero() };
 
-		static constexpr const char* COLLISION_GROUPS_ALL_TILES = "AllTiles_Query";
+		AZ::EntityId m_meshEntityId {};
 
 		static constexpr float SPEEDS_MENU_LIFT_ANIMATION = 0.1f;
 	};
@@ -24,11 +24,17 @@
 #include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
 
+#include "../Core/SaveFile.hpp"
+#include "../Core/StormRules.hpp"
 #include "../EBuses/TileBus.hpp"
 #include "../EBuses/SpaceshipBus.hpp"
+#include "../Utils/GameMetrics.hpp"
 #include "StormComponent.hpp"
 
+using Loherangrin::Games::O3DEJam2305::SaveFile;
+using Loherangrin::Games::O3DEJam2305::SaveStormRecord;
 using Loherangrin::Games::O3DEJam2305::StormComponent;
+using Loherangrin::Games::O3DEJam2305::StormRules;
 
 
 void StormComponent::Reflect(AZ::ReflectContext* io_context)
@@ -100,6 +106,8 @@ void StormComponent::Init()
 {
 	m_triggerEnterHandler = AzPhysics::SimulatedBodyEvents::OnTriggerEnter::Handler([this]([[maybe_unused]] AzPhysics::SimulatedBodyHandle i_bodyHandle, const AzPhysics::TriggerEvent& i_trigger)
 	{
+		GAME_PROFILE_SCOPE(STORMS, "StormComponent::OnTriggerEnter");
+
 		if(!i_trigger.m_otherBody)
 		{
 			return;
@@ -116,14 +124,16 @@ void StormComponent::Init()
 				m_hitTileEntityIds.emplace(otherEntityId);
 			}
 		}
-		else
+		else if(SpaceshipRequestBus::HasHandlers(otherEntityId))
 		{
-			m_isSpaceshipHit = true;
+			m_hitSpaceshipEntityIds.emplace(otherEntityId);
 		}
 	});
 
 	m_triggerExitHandler = AzPhysics::SimulatedBodyEvents::OnTriggerExit::Handler([this]([[maybe_unused]] AzPhysics::SimulatedBodyHandle i_bodyHandle, const AzPhysics::TriggerEvent& i_trigger)
 	{
+		GAME_PROFILE_SCOPE(STORMS, "StormComponent::OnTriggerExit");
+
 		if(!i_trigger.m_otherBody)
 		{
 			return;
@@ -136,11 +146,15 @@ void StormComponent::Init()
 		}
 		else
 		{
-			m_isSpaceshipHit = false;
+			m_hitSpaceshipEntityIds.extract(otherEntityId);
 		}
 	});
 
-	m_timer = m_duration;
+	if(m_timer < 0.f)
+	{
+		m_timer = m_duration;
+	}
+
 	m_animationSpeed = AZ::DegToRad(m_animationSpeed);
 }
 
@@ -148,6 +162,7 @@ void StormComponent::Activate()
 {
 	Physics::RigidBodyNotificationBus::Handler::BusConnect(GetEntityId());
 	GameNotificationBus::Handler::BusConnect();
+	SaveGameNotificationBus::Handler::BusConnect();
 }
 
 void StormComponent::OnPhysicsEnabled(const AZ::EntityId& i_entityId)
@@ -169,13 +184,14 @@ void StormComponent::OnPhysicsEnabled(const AZ::EntityId& i_entityId)
 	collider->RegisterOnTriggerEnterHandler(m_triggerEnterHandler);
 	collider->RegisterOnTriggerExitHandler(m_triggerExitHandler);
 
-	AZ::TickBus::Handler::BusConnect();
+	GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::TRANSFERS);
 }
 
 void StormComponent::Deactivate()
 {
+	SaveGameNotificationBus::Handler::BusDisconnect();
 	GameNotificationBus::Handler::BusDisconnect();
-	AZ::TickBus::Handler::BusDisconnect();
+	GameplayStageNotificationBus::Handler::BusDisconnect();
 	Physics::RigidBodyNotificationBus::Handler::BusDisconnect();
 
 	m_triggerEnterHandler.Disconnect();
@@ -184,26 +200,52 @@ void StormComponent::Deactivate()
 
 void StormComponent::OnGamePaused()
 {
-	AZ::TickBus::Handler::BusDisconnect();
+	GameplayStageNotificationBus::Handler::BusDisconnect();
 }
 
 void StormComponent::OnGameResumed()
 {
-	AZ::TickBus::Handler::BusConnect();
+	GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::TRANSFERS);
 }
 
 void StormComponent::OnGameEnded()
 {
-	AZ::TickBus::Handler::BusDisconnect();
+	GameplayStageNotificationBus::Handler::BusDisconnect();
 }
 
-void StormComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint i_time)
-{	
+void StormComponent::OnGameSaving(SaveFile& io_file)
+{
+	if(m_timer < 0.f)
+	{
+		return;
+	}
+
+	AZ::Vector3 position { AZ::Vector3::CreateZero() };
+	EBUS_EVENT_ID_RESULT(position, GetEntityId(), AZ::TransformBus, GetWorldTranslation);
+
+	SaveStormRecord record;
+	record.m_position[0] = position.GetX();
+	record.m_position[1] = position.GetY();
+	record.m_position[2] = position.GetZ();
+	record.m_moveDirection[0] = m_moveDirection.GetX();
+	record.m_moveDirection[1] = m_moveDirection.GetY();
+	record.m_moveSpeed = m_moveSpeed;
+	record.m_strength = m_strength;
+	record.m_duration = m_duration;
+	record.m_timer = m_timer;
+
+	io_file.AddStorm(record);
+}
+
+void StormComponent::OnStageTick(float i_deltaTime)
+{
+	GAME_PROFILE_SCOPE(STORMS, "StormComponent::OnStageTick");
+
 	m_timer -= i_deltaTime;
 
 	if(m_timer < 0.f)
 	{
-		AZ::TickBus::Handler::BusDisconnect();
+		GameplayStageNotificationBus::Handler::BusDisconnect();
 
 		EBUS_EVENT(AzFramework::GameEntityContextRequestBus, DestroyGameEntityAndDescendants, GetEntityId());
 	}
@@ -230,11 +272,11 @@ void StormComponent::PlayAnimation(float i_deltaTime)
 
 void StormComponent::ApplyDamages(float i_deltaTime)
 {
-	const float damage = m_strength * i_deltaTime;
+	const float damage = StormRules::CalculateDamage(m_strength, i_deltaTime);
 
-	if(m_isSpaceshipHit)
+	for(const AZ::EntityId& spaceshipEntityId : m_hitSpaceshipEntityIds)
 	{
-		EBUS_EVENT(SpaceshipRequestBus, SubtractEnergy, damage);
+		EBUS_EVENT_ID(spaceshipEntityId, SpaceshipRequestBus, SubtractEnergy, damage);
 	}
 
 	for(const AZ::EntityId& tileEntityId : m_hitTileEntityIds)
@@ -17,13 +17,16 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
-#include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/set.h>
 
 #include <AzFramework/Physics/Common/PhysicsSimulatedBodyEvents.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
 
 #include "../EBuses/GameBus.hpp"
+#include "../EBuses/GameplayBus.hpp"
+#include "../EBuses/SaveGameBus.hpp"
+#include "../Utils/GameAllocators.hpp"
 
 
 namespace Loherangrin::Games::O3DEJam2305
@@ -32,9 +35,10 @@ namespace Loherangrin::Games::O3DEJam2305
 
 	class StormComponent
 		: public AZ::Component
-		, protected AZ::TickBus::Handler
 		, protected Physics::RigidBodyNotificationBus::Handler
 		, protected GameNotificationBus::Handler
+		, protected GameplayStageNotificationBus::Handler
+		, protected SaveGameNotificationBus::Handler
 	{
 	public:
 		AZ_COMPONENT(StormComponent, "{9486C200-FB68-4508-9173-154832C41611}");
@@ -51,8 +55,8 @@ namespace Loherangrin::Games::O3DEJam2305
 		void Activate() override;
 		void Deactivate() override;
 
-		// AZ::TickBus
-		void OnTick(float i_deltaTime, AZ::ScriptTimePoint i_time) override;
+		// GameplayStageNotificationBus
+		void OnStageTick(float i_deltaTime) override;
 
 		// Physics::RigidBodyNotificationBus
 		void OnPhysicsEnabled(const AZ::EntityId& i_entityId) override;
@@ -62,6 +66,9 @@ namespace Loherangrin::Games::O3DEJam2305
 		void OnGameResumed() override;
 		void OnGameEnded() override;
 
+		// SaveGameNotificationBus
+		void OnGameSaving(SaveFile& io_file) override;
+
 	private:
 		void ApplyMovement(float i_deltaTime);
 		void PlayAnimation(float i_deltaTime);
@@ -76,10 +83,15 @@ namespace Loherangrin::Games::O3DEJam2305
 		float m_animationSpeed { 180.f };
 
 		float m_duration { 0.f };
+
+		// a storm restored from a save file is spawned with its remaining time already set
 		float m_timer { -1.f };
 
-		bool m_isSpaceshipHit { false };
-		AZStd::set<AZ::EntityId> m_hitTileEntityIds {};
+		// storms may be despawned after the session arena was reset, so their lists are freed one by one
+		using HitEntityIds = AZStd::set<AZ::EntityId, AZStd::less<AZ::EntityId>, GameStdAllocator>;
+
+		HitEntityIds m_hitSpaceshipEntityIds {};
+		HitEntityIds m_hitTileEntityIds {};
 
 		AZ::EntityId m_meshEntityId {};
 
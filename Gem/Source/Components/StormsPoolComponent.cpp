@@ -21,10 +21,21 @@
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/Serialization/SerializeContext.h>
 
+#include "../Core/SaveFile.hpp"
+#include "../Core/StormRules.hpp"
+#include "../EBuses/StormBus.hpp"
 #include "../EBuses/TileBus.hpp"
+#include "../Utils/GameMetrics.hpp"
 #include "StormComponent.hpp"
 #include "StormsPoolComponent.hpp"
 
+using Loherangrin::Games::O3DEJam2305::SaveFile;
+using Loherangrin::Games::O3DEJam2305::SavePool;
+using Loherangrin::Games::O3DEJam2305::SavePoolRecord;
+using Loherangrin::Games::O3DEJam2305::SaveStormRecord;
+using Loherangrin::Games::O3DEJam2305::StormParameters;
+using Loherangrin::Games::O3DEJam2305::StormRules;
+using Loherangrin::Games::O3DEJam2305::StormSettings;
 using Loherangrin::Games::O3DEJam2305::StormsPoolComponent;
 
 
@@ -107,21 +118,27 @@ void StormsPoolComponent::Init()
 {
 	m_stormSpawnTicket = AzFramework::EntitySpawnTicket { m_stormPrefab };
 
-	m_randomGenerator.SetSeed(m_randomSeed);
+	m_randomStream.SetSeed(m_randomSeed);
 	m_timer = m_spawnDelay;
 }
 
 void StormsPoolComponent::Activate()
 {
+	GameMetrics::TrackSpawnTicket(GameSubsystem::STORMS, m_stormSpawnTicket);
+
 	GameNotificationBus::Handler::BusConnect();
+	SaveGameNotificationBus::Handler::BusConnect();
 }
 
 void StormsPoolComponent::Deactivate()
 {
+	SaveGameNotificationBus::Handler::BusDisconnect();
 	GameNotificationBus::Handler::BusDisconnect();
-	AZ::TickBus::Handler::BusDisconnect();
+	GameplayStageNotificationBus::Handler::BusDisconnect();
 
 	DestroyAllStorms();
+
+	GameMetrics::UntrackSpawnTicket(m_stormSpawnTicket);
 }
 
 void StormsPoolComponent::OnGameLoading()
@@ -131,17 +148,24 @@ void StormsPoolComponent::OnGameLoading()
 
 void StormsPoolComponent::OnGameStarted()
 {
+	// storms follow the layout they are played on, so that the seed of a layout is enough to replay a whole game
+	AZ::u64 layoutSeed { 0 };
+	EBUS_EVENT_RESULT(layoutSeed, TilesRequestBus, GetLayoutSeed);
+
+	m_randomStream.SetSeed(m_randomSeed ^ layoutSeed);
+	m_timer = m_spawnDelay;
+
 	OnGameResumed();
 }
 
 void StormsPoolComponent::OnGamePaused()
 {
-	AZ::TickBus::Handler::BusDisconnect();
+	GameplayStageNotificationBus::Handler::BusDisconnect();
 }
 
 void StormsPoolComponent::OnGameResumed()
 {
-	AZ::TickBus::Handler::BusConnect();
+	GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::TRANSFERS);
 }
 
 void StormsPoolComponent::OnGameEnded()
@@ -149,8 +173,31 @@ void StormsPoolComponent::OnGameEnded()
 	OnGamePaused();
 }
 
-void StormsPoolComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint i_time)
-{	
+void StormsPoolComponent::OnGameSaving(SaveFile& io_file)
+{
+	// the live storms save themselves, while the pool keeps what decides the next ones
+	io_file.SetPool(SavePool::STORMS, m_randomStream.GetSeed(), m_randomStream.GetCounter(), m_timer);
+}
+
+void StormsPoolComponent::OnGameRestoring(const SaveFile& i_file)
+{
+	if(const SavePoolRecord* pool = i_file.FindPool(SavePool::STORMS))
+	{
+		m_randomStream.SetSeed(pool->m_seed);
+		m_randomStream.SetCounter(pool->m_counter);
+		m_timer = pool->m_timer;
+	}
+
+	for(const SaveStormRecord& storm : i_file.GetStorms())
+	{
+		CreateStorm(&storm);
+	}
+}
+
+void StormsPoolComponent::OnStageTick(float i_deltaTime)
+{
+	GAME_PROFILE_SCOPE(STORMS, "StormsPoolComponent::OnStageTick");
+
 	m_timer -= i_deltaTime;
 
 	if(m_timer > 0.f)
@@ -163,15 +210,20 @@ void StormsPoolComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptT
 		m_timer += m_spawnDelay;
 	}
 
-	CreateStorm();
+	CreateStorm(nullptr);
 }
 
-void StormsPoolComponent::CreateStorm()
+void StormsPoolComponent::CreateStorm(const SaveStormRecord* i_savedStorm)
 {
+	const bool isSaved = (i_savedStorm != nullptr);
+	const SaveStormRecord savedStorm = (isSaved) ? *i_savedStorm : SaveStormRecord {};
+
 	AzFramework::SpawnAllEntitiesOptionalArgs spawnOptions;
 	
-	spawnOptions.m_preInsertionCallback = [this]([[maybe_unused]] AzFramework::EntitySpawnTicket::Id i_spawnTicketId, AzFramework::SpawnableEntityContainerView i_newEntities)
+	spawnOptions.m_preInsertionCallback = [this, isSaved, savedStorm]([[maybe_unused]] AzFramework::EntitySpawnTicket::Id i_spawnTicketId, AzFramework::SpawnableEntityContainerView i_newEntities)
 	{
+		GAME_PROFILE_SCOPE(STORMS, "StormsPoolComponent::CreateStorm (pre-insertion)");
+
 		if(i_newEntities.empty())
 		{
 			AZ_Error("StormsPool", false, "Unable to spawn tiles. Please check if a prefab is assigned");
@@ -180,27 +232,58 @@ void StormsPoolComponent::CreateStorm()
 
 		AZ::Entity* newEntity = *(i_newEntities.begin() + 1);
 		auto newStorm = newEntity->FindComponent<StormComponent>();
-		newStorm->m_duration = GenerateRandomInRange(m_minStormDuration, m_maxStormDuration);
-		newStorm->m_strength = GenerateRandomInRange(m_minStormStrength, m_maxStormStrength);
 
-		newStorm->m_moveDirection = AZ::Vector3
+		if(isSaved)
 		{
-			m_randomGenerator.GetRandomFloat(),
-			m_randomGenerator.GetRandomFloat(),
-			0.f
-		}.GetNormalized();
+			newStorm->m_duration = savedStorm.m_duration;
+			newStorm->m_timer = savedStorm.m_timer;
+			newStorm->m_strength = savedStorm.m_strength;
+
+			newStorm->m_moveDirection = AZ::Vector3 { savedStorm.m_moveDirection[0], savedStorm.m_moveDirection[1], 0.f };
+			newStorm->m_moveSpeed = savedStorm.m_moveSpeed;
 
-		newStorm->m_moveSpeed = GenerateRandomInRange(m_minStormSpeed, m_maxStormSpeed);
+			return;
+		}
+
+		const StormSettings settings { m_minStormDuration, m_maxStormDuration, m_minStormSpeed, m_maxStormSpeed, m_minStormStrength, m_maxStormStrength };
+		const StormParameters storm = StormRules::GenerateStorm(settings, m_randomStream);
+
+		newStorm->m_duration = storm.m_duration;
+		newStorm->m_strength = storm.m_strength;
+
+		newStorm->m_moveDirection = AZ::Vector3 { storm.m_moveDirection.GetX(), storm.m_moveDirection.GetY(), 0.f };
+		newStorm->m_moveSpeed = storm.m_moveSpeed;
 	};
 
-	spawnOptions.m_completionCallback = [this]([[maybe_unused]] AzFramework::EntitySpawnTicket::Id i_spawnTicketId, AzFramework::SpawnableConstEntityContainerView i_newEntities)
+	spawnOptions.m_completionCallback = [this, isSaved, savedStorm](AzFramework::EntitySpawnTicket::Id i_spawnTicketId, AzFramework::SpawnableConstEntityContainerView i_newEntities)
 	{
+		GAME_PROFILE_SCOPE(STORMS, "StormsPoolComponent::CreateStorm (completion)");
+
+		GameMetrics::EndSpawn(i_spawnTicketId, i_newEntities.size());
+
 		if(i_newEntities.empty())
 		{
 			AZ_Error("StormsPool", false, "Unable to spawn tiles. Please check if a prefab is assigned");
 			return;
 		}
 
+		const AZ::Entity* newRootEntity = *(i_newEntities.begin());
+		const AZ::EntityId newRootEntityId = newRootEntity->GetId();
+
+		if(isSaved)
+		{
+			const AZ::Vector3 worldTranslation { savedStorm.m_position[0], savedStorm.m_position[1], savedStorm.m_position[2] };
+
+			// the saved position is the one of the moving storm, which is placed there as well as its root
+			const AZ::Entity* newStormEntity = *(i_newEntities.begin() + 1);
+
+			EBUS_EVENT_ID(newRootEntityId, AZ::TransformBus, SetWorldTranslation, worldTranslation);
+			EBUS_EVENT_ID(newStormEntity->GetId(), AZ::TransformBus, SetWorldTranslation, worldTranslation);
+
+			EBUS_EVENT(StormsNotificationBus, OnStormSpawned, newRootEntityId, worldTranslation);
+			return;
+		}
+
 		AZ::Vector2 halfGridSize { AZ::Vector2::CreateZero() };
 		EBUS_EVENT_RESULT(halfGridSize, TilesRequestBus, GetGridSize);
 
@@ -213,15 +296,15 @@ void StormsPoolComponent::CreateStorm()
 			m_stormHeight
 		};
 
-		const AZ::Entity* newRootEntity = *(i_newEntities.begin());
-		const AZ::EntityId newRootEntityId = newRootEntity->GetId();
-
 		EBUS_EVENT_ID(newRootEntityId, AZ::TransformBus, SetWorldTranslation, worldTranslation);
+
+		EBUS_EVENT(StormsNotificationBus, OnStormSpawned, newRootEntityId, worldTranslation);
 	};
 
 	auto spawnableSystem = AzFramework::SpawnableEntitiesInterface::Get();
     AZ_Assert(spawnableSystem, "Unable to retrieve the main spawnable system");
 
+	GameMetrics::BeginSpawn(m_stormSpawnTicket.GetId());
 	spawnableSystem->SpawnAllEntities(m_stormSpawnTicket, AZStd::move(spawnOptions));
 }
 
@@ -237,5 +320,5 @@ void StormsPoolComponent::DestroyAllStorms()
 
 float StormsPoolComponent::GenerateRandomInRange(float i_min, float i_max)
 {
-	return (i_min + (m_randomGenerator.GetRandomFloat() * (i_max - i_min)));
+	return StormRules::GenerateRandomInRange(m_randomStream, i_min, i_max);
 }
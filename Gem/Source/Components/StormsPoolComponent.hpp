@@ -18,21 +18,25 @@
 
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Component/Component.h>
-#include <AzCore/Component/TickBus.h>
-#include <AzCore/Math/Random.h>
 
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 
+#include "../Core/RandomStream.hpp"
 #include "../EBuses/GameBus.hpp"
+#include "../EBuses/GameplayBus.hpp"
+#include "../EBuses/SaveGameBus.hpp"
 
 
 namespace Loherangrin::Games::O3DEJam2305
 {
+	struct SaveStormRecord;
+
 	class StormsPoolComponent
 		: public AZ::Component
-		, protected AZ::TickBus::Handler
 		, protected GameNotificationBus::Handler
+		, protected GameplayStageNotificationBus::Handler
+		, protected SaveGameNotificationBus::Handler
 	{
 	public:
 		AZ_COMPONENT(StormsPoolComponent, "{C66C7EBA-D5DF-4331-9B67-38123276A580}");
@@ -49,8 +53,8 @@ namespace Loherangrin::Games::O3DEJam2305
 		void Activate() override;
 		void Deactivate() override;
 
-		// AZ::TickBus
-		void OnTick(float i_deltaTime, AZ::ScriptTimePoint i_time) override;
+		// GameplayStageNotificationBus
+		void OnStageTick(float i_deltaTime) override;
 
 		// GameNotificationBus
 		void OnGameLoading() override;
@@ -59,8 +63,13 @@ namespace Loherangrin::Games::O3DEJam2305
 		void OnGameResumed() override;
 		void OnGameEnded() override;
 
+		// SaveGameNotificationBus
+		void OnGameSaving(SaveFile& io_file) override;
+		void OnGameRestoring(const SaveFile& i_file) override;
+
 	private:
-		void CreateStorm();
+		// a saved storm is spawned as it was, otherwise a new one is generated
+		void CreateStorm(const SaveStormRecord* i_savedStorm);
 		void DestroyAllStorms();
 
 		float GenerateRandomInRange(float i_min, float i_max);
@@ -83,7 +92,7 @@ namespace Loherangrin::Games::O3DEJam2305
 		AzFramework::EntitySpawnTicket m_stormSpawnTicket {};
 
 		AZ::u64 m_randomSeed { 1234 };
-		AZ::SimpleLcgRandom m_randomGenerator {};
+		RandomStream m_randomStream { RandomStreamId::STORMS };
 	};
 
  } // Loherangrin::Games::O3DEJam2305
@@ -21,10 +21,18 @@
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/Serialization/SerializeContext.h>
 
+#include "../Core/SaveFile.hpp"
+#include "../Utils/GameMetrics.hpp"
 #include "TileComponent.hpp"
 
+using Loherangrin::Games::O3DEJam2305::SavedTiles;
+using Loherangrin::Games::O3DEJam2305::SaveFile;
 using Loherangrin::Games::O3DEJam2305::TileId;
 using Loherangrin::Games::O3DEJam2305::TileComponent;
+using Loherangrin::Games::O3DEJam2305::TileRules;
+using Loherangrin::Games::O3DEJam2305::TileSettings;
+using Loherangrin::Games::O3DEJam2305::TileState;
+using Loherangrin::Games::O3DEJam2305::TileTransition;
 
 
 void TileComponent::Reflect(AZ::ReflectContext* io_context)
@@ -36,6 +44,7 @@ void TileComponent::Reflect(AZ::ReflectContext* io_context)
 			->Field("Mesh", &TileComponent::m_meshEntityId)
 			->Field("Energy", &TileComponent::m_maxEnergy)
 			->Field("Decay", &TileComponent::m_decaySpeed)
+			->Field("EnergyNotification", &TileComponent::m_energyNotificationQuantum)
 			->Field("ShakeThreshold", &TileComponent::m_alertEnergyThreshold)
 			->Field("ShakeSpeed", &TileComponent::m_shakeSpeed)
 			->Field("ShakeHeight", &TileComponent::m_maxShakeHeight)
@@ -58,6 +67,7 @@ void TileComponent::Reflect(AZ::ReflectContext* io_context)
 
 					->DataElement(AZ::Edit::UIHandlers::Default, &TileComponent::m_maxEnergy, "Max", "")
 					->DataElement(AZ::Edit::UIHandlers::Default, &TileComponent::m_decaySpeed, "Decay", "")
+					->DataElement(AZ::Edit::UIHandlers::Default, &TileComponent::m_energyNotificationQuantum, "Notification", "Minimum change of normalized energy before listeners are notified")
 
 				->ClassElement(AZ::Edit::ClassElements::Group, "Alert")
 					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
@@ -100,7 +110,12 @@ void TileComponent::GetDependentServices([[maybe_unused]] AZ::ComponentDescripto
 
 void TileComponent::Activate()
 {
-	CollectablesNotificationBus::Handler::BusConnect();
+	const AZ::EntityId thisEntityId = GetEntityId();
+
+	m_energyNotifier.Configure(GameSubsystem::TILES, m_energyNotificationQuantum, { m_toggleEnergyThreshold / m_maxEnergy, m_alertEnergyThreshold / m_maxEnergy }, [thisEntityId](float i_normalizedEnergy)
+	{
+		EBUS_EVENT(TilesNotificationBus, OnTileEnergyChanged, thisEntityId, i_normalizedEnergy);
+	});
 
 	AZ::EntityBus::MultiHandler::BusConnect(m_selectionEntityId);
 	if(m_isClaimed)
@@ -108,9 +123,12 @@ void TileComponent::Activate()
 		AZ::EntityBus::MultiHandler::BusConnect(m_meshEntityId);
 	}
 
-	GameNotificationBus::Handler::BusConnect();
-
-	const AZ::EntityId thisEntityId = GetEntityId();
+	if(!m_isStandby)
+	{
+		CollectablesNotificationBus::Handler::BusConnect();
+		GameNotificationBus::Handler::BusConnect();
+		SaveGameNotificationBus::Handler::BusConnect();
+	}
 
 	TileRequestBus::Handler::BusConnect(thisEntityId);
 }
@@ -120,11 +138,14 @@ void TileComponent::Deactivate()
 	TileRequestBus::Handler::BusDisconnect();
 	TileNotificationBus::MultiHandler::BusDisconnect();
 
+	SaveGameNotificationBus::Handler::BusDisconnect();
 	GameNotificationBus::Handler::BusDisconnect();
-	AZ::TickBus::Handler::BusDisconnect();
+	GameplayStageNotificationBus::Handler::BusDisconnect();
 	AZ::EntityBus::MultiHandler::BusDisconnect();
 
-	CollectablesNotificationBus::Handler::BusConnect();
+	CollectablesNotificationBus::Handler::BusDisconnect();
+
+	m_energyNotifier.Cancel();
 }
 	
 void TileComponent::OnEntityActivated(const AZ::EntityId& i_entityId)
@@ -137,7 +158,7 @@ void TileComponent::OnEntityActivated(const AZ::EntityId& i_entityId)
 
 		if(!m_isLocked)
 		{
-			AZ::TickBus::Handler::BusConnect();
+			GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::TILES);
 		}
 	}
 	else if(i_entityId == m_selectionEntityId)
@@ -146,25 +167,98 @@ void TileComponent::OnEntityActivated(const AZ::EntityId& i_entityId)
 	}
 }
 
+void TileComponent::OnGameLoading()
+{
+	StopReplication();
+}
+
 void TileComponent::OnGamePaused()
 {
-	AZ::TickBus::Handler::BusDisconnect();
+	GameplayStageNotificationBus::Handler::BusDisconnect();
 }
 
 void TileComponent::OnGameResumed()
 {
 	if(m_animation != Animation::NONE || m_energy > 0.f)
 	{
-		AZ::TickBus::Handler::BusConnect();
+		GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::TILES);
 	}
 }
 
 void TileComponent::OnGameEnded()
 {
-	AZ::TickBus::Handler::BusDisconnect();
+	GameplayStageNotificationBus::Handler::BusDisconnect();
+}
+
+void TileComponent::OnGameSaving(SaveFile& io_file)
+{
+	SavedTiles& tiles = io_file.GetTiles();
+	if(m_id >= tiles.GetCount())
+	{
+		return;
+	}
+
+	tiles.m_energies[m_id] = m_energy;
+	tiles.m_noDecayTimers[m_id] = m_noDecayTimer;
+	tiles.m_flags[m_id] = SavedTiles::FLAG_PRESENT |
+		((m_isClaimed) ? SavedTiles::FLAG_CLAIMED : 0) |
+		((m_isLocked) ? SavedTiles::FLAG_LOCKED : 0) |
+		((m_isRecharging) ? SavedTiles::FLAG_RECHARGING : 0)
+	;
+}
+
+void TileComponent::OnGameRestoring(const SaveFile& i_file)
+{
+	const SavedTiles& tiles = i_file.GetTiles();
+	if(m_id >= tiles.GetCount() || (tiles.m_flags[m_id] & SavedTiles::FLAG_PRESENT) == 0)
+	{
+		return;
+	}
+
+	const AZ::u8 flags = tiles.m_flags[m_id];
+	const bool isClaimed = ((flags & SavedTiles::FLAG_CLAIMED) != 0);
+
+	m_energy = AZStd::clamp(tiles.m_energies[m_id], 0.f, m_maxEnergy);
+	m_noDecayTimer = tiles.m_noDecayTimers[m_id];
+	m_isRecharging = ((flags & SavedTiles::FLAG_RECHARGING) != 0);
+	m_isLocked = ((flags & SavedTiles::FLAG_LOCKED) != 0);
+
+	StopAnimation();
+
+	// the tile is turned at once, and its neighbors and listeners are told right away instead of at the end of a flip
+	const AZ::Quaternion rotation = AZ::Quaternion::CreateRotationX((isClaimed) ? 0.f : AZ::Constants::Pi);
+	EBUS_EVENT_ID(m_meshEntityId, AZ::TransformBus, SetLocalRotationQuaternion, rotation);
+
+	if(isClaimed != m_isClaimed)
+	{
+		m_isClaimed = isClaimed;
+
+		if(m_isClaimed)
+		{
+			EBUS_EVENT_ID(m_id, TileNotificationBus, OnTileClaimed);
+			EBUS_EVENT(TilesNotificationBus, OnTileClaimed, GetEntityId());
+		}
+		else
+		{
+			EBUS_EVENT_ID(m_id, TileNotificationBus, OnTileLost);
+			EBUS_EVENT(TilesNotificationBus, OnTileLost, GetEntityId());
+		}
+	}
+
+	if(m_isClaimed && !m_isLocked && m_energy < m_alertEnergyThreshold)
+	{
+		Alert();
+	}
+
+	m_energyNotifier.Update(m_energy / m_maxEnergy);
+
+	if(!m_isLocked && m_energy > 0.f && !GameplayStageNotificationBus::Handler::BusIsConnected())
+	{
+		GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::TILES);
+	}
 }
 
-void TileComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint i_time)
+void TileComponent::OnStageTick(float i_deltaTime)
 {
 	if(m_noDecayTimer > 0.f)
 	{
@@ -175,7 +269,7 @@ void TileComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoi
 	{
 		m_isRecharging = false;
 	}
-	else if(m_noDecayTimer < 0.f)
+	else if(m_noDecayTimer < 0.f && !m_isReplicated)
 	{
 		Decay(i_deltaTime);
 	}
@@ -184,15 +278,18 @@ void TileComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoi
 
 	if(m_animation == Animation::NONE && m_energy < AZ::Constants::FloatEpsilon)
 	{
-		AZ::TickBus::Handler::BusDisconnect();
+		GameplayStageNotificationBus::Handler::BusDisconnect();
 	}
 }
 
-void TileComponent::Decay(float i_deltaTime)
+AZ::u64 TileComponent::GetStageOrder() const
 {
-	const float decayMultiplier = 1.f - static_cast<float>(m_nClaimedNeighbors) / static_cast<float>(MAX_NEIGHBORS);
+	return m_id;
+}
 
-	const float lostEnergy = decayMultiplier * m_decaySpeed * i_deltaTime;
+void TileComponent::Decay(float i_deltaTime)
+{
+	const float lostEnergy = TileRules::CalculateDecay(GetSettings(), m_nClaimedNeighbors, i_deltaTime);
 	SubtractEnergy(lostEnergy);
 }
 
@@ -203,42 +300,54 @@ void TileComponent::SubtractEnergy(float i_amount)
 
 void TileComponent::AddEnergy(float i_amount)
 {
-	if(m_isLocked)
+	if(m_isLocked || m_isReplicated)
 	{
 		return;
 	}
 
-	m_energy = AZStd::clamp(m_energy + i_amount, 0.f, m_maxEnergy);
+	TileState state { m_energy, m_isClaimed };
+	const TileTransition transition = TileRules::AddEnergy(GetSettings(), state, i_amount);
 
-	const bool isAdded = (i_amount > 0.f);
-	if(isAdded)
+	m_energy = state.m_energy;
+
+	if(i_amount > 0.f)
 	{
 		m_isRecharging = true;
-		if(!m_isClaimed && m_energy > m_toggleEnergyThreshold)
+	}
+
+	switch(transition)
+	{
+		case TileTransition::TOGGLE:
 		{
 			Toggle();
 		}
-		else if(m_isClaimed && m_animation == Animation::SHAKE && m_energy > m_alertEnergyThreshold)
+		break;
+
+		case TileTransition::ALERT:
 		{
-			StopShakeAnimation();
+			Alert();
 		}
-	}
-	else
-	{
-		if(m_isClaimed)
+		break;
+
+		case TileTransition::RECOVER:
 		{
-			if(m_energy < m_toggleEnergyThreshold)
-			{
-				Toggle();
-			}
-			else if(m_energy < m_alertEnergyThreshold)
+			if(m_animation == Animation::SHAKE)
 			{
-				Alert();
+				StopShakeAnimation();
 			}
 		}
+		break;
+
+		default:
+		{}
 	}
 
-	EBUS_EVENT(TilesNotificationBus, OnTileEnergyChanged, GetEntityId(), m_energy / m_maxEnergy);
+	m_energyNotifier.Update(m_energy / m_maxEnergy);
+}
+
+TileSettings TileComponent::GetSettings() const
+{
+	return TileSettings { m_maxEnergy, m_decaySpeed, m_toggleEnergyThreshold, m_alertEnergyThreshold };
 }
 
 void TileComponent::Alert()
@@ -254,9 +363,9 @@ void TileComponent::Alert()
 	m_startHeight = -m_maxShakeHeight;
 	m_endHeight = m_maxShakeHeight;
 
-	if(!AZ::TickBus::Handler::BusIsConnected())
+	if(!GameplayStageNotificationBus::Handler::BusIsConnected())
 	{
-		AZ::TickBus::Handler::BusConnect();
+		GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::TILES);
 	}
 }
 
@@ -282,9 +391,9 @@ void TileComponent::Toggle()
 
 	m_isClaimed = !m_isClaimed;
 
-	if(!AZ::TickBus::Handler::BusIsConnected())
+	if(!GameplayStageNotificationBus::Handler::BusIsConnected())
 	{
-		AZ::TickBus::Handler::BusConnect();
+		GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::TILES);
 	}
 }
 
@@ -381,6 +490,12 @@ void TileComponent::StopShakeAnimation()
 
 void TileComponent::RegisterNeighbor(TileId i_tileId)
 {
+	if(m_isStandby)
+	{
+		m_standbyNeighborIds.push_back(i_tileId);
+		return;
+	}
+
 	if(TileNotificationBus::MultiHandler::BusIsConnectedId(i_tileId))
 	{
 		return;
@@ -389,6 +504,27 @@ void TileComponent::RegisterNeighbor(TileId i_tileId)
 	TileNotificationBus::MultiHandler::BusConnect(i_tileId);
 }
 
+void TileComponent::LeaveStandby()
+{
+	if(!m_isStandby)
+	{
+		return;
+	}
+
+	m_isStandby = false;
+
+	CollectablesNotificationBus::Handler::BusConnect();
+	GameNotificationBus::Handler::BusConnect();
+	SaveGameNotificationBus::Handler::BusConnect();
+
+	for(const TileId neighborId : m_standbyNeighborIds)
+	{
+		RegisterNeighbor(neighborId);
+	}
+
+	m_standbyNeighborIds.clear();
+}
+
 TileId TileComponent::GetTileId() const
 {
 	return m_id;
@@ -404,6 +540,11 @@ bool TileComponent::IsLandingArea() const
 	return m_isLandingArea;
 }
 
+bool TileComponent::IsLocked() const
+{
+	return m_isLocked;
+}
+
 void TileComponent::SetSelected(bool i_enabled)
 {
 	bool isSelected { false };
@@ -426,9 +567,37 @@ void TileComponent::SetSelected(bool i_enabled)
 	}
 }
 
+void TileComponent::ApplyReplicatedState(float i_normalizedEnergy, bool i_isClaimed, bool i_isLocked)
+{
+	m_isReplicated = true;
+	m_isLocked = i_isLocked;
+
+	m_energy = AZStd::clamp(i_normalizedEnergy, 0.f, 1.f) * m_maxEnergy;
+
+	if(i_isClaimed != m_isClaimed)
+	{
+		Toggle();
+	}
+	else if(m_isClaimed && m_energy < m_alertEnergyThreshold)
+	{
+		Alert();
+	}
+	else if(m_animation == Animation::SHAKE)
+	{
+		StopAnimation();
+	}
+
+	m_energyNotifier.Update(i_normalizedEnergy);
+}
+
+void TileComponent::StopReplication()
+{
+	m_isReplicated = false;
+}
+
 void TileComponent::OnTileClaimed()
 {
-	if(m_nClaimedNeighbors >= MAX_NEIGHBORS)
+	if(m_nClaimedNeighbors >= TileRules::MAX_NEIGHBORS)
 	{
 		return;
 	}
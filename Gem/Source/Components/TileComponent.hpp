@@ -18,12 +18,16 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/EntityBus.h>
-#include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Quaternion.h>
+#include <AzCore/std/containers/vector.h>
 
+#include "../Core/TileRules.hpp"
 #include "../EBuses/GameBus.hpp"
+#include "../EBuses/GameplayBus.hpp"
 #include "../EBuses/CollectableBus.hpp"
+#include "../EBuses/SaveGameBus.hpp"
 #include "../EBuses/TileBus.hpp"
+#include "../Utils/EnergyNotifier.hpp"
 
 
 namespace Loherangrin::Games::O3DEJam2305
@@ -33,9 +37,10 @@ namespace Loherangrin::Games::O3DEJam2305
 	class TileComponent
 		: public AZ::Component
 		, protected AZ::EntityBus::MultiHandler
-		, protected AZ::TickBus::Handler
 		, protected CollectablesNotificationBus::Handler
 		, protected GameNotificationBus::Handler
+		, protected GameplayStageNotificationBus::Handler
+		, protected SaveGameNotificationBus::Handler
 		, protected TileRequestBus::Handler
 		, protected TileNotificationBus::MultiHandler
 	{
@@ -56,8 +61,9 @@ namespace Loherangrin::Games::O3DEJam2305
 		// AZ::EntityBus
 		void OnEntityActivated(const AZ::EntityId& i_entityId) override;
 
-		// AZ::TickBus
-		void OnTick(float i_deltaTime, AZ::ScriptTimePoint i_time) override;
+		// GameplayStageNotificationBus
+		void OnStageTick(float i_deltaTime) override;
+		AZ::u64 GetStageOrder() const override;
 
 		// TileRequestBus
 		void AddEnergy(float i_amount) override;
@@ -66,9 +72,13 @@ namespace Loherangrin::Games::O3DEJam2305
 		TileId GetTileId() const override;
 		bool IsClaimed() const override;
 		bool IsLandingArea() const override;
+		bool IsLocked() const override;
 
 		void SetSelected(bool i_enabled) override;
 
+		void ApplyReplicatedState(float i_normalizedEnergy, bool i_isClaimed, bool i_isLocked) override;
+		void StopReplication() override;
+
 		// TileNotificationBus
 		void OnTileClaimed() override;
 		void OnTileLost() override;
@@ -78,10 +88,15 @@ namespace Loherangrin::Games::O3DEJam2305
 		void OnTileEnergyCollected(float i_energy) override;
 
 		// GameNotificationBus
+		void OnGameLoading() override;
 		void OnGamePaused() override;
 		void OnGameResumed() override;
 		void OnGameEnded() override;
 
+		// SaveGameNotificationBus
+		void OnGameSaving(SaveFile& io_file) override;
+		void OnGameRestoring(const SaveFile& i_file) override;
+
 	private:
 		enum class Animation : AZ::u8
 		{
@@ -91,8 +106,10 @@ namespace Loherangrin::Games::O3DEJam2305
 		};
 
 		void RegisterNeighbor(TileId i_tileId);
+		void LeaveStandby();
 
 		void Decay(float i_deltaTime);
+		TileSettings GetSettings() const;
 
 		void Alert();
 		void Toggle();
@@ -104,12 +121,17 @@ namespace Loherangrin::Games::O3DEJam2305
 		void StopAnimation();
 		void StopShakeAnimation();
 
+		TileId m_id { INVALID_TILE_ID };
+
 		float m_maxEnergy { 10.f };
 		float m_energy { 0.f };
 
 		float m_toggleEnergyThreshold { 2.5f };
 		float m_alertEnergyThreshold { 3.5f };
 
+		float m_energyNotificationQuantum { 1.f / 256.f };
+		EnergyNotifier m_energyNotifier {};
+
 		float m_decaySpeed { 0.25f };
 		float m_noDecayTimer { -1.f };
 
@@ -117,6 +139,11 @@ namespace Loherangrin::Games::O3DEJam2305
 		bool m_isClaimed { false };
 		bool m_isLocked { false };
 		bool m_isLandingArea { false };
+		bool m_isReplicated { false };
+
+		// tiles of the standby grid share their ids with the active ones, so they stay detached until the grids are swapped
+		bool m_isStandby { false };
+		AZStd::vector<TileId> m_standbyNeighborIds {};
 
 		AZ::u8 m_nClaimedNeighbors { 0 };
 
@@ -137,8 +164,6 @@ namespace Loherangrin::Games::O3DEJam2305
 		AZ::EntityId m_meshEntityId {};
 		AZ::EntityId m_selectionEntityId {};
 
-		static constexpr AZ::u8 MAX_NEIGHBORS = 8;
-
 		friend TilesPoolComponent;
 	};
 
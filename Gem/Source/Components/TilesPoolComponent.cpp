@@ -15,15 +15,29 @@
  */
 
 #include <AzCore/Asset/AssetSerializer.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
 
+#include "../Core/GridRules.hpp"
+#include "../Core/SaveFile.hpp"
+#include "../Utils/GameMetrics.hpp"
 #include "TileComponent.hpp"
 #include "TilesPoolComponent.hpp"
 
+using Loherangrin::Games::O3DEJam2305::GridRules;
+using Loherangrin::Games::O3DEJam2305::LayoutPlan;
+using Loherangrin::Games::O3DEJam2305::SaveFile;
+using Loherangrin::Games::O3DEJam2305::SaveObstacleRecord;
+using Loherangrin::Games::O3DEJam2305::SavePool;
+using Loherangrin::Games::O3DEJam2305::SavePoolRecord;
 using Loherangrin::Games::O3DEJam2305::TileId;
 using Loherangrin::Games::O3DEJam2305::TilesPoolComponent;
 
@@ -44,6 +58,8 @@ void TilesPoolComponent::Reflect(AZ::ReflectContext* io_context)
 			->Field("ObstacleCount", &TilesPoolComponent::m_maxObstacles)
 			->Field("ObstacleSize", &TilesPoolComponent::m_obstacleCellSize)
 			->Field("Obstacles", &TilesPoolComponent::m_obstaclePrefabs)
+			->Field("StandbyOffset", &TilesPoolComponent::m_standbyOffset)
+			->Field("StandbySpawns", &TilesPoolComponent::m_maxStandbySpawnsPerFrame)
 		;
 
 		if(AZ::EditContext* editContext = serializeContext->GetEditContext())
@@ -79,6 +95,12 @@ void TilesPoolComponent::Reflect(AZ::ReflectContext* io_context)
 					->DataElement(AZ::Edit::UIHandlers::Default, &TilesPoolComponent::m_maxObstacles, "Max", "")
 					->DataElement(AZ::Edit::UIHandlers::Default, &TilesPoolComponent::m_obstacleCellSize, "Cell", "")
 					->DataElement(AZ::Edit::UIHandlers::Default, &TilesPoolComponent::m_obstaclePrefabs, "Prefabs", "")
+
+				->ClassElement(AZ::Edit::ClassElements::Group, "Standby")
+					->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+					->DataElement(AZ::Edit::UIHandlers::Default, &TilesPoolComponent::m_standbyOffset, "Offset", "")
+					->DataElement(AZ::Edit::UIHandlers::Default, &TilesPoolComponent::m_maxStandbySpawnsPerFrame, "Spawns per Frame", "")
 			;
 		}
 	}
@@ -107,43 +129,131 @@ void TilesPoolComponent::Init()
 		m_boundarySpawnTickets.emplace_back(AzFramework::EntitySpawnTicket { prefab });
 	}
 
-	for(auto& prefab : m_obstaclePrefabs)
+	for(TileGrid& grid : m_grids)
 	{
-		m_obstacleSpawnTickets.emplace_back(AzFramework::EntitySpawnTicket { prefab });
-	}
-	
-	m_tileSpawnTickets.emplace_back(AzFramework::EntitySpawnTicket { m_landingTilePrefab });
-	for(auto& prefab : m_tilePrefabs)
-	{
-		m_tileSpawnTickets.emplace_back(AzFramework::EntitySpawnTicket { prefab });
+		for(auto& prefab : m_obstaclePrefabs)
+		{
+			grid.m_obstacleSpawnTickets.emplace_back(AzFramework::EntitySpawnTicket { prefab });
+		}
+
+		grid.m_tileSpawnTickets.emplace_back(AzFramework::EntitySpawnTicket { m_landingTilePrefab });
+		for(auto& prefab : m_tilePrefabs)
+		{
+			grid.m_tileSpawnTickets.emplace_back(AzFramework::EntitySpawnTicket { prefab });
+		}
 	}
 
-	m_randomGenerator.SetSeed(m_randomSeed);
+	m_layoutRandomStream.SetSeed(m_randomSeed);
 }
 
 void TilesPoolComponent::Activate()
 {
 	m_gridLength = GRID_LENGTHS_FIRST_ACTIVATION;
 
+	for(auto& spawnTicket : m_boundarySpawnTickets)
+	{
+		GameMetrics::TrackSpawnTicket(GameSubsystem::TILES, spawnTicket);
+	}
+
+	for(TileGrid& grid : m_grids)
+	{
+		for(auto spawnTickets : { &grid.m_obstacleSpawnTickets, &grid.m_tileSpawnTickets })
+		{
+			for(auto& spawnTicket : *spawnTickets)
+			{
+				GameMetrics::TrackSpawnTicket(GameSubsystem::TILES, spawnTicket);
+			}
+		}
+	}
+
 	CreateAllBoundaries();
-	CreateAllTiles(true);
+
+	// the menu background is an empty grid, which doesn't consume any random number
+	PlanLayout(m_activeGrid, m_gridLength, 0, true, false);
+	SpawnPlannedEntities(m_activeGrid, AZStd::numeric_limits<AZStd::size_t>::max());
+
+	EBUS_EVENT(TilesNotificationBus, OnAllTilesCreated);
+
+	// the first layout is prepared while the main menu is shown, so that the game doesn't wait for it when loading
+	PlanNextLayout();
 
 	GameNotificationBus::Handler::BusConnect();
+	SaveGameNotificationBus::Handler::BusConnect();
+	TilesNotificationBus::Handler::BusConnect();
+	TilesRequestBus::Handler::BusConnect();
+	AZ::TickBus::Handler::BusConnect();
 }
 
 void TilesPoolComponent::Deactivate()
 {
+	TilesRequestBus::Handler::BusDisconnect();
+	TilesNotificationBus::Handler::BusDisconnect();
+	SaveGameNotificationBus::Handler::BusDisconnect();
 	GameNotificationBus::Handler::BusDisconnect();
+	AZ::TickBus::Handler::BusDisconnect();
+
+	for(GridIndex i = 0; i < m_grids.size(); ++i)
+	{
+		DestroyGrid(i);
+	}
 
-	DestroyAllObstacles();
-	DestroyAllTiles();
 	DestroyAllBoundaries();
+
+	for(auto& spawnTicket : m_boundarySpawnTickets)
+	{
+		GameMetrics::UntrackSpawnTicket(spawnTicket);
+	}
+
+	for(TileGrid& grid : m_grids)
+	{
+		for(auto spawnTickets : { &grid.m_obstacleSpawnTickets, &grid.m_tileSpawnTickets })
+		{
+			for(const auto& spawnTicket : *spawnTickets)
+			{
+				GameMetrics::UntrackSpawnTicket(spawnTicket);
+			}
+		}
+	}
+}
+
+void TilesPoolComponent::OnGameEnded()
+{
+	// the next layout is prepared while the end menu is shown, so that a retry only needs to swap the grids
+	const TileGrid& standbyGrid = GetStandbyGrid();
+	if(standbyGrid.m_isPlanning || !standbyGrid.m_plan.IsEmpty())
+	{
+		return;
+	}
+
+	PlanNextLayout();
+
+	AZ::TickBus::Handler::BusConnect();
+}
+
+void TilesPoolComponent::OnTick([[maybe_unused]] float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint i_time)
+{
+	GAME_PROFILE_SCOPE(TILES, "TilesPoolComponent::OnTick");
+
+	if(GetStandbyGrid().m_isPlanning)
+	{
+		return;
+	}
+
+	WaitForPlan(GetStandbyGrid());
+
+	const GridIndex standbyGrid = GetStandbyGridIndex();
+	if(SpawnPlannedEntities(standbyGrid, m_maxStandbySpawnsPerFrame))
+	{
+		AZ::TickBus::Handler::BusDisconnect();
+	}
 }
 
 void TilesPoolComponent::OnGameLoading()
 {
-	DestroyAllObstacles();
-	DestroyAllTiles();
+	AZ::TickBus::Handler::BusDisconnect();
+
+	// the UI doesn't load the game before the next layout is ready, so this is only a fallback for any other caller
+	WaitForPlan(GetStandbyGrid());
 
 	if(m_gridLength != m_maxGridLength)
 	{
@@ -153,8 +263,79 @@ void TilesPoolComponent::OnGameLoading()
 		CreateAllBoundaries();
 	}
 
-	const CellIndexesList obstacleIndexes = CreateAllObstacles();
-	CreateAllTiles(false, obstacleIndexes);
+	const GridIndex standbyGrid = GetStandbyGridIndex();
+	if(GetStandbyGrid().m_plan.GetGridLength() != m_gridLength)
+	{
+		DestroyGrid(standbyGrid);
+
+		PlanNextLayout();
+		WaitForPlan(GetStandbyGrid());
+	}
+
+	SpawnPlannedEntities(standbyGrid, AZStd::numeric_limits<AZStd::size_t>::max());
+	SwapGrids();
+}
+
+void TilesPoolComponent::OnGameSaving(SaveFile& io_file)
+{
+	for(const LayoutPlan::Obstacle& obstacle : GetActiveGrid().m_plan.GetObstacles())
+	{
+		SaveObstacleRecord record;
+		record.m_row = obstacle.m_row;
+		record.m_column = obstacle.m_column;
+		record.m_type = static_cast<AZ::u8>(obstacle.m_type);
+
+		io_file.AddObstacle(record);
+	}
+
+	// the seed of the next layout is drawn from this stream
+	io_file.SetPool(SavePool::LAYOUT, m_layoutRandomStream.GetSeed(), m_layoutRandomStream.GetCounter(), 0.f);
+}
+
+void TilesPoolComponent::OnGameRestoring(const SaveFile& i_file)
+{
+	const AZStd::vector<LayoutPlan::Obstacle>& obstacles = GetActiveGrid().m_plan.GetObstacles();
+	const AZStd::span<const SaveObstacleRecord> savedObstacles = i_file.GetObstacles();
+
+	const auto isSameObstacle = [](const LayoutPlan::Obstacle& i_obstacle, const SaveObstacleRecord& i_record)
+	{
+		return (i_obstacle.m_row == i_record.m_row && i_obstacle.m_column == i_record.m_column && i_obstacle.m_type == i_record.m_type);
+	};
+
+	AZ_Warning("TilesPool", AZStd::equal(obstacles.begin(), obstacles.end(), savedObstacles.begin(), savedObstacles.end(), isSameObstacle),
+		"The layout generated from seed %llu does not match the saved obstacles", static_cast<unsigned long long>(GetLayoutSeed()));
+
+	if(const SavePoolRecord* pool = i_file.FindPool(SavePool::LAYOUT))
+	{
+		m_layoutRandomStream.SetSeed(pool->m_seed);
+		m_layoutRandomStream.SetCounter(pool->m_counter);
+	}
+}
+
+bool TilesPoolComponent::IsNextLayoutReady() const
+{
+	const TileGrid& standbyGrid = GetStandbyGrid();
+
+	if(standbyGrid.m_isPlanning || standbyGrid.m_plan.GetGridLength() != m_maxGridLength)
+	{
+		return false;
+	}
+
+	const AZStd::size_t nPlannedSpawns = standbyGrid.m_plan.GetObstacles().size() + standbyGrid.m_plan.GetTiles().size();
+
+	return (standbyGrid.m_nCompletedSpawns == nPlannedSpawns);
+}
+
+void TilesPoolComponent::SetNextLayoutSeed(AZ::u64 i_seed)
+{
+	m_nextLayoutSeed = i_seed;
+	m_hasNextLayoutSeed = true;
+
+	// a layout already prepared for a retry is dropped, and the requested one is prepared in its place
+	DestroyGrid(GetStandbyGridIndex());
+	PlanNextLayout();
+
+	AZ::TickBus::Handler::BusConnect();
 }
 
 AZ::Vector2 TilesPoolComponent::GetGridSize() const
@@ -162,8 +343,251 @@ AZ::Vector2 TilesPoolComponent::GetGridSize() const
 	return (m_tileCellSize * m_gridLength);
 }
 
+AZ::u16 TilesPoolComponent::GetGridLength() const
+{
+	return m_gridLength;
+}
+
+AZ::u64 TilesPoolComponent::GetLayoutSeed() const
+{
+	return GetActiveGrid().m_plan.GetSeed();
+}
+
+AZ::Vector3 TilesPoolComponent::GetTilePosition(TileId i_tileId) const
+{
+	const auto row = static_cast<AZ::u16>(i_tileId / m_gridLength);
+	const auto column = static_cast<AZ::u16>(i_tileId % m_gridLength);
+
+	return CalculateCellPosition(m_gridLength, row, column, m_tileCellSize);
+}
+
+TileId TilesPoolComponent::FindLandingAreaAt(const AZ::Vector3& i_position, bool i_onlyClaimed) const
+{
+	const AZ::Vector2 cellCoordinates = CalculateCellCoordinates(i_position, m_tileCellSize);
+
+	const float row = AZStd::round(cellCoordinates.GetY());
+	const float column = AZStd::round(cellCoordinates.GetX());
+
+	if(row < 0.f || column < 0.f)
+	{
+		return INVALID_TILE_ID;
+	}
+
+	return GetActiveGrid().m_landingAreas.FindLandingArea(static_cast<AZ::u16>(row), static_cast<AZ::u16>(column), i_onlyClaimed);
+}
+
+TileId TilesPoolComponent::FindNearestClaimedLandingArea(const AZ::Vector3& i_position) const
+{
+	const AZ::Vector2 cellCoordinates = CalculateCellCoordinates(i_position, m_tileCellSize);
+
+	return GetActiveGrid().m_landingAreas.FindNearestClaimedLandingArea(cellCoordinates.GetY(), cellCoordinates.GetX());
+}
+
+TileId TilesPoolComponent::FindNearestUnclaimedTile(const AZ::Vector3& i_position) const
+{
+	const AZStd::vector<TileState>& tileStates = GetActiveGrid().m_tileStates;
+	if(tileStates.empty())
+	{
+		return INVALID_TILE_ID;
+	}
+
+	const AZ::Vector2 cellCoordinates = CalculateCellCoordinates(i_position, m_tileCellSize);
+	const float queryRow = cellCoordinates.GetY();
+	const float queryColumn = cellCoordinates.GetX();
+
+	const auto gridLength = static_cast<AZ::s32>(m_gridLength);
+	const auto centerRow = static_cast<AZ::s32>(AZStd::clamp(AZStd::round(queryRow), 0.f, static_cast<float>(gridLength - 1)));
+	const auto centerColumn = static_cast<AZ::s32>(AZStd::clamp(AZStd::round(queryColumn), 0.f, static_cast<float>(gridLength - 1)));
+
+	TileId nearestTileId { INVALID_TILE_ID };
+	float nearestDistanceSq { AZStd::numeric_limits<float>::max() };
+
+	auto visitCell = [&](AZ::s32 i_row, AZ::s32 i_column)
+	{
+		if(i_row < 0 || i_column < 0 || i_row >= gridLength || i_column >= gridLength)
+		{
+			return;
+		}
+
+		const TileId tileId = CalculateTileId(m_gridLength, static_cast<AZ::u16>(i_row), static_cast<AZ::u16>(i_column));
+		if(tileId >= tileStates.size() || tileStates[tileId] != TileState::UNCLAIMED)
+		{
+			return;
+		}
+
+		const float rowOffset = static_cast<float>(i_row) - queryRow;
+		const float columnOffset = static_cast<float>(i_column) - queryColumn;
+		const float distanceSq = rowOffset * rowOffset + columnOffset * columnOffset;
+
+		if(distanceSq < nearestDistanceSq)
+		{
+			nearestDistanceSq = distanceSq;
+			nearestTileId = tileId;
+		}
+	};
+
+	// the query can be outside the grid, so the center cell is not always within half a cell of it
+	const float centerOffset = AZStd::max(AZStd::abs(queryRow - static_cast<float>(centerRow)), AZStd::abs(queryColumn - static_cast<float>(centerColumn)));
+
+	for(AZ::s32 ring = 0; ring < gridLength; ++ring)
+	{
+		if(nearestTileId != INVALID_TILE_ID && ring > 0)
+		{
+			const float minRingDistance = AZStd::max(static_cast<float>(ring) - centerOffset, 0.f);
+			if(nearestDistanceSq <= minRingDistance * minRingDistance)
+			{
+				break;
+			}
+		}
+
+		if(ring == 0)
+		{
+			visitCell(centerRow, centerColumn);
+			continue;
+		}
+
+		for(AZ::s32 column = centerColumn - ring; column <= centerColumn + ring; ++column)
+		{
+			visitCell(centerRow - ring, column);
+			visitCell(centerRow + ring, column);
+		}
+
+		for(AZ::s32 row = centerRow - ring + 1; row < centerRow + ring; ++row)
+		{
+			visitCell(row, centerColumn - ring);
+			visitCell(row, centerColumn + ring);
+		}
+	}
+
+	return nearestTileId;
+}
+
+AZ::Vector3 TilesPoolComponent::GetFlowDirectionToTile(const AZ::Vector3& i_position, TileId i_targetTileId)
+{
+	if(i_targetTileId >= GetActiveGrid().m_plan.GetObstacleCells().size())
+	{
+		return AZ::Vector3::CreateZero();
+	}
+
+	const FlowField& flowField = GetFlowField(i_targetTileId, AZStd::span<const TileId> { &i_targetTileId, 1 });
+
+	return CalculateFlowDirection(flowField, i_position);
+}
+
+AZ::Vector3 TilesPoolComponent::GetFlowDirectionToLandingArea(const AZ::Vector3& i_position)
+{
+	const FlowField& flowField = (m_flowFields.contains(FLOW_FIELDS_LANDING_AREAS))
+		? GetFlowField(FLOW_FIELDS_LANDING_AREAS, {})
+		: GetFlowField(FLOW_FIELDS_LANDING_AREAS, GetActiveGrid().m_landingAreas.GetClaimedLandingAreas())
+	;
+
+	return CalculateFlowDirection(flowField, i_position);
+}
+
+const Loherangrin::Games::O3DEJam2305::FlowField& TilesPoolComponent::GetFlowField(FlowFieldKey i_key, AZStd::span<const TileId> i_targetTileIds)
+{
+	++m_flowFieldsClock;
+
+	auto it = m_flowFields.find(i_key);
+	if(it != m_flowFields.end())
+	{
+		it->second.m_lastUse = m_flowFieldsClock;
+
+		return it->second.m_field;
+	}
+
+	if(m_flowFields.size() >= FLOW_FIELDS_MAX_CACHED)
+	{
+		auto oldestIt = m_flowFields.begin();
+		for(auto candidateIt = m_flowFields.begin(); candidateIt != m_flowFields.end(); ++candidateIt)
+		{
+			if(candidateIt->second.m_lastUse < oldestIt->second.m_lastUse)
+			{
+				oldestIt = candidateIt;
+			}
+		}
+
+		m_flowFields.erase(oldestIt);
+	}
+
+	CachedFlowField& cachedFlowField = m_flowFields[i_key];
+	cachedFlowField.m_field.Build(m_gridLength, GetActiveGrid().m_plan.GetObstacleCells(), i_targetTileIds);
+	cachedFlowField.m_lastUse = m_flowFieldsClock;
+
+	return cachedFlowField.m_field;
+}
+
+AZ::Vector3 TilesPoolComponent::CalculateFlowDirection(const FlowField& i_flowField, const AZ::Vector3& i_position) const
+{
+	const TileId tileId = CalculateTileIdAt(i_position);
+
+	const TileId nextTileId = i_flowField.GetNextCell(tileId);
+	if(nextTileId == INVALID_TILE_ID || nextTileId == tileId)
+	{
+		return AZ::Vector3::CreateZero();
+	}
+
+	AZ::Vector3 offset = GetTilePosition(nextTileId) - i_position;
+	offset.SetZ(0.f);
+
+	return offset.GetNormalizedSafe();
+}
+
+void TilesPoolComponent::InvalidateFlowFields()
+{
+	m_flowFields.clear();
+}
+
+TileId TilesPoolComponent::CalculateTileIdAt(const AZ::Vector3& i_position) const
+{
+	const AZ::Vector2 cellCoordinates = CalculateCellCoordinates(i_position, m_tileCellSize);
+
+	const float row = AZStd::round(cellCoordinates.GetY());
+	const float column = AZStd::round(cellCoordinates.GetX());
+
+	if(row < 0.f || column < 0.f || row >= m_gridLength || column >= m_gridLength)
+	{
+		return INVALID_TILE_ID;
+	}
+
+	return CalculateTileId(m_gridLength, static_cast<AZ::u16>(row), static_cast<AZ::u16>(column));
+}
+
+void TilesPoolComponent::OnTileClaimed(const AZ::EntityId& i_tileEntityId)
+{
+	UpdateTileState(i_tileEntityId, true);
+}
+
+void TilesPoolComponent::OnTileLost(const AZ::EntityId& i_tileEntityId)
+{
+	UpdateTileState(i_tileEntityId, false);
+}
+
+
+void TilesPoolComponent::UpdateTileState(const AZ::EntityId& i_tileEntityId, bool i_isClaimed)
+{
+	TileGrid& grid = GetActiveGrid();
+
+	auto it = grid.m_tileEntityIds.find(i_tileEntityId);
+	if(it == grid.m_tileEntityIds.end())
+	{
+		return;
+	}
+
+	const TileId tileId = it->second;
+	grid.m_tileStates[tileId] = (i_isClaimed) ? TileState::CLAIMED : TileState::UNCLAIMED;
+
+	if(grid.m_landingAreas.SetClaimed(tileId, i_isClaimed))
+	{
+		m_flowFields.erase(FLOW_FIELDS_LANDING_AREAS);
+	}
+}
+
 void TilesPoolComponent::CreateAllBoundaries()
 {
+	// boundaries only depend on the pool seed, so they don't shift the seeds of the following layouts
+	m_boundaryRandomStream.SetSeed(m_randomSeed);
+
 	const AZ::Vector2 halfGridSize = GetGridSize() / 2.f;
 	const AZ::Vector2 halfBoundaryCellSize = m_boundaryCellSize / 2.f;
 
@@ -225,12 +649,16 @@ void TilesPoolComponent::CreateAllBoundaries()
 
 void TilesPoolComponent::CreateBoundary(const AZ::Vector3& i_translation)
 {
-	const AZStd::size_t boundaryType = m_randomGenerator.Getu64Random() % m_boundarySpawnTickets.size();
+	const AZStd::size_t boundaryType = m_boundaryRandomStream.GetRandomBounded(static_cast<AZ::u32>(m_boundarySpawnTickets.size()));
 
 	AzFramework::SpawnAllEntitiesOptionalArgs spawnOptions;
 
-	spawnOptions.m_completionCallback = [i_translation]([[maybe_unused]] AzFramework::EntitySpawnTicket::Id i_spawnTicketId, AzFramework::SpawnableConstEntityContainerView i_newEntities)
+	spawnOptions.m_completionCallback = [i_translation](AzFramework::EntitySpawnTicket::Id i_spawnTicketId, AzFramework::SpawnableConstEntityContainerView i_newEntities)
 	{
+		GAME_PROFILE_SCOPE(TILES, "TilesPoolComponent::CreateBoundary (completion)");
+
+		GameMetrics::EndSpawn(i_spawnTicketId, i_newEntities.size());
+
 		if(i_newEntities.empty())
 		{
 			AZ_Error("TilesPool", false, "Unable to spawn boundaries. Please check if prefabs are assigned");
@@ -246,135 +674,194 @@ void TilesPoolComponent::CreateBoundary(const AZ::Vector3& i_translation)
 	auto spawnableSystem = AzFramework::SpawnableEntitiesInterface::Get();
     AZ_Assert(spawnableSystem, "Unable to retrieve the main spawnable system");
 
+	GameMetrics::BeginSpawn(m_boundarySpawnTickets[boundaryType].GetId());
 	spawnableSystem->SpawnAllEntities(m_boundarySpawnTickets[boundaryType], AZStd::move(spawnOptions));
 }
 
-TilesPoolComponent::CellIndexesList TilesPoolComponent::CreateAllObstacles()
+void TilesPoolComponent::PlanLayout(GridIndex i_gridIndex, AZ::u16 i_gridLength, AZ::u64 i_seed, bool i_forceEmptyTiles, bool i_isInBackground)
 {
-	const float rowScale = m_tileCellSize.GetY() / m_obstacleCellSize.GetY();
-	const float columnScale = m_tileCellSize.GetX() / m_obstacleCellSize.GetX();
+	TileGrid& grid = m_grids[i_gridIndex];
+	WaitForPlan(grid);
+
+	LayoutPlan::Settings settings;
+	settings.m_gridLength = i_gridLength;
+	settings.m_maxObstacles = (i_forceEmptyTiles) ? 0 : m_maxObstacles;
+	settings.m_obstacleCellSize = m_obstacleCellSize;
+	settings.m_tileCellSize = m_tileCellSize;
+	settings.m_nObstacleTypes = m_obstaclePrefabs.size();
+	settings.m_nTileTypes = m_tilePrefabs.size() + 1;
+	settings.m_forceEmptyTiles = i_forceEmptyTiles;
+
+	grid.m_nRequestedSpawns = 0;
+	grid.m_nCompletedSpawns = 0;
+
+	grid.m_tileStates.assign(i_gridLength * i_gridLength, TileState::NONE);
+	grid.m_tileEntityIds.clear();
+	grid.m_landingAreas.Reset(i_gridLength);
+	grid.m_standbyPlacements.clear();
+
+	AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+	if(!i_isInBackground || !jobContext)
+	{
+		grid.m_plan.Generate(settings, i_seed, jobContext);
+		return;
+	}
 
-	const float invertedRowScale = 1.f / rowScale;
-	const float invertedColumnScale = 1.f / columnScale;
+	// the largest layouts take several frames to plan, so the main thread goes on and spawns the grid once its plan is ready
+	grid.m_isPlanning = true;
+	grid.m_planCompletion = AZStd::make_unique<AZ::JobCompletion>(jobContext);
 
-	const auto nObstacleRows = static_cast<AZ::u16>(rowScale * m_gridLength);
-	const auto nObstacleColumns = static_cast<AZ::u16>(columnScale * m_gridLength);	
+	AZ::Job* planJob = AZ::CreateJobFunction([&grid, settings, i_seed, jobContext]()
+	{
+		grid.m_plan.Generate(settings, i_seed, jobContext);
+		grid.m_isPlanning = false;
+	}, true, jobContext);
+
+	planJob->SetDependent(grid.m_planCompletion.get());
+	planJob->Start();
+}
+
+void TilesPoolComponent::PlanNextLayout()
+{
+	// each layout is generated from its own seed, so that it can be identified and reproduced
+	const AZ::u64 layoutSeed = (m_hasNextLayoutSeed) ? m_nextLayoutSeed : m_layoutRandomStream.Getu64Random();
+	m_layoutRandomStream.SetSeed(layoutSeed);
+
+	m_hasNextLayoutSeed = false;
 
-	CellIndexesList obstacleCellIndexes {};
-	for(AZ::u16 i = 0, nAttempts = 0; i < m_maxObstacles;)
+	// the next layout is always played on the largest grid, even while the smaller one of the menu is active
+	PlanLayout(GetStandbyGridIndex(), m_maxGridLength, layoutSeed, false, true);
+}
+
+void TilesPoolComponent::WaitForPlan(TileGrid& io_grid)
+{
+	if(!io_grid.m_planCompletion)
 	{
-		const AZ::u16 obstacleRow = m_randomGenerator.Getu64Random() % nObstacleRows;
-		const AZ::u16 obstacleColumn = m_randomGenerator.Getu64Random() % nObstacleColumns;
+		return;
+	}
 
-		if(obstacleRow == nObstacleRows / 2 && obstacleColumn == nObstacleColumns / 2)
-		{
-			++nAttempts;
-			if(nAttempts > m_maxObstacles)
-			{
-				return obstacleCellIndexes;
-			}
+	GAME_PROFILE_SCOPE(TILES, "TilesPoolComponent::WaitForPlan");
 
-			continue;
-		}
+	io_grid.m_planCompletion->StartAndWaitForCompletion();
+	io_grid.m_planCompletion.reset();
+}
+
+bool TilesPoolComponent::SpawnPlannedEntities(GridIndex i_gridIndex, AZStd::size_t i_maxSpawns)
+{
+	TileGrid& grid = m_grids[i_gridIndex];
+
+	const AZStd::vector<LayoutPlan::Obstacle>& obstacles = grid.m_plan.GetObstacles();
+	const AZStd::vector<LayoutPlan::Tile>& tiles = grid.m_plan.GetTiles();
 
-		CreateObstacle(obstacleRow, obstacleColumn);
+	const AZStd::size_t nPlannedSpawns = obstacles.size() + tiles.size();
 
-		const auto tileRow = static_cast<AZ::u16>(static_cast<float>(obstacleRow) * invertedRowScale);
-		const auto tileColumn = static_cast<AZ::u16>(static_cast<float>(obstacleColumn) * invertedColumnScale);
+	for(AZStd::size_t i = 0; i < i_maxSpawns && grid.m_nRequestedSpawns < nPlannedSpawns; ++i)
+	{
+		const AZStd::size_t spawnIndex = grid.m_nRequestedSpawns++;
 
-		for(AZ::u16 j = 0; j < static_cast<AZ::u16>(invertedRowScale); ++j)
+		if(spawnIndex < obstacles.size())
 		{
-			for(AZ::u16 k = 0; k < static_cast<AZ::u16>(invertedColumnScale); ++k)
-			{
-				obstacleCellIndexes.emplace(AZStd::make_pair(tileRow + j, tileColumn + k));
-			}
+			CreateObstacle(i_gridIndex, obstacles[spawnIndex]);
+		}
+		else
+		{
+			CreateTile(i_gridIndex, tiles[spawnIndex - obstacles.size()]);
 		}
-
-		nAttempts = 0;
-		++i;
 	}
 
-	return obstacleCellIndexes;
+	return (grid.m_nRequestedSpawns == nPlannedSpawns);
 }
 
-void TilesPoolComponent::CreateObstacle(AZ::u16 i_row, AZ::u16 i_column)
+void TilesPoolComponent::CreateObstacle(GridIndex i_gridIndex, const LayoutPlan::Obstacle& i_obstacle)
 {
-	const AZStd::size_t obstacleType = m_randomGenerator.Getu64Random() % m_obstacleSpawnTickets.size();
+	TileGrid& grid = m_grids[i_gridIndex];
 
 	AzFramework::SpawnAllEntitiesOptionalArgs spawnOptions;
 
-	spawnOptions.m_completionCallback = [this, i_row, i_column]([[maybe_unused]] AzFramework::EntitySpawnTicket::Id i_spawnTicketId, AzFramework::SpawnableConstEntityContainerView i_newEntities)
+	spawnOptions.m_completionCallback = [this, i_gridIndex, generation = grid.m_generation, gridLength = grid.m_plan.GetGridLength(), i_obstacle](AzFramework::EntitySpawnTicket::Id i_spawnTicketId, AzFramework::SpawnableConstEntityContainerView i_newEntities)
 	{
+		GAME_PROFILE_SCOPE(TILES, "TilesPoolComponent::CreateObstacle (completion)");
+
+		GameMetrics::EndSpawn(i_spawnTicketId, i_newEntities.size());
+
 		if(i_newEntities.empty())
 		{
 			AZ_Error("TilesPool", false, "Unable to spawn obstacles. Please check if prefabs are assigned");
 			return;
 		}
 
-		const AZ::Vector3 obstacleTranslation = CalculateCellPosition(i_row, i_column, m_obstacleCellSize);
+		TileGrid& grid = m_grids[i_gridIndex];
+		if(grid.m_generation != generation)
+		{
+			return;
+		}
+
+		++grid.m_nCompletedSpawns;
+
+		const AZ::Vector3 obstacleTranslation = CalculateCellPosition(gridLength, i_obstacle.m_row, i_obstacle.m_column, m_obstacleCellSize);
 
 		const AZ::Entity* newRootEntity = *(i_newEntities.begin());
 		const AZ::EntityId newRootEntityId = newRootEntity->GetId();
 
-		EBUS_EVENT_ID(newRootEntityId, AZ::TransformBus, SetLocalTranslation, obstacleTranslation);
+		if(IsStandby(i_gridIndex))
+		{
+			grid.m_standbyPlacements.push_back({ newRootEntityId, AZ::EntityId {}, obstacleTranslation });
+
+			EBUS_EVENT_ID(newRootEntityId, AZ::TransformBus, SetLocalTranslation, obstacleTranslation + m_standbyOffset);
+		}
+		else
+		{
+			EBUS_EVENT_ID(newRootEntityId, AZ::TransformBus, SetLocalTranslation, obstacleTranslation);
+		}
 	};
 
 	auto spawnableSystem = AzFramework::SpawnableEntitiesInterface::Get();
     AZ_Assert(spawnableSystem, "Unable to retrieve the main spawnable system");
 
-	spawnableSystem->SpawnAllEntities(m_obstacleSpawnTickets[obstacleType], AZStd::move(spawnOptions));
+	GameMetrics::BeginSpawn(grid.m_obstacleSpawnTickets[i_obstacle.m_type].GetId());
+	spawnableSystem->SpawnAllEntities(grid.m_obstacleSpawnTickets[i_obstacle.m_type], AZStd::move(spawnOptions));
 }
 
-void TilesPoolComponent::CreateAllTiles(bool i_forceEmptyTiles, const CellIndexesList& i_ignoredCellIndexes)
+void TilesPoolComponent::CreateTile(GridIndex i_gridIndex, const LayoutPlan::Tile& i_tile)
 {
-	const AZ::u16 halfLength = m_gridLength / 2;
-
-	for(AZ::u16 i = 0; i < m_gridLength; ++i)
-	{
-		const bool isCenterRow = (i == halfLength);
-		
-		for(AZ::u16 j = 0; j < m_gridLength; ++j)
-		{
-			if(i_ignoredCellIndexes.contains(AZStd::make_pair(i, j)))
-			{
-				continue;
-			}
-
-			const bool isCenterColumn = (j == halfLength);
-
-			CreateTile(i, j, isCenterRow && isCenterColumn, i_forceEmptyTiles);
-		}
-	}
-
-	EBUS_EVENT(TilesNotificationBus, OnAllTilesCreated);
-}
-
-void TilesPoolComponent::CreateTile(AZ::u16 i_row, AZ::u16 i_column, bool i_isStart, bool i_forceEmpty)
-{
-	const AZStd::size_t tileType = (i_isStart)
-		? TILE_TYPES_LANDING_AREA
-		: ((i_forceEmpty)
-			? TILE_TYPES_EMPTY
-			: m_randomGenerator.Getu64Random() % m_tileSpawnTickets.size()
-		)
-	;
+	TileGrid& grid = m_grids[i_gridIndex];
 
 	AzFramework::SpawnAllEntitiesOptionalArgs spawnOptions;
 
-	spawnOptions.m_preInsertionCallback = [this, i_row, i_column, i_isStart, tileType]([[maybe_unused]] AzFramework::EntitySpawnTicket::Id i_spawnTicketId, AzFramework::SpawnableEntityContainerView i_newEntities)
+	spawnOptions.m_preInsertionCallback = [this, i_gridIndex, generation = grid.m_generation, gridLength = grid.m_plan.GetGridLength(), i_tile]([[maybe_unused]] AzFramework::EntitySpawnTicket::Id i_spawnTicketId, AzFramework::SpawnableEntityContainerView i_newEntities)
 	{
+		GAME_PROFILE_SCOPE(TILES, "TilesPoolComponent::CreateTile (pre-insertion)");
+
 		if(i_newEntities.empty())
 		{
 			AZ_Error("TilesPool", false, "Unable to spawn tiles. Please check if prefabs are assigned");
 			return;
 		}
 
+		TileGrid& grid = m_grids[i_gridIndex];
+		const bool isOutdated = (grid.m_generation != generation);
+
 		AZ::Entity* newEntity = *(i_newEntities.begin() + 1);
 		auto newTile = newEntity->FindComponent<TileComponent>();
-		newTile->m_id = CalculateTileId(i_row, i_column);
-		newTile->m_isLandingArea = (tileType == TILE_TYPES_LANDING_AREA);
+		newTile->m_isStandby = (isOutdated || IsStandby(i_gridIndex));
 
-		if(i_isStart)
+		if(isOutdated)
+		{
+			return;
+		}
+
+		newTile->m_id = CalculateTileId(gridLength, i_tile.m_row, i_tile.m_column);
+		newTile->m_isLandingArea = (i_tile.m_type == LayoutPlan::TILE_TYPES_LANDING_AREA);
+
+		grid.m_tileStates[newTile->m_id] = (i_tile.m_isStart) ? TileState::CLAIMED : TileState::UNCLAIMED;
+		grid.m_tileEntityIds[newEntity->GetId()] = newTile->m_id;
+
+		if(newTile->m_isLandingArea)
+		{
+			grid.m_landingAreas.AddLandingArea(newTile->m_id, i_tile.m_row, i_tile.m_column, i_tile.m_isStart);
+		}
+
+		if(i_tile.m_isStart)
 		{
 			newTile->m_isClaimed = true;
 			newTile->m_isLocked = true;
@@ -382,48 +869,115 @@ void TilesPoolComponent::CreateTile(AZ::u16 i_row, AZ::u16 i_column, bool i_isSt
 			return;
 		}
 
-		const AZStd::vector<TileId> neighborIds = CalculateNeighbors(i_row, i_column);
+		const GridRules::NeighborIds neighborIds = CalculateNeighbors(gridLength, i_tile.m_row, i_tile.m_column);
 		for(const TileId neighborId : neighborIds)
 		{
 			newTile->RegisterNeighbor(neighborId);
 		}
 	};
 
-	spawnOptions.m_completionCallback = [this, i_row, i_column]([[maybe_unused]] AzFramework::EntitySpawnTicket::Id i_spawnTicketId, AzFramework::SpawnableConstEntityContainerView i_newEntities)
+	spawnOptions.m_completionCallback = [this, i_gridIndex, generation = grid.m_generation, gridLength = grid.m_plan.GetGridLength(), i_tile](AzFramework::EntitySpawnTicket::Id i_spawnTicketId, AzFramework::SpawnableConstEntityContainerView i_newEntities)
 	{
+		GAME_PROFILE_SCOPE(TILES, "TilesPoolComponent::CreateTile (completion)");
+
+		GameMetrics::EndSpawn(i_spawnTicketId, i_newEntities.size());
+
 		if(i_newEntities.empty())
 		{
 			AZ_Error("TilesPool", false, "Unable to spawn tiles. Please check if a prefab is assigned");
 			return;
 		}
 
-		const AZ::Vector3 tileTranslation = CalculateCellPosition(i_row, i_column, m_tileCellSize);
+		TileGrid& grid = m_grids[i_gridIndex];
+		if(grid.m_generation != generation)
+		{
+			return;
+		}
+
+		++grid.m_nCompletedSpawns;
+
+		const AZ::Vector3 tileTranslation = CalculateCellPosition(gridLength, i_tile.m_row, i_tile.m_column, m_tileCellSize);
 
 		const AZ::Entity* newRootEntity = *(i_newEntities.begin());
 		const AZ::EntityId newRootEntityId = newRootEntity->GetId();
 
-		EBUS_EVENT_ID(newRootEntityId, AZ::TransformBus, SetLocalTranslation, tileTranslation);
+		const AZ::Entity* newTileEntity = *(i_newEntities.begin() + 1);
+		const AZ::EntityId newTileEntityId = newTileEntity->GetId();
+
+		if(IsStandby(i_gridIndex))
+		{
+			grid.m_standbyPlacements.push_back({ newRootEntityId, newTileEntityId, tileTranslation });
+
+			EBUS_EVENT_ID(newRootEntityId, AZ::TransformBus, SetLocalTranslation, tileTranslation + m_standbyOffset);
+		}
+		else
+		{
+			EBUS_EVENT_ID(newRootEntityId, AZ::TransformBus, SetLocalTranslation, tileTranslation);
+			EBUS_EVENT(TilesNotificationBus, OnTileCreated, newTileEntityId);
+		}
 	};
 
 	auto spawnableSystem = AzFramework::SpawnableEntitiesInterface::Get();
     AZ_Assert(spawnableSystem, "Unable to retrieve the main spawnable system");
 
-	spawnableSystem->SpawnAllEntities(m_tileSpawnTickets[tileType], AZStd::move(spawnOptions));
+	GameMetrics::BeginSpawn(grid.m_tileSpawnTickets[i_tile.m_type].GetId());
+	spawnableSystem->SpawnAllEntities(grid.m_tileSpawnTickets[i_tile.m_type], AZStd::move(spawnOptions));
 }
 
-void TilesPoolComponent::DestroyAllBoundaries()
+void TilesPoolComponent::SwapGrids()
 {
-	DestroyAllEntities(m_boundarySpawnTickets);
+	DestroyGrid(m_activeGrid);
+	m_activeGrid = GetStandbyGridIndex();
+
+	InvalidateFlowFields();
+
+	EBUS_EVENT(TilesNotificationBus, OnAllTilesCreated);
+
+	// entities still being spawned will be placed by their own callbacks, now that their grid is active
+	PlaceStandbyEntities(GetActiveGrid());
 }
 
-void TilesPoolComponent::DestroyAllObstacles()
+void TilesPoolComponent::PlaceStandbyEntities(TileGrid& io_grid)
 {
-	DestroyAllEntities(m_obstacleSpawnTickets);
+	for(const StandbyPlacement& placement : io_grid.m_standbyPlacements)
+	{
+		EBUS_EVENT_ID(placement.m_rootEntityId, AZ::TransformBus, SetLocalTranslation, placement.m_translation);
+
+		if(placement.m_tileEntityId.IsValid())
+		{
+			WakeUpTile(placement.m_tileEntityId);
+
+			EBUS_EVENT(TilesNotificationBus, OnTileCreated, placement.m_tileEntityId);
+		}
+	}
+
+	io_grid.m_standbyPlacements.clear();
 }
 
-void TilesPoolComponent::DestroyAllTiles()
+void TilesPoolComponent::DestroyAllBoundaries()
 {
-	DestroyAllEntities(m_tileSpawnTickets);
+	DestroyAllEntities(m_boundarySpawnTickets);
+}
+
+void TilesPoolComponent::DestroyGrid(GridIndex i_gridIndex)
+{
+	TileGrid& grid = m_grids[i_gridIndex];
+	WaitForPlan(grid);
+
+	DestroyAllEntities(grid.m_obstacleSpawnTickets);
+	DestroyAllEntities(grid.m_tileSpawnTickets);
+
+	// callbacks of spawns requested before this point must not touch the grid anymore
+	++grid.m_generation;
+
+	grid.m_plan.Clear();
+	grid.m_nRequestedSpawns = 0;
+	grid.m_nCompletedSpawns = 0;
+
+	grid.m_tileStates.clear();
+	grid.m_tileEntityIds.clear();
+	grid.m_landingAreas.Reset(m_gridLength);
+	grid.m_standbyPlacements.clear();
 }
 
 void TilesPoolComponent::DestroyAllEntities(AZStd::vector<AzFramework::EntitySpawnTicket>& io_spawnTickets)
@@ -437,70 +991,81 @@ void TilesPoolComponent::DestroyAllEntities(AZStd::vector<AzFramework::EntitySpa
 	}
 }
 
-AZ::Vector3 TilesPoolComponent::CalculateCellPosition(AZ::u16 i_row, AZ::u16 i_column, const AZ::Vector2& i_cellSize) const
+void TilesPoolComponent::WakeUpTile(const AZ::EntityId& i_tileEntityId)
 {
-	const AZ::Vector2 gridOffset = (GetGridSize() - i_cellSize) / 2.f;
+	AZ::Entity* tileEntity { nullptr };
+	EBUS_EVENT_RESULT(tileEntity, AZ::ComponentApplicationBus, FindEntity, i_tileEntityId);
 
-	return
+	if(!tileEntity)
 	{
-		i_column * i_cellSize.GetX() - gridOffset.GetX(),
-		i_row * i_cellSize.GetY() - gridOffset.GetY(),
-		0.f
-	};
+		return;
+	}
+
+	if(auto tile = tileEntity->FindComponent<TileComponent>())
+	{
+		tile->LeaveStandby();
+	}
 }
 
-TileId TilesPoolComponent::CalculateTileId(AZ::u16 i_row, AZ::u16 i_column) const
+bool TilesPoolComponent::IsStandby(GridIndex i_gridIndex) const
 {
-	return (i_row * m_gridLength) + i_column;
+	return (i_gridIndex != m_activeGrid);
 }
 
-AZStd::vector<TileId> TilesPoolComponent::CalculateNeighbors(AZ::u16 i_row, AZ::u16 i_column) const
+TilesPoolComponent::GridIndex TilesPoolComponent::GetStandbyGridIndex() const
 {
-	AZStd::vector<TileId> neighborIds;
-
-	if(i_row > 0)
-	{
-		const AZ::u16 previousRow = i_row - 1;
+	return (m_activeGrid == 0) ? 1 : 0;
+}
 
-		if(i_column > 0)
-		{
-			neighborIds.emplace_back(CalculateTileId(previousRow, i_column - 1));
-		}
+TilesPoolComponent::TileGrid& TilesPoolComponent::GetActiveGrid()
+{
+	return m_grids[m_activeGrid];
+}
 
-		neighborIds.emplace_back(CalculateTileId(previousRow, i_column));
+const TilesPoolComponent::TileGrid& TilesPoolComponent::GetActiveGrid() const
+{
+	return m_grids[m_activeGrid];
+}
 
-		if(i_column < m_gridLength - 1)
-		{
-			neighborIds.emplace_back(CalculateTileId(previousRow, i_column + 1));
-		}
-	}
+TilesPoolComponent::TileGrid& TilesPoolComponent::GetStandbyGrid()
+{
+	return m_grids[GetStandbyGridIndex()];
+}
 
-	if(i_column > 0)
-	{
-		neighborIds.emplace_back(CalculateTileId(i_row, i_column - 1));
-	}
+const TilesPoolComponent::TileGrid& TilesPoolComponent::GetStandbyGrid() const
+{
+	return m_grids[GetStandbyGridIndex()];
+}
 
-	if(i_column < m_gridLength - 1)
-	{
-		neighborIds.emplace_back(CalculateTileId(i_row, i_column + 1));
-	}
+AZ::Vector3 TilesPoolComponent::CalculateCellPosition(AZ::u16 i_gridLength, AZ::u16 i_row, AZ::u16 i_column, const AZ::Vector2& i_cellSize) const
+{
+	const AZ::Vector2 gridOffset = (m_tileCellSize * i_gridLength - i_cellSize) / 2.f;
 
-	if(i_row < m_gridLength - 1)
+	return
 	{
-		const AZ::u16 nextRow = i_row + 1;
+		i_column * i_cellSize.GetX() - gridOffset.GetX(),
+		i_row * i_cellSize.GetY() - gridOffset.GetY(),
+		0.f
+	};
+}
 
-		if(i_column > 0)
-		{
-			neighborIds.emplace_back(CalculateTileId(nextRow, i_column - 1));
-		}
+AZ::Vector2 TilesPoolComponent::CalculateCellCoordinates(const AZ::Vector3& i_position, const AZ::Vector2& i_cellSize) const
+{
+	const AZ::Vector2 gridOffset = (GetGridSize() - i_cellSize) / 2.f;
 
-		neighborIds.emplace_back(CalculateTileId(nextRow, i_column));
+	return
+	{
+		(i_position.GetX() + gridOffset.GetX()) / i_cellSize.GetX(),
+		(i_position.GetY() + gridOffset.GetY()) / i_cellSize.GetY()
+	};
+}
 
-		if(i_column < m_gridLength - 1)
-		{
-			neighborIds.emplace_back(CalculateTileId(nextRow, i_column + 1));
-		}
-	}
+TileId TilesPoolComponent::CalculateTileId(AZ::u16 i_gridLength, AZ::u16 i_row, AZ::u16 i_column) const
+{
+	return GridRules::CalculateTileId(i_gridLength, i_row, i_column);
+}
 
-	return neighborIds;
+GridRules::NeighborIds TilesPoolComponent::CalculateNeighbors(AZ::u16 i_gridLength, AZ::u16 i_row, AZ::u16 i_column) const
+{
+	return GridRules::CalculateNeighbors(i_gridLength, i_row, i_column);
 }
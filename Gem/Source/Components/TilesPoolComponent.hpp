@@ -18,24 +18,37 @@
 
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Component/Component.h>
-#include <AzCore/Math/Random.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Math/Vector3.h>
-#include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 
+#include "../Core/FlowField.hpp"
+#include "../Core/GridRules.hpp"
+#include "../Core/LayoutPlan.hpp"
+#include "../Core/RandomStream.hpp"
 #include "../EBuses/GameBus.hpp"
+#include "../EBuses/SaveGameBus.hpp"
 #include "../EBuses/TileBus.hpp"
+#include "../Utils/LandingAreasIndex.hpp"
 
 
 namespace Loherangrin::Games::O3DEJam2305
 {
 	class TilesPoolComponent
 		: public AZ::Component
+		, protected AZ::TickBus::Handler
 		, protected TilesRequestBus::Handler
 		, protected GameNotificationBus::Handler
+		, protected SaveGameNotificationBus::Handler
+		, protected TilesNotificationBus::Handler
 	{
 	public:
 		AZ_COMPONENT(TilesPoolComponent, "{C2212D14-4B02-4AE2-A5C9-2485D5CBEE54}");
@@ -52,35 +65,124 @@ namespace Loherangrin::Games::O3DEJam2305
 		void Activate() override;
 		void Deactivate() override;
 
+		// AZ::TickBus
+		void OnTick(float i_deltaTime, AZ::ScriptTimePoint i_time) override;
+
 		// TilesRequestBus
 		AZ::Vector2 GetGridSize() const override;
+		AZ::u16 GetGridLength() const override;
+		AZ::u64 GetLayoutSeed() const override;
+		AZ::Vector3 GetTilePosition(TileId i_tileId) const override;
+
+		TileId FindLandingAreaAt(const AZ::Vector3& i_position, bool i_onlyClaimed) const override;
+		TileId FindNearestClaimedLandingArea(const AZ::Vector3& i_position) const override;
+		TileId FindNearestUnclaimedTile(const AZ::Vector3& i_position) const override;
+
+		AZ::Vector3 GetFlowDirectionToTile(const AZ::Vector3& i_position, TileId i_targetTileId) override;
+		AZ::Vector3 GetFlowDirectionToLandingArea(const AZ::Vector3& i_position) override;
+
+		bool IsNextLayoutReady() const override;
+		void SetNextLayoutSeed(AZ::u64 i_seed) override;
 
 		// GameNotificationBus
 		void OnGameLoading() override;
+		void OnGameEnded() override;
+
+		// SaveGameNotificationBus
+		void OnGameSaving(SaveFile& io_file) override;
+		void OnGameRestoring(const SaveFile& i_file) override;
+
+		// TilesNotificationBus
+		void OnTileClaimed(const AZ::EntityId& i_tileEntityId) override;
+		void OnTileLost(const AZ::EntityId& i_tileEntityId) override;
 
 	private:
-		using CellIndex = AZStd::pair<AZ::u16, AZ::u16>;
-		using CellIndexesList = AZStd::set<CellIndex>;
-		using TileType = AZStd::size_t;
+		using GridIndex = AZ::u8;
+		using FlowFieldKey = TileId;
+
+		struct CachedFlowField
+		{
+			FlowField m_field {};
+			AZ::u64 m_lastUse { 0 };
+		};
+
+		enum class TileState : AZ::u8
+		{
+			NONE = 0,
+			UNCLAIMED,
+			CLAIMED
+		};
+
+		struct StandbyPlacement
+		{
+			AZ::EntityId m_rootEntityId {};
+			AZ::EntityId m_tileEntityId {};
+			AZ::Vector3 m_translation { AZ::Vector3::CreateZero() };
+		};
+
+		// one of the two sets of obstacles and tiles: the active grid is the one being played,
+		// while the standby grid is built out of view from the next layout
+		struct TileGrid
+		{
+			AZStd::vector<AzFramework::EntitySpawnTicket> m_obstacleSpawnTickets {};
+			AZStd::vector<AzFramework::EntitySpawnTicket> m_tileSpawnTickets {};
+
+			// while a plan is generated in background, the main thread doesn't read it
+			LayoutPlan m_plan {};
+			AZStd::unique_ptr<AZ::JobCompletion> m_planCompletion {};
+			AZStd::atomic_bool m_isPlanning { false };
+
+			AZStd::size_t m_nRequestedSpawns { 0 };
+			AZStd::size_t m_nCompletedSpawns { 0 };
+			AZ::u32 m_generation { 0 };
+
+			AZStd::vector<TileState> m_tileStates {};
+			AZStd::unordered_map<AZ::EntityId, TileId> m_tileEntityIds {};
+			LandingAreasIndex m_landingAreas {};
+
+			AZStd::vector<StandbyPlacement> m_standbyPlacements {};
+		};
 
 		void CreateAllBoundaries();
 		void CreateBoundary(const AZ::Vector3& i_translation);
 
-		CellIndexesList CreateAllObstacles();
-		void CreateObstacle(AZ::u16 i_row, AZ::u16 i_column);
+		void PlanLayout(GridIndex i_gridIndex, AZ::u16 i_gridLength, AZ::u64 i_seed, bool i_forceEmptyTiles, bool i_isInBackground);
+		void PlanNextLayout();
+		void WaitForPlan(TileGrid& io_grid);
 
-		void CreateAllTiles(bool i_forceEmptyTiles = false, const CellIndexesList& i_ignoredCellIndexes = {});
-		void CreateTile(AZ::u16 i_row, AZ::u16 i_column, bool i_isStart, bool i_forceEmpty);
+		bool SpawnPlannedEntities(GridIndex i_gridIndex, AZStd::size_t i_maxSpawns);
+		void CreateObstacle(GridIndex i_gridIndex, const LayoutPlan::Obstacle& i_obstacle);
+		void CreateTile(GridIndex i_gridIndex, const LayoutPlan::Tile& i_tile);
+
+		void SwapGrids();
+		void PlaceStandbyEntities(TileGrid& io_grid);
 
 		void DestroyAllBoundaries();
-		void DestroyAllObstacles();
-		void DestroyAllTiles();
+		void DestroyGrid(GridIndex i_gridIndex);
+
+		bool IsStandby(GridIndex i_gridIndex) const;
+		GridIndex GetStandbyGridIndex() const;
+		TileGrid& GetActiveGrid();
+		const TileGrid& GetActiveGrid() const;
+		TileGrid& GetStandbyGrid();
+		const TileGrid& GetStandbyGrid() const;
 
-		TileId CalculateTileId(AZ::u16 i_row, AZ::u16 i_column) const;
-		AZStd::vector<TileId> CalculateNeighbors(AZ::u16 i_row, AZ::u16 i_column) const;
+		TileId CalculateTileId(AZ::u16 i_gridLength, AZ::u16 i_row, AZ::u16 i_column) const;
+		GridRules::NeighborIds CalculateNeighbors(AZ::u16 i_gridLength, AZ::u16 i_row, AZ::u16 i_column) const;
+
+		AZ::Vector3 CalculateCellPosition(AZ::u16 i_gridLength, AZ::u16 i_row, AZ::u16 i_column, const AZ::Vector2& i_cellSize) const;
+		AZ::Vector2 CalculateCellCoordinates(const AZ::Vector3& i_position, const AZ::Vector2& i_cellSize) const;
+
+		TileId CalculateTileIdAt(const AZ::Vector3& i_position) const;
+
+		const FlowField& GetFlowField(FlowFieldKey i_key, AZStd::span<const TileId> i_targetTileIds);
+		AZ::Vector3 CalculateFlowDirection(const FlowField& i_flowField, const AZ::Vector3& i_position) const;
+		void InvalidateFlowFields();
+
+		void UpdateTileState(const AZ::EntityId& i_tileEntityId, bool i_isClaimed);
 
-		AZ::Vector3 CalculateCellPosition(AZ::u16 i_row, AZ::u16 i_column, const AZ::Vector2& i_cellSize) const;
 		static void DestroyAllEntities(AZStd::vector<AzFramework::EntitySpawnTicket>& io_spawnTickets);
+		static void WakeUpTile(const AZ::EntityId& i_tileEntityId);
 
 		AZ::u16 m_gridLength { 0 };
 		AZ::u16 m_maxGridLength { 11 };
@@ -94,19 +196,30 @@ namespace Loherangrin::Games::O3DEJam2305
     	AZStd::vector<AzFramework::EntitySpawnTicket> m_boundarySpawnTickets {};
 
 		AZStd::vector<AZ::Data::Asset<AzFramework::Spawnable>> m_obstaclePrefabs {};
-    	AZStd::vector<AzFramework::EntitySpawnTicket> m_obstacleSpawnTickets {};
 
 		AZ::Data::Asset<AzFramework::Spawnable> m_landingTilePrefab {};
 		AZStd::vector<AZ::Data::Asset<AzFramework::Spawnable>> m_tilePrefabs {};
-    	AZStd::vector<AzFramework::EntitySpawnTicket> m_tileSpawnTickets {};
+
+		AZStd::array<TileGrid, 2> m_grids {};
+		GridIndex m_activeGrid { 0 };
+
+		AZ::Vector3 m_standbyOffset { 0.f, 0.f, -1000.f };
+		AZ::u16 m_maxStandbySpawnsPerFrame { 16 };
+
+		AZStd::unordered_map<FlowFieldKey, CachedFlowField> m_flowFields {};
+		AZ::u64 m_flowFieldsClock { 0 };
 
 		AZ::u64 m_randomSeed { 1234 };
-		AZ::SimpleLcgRandom m_randomGenerator {};
+		RandomStream m_layoutRandomStream { RandomStreamId::LAYOUTS };
+		RandomStream m_boundaryRandomStream { RandomStreamId::BOUNDARIES };
 
-		static constexpr TileType TILE_TYPES_LANDING_AREA = 0;
-		static constexpr TileType TILE_TYPES_EMPTY = 1;
+		AZ::u64 m_nextLayoutSeed { 0 };
+		bool m_hasNextLayoutSeed { false };
 
 		static constexpr AZ::u16 GRID_LENGTHS_FIRST_ACTIVATION = 5;
+
+		static constexpr AZStd::size_t FLOW_FIELDS_MAX_CACHED = 16;
+		static constexpr FlowFieldKey FLOW_FIELDS_LANDING_AREAS = INVALID_TILE_ID - 1;
 	};
 
 } // Loherangrin::Games::O3DEJam2305
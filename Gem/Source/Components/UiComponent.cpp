@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <AzCore/EBus/Results.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -26,12 +27,52 @@
 #include <LyShine/Bus/UiFaderBus.h>
 #include <LyShine/Bus/UiImageBus.h>
 #include <LyShine/Bus/UiInteractableBus.h>
-#include <LyShine/Bus/UiTextBus.h>
 
+#include "../Utils/GameMetrics.hpp"
+#include "../Utils/UiElementResolver.hpp"
 #include "UiComponent.hpp"
 
 using Loherangrin::Games::O3DEJam2305::UiComponent;
-
+using Loherangrin::Games::O3DEJam2305::UiElementBinding;
+
+
+const UiElementBinding<UiComponent> UiComponent::UI_ELEMENTS[] =
+{
+	{ UI_HUD, &UiComponent::m_hudEntityId },
+	{ UI_HUD_LOW_ENERGY_MODE_TEXT, &UiComponent::m_lowEnergyModeEntityId },
+	{ UI_HUD_ENERGY_BARS_SEPARATOR_IMAGE, &UiComponent::m_energyBarsSeparatorEntityId },
+	{ UI_HUD_SPACESHIP_LOW_ENERGY_IMAGE, &UiComponent::m_spaceshipLowEnergyEntityId },
+	{ UI_HUD_SPACESHIP_HIGH_ENERGY_IMAGE, &UiComponent::m_spaceshipHighEnergyEntityId },
+	{ UI_HUD_TILE_ENERGY_BAR, &UiComponent::m_tileEnergyBarEntityId },
+	{ UI_HUD_TILE_LOW_ENERGY_IMAGE, &UiComponent::m_tileLowEnergyEntityId },
+	{ UI_HUD_TILE_HIGH_ENERGY_IMAGE, &UiComponent::m_tileHighEnergyEntityId },
+	{ UI_HUD_CLAIMED_TILES_TEXT, &UiComponent::m_claimedTilesEntityId },
+	{ UI_HUD_SCORE_TEXT, &UiComponent::m_scoreEntityId },
+	{ UI_HUD_POSITIVE_COLLECTABLE_TEXT, &UiComponent::m_positiveCollectableEntityId },
+	{ UI_HUD_NEGATIVE_COLLECTABLE_TEXT, &UiComponent::m_negativeCollectableEntityId },
+
+	{ UI_LOADING, &UiComponent::m_loadingScreenEntityId },
+	{ UI_LOADING_TEXT, &UiComponent::m_loadingTextEntityId },
+
+	{ UI_MAIN_MENU, &UiComponent::m_mainMenuEntityId },
+	{ UI_MAIN_MENU_START_BUTTON, &UiComponent::m_startGameEntityId },
+	{ UI_MAIN_MENU_EXIT_BUTTON, &UiComponent::m_exitGameEntityId },
+
+	{ UI_PAUSE_MENU, &UiComponent::m_pauseMenuEntityId },
+	{ UI_PAUSE_MENU_END_INSTRUCTIONS_TEXT, &UiComponent::m_endInstructionsEntityId },
+	{ UI_PAUSE_MENU_WARNING_INSTRUCTIONS_TEXT, &UiComponent::m_warningInstructionsEntityId },
+	{ UI_PAUSE_MENU_RESUME_BUTTON, &UiComponent::m_resumeGameEntityId },
+	{ UI_PAUSE_MENU_END_BUTTON, &UiComponent::m_endGameEntityId },
+	{ UI_PAUSE_MENU_CANCEL_BUTTON, &UiComponent::m_cancelGameEntityId },
+
+	{ UI_END_MENU, &UiComponent::m_endMenuEntityId },
+	{ UI_END_MENU_GAME_COMPLETED, &UiComponent::m_gameCompletedEntityId },
+	{ UI_END_MENU_GAME_FAILED, &UiComponent::m_gameFailedEntityId },
+	{ UI_END_MENU_FINAL_SCORE_TEXT, &UiComponent::m_finalScoreEntityId },
+	{ UI_END_MENU_RANK_TEXT, &UiComponent::m_rankEntityId },
+	{ UI_END_MENU_RETRY_BUTTON, &UiComponent::m_retryGameEntityId },
+	{ UI_END_MENU_RETURN_BUTTON, &UiComponent::m_returnMainMenuEntityId }
+};
 
 void UiComponent::Reflect(AZ::ReflectContext* io_context)
 {
@@ -105,16 +146,24 @@ void UiComponent::Activate()
 
 	InitializeAllUiElements();
 	ShowMainMenu();
+
+	GameRequestBus::Handler::BusConnect();
 }
 
 void UiComponent::Deactivate()
 {
-	AZ::TickBus::Handler::BusDisconnect();
+	GameplayStageNotificationBus::Handler::BusDisconnect();
 	UiCanvasAssetRefNotificationBus::Handler::BusDisconnect();
 
+	GameRequestBus::Handler::BusDisconnect();
+
+	UnbindAllTexts();
+
 	TilesNotificationBus::Handler::BusDisconnect();
+	SpaceshipsNotificationBus::Handler::BusDisconnect();
 	SpaceshipNotificationBus::Handler::BusDisconnect();
 	ScoreNotificationBus::Handler::BusDisconnect();
+	LeaderboardNotificationBus::Handler::BusDisconnect();
 	GameNotificationBus::Handler::BusDisconnect();
 }
 
@@ -131,6 +180,8 @@ void UiComponent::OnCanvasLoadedIntoEntity([[maybe_unused]] AZ::EntityId i_uiCan
 
 	InitializeAllUiElements();
 	ShowMainMenu();
+
+	GameRequestBus::Handler::BusConnect();
 }
 
 bool UiComponent::FindAllUiElements(const AZ::EntityId& i_canvasId)
@@ -146,56 +197,19 @@ bool UiComponent::FindAllUiElements(const AZ::EntityId& i_canvasId)
 
 	m_canvasId = i_canvasId;
 
-	m_hudEntityId = FindUiElement(UI_HUD);
-	m_lowEnergyModeEntityId = FindUiElement(UI_HUD_LOW_ENERGY_MODE_TEXT);
-	m_energyBarsSeparatorEntityId = FindUiElement(UI_HUD_ENERGY_BARS_SEPARATOR_IMAGE);
-	m_spaceshipLowEnergyEntityId = FindUiElement(UI_HUD_SPACESHIP_LOW_ENERGY_IMAGE);
-	m_spaceshipHighEnergyEntityId = FindUiElement(UI_HUD_SPACESHIP_HIGH_ENERGY_IMAGE);
-	m_tileEnergyBarEntityId = FindUiElement(UI_HUD_TILE_ENERGY_BAR);
-	m_tileLowEnergyEntityId = FindUiElement(UI_HUD_TILE_LOW_ENERGY_IMAGE);
-	m_tileHighEnergyEntityId = FindUiElement(UI_HUD_TILE_HIGH_ENERGY_IMAGE);
-	m_claimedTilesEntityId = FindUiElement(UI_HUD_CLAIMED_TILES_TEXT);
-	m_scoreEntityId = FindUiElement(UI_HUD_SCORE_TEXT);
-	m_positiveCollectableEntityId = FindUiElement(UI_HUD_POSITIVE_COLLECTABLE_TEXT);
-	m_negativeCollectableEntityId = FindUiElement(UI_HUD_NEGATIVE_COLLECTABLE_TEXT);
-
-	m_loadingScreenEntityId = FindUiElement(UI_LOADING);
-	m_loadingTextEntityId = FindUiElement(UI_LOADING_TEXT);
-
-	m_mainMenuEntityId = FindUiElement(UI_MAIN_MENU);
-	m_startGameEntityId = FindUiElement(UI_MAIN_MENU_START_BUTTON);
-	m_exitGameEntityId = FindUiElement(UI_MAIN_MENU_EXIT_BUTTON);
-
-	m_pauseMenuEntityId = FindUiElement(UI_PAUSE_MENU);
-	m_endInstructionsEntityId = FindUiElement(UI_PAUSE_MENU_END_INSTRUCTIONS_TEXT);
-	m_warningInstructionsEntityId = FindUiElement(UI_PAUSE_MENU_WARNING_INSTRUCTIONS_TEXT);
-	m_resumeGameEntityId = FindUiElement(UI_PAUSE_MENU_RESUME_BUTTON);
-	m_endGameEntityId = FindUiElement(UI_PAUSE_MENU_END_BUTTON);
-	m_cancelGameEntityId = FindUiElement(UI_PAUSE_MENU_CANCEL_BUTTON);
-
-	m_endMenuEntityId = FindUiElement(UI_END_MENU);
-	m_gameCompletedEntityId = FindUiElement(UI_END_MENU_GAME_COMPLETED);
-	m_gameFailedEntityId = FindUiElement(UI_END_MENU_GAME_FAILED);
-	m_finalScoreEntityId = FindUiElement(UI_END_MENU_FINAL_SCORE_TEXT);
-	m_retryGameEntityId = FindUiElement(UI_END_MENU_RETRY_BUTTON);
-	m_returnMainMenuEntityId = FindUiElement(UI_END_MENU_RETURN_BUTTON);
-
-	return true;
-}
+	// Missing elements are reported all together, and their bindings are left invalid
+	UiElementResolver::Resolve(m_canvasId, UI_ELEMENTS, *this);
 
-AZ::EntityId UiComponent::FindUiElement(const char* i_elementName) const
-{
-	AZ::EntityId elementId;
-	EBUS_EVENT_ID_RESULT(elementId, m_canvasId, UiCanvasBus, FindElementEntityIdByName, AZStd::string { i_elementName });
+	BindAllTexts();
 
-	return elementId;
+	return true;
 }
 
 void UiComponent::InitializeAllUiElements()
 {
 	ConnectOnButtonClick(m_startGameEntityId, [this]([[maybe_unused]] AZ::EntityId i_buttonEntityId, [[maybe_unused]] AZ::Vector2 i_clickPosition)
 	{
-		CreateGame();
+		NewGame();
 	});
 
 	ConnectOnButtonClick(m_exitGameEntityId, []([[maybe_unused]] AZ::EntityId i_buttonEntityId, [[maybe_unused]] AZ::Vector2 i_clickPosition)
@@ -222,9 +236,7 @@ void UiComponent::InitializeAllUiElements()
 
 	ConnectOnButtonClick(m_retryGameEntityId, [this]([[maybe_unused]] AZ::EntityId i_buttonEntityId, [[maybe_unused]] AZ::Vector2 i_clickPosition)
 	{
-		HideUiElement(m_endMenuEntityId);
-
-		StartGame();
+		RetryGame();
 	});
 
 	ConnectOnButtonClick(m_returnMainMenuEntityId, [this]([[maybe_unused]] AZ::EntityId i_buttonEntityId, [[maybe_unused]] AZ::Vector2 i_clickPosition)
@@ -254,22 +266,61 @@ void UiComponent::ShowMainMenu()
 	HideUiElement(m_loadingScreenEntityId, FADE_SPEED);
 }
 
+void UiComponent::NewGame()
+{
+	if(IsTransitionRunning())
+	{
+		return;
+	}
+
+	CreateGame();
+}
+
+void UiComponent::RetryGame()
+{
+	if(IsTransitionRunning())
+	{
+		return;
+	}
+
+	HideUiElement(m_endMenuEntityId);
+
+	bool isNextLayoutReady { false };
+	EBUS_EVENT_RESULT(isNextLayoutReady, TilesRequestBus, IsNextLayoutReady);
+
+	m_isInstantStart = isNextLayoutReady;
+
+	StartGame();
+}
+
+void UiComponent::ResumeGame()
+{
+	HideUiElement(m_pauseMenuEntityId);
+
+	EBUS_EVENT(GameNotificationBus, OnGameResumed);
+}
+
 void UiComponent::CreateGame()
 {
 	EBUS_EVENT(GameNotificationBus, OnGameCreated);
 
 	HideUiElement(m_mainMenuEntityId);
 
+	m_isInstantStart = false;
+
 	m_timer = m_liftDuration;
 	m_animation = Animation::TAKE_OFF;
 
-	AZ::TickBus::Handler::BusConnect();
+	GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::UI);
 }
 
 void UiComponent::StartGame()
 {
-	ShowUiElement(m_loadingScreenEntityId, 0.f);
-	ShowUiElement(m_loadingTextEntityId);
+	if(!m_isInstantStart)
+	{
+		ShowUiElement(m_loadingScreenEntityId, 0.f);
+		ShowUiElement(m_loadingTextEntityId);
+	}
 
 	HideUiElement(m_spaceshipLowEnergyEntityId);
 	ShowUiElement(m_spaceshipHighEnergyEntityId);
@@ -283,34 +334,46 @@ void UiComponent::StartGame()
 	HideUiElement(m_energyBarsSeparatorEntityId);
 
 	HideUiElement(m_lowEnergyModeEntityId);
-	HideUiElement(m_positiveCollectableEntityId);
-	HideUiElement(m_negativeCollectableEntityId);
+	m_collectableBanners.Clear();
+
+	m_rankText.SetText("-");
 
 	GameNotificationBus::Handler::BusConnect();
 
 	CollectablesNotificationBus::Handler::BusConnect();
+	LeaderboardNotificationBus::Handler::BusConnect();
 	ScoreNotificationBus::Handler::BusConnect();
-	SpaceshipNotificationBus::Handler::BusConnect();
+	SpaceshipsNotificationBus::Handler::BusConnect();
+	BindPlayerSpaceship(FindPlayerSpaceship());
 	TilesNotificationBus::Handler::BusConnect();
 
 	EBUS_EVENT_ID(m_gameCamera, Camera::CameraRequestBus, MakeActiveView);
 
+	if(m_isInstantStart)
+	{
+		// the next layout has already been built in the background, so the grids are swapped right away
+		EBUS_EVENT(GameNotificationBus, OnGameLoading);
+		return;
+	}
+
 	m_animation = Animation::LOADING;
 	m_timer = 0.5f;
 
-	AZ::TickBus::Handler::BusConnect();
+	GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::UI);
 }
 
 void UiComponent::OnAllTilesCreated()
 {
-	m_timer = 0.5f;
+	m_timer = (m_isInstantStart) ? 0.f : 0.5f;
 	m_animation = Animation::AFTER_LOADING;
 
-	AZ::TickBus::Handler::BusConnect();
+	GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::UI);
 }
 
-void UiComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint i_time)
+void UiComponent::OnStageTick(float i_deltaTime)
 {
+	GAME_PROFILE_SCOPE(UI, "UiComponent::OnStageTick");
+
 	m_timer -= i_deltaTime;
 	if(m_timer > 0.f)
 	{
@@ -321,8 +384,17 @@ void UiComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint
 	{
 		case Animation::LOADING:
 		{
+			// the loading screen stays until the next layout has been built in the background, instead of stalling the frame that loads the game
+			bool isNextLayoutReady { false };
+			EBUS_EVENT_RESULT(isNextLayoutReady, TilesRequestBus, IsNextLayoutReady);
+
+			if(!isNextLayoutReady)
+			{
+				return;
+			}
+
 			m_animation = Animation::NONE;
-			AZ::TickBus::Handler::BusDisconnect();
+			GameplayStageNotificationBus::Handler::BusDisconnect();
 
 			EBUS_EVENT(GameNotificationBus, OnGameLoading);
 		}
@@ -331,9 +403,10 @@ void UiComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint
 		case Animation::AFTER_LOADING:
 		{
 			m_animation = Animation::NONE;
-			AZ::TickBus::Handler::BusDisconnect();
+			GameplayStageNotificationBus::Handler::BusDisconnect();
 
 			ShowUiElement(m_hudEntityId);
+			RefreshAllTexts();
 
 			EBUS_EVENT(GameNotificationBus, OnGameStarted);
 
@@ -382,24 +455,14 @@ void UiComponent::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint
 			ShowMainMenu();
 
 			m_animation = Animation::NONE;
-			AZ::TickBus::Handler::BusDisconnect();
-		}
-		break;
-
-		case Animation::COLLECTABLE:
-		{
-			HideUiElement(m_negativeCollectableEntityId);
-			HideUiElement(m_positiveCollectableEntityId);
-
-			m_animation = Animation::NONE;
-			AZ::TickBus::Handler::BusDisconnect();
+			GameplayStageNotificationBus::Handler::BusDisconnect();
 		}
 		break;
 
 		default:
 		{
 			m_animation = Animation::NONE;
-			AZ::TickBus::Handler::BusDisconnect();
+			GameplayStageNotificationBus::Handler::BusDisconnect();
 		}
 	}
 }
@@ -409,13 +472,6 @@ void UiComponent::OnGamePaused()
 	ShowUiElement(m_pauseMenuEntityId);
 }
 
-void UiComponent::ResumeGame()
-{
-	HideUiElement(m_pauseMenuEntityId);
-
-	EBUS_EVENT(GameNotificationBus, OnGameResumed);
-}
-
 void UiComponent::OnGameEnded()
 {
 	HideUiElement(m_hudEntityId);
@@ -425,6 +481,7 @@ void UiComponent::OnGameEnded()
 	ShowUiElement(m_gameFailedEntityId);
 
 	ShowUiElement(m_endMenuEntityId);
+	RefreshAllTexts();
 }
 
 void UiComponent::EndGame()
@@ -442,20 +499,23 @@ void UiComponent::DestroyGame()
 
 	ShowUiElement(m_loadingScreenEntityId, FADE_SPEED);
 
-	AZ::TickBus::Handler::BusConnect();
+	GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::UI);
 }
 
 void UiComponent::OnScoreChanged(TotalPoints i_newPoints)
 {
-	const AZStd::string score = AZStd::to_string(i_newPoints);
+	m_scoreText.Format("%llu", static_cast<unsigned long long>(i_newPoints));
+	m_finalScoreText.Format("%llu", static_cast<unsigned long long>(i_newPoints));
+}
 
-	EBUS_EVENT_ID(m_scoreEntityId, UiTextBus, SetText, score);
-	EBUS_EVENT_ID(m_finalScoreEntityId, UiTextBus, SetText, score);
+void UiComponent::OnRunRecorded([[maybe_unused]] const LeaderboardEntry& i_entry, LeaderboardRank i_rank, [[maybe_unused]] LeaderboardRank i_seedRank)
+{
+	m_rankText.Format("#%u", i_rank);
 }
 
 void UiComponent::OnClaimedTilesChanged(TileCount i_newClaimedTiles)
 {
-	EBUS_EVENT_ID(m_claimedTilesEntityId, UiTextBus, SetText, AZStd::to_string(i_newClaimedTiles));
+	m_claimedTilesText.Format("%u", static_cast<unsigned int>(i_newClaimedTiles));
 }
 
 void UiComponent::OnLandingEnded()
@@ -559,55 +619,126 @@ void UiComponent::OnTileDeselected(const AZ::EntityId& i_tileEntityId)
 
 void UiComponent::OnStopDecayCollected(float i_duration)
 {
-	SetCollectableText(AZStd::string::format("Block tiles for %.f sec", i_duration), true);
+	m_collectableBanners.Push(true, "Block tiles for %.f sec", i_duration);
 }
 
-void UiComponent::OnSpaceshipEnergyCollected(float i_energy)
+void UiComponent::OnSpaceshipEnergyCollected(const AZ::EntityId& i_spaceshipEntityId, float i_energy)
 {
+	if(i_spaceshipEntityId != m_playerSpaceshipEntityId)
+	{
+		return;
+	}
+
 	const bool isDamage = (i_energy < 0.f);
-	SetCollectableText(AZStd::string::format("%s%.f energy to spaceship", (isDamage) ? "-" : "+", AZStd::abs(i_energy)), !isDamage);
+	m_collectableBanners.Push(!isDamage, "%s%.f energy to spaceship", (isDamage) ? "-" : "+", AZStd::abs(i_energy));
 }
 
 void UiComponent::OnTileEnergyCollected(float i_energy)
 {
 	const bool isDamage = (i_energy < 0.f);
-	SetCollectableText(AZStd::string::format("%s%.f energy to all tiles", (isDamage) ? "-" : "+", AZStd::abs(i_energy)), !isDamage);
+	m_collectableBanners.Push(!isDamage, "%s%.f energy to all tiles", (isDamage) ? "-" : "+", AZStd::abs(i_energy));
 }
 
 void UiComponent::OnPointsCollected(Points i_points)
 {
-	SetCollectableText(AZStd::string::format("+%u points", i_points), true);
+	m_collectableBanners.Push(true, "+%u points", i_points);
 }
 
-void UiComponent::OnSpeedCollected(float i_multiplier, float i_duration)
+void UiComponent::OnSpeedCollected(const AZ::EntityId& i_spaceshipEntityId, float i_multiplier, float i_duration)
 {
+	if(i_spaceshipEntityId != m_playerSpaceshipEntityId)
+	{
+		return;
+	}
+
 	const bool isBoost = (i_multiplier > 1.f);
-	SetCollectableText(AZStd::string::format("x%.1f speed for %.f sec", i_multiplier, i_duration), isBoost);
+	m_collectableBanners.Push(isBoost, "x%.1f speed for %.f sec", i_multiplier, i_duration);
 }
 
-void UiComponent::SetCollectableText(const AZStd::string& i_message, bool i_isPositive)
+void UiComponent::OnSpaceshipRegistered(const AZ::EntityId& i_spaceshipEntityId)
 {
-	if(m_animation == Animation::COLLECTABLE)
+	if(m_playerSpaceshipEntityId.IsValid())
 	{
-		if(i_isPositive)
-		{
-			HideUiElement(m_negativeCollectableEntityId);
-		}
-		else
+		return;
+	}
+
+	bool isPlayer { false };
+	EBUS_EVENT_ID_RESULT(isPlayer, i_spaceshipEntityId, SpaceshipRequestBus, IsPlayer);
+
+	if(isPlayer)
+	{
+		BindPlayerSpaceship(i_spaceshipEntityId);
+	}
+}
+
+void UiComponent::OnSpaceshipUnregistered(const AZ::EntityId& i_spaceshipEntityId)
+{
+	if(i_spaceshipEntityId != m_playerSpaceshipEntityId)
+	{
+		return;
+	}
+
+	BindPlayerSpaceship(AZ::EntityId {});
+}
+
+void UiComponent::BindPlayerSpaceship(const AZ::EntityId& i_spaceshipEntityId)
+{
+	SpaceshipNotificationBus::Handler::BusDisconnect();
+
+	m_playerSpaceshipEntityId = i_spaceshipEntityId;
+	if(!m_playerSpaceshipEntityId.IsValid())
+	{
+		return;
+	}
+
+	SpaceshipNotificationBus::Handler::BusConnect(m_playerSpaceshipEntityId);
+}
+
+AZ::EntityId UiComponent::FindPlayerSpaceship()
+{
+	AZ::EBusAggregateResults<AZ::EntityId> spaceshipEntityIds;
+	EBUS_EVENT_RESULT(spaceshipEntityIds, SpaceshipRequestBus, GetSpaceshipId);
+
+	for(const AZ::EntityId& spaceshipEntityId : spaceshipEntityIds.values)
+	{
+		bool isPlayer { false };
+		EBUS_EVENT_ID_RESULT(isPlayer, spaceshipEntityId, SpaceshipRequestBus, IsPlayer);
+
+		if(isPlayer)
 		{
-			HideUiElement(m_positiveCollectableEntityId);
+			return spaceshipEntityId;
 		}
 	}
 
-	const AZ::EntityId& collectableEntityId = (i_isPositive) ? m_positiveCollectableEntityId : m_negativeCollectableEntityId;
-	ShowUiElement(collectableEntityId);
+	return AZ::EntityId {};
+}
 
-	EBUS_EVENT_ID(collectableEntityId, UiTextBus, SetText, i_message);
+void UiComponent::BindAllTexts()
+{
+	m_claimedTilesText.Bind(m_claimedTilesEntityId);
+	m_scoreText.Bind(m_scoreEntityId);
+	m_collectableBanners.Bind(m_positiveCollectableEntityId, m_negativeCollectableEntityId);
+	m_collectableBanners.SetDisplayDuration(m_collectableNotificationDuration);
+	m_finalScoreText.Bind(m_finalScoreEntityId);
+	m_rankText.Bind(m_rankEntityId);
+}
 
-	m_animation = Animation::COLLECTABLE;
-	m_timer = m_collectableNotificationDuration;
+void UiComponent::UnbindAllTexts()
+{
+	m_claimedTilesText.Unbind();
+	m_scoreText.Unbind();
+	m_collectableBanners.Unbind();
+	m_finalScoreText.Unbind();
+	m_rankText.Unbind();
+}
 
-	AZ::TickBus::Handler::BusConnect();
+void UiComponent::RefreshAllTexts()
+{
+	m_claimedTilesText.Refresh();
+	m_scoreText.Refresh();
+	m_collectableBanners.Refresh();
+	m_finalScoreText.Refresh();
+	m_rankText.Refresh();
 }
 
 void UiComponent::ConnectOnButtonClick(const AZ::EntityId& i_buttonEntityId, const UiButtonInterface::OnClickCallback& i_callback)
@@ -635,6 +766,11 @@ void UiComponent::HideUiElement(const AZ::EntityId& i_elementEntityId, float i_f
 	EBUS_EVENT_ID(i_elementEntityId, UiFaderBus, Fade, 0.f, i_fadeSpeed);
 }
 
+bool UiComponent::IsTransitionRunning() const
+{
+	return (m_animation != Animation::NONE);
+}
+
 void UiComponent::SwapUiElements(const AZ::EntityId*& io_currentEntityId, const AZ::EntityId& i_newEntityId)
 {
 	HideUiElement(*io_currentEntityId);
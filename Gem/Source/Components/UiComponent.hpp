@@ -17,7 +17,6 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
-#include <AzCore/Component/TickBus.h>
 #include <AzCore/std/string/string.h>
 
 #include <LyShine/Bus/World/UiCanvasRefBus.h>
@@ -25,21 +24,29 @@
 
 #include "../EBuses/CollectableBus.hpp"
 #include "../EBuses/GameBus.hpp"
+#include "../EBuses/GameplayBus.hpp"
+#include "../EBuses/LeaderboardBus.hpp"
 #include "../EBuses/ScoreBus.hpp"
 #include "../EBuses/SpaceshipBus.hpp"
 #include "../EBuses/TileBus.hpp"
+#include "../Utils/CollectableBannerQueue.hpp"
+#include "../Utils/HudTextBinding.hpp"
+#include "../Utils/UiElementResolver.hpp"
 
 
 namespace Loherangrin::Games::O3DEJam2305
 {
 	class UiComponent
 		: public AZ::Component
-		, protected AZ::TickBus::Handler
 		, protected UiCanvasAssetRefNotificationBus::Handler
 		, protected CollectablesNotificationBus::Handler
+		, protected GameRequestBus::Handler
 		, protected GameNotificationBus::Handler
+		, protected GameplayStageNotificationBus::Handler
+		, protected LeaderboardNotificationBus::Handler
 		, protected ScoreNotificationBus::Handler
 		, protected SpaceshipNotificationBus::Handler
+		, protected SpaceshipsNotificationBus::Handler
 		, protected TilesNotificationBus::Handler
 	{
 	public:
@@ -59,20 +66,28 @@ namespace Loherangrin::Games::O3DEJam2305
 		// UiCanvasRefNotificationBus
 		void OnCanvasLoadedIntoEntity(AZ::EntityId i_uiCanvasEntity) override;
 
-		// AZ::TickBus
-		void OnTick(float i_deltaTime, AZ::ScriptTimePoint i_time) override;
+		// GameplayStageNotificationBus
+		void OnStageTick(float i_deltaTime) override;
 
 		// CollectablesNotificationBus
 		void OnStopDecayCollected(float i_duration);
-		void OnSpaceshipEnergyCollected(float i_energy);
+		void OnSpaceshipEnergyCollected(const AZ::EntityId& i_spaceshipEntityId, float i_energy) override;
 		void OnTileEnergyCollected(float i_energy);
 		void OnPointsCollected(Points i_points);
-		void OnSpeedCollected(float i_multiplier, float i_duration);
+		void OnSpeedCollected(const AZ::EntityId& i_spaceshipEntityId, float i_multiplier, float i_duration) override;
+
+		// GameRequestBus
+		void NewGame() override;
+		void RetryGame() override;
+		void ResumeGame() override;
 
 		// GameNotificationBus
 		void OnGamePaused() override;
 		void OnGameEnded() override;
 
+		// LeaderboardNotificationBus
+		void OnRunRecorded(const LeaderboardEntry& i_entry, LeaderboardRank i_rank, LeaderboardRank i_seedRank) override;
+
 		// ScoreNotificationBus
 		void OnScoreChanged(TotalPoints i_newPoints) override;
 		void OnClaimedTilesChanged(TileCount i_newClaimedTiles) override;
@@ -84,6 +99,10 @@ namespace Loherangrin::Games::O3DEJam2305
 		void OnLandingEnded() override;
 		void OnTakeOffStarted() override;
 
+		// SpaceshipsNotificationBus
+		void OnSpaceshipRegistered(const AZ::EntityId& i_spaceshipEntityId) override;
+		void OnSpaceshipUnregistered(const AZ::EntityId& i_spaceshipEntityId) override;
+
 		// TilesNotificationBus
 		void OnAllTilesCreated();
 		void OnTileEnergyChanged(const AZ::EntityId& i_tileEntityId, float i_normalizedNewEnergy) override;
@@ -101,23 +120,27 @@ namespace Loherangrin::Games::O3DEJam2305
 			BEFORE_LAND,
 			LAND,
 			LOADING,
-			AFTER_LOADING,
-			COLLECTABLE
+			AFTER_LOADING
 		};
 
 		bool FindAllUiElements(const AZ::EntityId& i_canvasId);
-		AZ::EntityId FindUiElement(const char* i_elementName) const;
 
 		void InitializeAllUiElements();
 		
 		void ShowMainMenu();
 		void CreateGame();
 		void StartGame();
-		void ResumeGame();
 		void EndGame();
 		void DestroyGame();
 
-		void SetCollectableText(const AZStd::string& i_message, bool i_isPositive);
+		bool IsTransitionRunning() const;
+
+		void BindPlayerSpaceship(const AZ::EntityId& i_spaceshipEntityId);
+		static AZ::EntityId FindPlayerSpaceship();
+
+		void BindAllTexts();
+		void UnbindAllTexts();
+		void RefreshAllTexts();
 
 		static void ConnectOnButtonClick(const AZ::EntityId& i_buttonEntityId, const UiButtonInterface::OnClickCallback& i_callback);
 
@@ -136,6 +159,9 @@ namespace Loherangrin::Games::O3DEJam2305
 		float m_fadeDuration { 2.f };
 		float m_timer { -1.f };
 
+		bool m_isInstantStart { false };
+
+		AZ::EntityId m_playerSpaceshipEntityId {};
 		AZ::EntityId m_selectedTileEntityId {};
 
 		AZ::EntityId m_menuCamera {};
@@ -180,9 +206,18 @@ namespace Loherangrin::Games::O3DEJam2305
 		AZ::EntityId m_gameCompletedEntityId {};
 		AZ::EntityId m_gameFailedEntityId {};
 		AZ::EntityId m_finalScoreEntityId {};
+		AZ::EntityId m_rankEntityId {};
 		AZ::EntityId m_retryGameEntityId {};
 		AZ::EntityId m_returnMainMenuEntityId {};
 
+		// Texts
+		HudTextBinding m_claimedTilesText {};
+		HudTextBinding m_scoreText {};
+		HudTextBinding m_finalScoreText {};
+		HudTextBinding m_rankText {};
+
+		CollectableBannerQueue m_collectableBanners {};
+
 		const AZ::EntityId* m_spaceshipEnergyEntityId { nullptr };
 		const AZ::EntityId* m_tileEnergyEntityId { nullptr };
 
@@ -219,8 +254,11 @@ namespace Loherangrin::Games::O3DEJam2305
 		static constexpr const char* UI_END_MENU_GAME_COMPLETED = "Background_Completed";
 		static constexpr const char* UI_END_MENU_GAME_FAILED = "Background_Failed";
 		static constexpr const char* UI_END_MENU_FINAL_SCORE_TEXT = "FinalScore_Value";
+		static constexpr const char* UI_END_MENU_RANK_TEXT = "Rank_Value";
 		static constexpr const char* UI_END_MENU_RETRY_BUTTON = "RetryButton";
 		static constexpr const char* UI_END_MENU_RETURN_BUTTON = "ReturnButton";
+
+		static const UiElementBinding<UiComponent> UI_ELEMENTS[];
 	};
 
 } // Loherangrin::Games::O3DEJam2305
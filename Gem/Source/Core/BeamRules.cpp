@@ -0,0 +1,34 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BeamRules.hpp"
+
+using Loherangrin::Games::O3DEJam2305::BeamRules;
+using Loherangrin::Games::O3DEJam2305::BeamTransfer;
+
+
+BeamTransfer BeamRules::CalculateTransfer(float i_transferSpeed, AZStd::size_t i_nSelectedTiles, float i_deltaTime)
+{
+	if(i_nSelectedTiles == 0)
+	{
+		return BeamTransfer {};
+	}
+
+	const float sentEnergy = i_transferSpeed * i_deltaTime;
+	const float tileEnergy = sentEnergy / static_cast<float>(i_nSelectedTiles);
+
+	return BeamTransfer { sentEnergy, tileEnergy };
+}
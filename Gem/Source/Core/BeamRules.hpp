@@ -0,0 +1,37 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	struct BeamTransfer
+	{
+		float m_sentEnergy { 0.f };
+		float m_tileEnergy { 0.f };
+	};
+
+	class BeamRules
+	{
+	public:
+		// the spaceship pays for the whole beam, which is split evenly among the selected tiles
+		static BeamTransfer CalculateTransfer(float i_transferSpeed, AZStd::size_t i_nSelectedTiles, float i_deltaTime);
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,104 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CollectableRules.hpp"
+
+using Loherangrin::Games::O3DEJam2305::CollectableEffect;
+using Loherangrin::Games::O3DEJam2305::CollectableRules;
+using Loherangrin::Games::O3DEJam2305::CollectableType;
+using Loherangrin::Games::O3DEJam2305::RandomStream;
+
+
+CollectableEffect CollectableRules::CalculateEffect(CollectableType i_type, float i_amount, float i_duration)
+{
+	CollectableEffect effect;
+
+	switch(i_type)
+	{
+		case CollectableType::STOP_DECAY:
+		{
+			effect.m_stopDecayDuration = i_duration;
+		}
+		break;
+
+		case CollectableType::SPACESHIP_DAMAGE:
+		{
+			effect.m_spaceshipEnergy = -i_amount;
+		}
+		break;
+
+		case CollectableType::SPACESHIP_ENERGY:
+		{
+			effect.m_spaceshipEnergy = i_amount;
+		}
+		break;
+
+		case CollectableType::TILE_DAMAGE:
+		{
+			effect.m_tileEnergy = -i_amount;
+		}
+		break;
+
+		case CollectableType::TILE_ENERGY:
+		{
+			effect.m_tileEnergy = i_amount;
+		}
+		break;
+
+		case CollectableType::SMALL_POINTS:
+		case CollectableType::MEDIUM_POINTS:
+		case CollectableType::LARGE_POINTS:
+		{
+			effect.m_points = static_cast<CollectableEffect::Points>(i_amount);
+		}
+		break;
+
+		case CollectableType::SPEED_UP:
+		{
+			effect.m_speedMultiplier = i_amount;
+			effect.m_speedDuration = i_duration;
+		}
+		break;
+
+		case CollectableType::SPEED_DOWN:
+		{
+			effect.m_speedMultiplier = 1.f / i_amount;
+			effect.m_speedDuration = i_duration;
+		}
+		break;
+
+		default:
+		{}
+	}
+
+	return effect;
+}
+
+CollectableType CollectableRules::SampleDrop(RandomStream& io_randomStream, float i_probability, AZ::u8 i_nTypes)
+{
+	const bool hasCollectable = (io_randomStream.GetRandomFloat() < i_probability);
+	if(!hasCollectable || i_nTypes == 0)
+	{
+		return CollectableType::NONE;
+	}
+
+	return static_cast<CollectableType>(io_randomStream.GetRandomBounded(i_nTypes) + 1);
+}
+
+float CollectableRules::GenerateRandomInRange(RandomStream& io_randomStream, float i_min, float i_max)
+{
+	return (i_min + (io_randomStream.GetRandomFloat() * (i_max - i_min)));
+}
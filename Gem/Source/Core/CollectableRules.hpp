@@ -0,0 +1,67 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "RandomStream.hpp"
+
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	enum class CollectableType : AZ::u8
+	{
+		NONE = 0,
+		STOP_DECAY,
+		SPACESHIP_DAMAGE,
+		SPACESHIP_ENERGY,
+		TILE_DAMAGE,
+		TILE_ENERGY,
+		SMALL_POINTS,
+		MEDIUM_POINTS,
+		LARGE_POINTS,
+		SPEED_UP,
+		SPEED_DOWN
+	};
+
+	struct CollectableEffect
+	{
+		using Points = AZ::u16;
+
+		float m_spaceshipEnergy { 0.f };
+		float m_tileEnergy { 0.f };
+		Points m_points { 0 };
+
+		float m_speedMultiplier { 1.f };
+		float m_speedDuration { 0.f };
+
+		float m_stopDecayDuration { 0.f };
+	};
+
+	class CollectableRules
+	{
+	public:
+		static CollectableEffect CalculateEffect(CollectableType i_type, float i_amount, float i_duration);
+
+		// the pool and the simulator draw from their streams in the same order, so seeded sessions keep their collectables
+		static CollectableType SampleDrop(RandomStream& io_randomStream, float i_probability, AZ::u8 i_nTypes);
+
+		static float GenerateRandomInRange(RandomStream& io_randomStream, float i_min, float i_max);
+
+		static constexpr AZ::u8 N_TYPES = static_cast<AZ::u8>(CollectableType::SPEED_DOWN);
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,160 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/std/containers/queue.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/limits.h>
+
+#include "FlowField.hpp"
+
+using Loherangrin::Games::O3DEJam2305::FlowField;
+using Loherangrin::Games::O3DEJam2305::TileId;
+
+
+const FlowField::Step FlowField::STEPS[FlowField::N_STEPS] =
+{
+	{ -1,  0, 1.f },
+	{  1,  0, 1.f },
+	{  0, -1, 1.f },
+	{  0,  1, 1.f },
+	{ -1, -1, DIAGONAL_COST },
+	{ -1,  1, DIAGONAL_COST },
+	{  1, -1, DIAGONAL_COST },
+	{  1,  1, DIAGONAL_COST }
+};
+
+void FlowField::Build(AZ::u16 i_gridLength, const CellMask& i_blockedCells, AZStd::span<const TileId> i_targetCells)
+{
+	using QueueItem = AZStd::pair<float, TileId>;
+
+	m_gridLength = i_gridLength;
+
+	const TileCount nCells = static_cast<TileCount>(i_gridLength) * i_gridLength;
+	m_distances.assign(nCells, AZStd::numeric_limits<float>::max());
+	m_directions.assign(nCells, DIRECTIONS_NONE);
+
+	AZStd::priority_queue<QueueItem, AZStd::vector<QueueItem>, AZStd::greater<QueueItem>> frontier {};
+
+	for(const TileId targetCell : i_targetCells)
+	{
+		if(targetCell >= nCells || i_blockedCells[targetCell])
+		{
+			continue;
+		}
+
+		m_distances[targetCell] = 0.f;
+		m_directions[targetCell] = DIRECTIONS_TARGET;
+
+		frontier.emplace(0.f, targetCell);
+	}
+
+	while(!frontier.empty())
+	{
+		const auto [distance, cell] = frontier.top();
+		frontier.pop();
+
+		if(distance > m_distances[cell])
+		{
+			continue;
+		}
+
+		for(Direction i = 0; i < N_STEPS; ++i)
+		{
+			const Step& step = STEPS[i];
+
+			const TileId neighbor = CalculateNeighbor(cell, step);
+			if(neighbor == INVALID_TILE_ID || i_blockedCells[neighbor] || IsCornerBlocked(cell, step, i_blockedCells))
+			{
+				continue;
+			}
+
+			const float neighborDistance = distance + step.m_cost;
+			if(neighborDistance >= m_distances[neighbor])
+			{
+				continue;
+			}
+
+			m_distances[neighbor] = neighborDistance;
+
+			// The neighbor reaches the target moving back along the explored step
+			m_directions[neighbor] = (i < 4) ? (i ^ 1) : (N_STEPS + 3 - i);
+
+			frontier.emplace(neighborDistance, neighbor);
+		}
+	}
+}
+
+bool FlowField::IsReachable(TileId i_cell) const
+{
+	return (i_cell < m_directions.size() && m_directions[i_cell] != DIRECTIONS_NONE);
+}
+
+bool FlowField::IsTarget(TileId i_cell) const
+{
+	return (i_cell < m_directions.size() && m_directions[i_cell] == DIRECTIONS_TARGET);
+}
+
+float FlowField::GetDistance(TileId i_cell) const
+{
+	if(i_cell >= m_distances.size())
+	{
+		return AZStd::numeric_limits<float>::max();
+	}
+
+	return m_distances[i_cell];
+}
+
+TileId FlowField::GetNextCell(TileId i_cell) const
+{
+	if(i_cell >= m_directions.size())
+	{
+		return INVALID_TILE_ID;
+	}
+
+	const Direction direction = m_directions[i_cell];
+	if(direction < 0)
+	{
+		return (direction == DIRECTIONS_TARGET) ? i_cell : INVALID_TILE_ID;
+	}
+
+	return CalculateNeighbor(i_cell, STEPS[direction]);
+}
+
+TileId FlowField::CalculateNeighbor(TileId i_cell, const Step& i_step) const
+{
+	const auto row = static_cast<AZ::s32>(i_cell / m_gridLength) + i_step.m_rowOffset;
+	const auto column = static_cast<AZ::s32>(i_cell % m_gridLength) + i_step.m_columnOffset;
+
+	if(row < 0 || row >= m_gridLength || column < 0 || column >= m_gridLength)
+	{
+		return INVALID_TILE_ID;
+	}
+
+	return (static_cast<TileId>(row) * m_gridLength) + static_cast<TileId>(column);
+}
+
+bool FlowField::IsCornerBlocked(TileId i_cell, const Step& i_step, const CellMask& i_blockedCells) const
+{
+	if(i_step.m_rowOffset == 0 || i_step.m_columnOffset == 0)
+	{
+		return false;
+	}
+
+	const TileId rowNeighbor = CalculateNeighbor(i_cell, { i_step.m_rowOffset, 0, 0.f });
+	const TileId columnNeighbor = CalculateNeighbor(i_cell, { 0, i_step.m_columnOffset, 0.f });
+
+	return (i_blockedCells[rowNeighbor] || i_blockedCells[columnNeighbor]);
+}
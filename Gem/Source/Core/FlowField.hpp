@@ -0,0 +1,67 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+#include "GridTypes.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class FlowField
+	{
+	public:
+		using CellMask = AZStd::vector<bool>;
+
+		void Build(AZ::u16 i_gridLength, const CellMask& i_blockedCells, AZStd::span<const TileId> i_targetCells);
+
+		bool IsReachable(TileId i_cell) const;
+		bool IsTarget(TileId i_cell) const;
+
+		float GetDistance(TileId i_cell) const;
+		TileId GetNextCell(TileId i_cell) const;
+
+	private:
+		using Direction = AZ::s8;
+
+		struct Step
+		{
+			AZ::s8 m_rowOffset { 0 };
+			AZ::s8 m_columnOffset { 0 };
+			float m_cost { 0.f };
+		};
+
+		TileId CalculateNeighbor(TileId i_cell, const Step& i_step) const;
+		bool IsCornerBlocked(TileId i_cell, const Step& i_step, const CellMask& i_blockedCells) const;
+
+		AZ::u16 m_gridLength { 0 };
+
+		AZStd::vector<float> m_distances {};
+		AZStd::vector<Direction> m_directions {};
+
+		static constexpr Direction DIRECTIONS_NONE = -1;
+		static constexpr Direction DIRECTIONS_TARGET = -2;
+
+		static constexpr float DIAGONAL_COST = 1.41421356f;
+
+		static constexpr AZ::u8 N_STEPS = 8;
+		static const Step STEPS[N_STEPS];
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,522 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/std/algorithm.h>
+
+#include <cmath>
+
+#include "GridReplication.hpp"
+
+using Loherangrin::Games::O3DEJam2305::BandwidthCounter;
+using Loherangrin::Games::O3DEJam2305::GridAckPacket;
+using Loherangrin::Games::O3DEJam2305::GridDeltaDecoder;
+using Loherangrin::Games::O3DEJam2305::GridDeltaEncoder;
+using Loherangrin::Games::O3DEJam2305::GridDeltaHeader;
+using Loherangrin::Games::O3DEJam2305::GridPacketType;
+using Loherangrin::Games::O3DEJam2305::GridReplica;
+using Loherangrin::Games::O3DEJam2305::PackedGrid;
+using Loherangrin::Games::O3DEJam2305::PackedTile;
+using Loherangrin::Games::O3DEJam2305::TileId;
+
+
+namespace
+{
+	// unchanged tiles between two runs are sent anyway when they cost less than the header of a new run
+	static constexpr TileId MAX_RUN_GAP = 1;
+	static constexpr AZStd::size_t MAX_VARINT_SIZE = 5;
+
+	static AZStd::size_t GetVarIntSize(AZ::u32 i_value)
+	{
+		AZStd::size_t size = 1;
+		while(i_value >= 0x80)
+		{
+			i_value >>= 7;
+			++size;
+		}
+
+		return size;
+	}
+
+	static AZ::u8* WriteVarInt(AZ::u32 i_value, AZ::u8* o_buffer)
+	{
+		while(i_value >= 0x80)
+		{
+			*o_buffer++ = static_cast<AZ::u8>(i_value | 0x80);
+			i_value >>= 7;
+		}
+
+		*o_buffer++ = static_cast<AZ::u8>(i_value);
+		return o_buffer;
+	}
+
+	static const AZ::u8* ReadVarInt(const AZ::u8* i_buffer, const AZ::u8* i_end, AZ::u32& o_value)
+	{
+		o_value = 0;
+
+		for(AZ::u32 shift = 0; shift < 7 * MAX_VARINT_SIZE && i_buffer < i_end; shift += 7)
+		{
+			const AZ::u8 byte = *i_buffer++;
+			o_value |= static_cast<AZ::u32>(byte & 0x7F) << shift;
+
+			if((byte & 0x80) == 0)
+			{
+				return i_buffer;
+			}
+		}
+
+		return nullptr;
+	}
+}
+
+// ---
+
+PackedTile PackedTile::Pack(float i_normalizedEnergy, bool i_isClaimed, bool i_isLocked)
+{
+	PackedTile tile;
+	tile.m_energy = static_cast<AZ::u8>(std::lround(AZStd::clamp(i_normalizedEnergy, 0.f, 1.f) * 255.f));
+	tile.m_flags = (i_isClaimed ? FLAG_CLAIMED : 0) | (i_isLocked ? FLAG_LOCKED : 0);
+
+	return tile;
+}
+
+float PackedTile::GetNormalizedEnergy() const
+{
+	return static_cast<float>(m_energy) / 255.f;
+}
+
+bool PackedTile::IsClaimed() const
+{
+	return (m_flags & FLAG_CLAIMED) != 0;
+}
+
+bool PackedTile::IsLocked() const
+{
+	return (m_flags & FLAG_LOCKED) != 0;
+}
+
+bool PackedTile::operator==(const PackedTile& i_other) const
+{
+	return (m_energy == i_other.m_energy && m_flags == i_other.m_flags);
+}
+
+bool PackedTile::operator!=(const PackedTile& i_other) const
+{
+	return !(*this == i_other);
+}
+
+// ---
+
+void BandwidthCounter::Add(AZStd::size_t i_nBytes)
+{
+	m_totalBytes += i_nBytes;
+	m_sampleBytes += i_nBytes;
+	++m_samplePackets;
+}
+
+void BandwidthCounter::Update(float i_deltaTime)
+{
+	m_sampleTime += i_deltaTime;
+	if(m_sampleTime < 1.f)
+	{
+		return;
+	}
+
+	m_bytesPerSecond = static_cast<float>(m_sampleBytes) / m_sampleTime;
+	m_packetsPerSecond = static_cast<float>(m_samplePackets) / m_sampleTime;
+
+	m_sampleBytes = 0;
+	m_samplePackets = 0;
+	m_sampleTime = 0.f;
+}
+
+float BandwidthCounter::GetBytesPerSecond() const
+{
+	return m_bytesPerSecond;
+}
+
+float BandwidthCounter::GetPacketsPerSecond() const
+{
+	return m_packetsPerSecond;
+}
+
+AZ::u64 BandwidthCounter::GetTotalBytes() const
+{
+	return m_totalBytes;
+}
+
+// ---
+
+void GridDeltaEncoder::Reset(AZ::u16 i_gridLength, AZ::u64 i_layoutSeed)
+{
+	m_gridLength = i_gridLength;
+	m_layoutSeed = i_layoutSeed;
+	++m_session;
+	m_emptyGrid.assign(static_cast<TileId>(i_gridLength) * i_gridLength, PackedTile {});
+
+	for(SentSnapshot& snapshot : m_history)
+	{
+		snapshot.m_sequence = 0;
+		snapshot.m_grid.clear();
+		snapshot.m_cursor = 0;
+	}
+
+	m_nextSequence = 1;
+	m_ackedSequence = 0;
+	m_ackedSlot = 0;
+}
+
+AZStd::size_t GridDeltaEncoder::Encode(const PackedGrid& i_grid, AZ::u8* o_packet, AZStd::size_t i_maxPacketSize)
+{
+	const TileId nTiles = m_emptyGrid.size();
+	AZ_Assert(i_grid.size() == nTiles, "Grid does not match the length the encoder was reset to");
+	AZ_Assert(i_maxPacketSize > sizeof(GridDeltaHeader) + 2 * MAX_VARINT_SIZE + sizeof(PackedTile), "Packet size is too small to carry any tile");
+
+	// the client only keeps as many snapshots as the encoder, so an older base may be gone when acks are lost
+	if(m_ackedSequence != 0 && m_nextSequence - m_ackedSequence > m_history.size())
+	{
+		m_ackedSequence = 0;
+	}
+
+	const PackedGrid& baseGrid = GetBaseGrid();
+
+	AZ::u8* writePtr = o_packet + sizeof(GridDeltaHeader);
+	const AZ::u8* const endPtr = o_packet + i_maxPacketSize;
+
+	AZ::u32 nRuns = 0;
+	bool isFull = false;
+
+	// the client may have applied packets after the base, so their tiles are sent again before any other
+	const TileId baseCursor = GetBaseCursor();
+
+	TileId nScannedTiles = 0;
+	TileId tileId = (baseCursor < nTiles) ? baseCursor : 0;
+
+	SentSnapshot* snapshot = nullptr;
+
+	while(nScannedTiles < nTiles && !isFull)
+	{
+		if(i_grid[tileId] == baseGrid[tileId])
+		{
+			++nScannedTiles;
+			tileId = (tileId + 1 < nTiles) ? tileId + 1 : 0;
+
+			continue;
+		}
+
+		// runs never wrap around the end of the grid
+		const TileId runStart = tileId;
+		TileId runEnd = runStart + 1;
+		TileId lastChanged = runStart;
+
+		while(runEnd < nTiles && nScannedTiles + (runEnd - runStart) < nTiles)
+		{
+			if(i_grid[runEnd] != baseGrid[runEnd])
+			{
+				lastChanged = runEnd;
+			}
+			else if(runEnd - lastChanged > MAX_RUN_GAP)
+			{
+				break;
+			}
+
+			++runEnd;
+		}
+
+		runEnd = lastChanged + 1;
+
+		const auto headerSize = GetVarIntSize(static_cast<AZ::u32>(runStart)) + MAX_VARINT_SIZE;
+		const auto availableSize = static_cast<AZStd::size_t>(endPtr - writePtr);
+		if(availableSize < headerSize + sizeof(PackedTile))
+		{
+			isFull = true;
+			break;
+		}
+
+		TileId runLength = runEnd - runStart;
+
+		const TileId maxRunLength = (availableSize - headerSize) / sizeof(PackedTile);
+		if(runLength > maxRunLength)
+		{
+			runLength = maxRunLength;
+			isFull = true;
+		}
+
+		if(!snapshot)
+		{
+			snapshot = &AllocateSnapshot();
+			snapshot->m_grid = baseGrid;
+		}
+
+		writePtr = WriteVarInt(static_cast<AZ::u32>(runStart), writePtr);
+		writePtr = WriteVarInt(static_cast<AZ::u32>(runLength), writePtr);
+
+		for(TileId i = runStart; i < runStart + runLength; ++i)
+		{
+			*writePtr++ = i_grid[i].m_energy;
+			*writePtr++ = i_grid[i].m_flags;
+
+			snapshot->m_grid[i] = i_grid[i];
+		}
+
+		++nRuns;
+
+		nScannedTiles += runLength;
+		tileId = (runStart + runLength < nTiles) ? runStart + runLength : 0;
+	}
+
+	if(!snapshot)
+	{
+		return 0;
+	}
+
+	// once this snapshot is acknowledged, the next packets start from the first tile that did not fit, so that every tile is eventually sent
+	snapshot->m_cursor = (isFull) ? tileId : 0;
+	snapshot->m_sequence = m_nextSequence++;
+
+	GridDeltaHeader header;
+	header.m_session = m_session;
+	header.m_gridLength = m_gridLength;
+	header.m_sequence = snapshot->m_sequence;
+	header.m_baseSequence = m_ackedSequence;
+	header.m_nRuns = nRuns;
+	header.m_layoutSeed = m_layoutSeed;
+
+	memcpy(o_packet, &header, sizeof(GridDeltaHeader));
+
+	return static_cast<AZStd::size_t>(writePtr - o_packet);
+}
+
+void GridDeltaEncoder::Acknowledge(AZ::u32 i_sequence)
+{
+	if(i_sequence <= m_ackedSequence)
+	{
+		return;
+	}
+
+	for(AZ::u32 i = 0; i < m_history.size(); ++i)
+	{
+		if(m_history[i].m_sequence == i_sequence)
+		{
+			m_ackedSequence = i_sequence;
+			m_ackedSlot = i;
+
+			return;
+		}
+	}
+}
+
+AZ::u32 GridDeltaEncoder::GetAcknowledgedSequence() const
+{
+	return m_ackedSequence;
+}
+
+const PackedGrid& GridDeltaEncoder::GetBaseGrid() const
+{
+	if(m_ackedSequence == 0)
+	{
+		return m_emptyGrid;
+	}
+
+	return m_history[m_ackedSlot].m_grid;
+}
+
+TileId GridDeltaEncoder::GetBaseCursor() const
+{
+	if(m_ackedSequence == 0)
+	{
+		return 0;
+	}
+
+	return m_history[m_ackedSlot].m_cursor;
+}
+
+GridDeltaEncoder::SentSnapshot& GridDeltaEncoder::AllocateSnapshot()
+{
+	// the oldest snapshot is replaced, unless the client is still acknowledging it
+	AZ::u32 slot = m_nextSequence % m_history.size();
+	if(m_ackedSequence != 0 && slot == m_ackedSlot)
+	{
+		slot = (slot + 1) % m_history.size();
+	}
+
+	return m_history[slot];
+}
+
+// ---
+
+void GridDeltaDecoder::Reset()
+{
+	for(ReceivedSnapshot& snapshot : m_history)
+	{
+		snapshot.m_sequence = 0;
+		snapshot.m_grid.clear();
+	}
+
+	m_nextSlot = 0;
+	m_currentSlot = 0;
+	m_currentSequence = 0;
+	m_gridLength = 0;
+	m_layoutSeed = 0;
+	m_session = 0;
+
+	m_emptyGrid.clear();
+}
+
+AZ::u32 GridDeltaDecoder::Decode(const AZ::u8* i_packet, AZStd::size_t i_packetSize)
+{
+	if(i_packetSize < sizeof(GridDeltaHeader))
+	{
+		return 0;
+	}
+
+	GridDeltaHeader header;
+	memcpy(&header, i_packet, sizeof(GridDeltaHeader));
+
+	if(header.m_type != GridPacketType::DELTA)
+	{
+		return 0;
+	}
+
+	// a new session may replay the same layout from the first sequence again
+	if(header.m_session != m_session || header.m_layoutSeed != m_layoutSeed || header.m_gridLength != m_gridLength)
+	{
+		Reset();
+
+		m_gridLength = header.m_gridLength;
+		m_layoutSeed = header.m_layoutSeed;
+		m_session = header.m_session;
+	}
+	else if(header.m_sequence <= m_currentSequence)
+	{
+		return 0;
+	}
+
+	// the base may have been dropped already, or never received at all
+	const PackedGrid* baseGrid = FindGrid(header.m_baseSequence, header.m_gridLength);
+	if(!baseGrid)
+	{
+		return 0;
+	}
+
+	const AZ::u32 slot = m_nextSlot;
+	ReceivedSnapshot& snapshot = m_history[slot];
+
+	if(baseGrid != &snapshot.m_grid)
+	{
+		snapshot.m_grid = *baseGrid;
+	}
+
+	snapshot.m_sequence = 0;
+
+	const TileId nTiles = snapshot.m_grid.size();
+
+	const AZ::u8* readPtr = i_packet + sizeof(GridDeltaHeader);
+	const AZ::u8* const endPtr = i_packet + i_packetSize;
+
+	for(AZ::u32 i = 0; i < header.m_nRuns; ++i)
+	{
+		AZ::u32 runStart;
+		AZ::u32 runLength;
+
+		readPtr = ReadVarInt(readPtr, endPtr, runStart);
+		if(readPtr)
+		{
+			readPtr = ReadVarInt(readPtr, endPtr, runLength);
+		}
+
+		if(!readPtr || runStart >= nTiles || runLength > nTiles - runStart ||
+			static_cast<AZStd::size_t>(endPtr - readPtr) < runLength * sizeof(PackedTile))
+		{
+			snapshot.m_grid.clear();
+			return 0;
+		}
+
+		for(TileId tileId = runStart; tileId < runStart + runLength; ++tileId)
+		{
+			snapshot.m_grid[tileId].m_energy = *readPtr++;
+			snapshot.m_grid[tileId].m_flags = *readPtr++;
+		}
+	}
+
+	snapshot.m_sequence = header.m_sequence;
+
+	m_currentSlot = slot;
+	m_currentSequence = header.m_sequence;
+
+	m_nextSlot = (slot + 1) % m_history.size();
+
+	return header.m_sequence;
+}
+
+const PackedGrid& GridDeltaDecoder::GetGrid() const
+{
+	if(m_currentSequence == 0)
+	{
+		return m_emptyGrid;
+	}
+
+	return m_history[m_currentSlot].m_grid;
+}
+
+AZ::u16 GridDeltaDecoder::GetGridLength() const
+{
+	return m_gridLength;
+}
+
+AZ::u64 GridDeltaDecoder::GetLayoutSeed() const
+{
+	return m_layoutSeed;
+}
+
+AZ::u32 GridDeltaDecoder::GetSequence() const
+{
+	return m_currentSequence;
+}
+
+const PackedGrid* GridDeltaDecoder::FindGrid(AZ::u32 i_sequence, AZ::u16 i_gridLength)
+{
+	if(i_sequence == 0)
+	{
+		m_emptyGrid.assign(static_cast<TileId>(i_gridLength) * i_gridLength, PackedTile {});
+		return &m_emptyGrid;
+	}
+
+	for(const ReceivedSnapshot& snapshot : m_history)
+	{
+		if(snapshot.m_sequence == i_sequence)
+		{
+			return (snapshot.m_grid.size() == static_cast<TileId>(i_gridLength) * i_gridLength) ? &snapshot.m_grid : nullptr;
+		}
+	}
+
+	return nullptr;
+}
+
+// ---
+
+void GridReplica::Reset(TileId i_nTiles)
+{
+	m_appliedGrid.assign(i_nTiles, PackedTile {});
+	m_isApplied.assign(i_nTiles, false);
+}
+
+void GridReplica::InvalidateTile(TileId i_tileId)
+{
+	if(i_tileId < m_isApplied.size())
+	{
+		m_isApplied[i_tileId] = false;
+	}
+}
@@ -0,0 +1,235 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+#include "GridTypes.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// below the usual MTU, so that packets are never fragmented
+	static constexpr AZStd::size_t MAX_REPLICATION_PACKET_SIZE = 1200;
+
+	// Replicated state of a tile, with its energy quantized to 8 bits
+	struct PackedTile
+	{
+		AZ::u8 m_energy { 0 };
+		AZ::u8 m_flags { 0 };
+
+		static constexpr AZ::u8 FLAG_CLAIMED = 1 << 0;
+		static constexpr AZ::u8 FLAG_LOCKED = 1 << 1;
+
+		static PackedTile Pack(float i_normalizedEnergy, bool i_isClaimed, bool i_isLocked);
+
+		float GetNormalizedEnergy() const;
+		bool IsClaimed() const;
+		bool IsLocked() const;
+
+		bool operator==(const PackedTile& i_other) const;
+		bool operator!=(const PackedTile& i_other) const;
+	};
+
+	static_assert(sizeof(PackedTile) == 2, "Packed tiles must stay 2 bytes long");
+
+	using PackedGrid = AZStd::vector<PackedTile>;
+
+	// ---
+
+	enum class GridPacketType : AZ::u8
+	{
+		DELTA = 1,
+		ACK
+	};
+
+	// A delta packet is followed by runs of changed tiles, each one made of its first tile id and its length as varints,
+	// then of the packed tiles themselves. The base is the snapshot the runs are applied to, 0 being a grid of empty tiles.
+	// Sequences restart from 1 in each session, which the server begins whenever it resets its grid, even on the same layout.
+	struct GridDeltaHeader
+	{
+		GridPacketType m_type { GridPacketType::DELTA };
+		AZ::u8 m_session { 0 };
+		AZ::u16 m_gridLength { 0 };
+		AZ::u32 m_sequence { 0 };
+		AZ::u32 m_baseSequence { 0 };
+		AZ::u32 m_nRuns { 0 };
+		AZ::u64 m_layoutSeed { 0 };
+	};
+
+	static_assert(sizeof(GridDeltaHeader) == 24, "Grid delta headers must stay 24 bytes long");
+
+	struct GridAckPacket
+	{
+		GridPacketType m_type { GridPacketType::ACK };
+		AZ::u8 m_reserved[3] { 0, 0, 0 };
+		AZ::u32 m_sequence { 0 };
+	};
+
+	static_assert(sizeof(GridAckPacket) == 8, "Grid ack packets must stay 8 bytes long");
+
+	// ---
+
+	// Bytes and packets counted over the last whole second, for the overlays and console commands
+	class BandwidthCounter
+	{
+	public:
+		void Add(AZStd::size_t i_nBytes);
+		void Update(float i_deltaTime);
+
+		float GetBytesPerSecond() const;
+		float GetPacketsPerSecond() const;
+		AZ::u64 GetTotalBytes() const;
+
+	private:
+		AZ::u64 m_totalBytes { 0 };
+
+		AZ::u64 m_sampleBytes { 0 };
+		AZ::u32 m_samplePackets { 0 };
+		float m_sampleTime { 0.f };
+
+		float m_bytesPerSecond { 0.f };
+		float m_packetsPerSecond { 0.f };
+	};
+
+	// ---
+
+	// Server side of the replication of a grid to a single client.
+	// Each packet only carries the tiles that differ from the last snapshot acknowledged by the client, up to a maximum size,
+	// so that bandwidth stays bounded on any grid. Packets go on from the tile where the acknowledged snapshot stopped:
+	// until a packet is acknowledged, the following ones carry its tiles again with their latest state, instead of
+	// reverting them to the older base on the client.
+	class GridDeltaEncoder
+	{
+	public:
+		void Reset(AZ::u16 i_gridLength, AZ::u64 i_layoutSeed);
+
+		// returns the size of the packet written to the buffer, which is 0 when the client is already up to date
+		AZStd::size_t Encode(const PackedGrid& i_grid, AZ::u8* o_packet, AZStd::size_t i_maxPacketSize);
+		void Acknowledge(AZ::u32 i_sequence);
+
+		AZ::u32 GetAcknowledgedSequence() const;
+
+	private:
+		struct SentSnapshot
+		{
+			AZ::u32 m_sequence { 0 };
+			PackedGrid m_grid {};
+
+			// first tile of the packets built on this snapshot, past the ones that did not fit in it
+			TileId m_cursor { 0 };
+		};
+
+		const PackedGrid& GetBaseGrid() const;
+		TileId GetBaseCursor() const;
+		SentSnapshot& AllocateSnapshot();
+
+		AZ::u16 m_gridLength { 0 };
+		AZ::u64 m_layoutSeed { 0 };
+		AZ::u8 m_session { 0 };
+		PackedGrid m_emptyGrid {};
+
+		AZStd::array<SentSnapshot, 16> m_history {};
+		AZ::u32 m_nextSequence { 1 };
+		AZ::u32 m_ackedSequence { 0 };
+		AZ::u32 m_ackedSlot { 0 };
+	};
+
+	// ---
+
+	// Client side of the replication, which rebuilds the snapshots of the server from its deltas
+	class GridDeltaDecoder
+	{
+	public:
+		void Reset();
+
+		// returns the sequence to acknowledge, or 0 when the packet could not be applied
+		AZ::u32 Decode(const AZ::u8* i_packet, AZStd::size_t i_packetSize);
+
+		const PackedGrid& GetGrid() const;
+		AZ::u16 GetGridLength() const;
+		AZ::u64 GetLayoutSeed() const;
+		AZ::u32 GetSequence() const;
+
+	private:
+		struct ReceivedSnapshot
+		{
+			AZ::u32 m_sequence { 0 };
+			PackedGrid m_grid {};
+		};
+
+		const PackedGrid* FindGrid(AZ::u32 i_sequence, AZ::u16 i_gridLength);
+
+		AZStd::array<ReceivedSnapshot, 16> m_history {};
+		AZ::u32 m_nextSlot { 0 };
+		AZ::u32 m_currentSlot { 0 };
+		AZ::u32 m_currentSequence { 0 };
+		AZ::u16 m_gridLength { 0 };
+		AZ::u64 m_layoutSeed { 0 };
+		AZ::u8 m_session { 0 };
+
+		PackedGrid m_emptyGrid {};
+	};
+
+	// ---
+
+	// Client side record of the replicated state applied to each tile.
+	// Tiles start without any state, so that the first snapshot reaches all of them, even the ones the server never changes.
+	class GridReplica
+	{
+	public:
+		void Reset(TileId i_nTiles);
+		void InvalidateTile(TileId i_tileId);
+
+		// the function is called with each tile whose replicated state was not applied yet, and returns whether it applied it
+		template <typename t_ApplyFunction>
+		void Apply(const PackedGrid& i_replicatedGrid, t_ApplyFunction i_applyFunction);
+
+	private:
+		PackedGrid m_appliedGrid {};
+		AZStd::vector<bool> m_isApplied {};
+	};
+
+	// ---
+
+	template <typename t_ApplyFunction>
+	void GridReplica::Apply(const PackedGrid& i_replicatedGrid, t_ApplyFunction i_applyFunction)
+	{
+		if(i_replicatedGrid.size() != m_appliedGrid.size())
+		{
+			return;
+		}
+
+		for(TileId tileId = 0; tileId < m_appliedGrid.size(); ++tileId)
+		{
+			const PackedTile& replicatedTile = i_replicatedGrid[tileId];
+			if(m_isApplied[tileId] && replicatedTile == m_appliedGrid[tileId])
+			{
+				continue;
+			}
+
+			if(i_applyFunction(tileId, replicatedTile))
+			{
+				m_appliedGrid[tileId] = replicatedTile;
+				m_isApplied[tileId] = true;
+			}
+		}
+	}
+
+} // Loherangrin::Games::O3DEJam2305
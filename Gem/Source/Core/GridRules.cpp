@@ -0,0 +1,77 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GridRules.hpp"
+
+using Loherangrin::Games::O3DEJam2305::GridRules;
+using Loherangrin::Games::O3DEJam2305::TileId;
+
+
+TileId GridRules::CalculateTileId(AZ::u16 i_gridLength, AZ::u16 i_row, AZ::u16 i_column)
+{
+	return (i_row * i_gridLength) + i_column;
+}
+
+GridRules::NeighborIds GridRules::CalculateNeighbors(AZ::u16 i_gridLength, AZ::u16 i_row, AZ::u16 i_column)
+{
+	NeighborIds neighborIds;
+
+	if(i_row > 0)
+	{
+		const AZ::u16 previousRow = i_row - 1;
+
+		if(i_column > 0)
+		{
+			neighborIds.emplace_back(CalculateTileId(i_gridLength, previousRow, i_column - 1));
+		}
+
+		neighborIds.emplace_back(CalculateTileId(i_gridLength, previousRow, i_column));
+
+		if(i_column < i_gridLength - 1)
+		{
+			neighborIds.emplace_back(CalculateTileId(i_gridLength, previousRow, i_column + 1));
+		}
+	}
+
+	if(i_column > 0)
+	{
+		neighborIds.emplace_back(CalculateTileId(i_gridLength, i_row, i_column - 1));
+	}
+
+	if(i_column < i_gridLength - 1)
+	{
+		neighborIds.emplace_back(CalculateTileId(i_gridLength, i_row, i_column + 1));
+	}
+
+	if(i_row < i_gridLength - 1)
+	{
+		const AZ::u16 nextRow = i_row + 1;
+
+		if(i_column > 0)
+		{
+			neighborIds.emplace_back(CalculateTileId(i_gridLength, nextRow, i_column - 1));
+		}
+
+		neighborIds.emplace_back(CalculateTileId(i_gridLength, nextRow, i_column));
+
+		if(i_column < i_gridLength - 1)
+		{
+			neighborIds.emplace_back(CalculateTileId(i_gridLength, nextRow, i_column + 1));
+		}
+	}
+
+	return neighborIds;
+}
@@ -0,0 +1,38 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/fixed_vector.h>
+
+#include "GridTypes.hpp"
+#include "TileRules.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class GridRules
+	{
+	public:
+		using NeighborIds = AZStd::fixed_vector<TileId, TileRules::MAX_NEIGHBORS>;
+
+		static TileId CalculateTileId(AZ::u16 i_gridLength, AZ::u16 i_row, AZ::u16 i_column);
+
+		// row by row, from the top-left neighbor to the bottom-right one
+		static NeighborIds CalculateNeighbors(AZ::u16 i_gridLength, AZ::u16 i_row, AZ::u16 i_column);
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,30 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/limits.h>
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	using TileId = AZStd::size_t;
+	using TileCount = TileId;
+
+    static constexpr TileId INVALID_TILE_ID = AZStd::numeric_limits<TileId>::max();
+
+} // Loherangrin::Games::O3DEJam2305
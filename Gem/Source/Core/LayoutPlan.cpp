@@ -0,0 +1,240 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/algorithm.h>
+
+#include "LayoutPlan.hpp"
+
+using Loherangrin::Games::O3DEJam2305::FlowField;
+using Loherangrin::Games::O3DEJam2305::LayoutPlan;
+using Loherangrin::Games::O3DEJam2305::RandomStream;
+using Loherangrin::Games::O3DEJam2305::RandomStreamId;
+
+
+void LayoutPlan::Generate(const Settings& i_settings, AZ::u64 i_seed, AZ::JobContext* io_jobContext)
+{
+	m_seed = i_seed;
+	m_gridLength = i_settings.m_gridLength;
+
+	m_obstacles.clear();
+	m_tiles.clear();
+	m_obstacleCells.assign(m_gridLength * m_gridLength, false);
+
+	RandomStream obstacleStream { RandomStreamId::OBSTACLES, i_seed };
+	GenerateObstacles(i_settings, obstacleStream);
+
+	const RandomStream tileTypeStream { RandomStreamId::TILE_TYPES, i_seed };
+	GenerateTiles(i_settings, tileTypeStream, io_jobContext);
+}
+
+void LayoutPlan::Clear()
+{
+	m_seed = 0;
+	m_gridLength = 0;
+
+	m_obstacles.clear();
+	m_tiles.clear();
+	m_obstacleCells.clear();
+}
+
+bool LayoutPlan::IsEmpty() const
+{
+	return (m_gridLength == 0);
+}
+
+AZ::u64 LayoutPlan::GetSeed() const
+{
+	return m_seed;
+}
+
+AZ::u16 LayoutPlan::GetGridLength() const
+{
+	return m_gridLength;
+}
+
+const AZStd::vector<LayoutPlan::Obstacle>& LayoutPlan::GetObstacles() const
+{
+	return m_obstacles;
+}
+
+const AZStd::vector<LayoutPlan::Tile>& LayoutPlan::GetTiles() const
+{
+	return m_tiles;
+}
+
+const FlowField::CellMask& LayoutPlan::GetObstacleCells() const
+{
+	return m_obstacleCells;
+}
+
+void LayoutPlan::GenerateObstacles(const Settings& i_settings, RandomStream& io_obstacleStream)
+{
+	if(i_settings.m_nObstacleTypes == 0)
+	{
+		return;
+	}
+
+	const float rowScale = i_settings.m_tileCellSize.GetY() / i_settings.m_obstacleCellSize.GetY();
+	const float columnScale = i_settings.m_tileCellSize.GetX() / i_settings.m_obstacleCellSize.GetX();
+
+	const float invertedRowScale = 1.f / rowScale;
+	const float invertedColumnScale = 1.f / columnScale;
+
+	const auto nObstacleRows = static_cast<AZ::u16>(rowScale * m_gridLength);
+	const auto nObstacleColumns = static_cast<AZ::u16>(columnScale * m_gridLength);
+
+	if(nObstacleRows == 0 || nObstacleColumns == 0)
+	{
+		return;
+	}
+
+	for(AZ::u16 i = 0, nAttempts = 0; i < i_settings.m_maxObstacles;)
+	{
+		const auto obstacleRow = static_cast<AZ::u16>(io_obstacleStream.GetRandomBounded(nObstacleRows));
+		const auto obstacleColumn = static_cast<AZ::u16>(io_obstacleStream.GetRandomBounded(nObstacleColumns));
+
+		if(obstacleRow == nObstacleRows / 2 && obstacleColumn == nObstacleColumns / 2)
+		{
+			++nAttempts;
+			if(nAttempts > i_settings.m_maxObstacles)
+			{
+				return;
+			}
+
+			continue;
+		}
+
+		const ObstacleType obstacleType = io_obstacleStream.GetRandomBounded(static_cast<AZ::u32>(i_settings.m_nObstacleTypes));
+		m_obstacles.push_back({ obstacleRow, obstacleColumn, obstacleType });
+
+		const auto tileRow = static_cast<AZ::u16>(static_cast<float>(obstacleRow) * invertedRowScale);
+		const auto tileColumn = static_cast<AZ::u16>(static_cast<float>(obstacleColumn) * invertedColumnScale);
+
+		const auto lastTileRow = AZStd::min(static_cast<AZ::u16>(tileRow + static_cast<AZ::u16>(invertedRowScale)), m_gridLength);
+		const auto lastTileColumn = AZStd::min(static_cast<AZ::u16>(tileColumn + static_cast<AZ::u16>(invertedColumnScale)), m_gridLength);
+
+		for(AZ::u16 j = tileRow; j < lastTileRow; ++j)
+		{
+			for(AZ::u16 k = tileColumn; k < lastTileColumn; ++k)
+			{
+				m_obstacleCells[(j * m_gridLength) + k] = true;
+			}
+		}
+
+		nAttempts = 0;
+		++i;
+	}
+}
+
+template <typename t_ChunkFunction>
+void LayoutPlan::ForEachRowChunk(AZ::JobContext* io_jobContext, const t_ChunkFunction& i_function) const
+{
+	const AZ::u16 nChunks = (m_gridLength + ROWS_PER_CHUNK - 1) / ROWS_PER_CHUNK;
+
+	const auto runChunk = [this, &i_function](AZ::u16 i_chunk)
+	{
+		const auto firstRow = static_cast<AZ::u16>(i_chunk * ROWS_PER_CHUNK);
+		const auto lastRow = static_cast<AZ::u16>(AZStd::min(firstRow + ROWS_PER_CHUNK, static_cast<int>(m_gridLength)));
+
+		i_function(i_chunk, firstRow, lastRow);
+	};
+
+	if(!io_jobContext || nChunks <= 1)
+	{
+		for(AZ::u16 i = 0; i < nChunks; ++i)
+		{
+			runChunk(i);
+		}
+
+		return;
+	}
+
+	// chunks only write their own part of the plan, and the calling thread helps running them while waiting
+	AZ::JobCompletion completion { io_jobContext };
+
+	for(AZ::u16 i = 0; i < nChunks; ++i)
+	{
+		AZ::Job* chunkJob = AZ::CreateJobFunction([&runChunk, i]()
+		{
+			runChunk(i);
+		}, true, io_jobContext);
+
+		chunkJob->SetDependent(&completion);
+		chunkJob->Start();
+	}
+
+	completion.StartAndWaitForCompletion();
+}
+
+void LayoutPlan::GenerateTiles(const Settings& i_settings, const RandomStream& i_tileTypeStream, AZ::JobContext* io_jobContext)
+{
+	const AZ::u16 halfLength = m_gridLength / 2;
+	const AZ::u16 nChunks = (m_gridLength + ROWS_PER_CHUNK - 1) / ROWS_PER_CHUNK;
+
+	// every chunk counts its free cells first, so that it knows where its own tiles start in the list
+	AZStd::vector<AZStd::size_t> chunkOffsets(nChunks + 1, 0);
+
+	ForEachRowChunk(io_jobContext, [this, &chunkOffsets](AZ::u16 i_chunk, AZ::u16 i_firstRow, AZ::u16 i_lastRow)
+	{
+		AZStd::size_t nFreeCells = 0;
+		for(AZStd::size_t cellIndex = i_firstRow * m_gridLength; cellIndex < i_lastRow * m_gridLength; ++cellIndex)
+		{
+			nFreeCells += (m_obstacleCells[cellIndex]) ? 0 : 1;
+		}
+
+		chunkOffsets[i_chunk + 1] = nFreeCells;
+	});
+
+	for(AZ::u16 i = 0; i < nChunks; ++i)
+	{
+		chunkOffsets[i + 1] += chunkOffsets[i];
+	}
+
+	m_tiles.resize(chunkOffsets[nChunks]);
+
+	ForEachRowChunk(io_jobContext, [this, &i_settings, &i_tileTypeStream, &chunkOffsets, halfLength](AZ::u16 i_chunk, AZ::u16 i_firstRow, AZ::u16 i_lastRow)
+	{
+		Tile* nextTile = m_tiles.data() + chunkOffsets[i_chunk];
+
+		for(AZ::u16 i = i_firstRow; i < i_lastRow; ++i)
+		{
+			const bool isCenterRow = (i == halfLength);
+
+			for(AZ::u16 j = 0; j < m_gridLength; ++j)
+			{
+				const AZStd::size_t cellIndex = (i * m_gridLength) + j;
+				if(m_obstacleCells[cellIndex])
+				{
+					continue;
+				}
+
+				const bool isStart = (isCenterRow && j == halfLength);
+
+				const TileType tileType = (isStart)
+					? TILE_TYPES_LANDING_AREA
+					: ((i_settings.m_forceEmptyTiles)
+						? TILE_TYPES_EMPTY
+						: i_tileTypeStream.GetBoundedAt(cellIndex, static_cast<AZ::u32>(i_settings.m_nTileTypes))
+					)
+				;
+
+				*nextTile++ = { i, j, tileType, isStart };
+			}
+		}
+	});
+}
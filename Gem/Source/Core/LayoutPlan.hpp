@@ -0,0 +1,102 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/std/containers/vector.h>
+
+#include "FlowField.hpp"
+#include "RandomStream.hpp"
+
+
+namespace AZ
+{
+	class JobContext;
+}
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Placement of every obstacle and tile of a grid, decided before anything is spawned.
+	// Obstacles and tile types are drawn from their own streams of the layout seed, and the type
+	// of a tile only depends on its cell, so a given seed always produces the same layout.
+	class LayoutPlan
+	{
+	public:
+		using TileType = AZStd::size_t;
+		using ObstacleType = AZStd::size_t;
+
+		struct Settings
+		{
+			AZ::u16 m_gridLength { 0 };
+			AZ::u16 m_maxObstacles { 0 };
+
+			AZ::Vector2 m_obstacleCellSize { 1.f, 1.f };
+			AZ::Vector2 m_tileCellSize { 1.f, 1.f };
+
+			AZStd::size_t m_nObstacleTypes { 0 };
+			AZStd::size_t m_nTileTypes { 0 };
+
+			bool m_forceEmptyTiles { false };
+		};
+
+		struct Obstacle
+		{
+			AZ::u16 m_row { 0 };
+			AZ::u16 m_column { 0 };
+			ObstacleType m_type { 0 };
+		};
+
+		struct Tile
+		{
+			AZ::u16 m_row { 0 };
+			AZ::u16 m_column { 0 };
+			TileType m_type { 0 };
+			bool m_isStart { false };
+		};
+
+		void Generate(const Settings& i_settings, AZ::u64 i_seed, AZ::JobContext* io_jobContext = nullptr);
+		void Clear();
+
+		bool IsEmpty() const;
+		AZ::u64 GetSeed() const;
+		AZ::u16 GetGridLength() const;
+
+		const AZStd::vector<Obstacle>& GetObstacles() const;
+		const AZStd::vector<Tile>& GetTiles() const;
+		const FlowField::CellMask& GetObstacleCells() const;
+
+		static constexpr TileType TILE_TYPES_LANDING_AREA = 0;
+		static constexpr TileType TILE_TYPES_EMPTY = 1;
+
+	private:
+		void GenerateObstacles(const Settings& i_settings, RandomStream& io_obstacleStream);
+		void GenerateTiles(const Settings& i_settings, const RandomStream& i_tileTypeStream, AZ::JobContext* io_jobContext);
+
+		template <typename t_ChunkFunction>
+		void ForEachRowChunk(AZ::JobContext* io_jobContext, const t_ChunkFunction& i_function) const;
+
+		static constexpr AZ::u16 ROWS_PER_CHUNK = 32;
+
+		AZ::u64 m_seed { 0 };
+		AZ::u16 m_gridLength { 0 };
+
+		AZStd::vector<Obstacle> m_obstacles {};
+		AZStd::vector<Tile> m_tiles {};
+		FlowField::CellMask m_obstacleCells {};
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,152 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RandomStream.hpp"
+
+using Loherangrin::Games::O3DEJam2305::RandomStream;
+using Loherangrin::Games::O3DEJam2305::RandomStreamId;
+
+
+namespace
+{
+	struct PhiloxBlock
+	{
+		AZ::u32 m_words[4] { 0, 0, 0, 0 };
+	};
+
+	constexpr AZ::u32 PHILOX_MULTIPLIER_0 = 0xD2511F53;
+	constexpr AZ::u32 PHILOX_MULTIPLIER_1 = 0xCD9E8D57;
+	constexpr AZ::u32 PHILOX_WEYL_0 = 0x9E3779B9;
+	constexpr AZ::u32 PHILOX_WEYL_1 = 0xBB67AE85;
+	constexpr AZ::u8 PHILOX_N_ROUNDS = 10;
+
+	// the counter is made of the index, the stream and the number of rejected blocks while sampling a bounded value
+	PhiloxBlock GenerateBlock(AZ::u64 i_seed, RandomStreamId i_id, AZ::u64 i_index, AZ::u32 i_attempt)
+	{
+		PhiloxBlock block;
+		block.m_words[0] = static_cast<AZ::u32>(i_index);
+		block.m_words[1] = static_cast<AZ::u32>(i_index >> 32);
+		block.m_words[2] = static_cast<AZ::u32>(i_id);
+		block.m_words[3] = i_attempt;
+
+		AZ::u32 key0 = static_cast<AZ::u32>(i_seed);
+		AZ::u32 key1 = static_cast<AZ::u32>(i_seed >> 32);
+
+		for(AZ::u8 i = 0; i < PHILOX_N_ROUNDS; ++i)
+		{
+			const AZ::u64 product0 = static_cast<AZ::u64>(PHILOX_MULTIPLIER_0) * block.m_words[0];
+			const AZ::u64 product1 = static_cast<AZ::u64>(PHILOX_MULTIPLIER_1) * block.m_words[2];
+
+			block = PhiloxBlock {{
+				static_cast<AZ::u32>(product1 >> 32) ^ block.m_words[1] ^ key0,
+				static_cast<AZ::u32>(product1),
+				static_cast<AZ::u32>(product0 >> 32) ^ block.m_words[3] ^ key1,
+				static_cast<AZ::u32>(product0)
+			}};
+
+			key0 += PHILOX_WEYL_0;
+			key1 += PHILOX_WEYL_1;
+		}
+
+		return block;
+	}
+}
+
+
+RandomStream::RandomStream(RandomStreamId i_id, AZ::u64 i_seed)
+	: m_seed { i_seed }
+	, m_id { i_id }
+{}
+
+void RandomStream::SetSeed(AZ::u64 i_seed)
+{
+	m_seed = i_seed;
+	m_counter = 0;
+}
+
+AZ::u64 RandomStream::GetSeed() const
+{
+	return m_seed;
+}
+
+void RandomStream::SetCounter(AZ::u64 i_counter)
+{
+	m_counter = i_counter;
+}
+
+AZ::u64 RandomStream::GetCounter() const
+{
+	return m_counter;
+}
+
+RandomStreamId RandomStream::GetId() const
+{
+	return m_id;
+}
+
+AZ::u64 RandomStream::Getu64Random()
+{
+	return Getu64At(m_counter++);
+}
+
+AZ::u32 RandomStream::GetRandomBounded(AZ::u32 i_range)
+{
+	return GetBoundedAt(m_counter++, i_range);
+}
+
+float RandomStream::GetRandomFloat()
+{
+	return GetFloatAt(m_counter++);
+}
+
+AZ::u64 RandomStream::Getu64At(AZ::u64 i_index) const
+{
+	const PhiloxBlock block = GenerateBlock(m_seed, m_id, i_index, 0);
+	return ((static_cast<AZ::u64>(block.m_words[1]) << 32) | block.m_words[0]);
+}
+
+AZ::u32 RandomStream::GetBoundedAt(AZ::u64 i_index, AZ::u32 i_range) const
+{
+	if(i_range <= 1)
+	{
+		return 0;
+	}
+
+	// Lemire's multiply and shift, rejecting the few low products that would bias the result
+	// instead of taking a modulo. Rejections move on to the next word of the block, then to new blocks
+	const AZ::u32 threshold = (0u - i_range) % i_range;
+
+	for(AZ::u32 attempt = 0;; ++attempt)
+	{
+		const PhiloxBlock block = GenerateBlock(m_seed, m_id, i_index, attempt);
+
+		for(const AZ::u32 word : block.m_words)
+		{
+			const AZ::u64 product = static_cast<AZ::u64>(word) * i_range;
+			if(static_cast<AZ::u32>(product) >= threshold)
+			{
+				return static_cast<AZ::u32>(product >> 32);
+			}
+		}
+	}
+}
+
+float RandomStream::GetFloatAt(AZ::u64 i_index) const
+{
+	// the top 24 bits fill the mantissa exactly, so the result stays below 1
+	const PhiloxBlock block = GenerateBlock(m_seed, m_id, i_index, 0);
+	return (static_cast<float>(block.m_words[0] >> 8) * (1.f / 16777216.f));
+}
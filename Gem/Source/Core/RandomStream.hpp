@@ -0,0 +1,68 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Independent sequences drawn from the same seed, one for each kind of generated content
+	enum class RandomStreamId : AZ::u32
+	{
+		LAYOUTS = 1,
+		TILE_TYPES,
+		OBSTACLES,
+		BOUNDARIES,
+		STORMS,
+		DROPS
+	};
+
+	// Counter-based random numbers (Philox4x32-10). Each value is a pure function of the seed,
+	// the stream and its index, so values can be drawn in any order or from several threads
+	// and a generator is fully described by its seed and its counter.
+	class RandomStream
+	{
+	public:
+		explicit RandomStream(RandomStreamId i_id, AZ::u64 i_seed = 0);
+
+		// restarts the stream from its first value
+		void SetSeed(AZ::u64 i_seed);
+		AZ::u64 GetSeed() const;
+
+		void SetCounter(AZ::u64 i_counter);
+		AZ::u64 GetCounter() const;
+
+		RandomStreamId GetId() const;
+
+		// sequential draws, each one advancing the counter by one
+		AZ::u64 Getu64Random();
+		AZ::u32 GetRandomBounded(AZ::u32 i_range);
+		float GetRandomFloat();
+
+		// random access draws, which leave the counter untouched
+		AZ::u64 Getu64At(AZ::u64 i_index) const;
+		AZ::u32 GetBoundedAt(AZ::u64 i_index, AZ::u32 i_range) const;
+		float GetFloatAt(AZ::u64 i_index) const;
+
+	private:
+		AZ::u64 m_seed { 0 };
+		AZ::u64 m_counter { 0 };
+		RandomStreamId m_id { RandomStreamId::LAYOUTS };
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,221 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/algorithm.h>
+
+#include <cmath>
+
+#include "ReplayFile.hpp"
+
+using Loherangrin::Games::O3DEJam2305::ReplayChecksumRecord;
+using Loherangrin::Games::O3DEJam2305::ReplayFile;
+using Loherangrin::Games::O3DEJam2305::ReplayHeader;
+using Loherangrin::Games::O3DEJam2305::ReplayInputRecord;
+using Loherangrin::Games::O3DEJam2305::StateHasher;
+
+
+void StateHasher::Add(const void* i_data, AZStd::size_t i_size)
+{
+	const auto* bytes = static_cast<const AZ::u8*>(i_data);
+	for(AZStd::size_t i = 0; i < i_size; ++i)
+	{
+		m_hash ^= bytes[i];
+		m_hash *= PRIME;
+	}
+}
+
+void StateHasher::AddQuantized(float i_value, float i_step)
+{
+	const auto quantizedValue = static_cast<AZ::s32>(std::lround(i_value / i_step));
+	AddValue(quantizedValue);
+}
+
+AZ::u64 StateHasher::GetHash() const
+{
+	return m_hash;
+}
+
+void ReplayFile::Reset(const ReplayHeader& i_header)
+{
+	m_header = i_header;
+	m_header.m_nTicks = 0;
+	m_header.m_nInputs = 0;
+	m_header.m_nChecksums = 0;
+
+	m_inputs.clear();
+	m_checksums.clear();
+}
+
+void ReplayFile::AddInput(const ReplayInputRecord& i_input)
+{
+	AZ_Assert(m_inputs.empty() || m_inputs.back().m_tick <= i_input.m_tick, "Replay inputs must be added in tick order");
+
+	m_inputs.push_back(i_input);
+}
+
+void ReplayFile::AddChecksum(AZ::u32 i_tick, AZ::u64 i_checksum)
+{
+	AZ_Assert(m_checksums.empty() || m_checksums.back().m_tick < i_tick, "Replay checksums must be added in tick order");
+
+	ReplayChecksumRecord record;
+	record.m_tick = i_tick;
+	record.m_checksum = i_checksum;
+
+	m_checksums.push_back(record);
+}
+
+void ReplayFile::SetTicksCount(AZ::u32 i_nTicks)
+{
+	m_header.m_nTicks = i_nTicks;
+}
+
+const ReplayHeader& ReplayFile::GetHeader() const
+{
+	return m_header;
+}
+
+AZStd::span<const ReplayInputRecord> ReplayFile::GetInputs(AZ::u32 i_tick) const
+{
+	const auto isBefore = [](const ReplayInputRecord& i_input, AZ::u32 i_tick)
+	{
+		return (i_input.m_tick < i_tick);
+	};
+
+	const auto first = AZStd::lower_bound(m_inputs.begin(), m_inputs.end(), i_tick, isBefore);
+
+	auto last = first;
+	while(last != m_inputs.end() && last->m_tick == i_tick)
+	{
+		++last;
+	}
+
+	return AZStd::span<const ReplayInputRecord> { m_inputs.data() + (first - m_inputs.begin()), static_cast<AZStd::size_t>(last - first) };
+}
+
+bool ReplayFile::FindChecksum(AZ::u32 i_tick, AZ::u64& o_checksum) const
+{
+	const auto isBefore = [](const ReplayChecksumRecord& i_record, AZ::u32 i_tick)
+	{
+		return (i_record.m_tick < i_tick);
+	};
+
+	const auto it = AZStd::lower_bound(m_checksums.begin(), m_checksums.end(), i_tick, isBefore);
+	if(it == m_checksums.end() || it->m_tick != i_tick)
+	{
+		return false;
+	}
+
+	o_checksum = it->m_checksum;
+	return true;
+}
+
+bool ReplayFile::IsChecksumTick(AZ::u32 i_tick) const
+{
+	return (m_header.m_checksumInterval > 0 && i_tick % m_header.m_checksumInterval == 0);
+}
+
+bool ReplayFile::Write(const char* i_filePath)
+{
+	AZ::IO::SystemFile file;
+
+	const int openMode = AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY;
+	const bool isFileOpen = file.Open(i_filePath, openMode);
+
+	AZ_Error("ReplayFile", isFileOpen, "Unable to open the replay file at %s", i_filePath);
+	if(!isFileOpen)
+	{
+		return false;
+	}
+
+	m_header.m_nInputs = static_cast<AZ::u32>(m_inputs.size());
+	m_header.m_nChecksums = static_cast<AZ::u32>(m_checksums.size());
+
+	const AZ::u64 inputsSize = m_inputs.size() * sizeof(ReplayInputRecord);
+	const AZ::u64 checksumsSize = m_checksums.size() * sizeof(ReplayChecksumRecord);
+
+	bool isWritten = (file.Write(&m_header, sizeof(ReplayHeader)) == sizeof(ReplayHeader));
+	isWritten = isWritten && (file.Write(m_inputs.data(), inputsSize) == inputsSize);
+	isWritten = isWritten && (file.Write(m_checksums.data(), checksumsSize) == checksumsSize);
+
+	file.Close();
+
+	AZ_Error("ReplayFile", isWritten, "Unable to write the replay file at %s", i_filePath);
+	return isWritten;
+}
+
+bool ReplayFile::Read(const char* i_filePath)
+{
+	AZ::IO::SystemFile file;
+
+	const bool isFileOpen = file.Open(i_filePath, AZ::IO::SystemFile::SF_OPEN_READ_ONLY);
+
+	AZ_Error("ReplayFile", isFileOpen, "Unable to open the replay file at %s", i_filePath);
+	if(!isFileOpen)
+	{
+		return false;
+	}
+
+	ReplayHeader header;
+	const ReplayHeader expectedHeader;
+
+	bool isValid = (file.Read(sizeof(ReplayHeader), &header) == sizeof(ReplayHeader));
+	isValid = isValid && AZStd::equal(header.m_magic, header.m_magic + 4, expectedHeader.m_magic);
+	isValid = isValid && (header.m_version == expectedHeader.m_version);
+
+	if(isValid)
+	{
+		// counts come from the file, so they must match its length before anything is allocated for them
+		const AZ::u64 inputsSize = static_cast<AZ::u64>(header.m_nInputs) * sizeof(ReplayInputRecord);
+		const AZ::u64 checksumsSize = static_cast<AZ::u64>(header.m_nChecksums) * sizeof(ReplayChecksumRecord);
+
+		isValid = (file.Length() == sizeof(ReplayHeader) + inputsSize + checksumsSize);
+		if(isValid)
+		{
+			m_inputs.resize(header.m_nInputs);
+			m_checksums.resize(header.m_nChecksums);
+
+			isValid = (file.Read(inputsSize, m_inputs.data()) == inputsSize);
+			isValid = isValid && (file.Read(checksumsSize, m_checksums.data()) == checksumsSize);
+		}
+
+		// lookups by tick rely on binary searches
+		const auto isInputBefore = [](const ReplayInputRecord& i_lhs, const ReplayInputRecord& i_rhs)
+		{
+			return (i_lhs.m_tick < i_rhs.m_tick);
+		};
+
+		const auto isChecksumNotBefore = [](const ReplayChecksumRecord& i_lhs, const ReplayChecksumRecord& i_rhs)
+		{
+			return (i_lhs.m_tick >= i_rhs.m_tick);
+		};
+
+		isValid = isValid && AZStd::is_sorted(m_inputs.begin(), m_inputs.end(), isInputBefore);
+		isValid = isValid && (AZStd::adjacent_find(m_checksums.begin(), m_checksums.end(), isChecksumNotBefore) == m_checksums.end());
+	}
+
+	file.Close();
+
+	AZ_Error("ReplayFile", isValid, "Unable to read the replay file at %s, it is either corrupted or from an older version", i_filePath);
+	if(!isValid)
+	{
+		Reset(ReplayHeader {});
+		return false;
+	}
+
+	m_header = header;
+	return true;
+}
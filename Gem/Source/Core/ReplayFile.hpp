@@ -0,0 +1,126 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Accumulates values into a 64 bits FNV-1a hash, so that the state of two runs can be compared tick by tick
+	class StateHasher
+	{
+	public:
+		void Add(const void* i_data, AZStd::size_t i_size);
+
+		template <typename t_Value>
+		void AddValue(const t_Value& i_value);
+
+		// values coming from physics are never bit exact between runs, so they are compared on a grid of the given step
+		void AddQuantized(float i_value, float i_step);
+
+		AZ::u64 GetHash() const;
+
+	private:
+		static constexpr AZ::u64 OFFSET_BASIS = 0xcbf29ce484222325ull;
+		static constexpr AZ::u64 PRIME = 0x100000001b3ull;
+
+		AZ::u64 m_hash { OFFSET_BASIS };
+	};
+
+	// ---
+
+	struct ReplayInputRecord
+	{
+		AZ::u32 m_tick { 0 };
+		AZ::u32 m_channel { 0 };
+		float m_value { 0.f };
+		AZ::u8 m_state { 0 };
+		AZ::u8 m_reserved[3] { 0, 0, 0 };
+	};
+
+	static_assert(sizeof(ReplayInputRecord) == 16, "Replay input records must stay 16 bytes long");
+
+	struct ReplayChecksumRecord
+	{
+		AZ::u32 m_tick { 0 };
+		AZ::u32 m_reserved { 0 };
+		AZ::u64 m_checksum { 0 };
+	};
+
+	static_assert(sizeof(ReplayChecksumRecord) == 16, "Replay checksum records must stay 16 bytes long");
+
+	struct ReplayHeader
+	{
+		char m_magic[4] { 'R', 'P', 'L', 'Y' };
+		AZ::u16 m_version { 2 };
+		AZ::u16 m_checksumInterval { 0 };
+
+		AZ::u64 m_seed { 0 };
+		float m_timeStep { 0.f };
+		AZ::u32 m_nTicks { 0 };
+
+		AZ::u16 m_gridLength { 0 };
+		AZ::u16 m_maxObstacles { 0 };
+		AZ::u8 m_nSpaceships { 0 };
+		AZ::u8 m_reserved[3] { 0, 0, 0 };
+
+		AZ::u32 m_nInputs { 0 };
+		AZ::u32 m_nChecksums { 0 };
+	};
+
+	// ---
+
+	// A game session reduced to what is needed to play it again: the seed, the fixed time step and the number of ticks,
+	// the input events received at each tick and the checksums of the game state taken every few ticks.
+	// Records are kept sorted by tick, as they are added while the session is being played.
+	class ReplayFile
+	{
+	public:
+		void Reset(const ReplayHeader& i_header);
+
+		void AddInput(const ReplayInputRecord& i_input);
+		void AddChecksum(AZ::u32 i_tick, AZ::u64 i_checksum);
+		void SetTicksCount(AZ::u32 i_nTicks);
+
+		const ReplayHeader& GetHeader() const;
+		AZStd::span<const ReplayInputRecord> GetInputs(AZ::u32 i_tick) const;
+		bool FindChecksum(AZ::u32 i_tick, AZ::u64& o_checksum) const;
+
+		bool IsChecksumTick(AZ::u32 i_tick) const;
+
+		bool Write(const char* i_filePath);
+		bool Read(const char* i_filePath);
+
+	private:
+		ReplayHeader m_header {};
+
+		AZStd::vector<ReplayInputRecord> m_inputs {};
+		AZStd::vector<ReplayChecksumRecord> m_checksums {};
+	};
+
+	// ---
+
+	template <typename t_Value>
+	void StateHasher::AddValue(const t_Value& i_value)
+	{
+		Add(&i_value, sizeof(t_Value));
+	}
+
+} // Loherangrin::Games::O3DEJam2305
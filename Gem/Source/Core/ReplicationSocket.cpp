@@ -0,0 +1,140 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Socket/AzSocket.h>
+
+#include "ReplicationSocket.hpp"
+
+using Loherangrin::Games::O3DEJam2305::BandwidthCounter;
+using Loherangrin::Games::O3DEJam2305::ReplicationSocket;
+
+
+namespace
+{
+	static constexpr const char* LOOPBACK_ADDRESS = "127.0.0.1";
+}
+
+// ---
+
+ReplicationSocket::~ReplicationSocket()
+{
+	Close();
+}
+
+bool ReplicationSocket::Open(AZ::u16 i_localPort, AZ::u16 i_remotePort)
+{
+	Close();
+
+	AZ::AzSock::Startup();
+
+	m_socket = AZ::AzSock::Socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if(!AZ::AzSock::IsAzSocketValid(m_socket))
+	{
+		AZ_Error("Replication", false, "Unable to create a replication socket");
+
+		AZ::AzSock::Cleanup();
+		return false;
+	}
+
+	AZ::AzSock::AzSocketAddress localAddress;
+	AZ::AzSock::AzSocketAddress remoteAddress;
+
+	// the peer is connected, so that the socket only receives its packets
+	const bool isOpen = localAddress.SetAddress(LOOPBACK_ADDRESS, i_localPort) &&
+		remoteAddress.SetAddress(LOOPBACK_ADDRESS, i_remotePort) &&
+		AZ::AzSock::Bind(m_socket, localAddress) == 0 &&
+		AZ::AzSock::Connect(m_socket, remoteAddress) == 0 &&
+		AZ::AzSock::SetSocketBlockingMode(m_socket, false) == 0;
+
+	if(!isOpen)
+	{
+		AZ_Error("Replication", false, "Unable to open a replication socket from port %u to port %u", i_localPort, i_remotePort);
+
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+void ReplicationSocket::Close()
+{
+	if(!AZ::AzSock::IsAzSocketValid(m_socket))
+	{
+		return;
+	}
+
+	AZ::AzSock::CloseSocket(m_socket);
+	m_socket = AZ_SOCKET_INVALID;
+
+	AZ::AzSock::Cleanup();
+}
+
+bool ReplicationSocket::IsOpen() const
+{
+	return AZ::AzSock::IsAzSocketValid(m_socket);
+}
+
+bool ReplicationSocket::Send(const AZ::u8* i_packet, AZStd::size_t i_packetSize)
+{
+	if(!IsOpen())
+	{
+		return false;
+	}
+
+	const AZ::s32 nSentBytes = AZ::AzSock::Send(m_socket, reinterpret_cast<const char*>(i_packet), static_cast<AZ::s32>(i_packetSize), 0);
+	if(nSentBytes != static_cast<AZ::s32>(i_packetSize))
+	{
+		return false;
+	}
+
+	m_sentBandwidth.Add(i_packetSize);
+	return true;
+}
+
+AZStd::size_t ReplicationSocket::Receive(AZ::u8* o_packet, AZStd::size_t i_maxPacketSize)
+{
+	if(!IsOpen())
+	{
+		return 0;
+	}
+
+	// errors are not reported, as the peer being closed or not opened yet is expected
+	const AZ::s32 nReceivedBytes = AZ::AzSock::Recv(m_socket, reinterpret_cast<char*>(o_packet), static_cast<AZ::s32>(i_maxPacketSize), 0);
+	if(nReceivedBytes <= 0)
+	{
+		return 0;
+	}
+
+	m_receivedBandwidth.Add(static_cast<AZStd::size_t>(nReceivedBytes));
+	return static_cast<AZStd::size_t>(nReceivedBytes);
+}
+
+void ReplicationSocket::Update(float i_deltaTime)
+{
+	m_sentBandwidth.Update(i_deltaTime);
+	m_receivedBandwidth.Update(i_deltaTime);
+}
+
+const BandwidthCounter& ReplicationSocket::GetSentBandwidth() const
+{
+	return m_sentBandwidth;
+}
+
+const BandwidthCounter& ReplicationSocket::GetReceivedBandwidth() const
+{
+	return m_receivedBandwidth;
+}
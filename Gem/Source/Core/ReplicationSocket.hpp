@@ -0,0 +1,56 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Socket/AzSocket_fwd.h>
+
+#include "GridReplication.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Non-blocking UDP socket exchanging replication packets with a single peer on the local machine
+	class ReplicationSocket
+	{
+	public:
+		ReplicationSocket() = default;
+		~ReplicationSocket();
+
+		ReplicationSocket(const ReplicationSocket&) = delete;
+		ReplicationSocket& operator=(const ReplicationSocket&) = delete;
+
+		bool Open(AZ::u16 i_localPort, AZ::u16 i_remotePort);
+		void Close();
+		bool IsOpen() const;
+
+		bool Send(const AZ::u8* i_packet, AZStd::size_t i_packetSize);
+		// returns the size of the packet read into the buffer, which is 0 when none is pending
+		AZStd::size_t Receive(AZ::u8* o_packet, AZStd::size_t i_maxPacketSize);
+
+		void Update(float i_deltaTime);
+
+		const BandwidthCounter& GetSentBandwidth() const;
+		const BandwidthCounter& GetReceivedBandwidth() const;
+
+	private:
+		AZSOCKET m_socket { AZ_SOCKET_INVALID };
+
+		BandwidthCounter m_sentBandwidth {};
+		BandwidthCounter m_receivedBandwidth {};
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,382 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/algorithm.h>
+
+#include "SaveFile.hpp"
+
+using Loherangrin::Games::O3DEJam2305::SaveChunkHeader;
+using Loherangrin::Games::O3DEJam2305::SaveCollectableRecord;
+using Loherangrin::Games::O3DEJam2305::SavedTiles;
+using Loherangrin::Games::O3DEJam2305::SaveFile;
+using Loherangrin::Games::O3DEJam2305::SaveHeader;
+using Loherangrin::Games::O3DEJam2305::SaveObstacleRecord;
+using Loherangrin::Games::O3DEJam2305::SavePool;
+using Loherangrin::Games::O3DEJam2305::SavePoolRecord;
+using Loherangrin::Games::O3DEJam2305::SaveScoreRecord;
+using Loherangrin::Games::O3DEJam2305::SaveSpaceshipRecord;
+using Loherangrin::Games::O3DEJam2305::SaveStormRecord;
+using Loherangrin::Games::O3DEJam2305::TileCount;
+
+
+namespace
+{
+	constexpr AZ::u32 MakeChunkTag(const char (&i_name)[5])
+	{
+		return (static_cast<AZ::u32>(i_name[0]) | (static_cast<AZ::u32>(i_name[1]) << 8) | (static_cast<AZ::u32>(i_name[2]) << 16) | (static_cast<AZ::u32>(i_name[3]) << 24));
+	}
+
+	constexpr AZ::u32 TAG_TILE_ENERGIES = MakeChunkTag("TENG");
+	constexpr AZ::u32 TAG_TILE_TIMERS = MakeChunkTag("TTMR");
+	constexpr AZ::u32 TAG_TILE_FLAGS = MakeChunkTag("TFLG");
+	constexpr AZ::u32 TAG_OBSTACLES = MakeChunkTag("OBST");
+	constexpr AZ::u32 TAG_SPACESHIPS = MakeChunkTag("SHIP");
+	constexpr AZ::u32 TAG_STORMS = MakeChunkTag("STRM");
+	constexpr AZ::u32 TAG_COLLECTABLES = MakeChunkTag("COLL");
+	constexpr AZ::u32 TAG_SCORE = MakeChunkTag("SCOR");
+	constexpr AZ::u32 TAG_POOLS = MakeChunkTag("POOL");
+
+	template <typename t_Record>
+	bool WriteChunk(AZ::IO::SystemFile& io_file, AZ::u32 i_tag, const AZStd::vector<t_Record>& i_records)
+	{
+		SaveChunkHeader chunk;
+		chunk.m_tag = i_tag;
+		chunk.m_size = static_cast<AZ::u32>(i_records.size() * sizeof(t_Record));
+
+		bool isWritten = (io_file.Write(&chunk, sizeof(SaveChunkHeader)) == sizeof(SaveChunkHeader));
+		isWritten = isWritten && (io_file.Write(i_records.data(), chunk.m_size) == chunk.m_size);
+
+		return isWritten;
+	}
+
+	// sizes come from the file, so they are never trusted beyond the bytes that are actually left in it
+	bool IsChunkInFile(const AZ::IO::SystemFile& i_file, const SaveChunkHeader& i_chunk)
+	{
+		const AZ::IO::SystemFile::SizeType fileLength = i_file.Length();
+		const AZ::IO::SystemFile::SizeType filePosition = i_file.Tell();
+
+		return (filePosition <= fileLength && i_chunk.m_size <= fileLength - filePosition);
+	}
+
+	template <typename t_Record>
+	bool ReadChunk(AZ::IO::SystemFile& io_file, const SaveChunkHeader& i_chunk, AZStd::vector<t_Record>& o_records)
+	{
+		if(i_chunk.m_size % sizeof(t_Record) != 0 || !IsChunkInFile(io_file, i_chunk))
+		{
+			return false;
+		}
+
+		o_records.resize(i_chunk.m_size / sizeof(t_Record));
+		return (io_file.Read(i_chunk.m_size, o_records.data()) == i_chunk.m_size);
+	}
+}
+
+// ---
+
+void SavedTiles::Resize(TileCount i_nTiles)
+{
+	m_energies.assign(i_nTiles, 0.f);
+	m_noDecayTimers.assign(i_nTiles, -1.f);
+	m_flags.assign(i_nTiles, 0);
+}
+
+TileCount SavedTiles::GetCount() const
+{
+	return m_flags.size();
+}
+
+// ---
+
+void SaveFile::Reset(const SaveHeader& i_header)
+{
+	m_header = i_header;
+	m_header.m_nChunks = 0;
+
+	m_tiles.Resize(static_cast<TileCount>(m_header.m_gridLength) * m_header.m_gridLength);
+
+	m_obstacles.clear();
+	m_spaceships.clear();
+	m_storms.clear();
+	m_collectables.clear();
+	m_score.clear();
+	m_pools.clear();
+}
+
+const SaveHeader& SaveFile::GetHeader() const
+{
+	return m_header;
+}
+
+SavedTiles& SaveFile::GetTiles()
+{
+	return m_tiles;
+}
+
+const SavedTiles& SaveFile::GetTiles() const
+{
+	return m_tiles;
+}
+
+void SaveFile::AddObstacle(const SaveObstacleRecord& i_obstacle)
+{
+	m_obstacles.push_back(i_obstacle);
+}
+
+void SaveFile::AddSpaceship(const SaveSpaceshipRecord& i_spaceship)
+{
+	m_spaceships.push_back(i_spaceship);
+}
+
+void SaveFile::AddStorm(const SaveStormRecord& i_storm)
+{
+	m_storms.push_back(i_storm);
+}
+
+void SaveFile::AddCollectable(const SaveCollectableRecord& i_collectable)
+{
+	m_collectables.push_back(i_collectable);
+}
+
+void SaveFile::SetScore(const SaveScoreRecord& i_score)
+{
+	m_score.assign(1, i_score);
+}
+
+void SaveFile::SetPool(SavePool i_pool, AZ::u64 i_seed, AZ::u64 i_counter, float i_timer)
+{
+	const auto isPool = [i_pool](const SavePoolRecord& i_record)
+	{
+		return (i_record.m_pool == i_pool);
+	};
+
+	auto it = AZStd::find_if(m_pools.begin(), m_pools.end(), isPool);
+	if(it == m_pools.end())
+	{
+		it = m_pools.insert(m_pools.end(), SavePoolRecord {});
+		it->m_pool = i_pool;
+	}
+
+	it->m_seed = i_seed;
+	it->m_counter = i_counter;
+	it->m_timer = i_timer;
+}
+
+AZStd::span<const SaveObstacleRecord> SaveFile::GetObstacles() const
+{
+	return AZStd::span<const SaveObstacleRecord> { m_obstacles.data(), m_obstacles.size() };
+}
+
+AZStd::span<const SaveSpaceshipRecord> SaveFile::GetSpaceships() const
+{
+	return AZStd::span<const SaveSpaceshipRecord> { m_spaceships.data(), m_spaceships.size() };
+}
+
+AZStd::span<const SaveStormRecord> SaveFile::GetStorms() const
+{
+	return AZStd::span<const SaveStormRecord> { m_storms.data(), m_storms.size() };
+}
+
+AZStd::span<const SaveCollectableRecord> SaveFile::GetCollectables() const
+{
+	return AZStd::span<const SaveCollectableRecord> { m_collectables.data(), m_collectables.size() };
+}
+
+const SaveSpaceshipRecord* SaveFile::FindSpaceship(AZ::u32 i_nameCrc) const
+{
+	const auto isSpaceship = [i_nameCrc](const SaveSpaceshipRecord& i_record)
+	{
+		return (i_record.m_nameCrc == i_nameCrc);
+	};
+
+	const auto it = AZStd::find_if(m_spaceships.begin(), m_spaceships.end(), isSpaceship);
+	return (it != m_spaceships.end()) ? &(*it) : nullptr;
+}
+
+const SaveScoreRecord& SaveFile::GetScore() const
+{
+	static const SaveScoreRecord EMPTY_SCORE {};
+
+	return (!m_score.empty()) ? m_score.front() : EMPTY_SCORE;
+}
+
+const SavePoolRecord* SaveFile::FindPool(SavePool i_pool) const
+{
+	const auto isPool = [i_pool](const SavePoolRecord& i_record)
+	{
+		return (i_record.m_pool == i_pool);
+	};
+
+	const auto it = AZStd::find_if(m_pools.begin(), m_pools.end(), isPool);
+	return (it != m_pools.end()) ? &(*it) : nullptr;
+}
+
+bool SaveFile::Write(const char* i_filePath) const
+{
+	AZ::IO::SystemFile file;
+
+	const int openMode = AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY;
+	const bool isFileOpen = file.Open(i_filePath, openMode);
+
+	AZ_Error("SaveFile", isFileOpen, "Unable to open the save file at %s", i_filePath);
+	if(!isFileOpen)
+	{
+		return false;
+	}
+
+	SaveHeader header = m_header;
+	header.m_nChunks = 9;
+
+	bool isWritten = (file.Write(&header, sizeof(SaveHeader)) == sizeof(SaveHeader));
+	isWritten = isWritten && WriteChunk(file, TAG_TILE_ENERGIES, m_tiles.m_energies);
+	isWritten = isWritten && WriteChunk(file, TAG_TILE_TIMERS, m_tiles.m_noDecayTimers);
+	isWritten = isWritten && WriteChunk(file, TAG_TILE_FLAGS, m_tiles.m_flags);
+	isWritten = isWritten && WriteChunk(file, TAG_OBSTACLES, m_obstacles);
+	isWritten = isWritten && WriteChunk(file, TAG_SPACESHIPS, m_spaceships);
+	isWritten = isWritten && WriteChunk(file, TAG_STORMS, m_storms);
+	isWritten = isWritten && WriteChunk(file, TAG_COLLECTABLES, m_collectables);
+	isWritten = isWritten && WriteChunk(file, TAG_SCORE, m_score);
+	isWritten = isWritten && WriteChunk(file, TAG_POOLS, m_pools);
+
+	file.Close();
+
+	AZ_Error("SaveFile", isWritten, "Unable to write the save file at %s", i_filePath);
+	return isWritten;
+}
+
+bool SaveFile::Read(const char* i_filePath)
+{
+	AZ::IO::SystemFile file;
+
+	const bool isFileOpen = file.Open(i_filePath, AZ::IO::SystemFile::SF_OPEN_READ_ONLY);
+
+	AZ_Error("SaveFile", isFileOpen, "Unable to open the save file at %s", i_filePath);
+	if(!isFileOpen)
+	{
+		return false;
+	}
+
+	SaveHeader header;
+	const SaveHeader expectedHeader;
+
+	bool isValid = (file.Read(sizeof(SaveHeader), &header) == sizeof(SaveHeader));
+	isValid = isValid && AZStd::equal(header.m_magic, header.m_magic + 4, expectedHeader.m_magic);
+	isValid = isValid && (header.m_version == expectedHeader.m_version);
+
+	if(isValid)
+	{
+		Reset(header);
+
+		for(AZ::u32 i = 0; isValid && i < header.m_nChunks; ++i)
+		{
+			SaveChunkHeader chunk;
+			isValid = (file.Read(sizeof(SaveChunkHeader), &chunk) == sizeof(SaveChunkHeader));
+			if(!isValid)
+			{
+				break;
+			}
+
+			switch(chunk.m_tag)
+			{
+				case TAG_TILE_ENERGIES:
+				{
+					isValid = ReadChunk(file, chunk, m_tiles.m_energies);
+				}
+				break;
+
+				case TAG_TILE_TIMERS:
+				{
+					isValid = ReadChunk(file, chunk, m_tiles.m_noDecayTimers);
+				}
+				break;
+
+				case TAG_TILE_FLAGS:
+				{
+					isValid = ReadChunk(file, chunk, m_tiles.m_flags);
+				}
+				break;
+
+				case TAG_OBSTACLES:
+				{
+					isValid = ReadChunk(file, chunk, m_obstacles);
+				}
+				break;
+
+				case TAG_SPACESHIPS:
+				{
+					isValid = ReadChunk(file, chunk, m_spaceships);
+				}
+				break;
+
+				case TAG_STORMS:
+				{
+					isValid = ReadChunk(file, chunk, m_storms);
+				}
+				break;
+
+				case TAG_COLLECTABLES:
+				{
+					isValid = ReadChunk(file, chunk, m_collectables);
+				}
+				break;
+
+				case TAG_SCORE:
+				{
+					isValid = ReadChunk(file, chunk, m_score);
+				}
+				break;
+
+				case TAG_POOLS:
+				{
+					isValid = ReadChunk(file, chunk, m_pools);
+				}
+				break;
+
+				default:
+				{
+					isValid = IsChunkInFile(file, chunk);
+					if(isValid)
+					{
+						const AZ::IO::SystemFile::SizeType nextChunkPosition = file.Tell() + chunk.m_size;
+
+						file.Seek(chunk.m_size, AZ::IO::SystemFile::SF_SEEK_CURRENT);
+						isValid = (file.Tell() == nextChunkPosition);
+					}
+				}
+				break;
+			}
+		}
+
+		const TileCount nTiles = static_cast<TileCount>(header.m_gridLength) * header.m_gridLength;
+
+		isValid = isValid && (m_tiles.m_energies.size() == nTiles);
+		isValid = isValid && (m_tiles.m_noDecayTimers.size() == nTiles);
+		isValid = isValid && (m_tiles.m_flags.size() == nTiles);
+		isValid = isValid && (m_score.size() <= 1);
+	}
+
+	file.Close();
+
+	AZ_Error("SaveFile", isValid, "Unable to read the save file at %s, it is either corrupted or from an older version", i_filePath);
+	if(!isValid)
+	{
+		Reset(SaveHeader {});
+		return false;
+	}
+
+	m_header = header;
+	return true;
+}
@@ -0,0 +1,211 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+#include "GridTypes.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Tiles are stored as one array per field, indexed by tile id, so that each of them is read and written in bulk
+	struct SavedTiles
+	{
+		static constexpr AZ::u8 FLAG_PRESENT = 1 << 0;
+		static constexpr AZ::u8 FLAG_CLAIMED = 1 << 1;
+		static constexpr AZ::u8 FLAG_LOCKED = 1 << 2;
+		static constexpr AZ::u8 FLAG_RECHARGING = 1 << 3;
+
+		void Resize(TileCount i_nTiles);
+		TileCount GetCount() const;
+
+		AZStd::vector<float> m_energies {};
+		AZStd::vector<float> m_noDecayTimers {};
+		AZStd::vector<AZ::u8> m_flags {};
+	};
+
+	// ---
+
+	struct SaveObstacleRecord
+	{
+		AZ::u16 m_row { 0 };
+		AZ::u16 m_column { 0 };
+		AZ::u8 m_type { 0 };
+		AZ::u8 m_reserved[3] { 0, 0, 0 };
+	};
+
+	static_assert(sizeof(SaveObstacleRecord) == 8, "Save obstacle records must stay 8 bytes long");
+
+	// spaceships are matched by the CRC of their name, as entity ids change from a session to another
+	struct SaveSpaceshipRecord
+	{
+		static constexpr AZ::u8 FLAG_LANDED = 1 << 0;
+		static constexpr AZ::u8 FLAG_PLAYER = 1 << 1;
+		static constexpr AZ::u8 FLAG_ACTIVE = 1 << 2;
+
+		AZ::u32 m_nameCrc { 0 };
+		AZ::u32 m_targetTileId { 0xFFFFFFFF };
+
+		float m_position[3] { 0.f, 0.f, 0.f };
+		float m_rotation[4] { 0.f, 0.f, 0.f, 1.f };
+
+		float m_energy { 0.f };
+		float m_speedMultiplier { 1.f };
+		float m_speedTimer { -1.f };
+
+		AZ::u8 m_flags { 0 };
+		AZ::u8 m_reserved[3] { 0, 0, 0 };
+	};
+
+	static_assert(sizeof(SaveSpaceshipRecord) == 52, "Save spaceship records must stay 52 bytes long");
+
+	struct SaveStormRecord
+	{
+		float m_position[3] { 0.f, 0.f, 0.f };
+		float m_moveDirection[2] { 0.f, 0.f };
+		float m_moveSpeed { 0.f };
+		float m_strength { 0.f };
+		float m_duration { 0.f };
+		float m_timer { 0.f };
+	};
+
+	static_assert(sizeof(SaveStormRecord) == 36, "Save storm records must stay 36 bytes long");
+
+	struct SaveCollectableRecord
+	{
+		AZ::u8 m_type { 0 };
+		AZ::u8 m_reserved[3] { 0, 0, 0 };
+		AZ::u32 m_tileId { 0xFFFFFFFF };
+
+		float m_position[3] { 0.f, 0.f, 0.f };
+		float m_timer { 0.f };
+	};
+
+	static_assert(sizeof(SaveCollectableRecord) == 24, "Save collectable records must stay 24 bytes long");
+
+	// times are relative to the moment of the save, as clocks start again from another point in the next session
+	struct SaveScoreRecord
+	{
+		AZ::u64 m_totalPoints { 0 };
+		AZ::u64 m_claimedTileTime { 0 };
+		AZ::u64 m_paidTilePoints { 0 };
+		AZ::u64 m_timeSinceIntegration { 0 };
+
+		AZ::u32 m_nClaimedTiles { 0 };
+		AZ::u8 m_isIntegrating { 0 };
+		AZ::u8 m_reserved[3] { 0, 0, 0 };
+	};
+
+	static_assert(sizeof(SaveScoreRecord) == 40, "Save score records must stay 40 bytes long");
+
+	enum class SavePool : AZ::u32
+	{
+		LAYOUT = 1,
+		STORMS,
+		COLLECTABLES
+	};
+
+	// a random stream goes on from its seed and its counter
+	struct SavePoolRecord
+	{
+		SavePool m_pool { SavePool::LAYOUT };
+		float m_timer { 0.f };
+		AZ::u64 m_seed { 0 };
+		AZ::u64 m_counter { 0 };
+	};
+
+	static_assert(sizeof(SavePoolRecord) == 24, "Save pool records must stay 24 bytes long");
+
+	struct SaveHeader
+	{
+		char m_magic[4] { 'S', 'A', 'V', 'E' };
+		AZ::u16 m_version { 2 };
+		AZ::u16 m_gridLength { 0 };
+
+		AZ::u64 m_layoutSeed { 0 };
+
+		float m_time { 0.f };
+		AZ::u32 m_tick { 0 };
+
+		AZ::u32 m_nChunks { 0 };
+		AZ::u32 m_reserved { 0 };
+	};
+
+	static_assert(sizeof(SaveHeader) == 32, "Save headers must stay 32 bytes long");
+
+	// every chunk starts with its tag and the size of its payload, so that readers skip the chunks they do not know
+	struct SaveChunkHeader
+	{
+		AZ::u32 m_tag { 0 };
+		AZ::u32 m_size { 0 };
+	};
+
+	static_assert(sizeof(SaveChunkHeader) == 8, "Save chunk headers must stay 8 bytes long");
+
+	// ---
+
+	// The state of a game session at one point, written as a header followed by a chunk for each array of records.
+	// The layout is stored as its seed, so that it is generated again by the usual path when the save is restored,
+	// while the obstacle cells are kept to detect layouts that would be generated differently by another version.
+	class SaveFile
+	{
+	public:
+		void Reset(const SaveHeader& i_header);
+		const SaveHeader& GetHeader() const;
+
+		SavedTiles& GetTiles();
+		const SavedTiles& GetTiles() const;
+
+		void AddObstacle(const SaveObstacleRecord& i_obstacle);
+		void AddSpaceship(const SaveSpaceshipRecord& i_spaceship);
+		void AddStorm(const SaveStormRecord& i_storm);
+		void AddCollectable(const SaveCollectableRecord& i_collectable);
+
+		void SetScore(const SaveScoreRecord& i_score);
+		void SetPool(SavePool i_pool, AZ::u64 i_seed, AZ::u64 i_counter, float i_timer);
+
+		AZStd::span<const SaveObstacleRecord> GetObstacles() const;
+		AZStd::span<const SaveSpaceshipRecord> GetSpaceships() const;
+		AZStd::span<const SaveStormRecord> GetStorms() const;
+		AZStd::span<const SaveCollectableRecord> GetCollectables() const;
+
+		const SaveSpaceshipRecord* FindSpaceship(AZ::u32 i_nameCrc) const;
+		const SaveScoreRecord& GetScore() const;
+		const SavePoolRecord* FindPool(SavePool i_pool) const;
+
+		bool Write(const char* i_filePath) const;
+
+		// chunks are read one by one straight into their arrays, without loading the whole file first
+		bool Read(const char* i_filePath);
+
+	private:
+		SaveHeader m_header {};
+
+		SavedTiles m_tiles {};
+
+		AZStd::vector<SaveObstacleRecord> m_obstacles {};
+		AZStd::vector<SaveSpaceshipRecord> m_spaceships {};
+		AZStd::vector<SaveStormRecord> m_storms {};
+		AZStd::vector<SaveCollectableRecord> m_collectables {};
+		AZStd::vector<SaveScoreRecord> m_score {};
+		AZStd::vector<SavePoolRecord> m_pools {};
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,160 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/std/algorithm.h>
+
+#include "SaveFile.hpp"
+#include "ScoreLedger.hpp"
+
+using Loherangrin::Games::O3DEJam2305::SaveScoreRecord;
+using Loherangrin::Games::O3DEJam2305::ScoreLedger;
+using Loherangrin::Games::O3DEJam2305::TileCount;
+
+
+void ScoreLedger::Configure(Points i_claimedTilePoints, TimeMs i_tilePeriod)
+{
+	m_claimedTilePoints = i_claimedTilePoints;
+	m_tilePeriod = AZStd::max(i_tilePeriod, TimeMs { 1 });
+}
+
+ScoreLedger::TimeMs ScoreLedger::GetTilePeriod() const
+{
+	return m_tilePeriod;
+}
+
+void ScoreLedger::Start(TimeMs i_now)
+{
+	m_totalPoints = 0;
+	m_nClaimedTiles = 0;
+
+	m_claimedTileTime = 0;
+	m_paidTilePoints = 0;
+
+	m_lastIntegrationTime = i_now;
+	m_isIntegrating = true;
+}
+
+void ScoreLedger::Pause(TimeMs i_now)
+{
+	IntegrateClaimedTiles(i_now);
+	m_isIntegrating = false;
+}
+
+void ScoreLedger::Resume(TimeMs i_now)
+{
+	m_lastIntegrationTime = i_now;
+	m_isIntegrating = true;
+}
+
+void ScoreLedger::Stop(TimeMs i_now)
+{
+	IntegrateClaimedTiles(i_now);
+	m_isIntegrating = false;
+
+	MaterializeTilePoints();
+}
+
+void ScoreLedger::AddPoints(Points i_points)
+{
+	m_totalPoints += i_points;
+}
+
+void ScoreLedger::ClaimTile(TimeMs i_now)
+{
+	IntegrateClaimedTiles(i_now);
+
+	++m_nClaimedTiles;
+}
+
+bool ScoreLedger::LoseTile(TimeMs i_now)
+{
+	if(m_nClaimedTiles == 0)
+	{
+		return false;
+	}
+
+	IntegrateClaimedTiles(i_now);
+
+	--m_nClaimedTiles;
+
+	return true;
+}
+
+void ScoreLedger::Settle(TimeMs i_now)
+{
+	IntegrateClaimedTiles(i_now);
+	MaterializeTilePoints();
+}
+
+ScoreLedger::TotalPoints ScoreLedger::GetTotalPoints() const
+{
+	return m_totalPoints;
+}
+
+TileCount ScoreLedger::GetClaimedTiles() const
+{
+	return m_nClaimedTiles;
+}
+
+bool ScoreLedger::IsIntegrating() const
+{
+	return m_isIntegrating;
+}
+
+void ScoreLedger::Save(TimeMs i_now, SaveScoreRecord& o_record) const
+{
+	o_record.m_totalPoints = m_totalPoints;
+	o_record.m_claimedTileTime = m_claimedTileTime;
+	o_record.m_paidTilePoints = m_paidTilePoints;
+	o_record.m_timeSinceIntegration = (i_now > m_lastIntegrationTime) ? (i_now - m_lastIntegrationTime) : 0;
+
+	o_record.m_nClaimedTiles = static_cast<AZ::u32>(m_nClaimedTiles);
+	o_record.m_isIntegrating = (m_isIntegrating) ? 1 : 0;
+}
+
+void ScoreLedger::Restore(const SaveScoreRecord& i_record, TimeMs i_now)
+{
+	m_totalPoints = i_record.m_totalPoints;
+	m_claimedTileTime = i_record.m_claimedTileTime;
+	m_paidTilePoints = i_record.m_paidTilePoints;
+	m_lastIntegrationTime = (i_now > i_record.m_timeSinceIntegration) ? (i_now - i_record.m_timeSinceIntegration) : 0;
+
+	m_nClaimedTiles = i_record.m_nClaimedTiles;
+	m_isIntegrating = (i_record.m_isIntegrating != 0);
+}
+
+void ScoreLedger::IntegrateClaimedTiles(TimeMs i_now)
+{
+	if(m_isIntegrating && i_now > m_lastIntegrationTime)
+	{
+		const AZ::u64 elapsedTime = i_now - m_lastIntegrationTime;
+		m_claimedTileTime += static_cast<AZ::u64>(m_nClaimedTiles) * elapsedTime;
+	}
+
+	m_lastIntegrationTime = i_now;
+}
+
+void ScoreLedger::MaterializeTilePoints()
+{
+	const TotalPoints earnedTilePoints = (m_claimedTileTime * m_claimedTilePoints) / m_tilePeriod;
+	if(earnedTilePoints <= m_paidTilePoints)
+	{
+		return;
+	}
+
+	m_totalPoints += earnedTilePoints - m_paidTilePoints;
+	m_paidTilePoints = earnedTilePoints;
+}
@@ -0,0 +1,78 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+#include "GridTypes.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	struct SaveScoreRecord;
+
+	class ScoreLedger
+	{
+	public:
+		using Points = AZ::u16;
+		using TotalPoints = AZ::u64;
+		using TimeMs = AZ::u64;
+
+		void Configure(Points i_claimedTilePoints, TimeMs i_tilePeriod);
+		TimeMs GetTilePeriod() const;
+
+		void Start(TimeMs i_now);
+		void Pause(TimeMs i_now);
+		void Resume(TimeMs i_now);
+		void Stop(TimeMs i_now);
+
+		void AddPoints(Points i_points);
+
+		void ClaimTile(TimeMs i_now);
+		bool LoseTile(TimeMs i_now);
+
+		// pays every whole point earned by the claimed tiles until now
+		void Settle(TimeMs i_now);
+
+		TotalPoints GetTotalPoints() const;
+		TileCount GetClaimedTiles() const;
+		bool IsIntegrating() const;
+
+		// the time since the last integration is kept relative to now, so the restored ledger goes on from any clock
+		void Save(TimeMs i_now, SaveScoreRecord& o_record) const;
+		void Restore(const SaveScoreRecord& i_record, TimeMs i_now);
+
+	private:
+		void IntegrateClaimedTiles(TimeMs i_now);
+		void MaterializeTilePoints();
+
+		TotalPoints m_totalPoints { 0 };
+
+		Points m_claimedTilePoints { 1 };
+		TimeMs m_tilePeriod { 5000 };
+
+		TileCount m_nClaimedTiles { 0 };
+
+		// area under the claimed tiles step function, in tiles * milliseconds
+		AZ::u64 m_claimedTileTime { 0 };
+		TotalPoints m_paidTilePoints { 0 };
+
+		TimeMs m_lastIntegrationTime { 0 };
+		bool m_isIntegrating { false };
+	};
+
+} // Loherangrin::Games::O3DEJam2305
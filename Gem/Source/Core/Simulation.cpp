@@ -0,0 +1,936 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/std/algorithm.h>
+
+#include "BeamRules.hpp"
+#include "ReplayFile.hpp"
+#include "SaveFile.hpp"
+#include "Simulation.hpp"
+#include "TraceRecorder.hpp"
+
+using Loherangrin::Games::O3DEJam2305::LayoutPlan;
+using Loherangrin::Games::O3DEJam2305::RandomStream;
+using Loherangrin::Games::O3DEJam2305::SaveCollectableRecord;
+using Loherangrin::Games::O3DEJam2305::SavedTiles;
+using Loherangrin::Games::O3DEJam2305::SaveFile;
+using Loherangrin::Games::O3DEJam2305::SaveHeader;
+using Loherangrin::Games::O3DEJam2305::SaveObstacleRecord;
+using Loherangrin::Games::O3DEJam2305::SavePool;
+using Loherangrin::Games::O3DEJam2305::SavePoolRecord;
+using Loherangrin::Games::O3DEJam2305::SaveScoreRecord;
+using Loherangrin::Games::O3DEJam2305::SaveSpaceshipRecord;
+using Loherangrin::Games::O3DEJam2305::SaveStormRecord;
+using Loherangrin::Games::O3DEJam2305::ScoreLedger;
+using Loherangrin::Games::O3DEJam2305::Simulation;
+using Loherangrin::Games::O3DEJam2305::SimulationResult;
+using Loherangrin::Games::O3DEJam2305::ScopedTraceEvent;
+using Loherangrin::Games::O3DEJam2305::StateHasher;
+using Loherangrin::Games::O3DEJam2305::TileId;
+using Loherangrin::Games::O3DEJam2305::TraceRecorder;
+
+
+SimulationResult Simulation::Run(const SimulationSettings& i_settings, AZ::u64 i_seed)
+{
+	Start(i_settings, i_seed);
+
+	while(Step())
+	{}
+
+	return GetResult();
+}
+
+void Simulation::Start(const SimulationSettings& i_settings, AZ::u64 i_seed)
+{
+	m_settings = i_settings;
+	m_seed = i_seed;
+
+	const ScopedTraceEvent traceEvent { m_traceRecorder, "Simulation", "Simulation::Start" };
+
+	m_stormRandomStream.SetSeed(i_seed);
+	m_dropRandomStream.SetSeed(i_seed);
+
+	LayoutPlan::Settings layoutSettings;
+	layoutSettings.m_gridLength = m_settings.m_gridLength;
+	layoutSettings.m_maxObstacles = m_settings.m_maxObstacles;
+	layoutSettings.m_obstacleCellSize = AZ::Vector2 { m_settings.m_obstacleSize, m_settings.m_obstacleSize };
+	layoutSettings.m_tileCellSize = AZ::Vector2 { m_settings.m_tileSize, m_settings.m_tileSize };
+	layoutSettings.m_nObstacleTypes = m_settings.m_nObstacleTypes;
+	layoutSettings.m_nTileTypes = m_settings.m_nTileTypes;
+
+	m_layout.Generate(layoutSettings, i_seed);
+
+	const AZ::u16 gridLength = m_layout.GetGridLength();
+	m_tiles.assign(gridLength * gridLength, Tile {});
+	m_startTileId = INVALID_TILE_ID;
+
+	for(const LayoutPlan::Tile& planTile : m_layout.GetTiles())
+	{
+		const TileId tileId = (planTile.m_row * gridLength) + planTile.m_column;
+		m_tiles[tileId].m_isPresent = true;
+
+		if(planTile.m_isStart)
+		{
+			m_startTileId = tileId;
+		}
+	}
+
+	m_ledger.Configure(m_settings.m_claimedTilePoints, static_cast<ScoreLedger::TimeMs>(m_settings.m_tileTimerPeriod * 1000.f));
+	m_ledger.Start(0);
+
+	m_time = 0.f;
+	m_tick = 0;
+	m_stormTimer = m_settings.m_stormSpawnDelay;
+
+	m_result = SimulationResult {};
+	m_result.m_seed = i_seed;
+
+	m_storms.clear();
+	m_collectables.clear();
+
+	if(m_startTileId == INVALID_TILE_ID)
+	{
+		m_spaceships.clear();
+		Finish();
+
+		return;
+	}
+
+	// the start tile is claimed from the beginning, so only its neighbors are told about it
+	Tile& startTile = m_tiles[m_startTileId];
+	startTile.m_state.m_isClaimed = true;
+	startTile.m_isLocked = true;
+
+	ToggleTile(m_startTileId);
+
+	m_spaceships.assign(AZStd::max(m_settings.m_nSpaceships, AZ::u8 { 1 }), Spaceship {});
+	for(Spaceship& spaceship : m_spaceships)
+	{
+		SpaceshipRules::Reset(m_settings.m_spaceship, spaceship.m_state);
+		spaceship.m_position = GetTileCenter(m_startTileId);
+	}
+
+	m_isOver = false;
+}
+
+bool Simulation::Step()
+{
+	if(m_isOver)
+	{
+		return false;
+	}
+
+	const float deltaTime = m_settings.m_timeStep;
+	m_time += deltaTime;
+	++m_tick;
+
+	const ScopedTraceEvent stepEvent { m_traceRecorder, "Simulation", "Simulation::Step" };
+
+	{
+		const ScopedTraceEvent traceEvent { m_traceRecorder, "Spaceships", "Simulation::UpdateSpaceship" };
+
+		for(AZ::u8 i = 0; i < m_spaceships.size() && !m_isOver; ++i)
+		{
+			UpdateSpaceship(i, deltaTime);
+		}
+	}
+
+	if(!m_isOver)
+	{
+		const ScopedTraceEvent traceEvent { m_traceRecorder, "Storms", "Simulation::UpdateStorms" };
+		UpdateStorms(deltaTime);
+	}
+
+	if(!m_isOver)
+	{
+		{
+			const ScopedTraceEvent traceEvent { m_traceRecorder, "Tiles", "Simulation::UpdateTiles" };
+			UpdateTiles(deltaTime);
+		}
+
+		{
+			const ScopedTraceEvent traceEvent { m_traceRecorder, "Collectables", "Simulation::UpdateCollectables" };
+			UpdateCollectables(deltaTime);
+		}
+	}
+
+	if(m_traceRecorder && m_traceRecorder->IsRecording())
+	{
+		const TraceRecorder::Clock::time_point now = TraceRecorder::Clock::now();
+
+		m_traceRecorder->AddCounter("Claimed tiles", m_ledger.GetClaimedTiles(), now);
+		m_traceRecorder->AddCounter("Storms", static_cast<AZ::s64>(m_storms.size()), now);
+		m_traceRecorder->AddCounter("Collectables", static_cast<AZ::s64>(m_collectables.size()), now);
+	}
+
+	if(!m_isOver && m_time >= m_settings.m_maxDuration)
+	{
+		Finish();
+	}
+
+	return !m_isOver;
+}
+
+bool Simulation::IsOver() const
+{
+	return m_isOver;
+}
+
+SimulationResult Simulation::GetResult() const
+{
+	return m_result;
+}
+
+const LayoutPlan& Simulation::GetLayout() const
+{
+	return m_layout;
+}
+
+AZ::u32 Simulation::GetTick() const
+{
+	return m_tick;
+}
+
+AZ::u64 Simulation::CalculateChecksum() const
+{
+	StateHasher hasher;
+	hasher.AddValue(m_tick);
+
+	for(const Tile& tile : m_tiles)
+	{
+		hasher.AddValue(tile.m_state.m_energy);
+		hasher.AddValue(tile.m_state.m_isClaimed);
+	}
+
+	for(const Spaceship& spaceship : m_spaceships)
+	{
+		hasher.AddValue(spaceship.m_state.m_energy);
+		hasher.AddValue(spaceship.m_position.GetX());
+		hasher.AddValue(spaceship.m_position.GetY());
+		hasher.AddValue(spaceship.m_targetTileId);
+		hasher.AddValue(spaceship.m_isLanded);
+	}
+
+	hasher.AddValue(m_ledger.GetTotalPoints());
+	hasher.AddValue(m_ledger.GetClaimedTiles());
+
+	return hasher.GetHash();
+}
+
+void Simulation::Save(SaveFile& o_file) const
+{
+	SaveHeader header;
+	header.m_gridLength = m_layout.GetGridLength();
+	header.m_layoutSeed = m_seed;
+	header.m_time = m_time;
+	header.m_tick = m_tick;
+
+	o_file.Reset(header);
+
+	SavedTiles& savedTiles = o_file.GetTiles();
+	for(TileId tileId = 0; tileId < m_tiles.size(); ++tileId)
+	{
+		const Tile& tile = m_tiles[tileId];
+
+		savedTiles.m_energies[tileId] = tile.m_state.m_energy;
+		savedTiles.m_noDecayTimers[tileId] = tile.m_noDecayTimer;
+		savedTiles.m_flags[tileId] =
+			((tile.m_isPresent) ? SavedTiles::FLAG_PRESENT : 0) |
+			((tile.m_state.m_isClaimed) ? SavedTiles::FLAG_CLAIMED : 0) |
+			((tile.m_isLocked) ? SavedTiles::FLAG_LOCKED : 0) |
+			((tile.m_isRecharging) ? SavedTiles::FLAG_RECHARGING : 0)
+		;
+	}
+
+	for(const LayoutPlan::Obstacle& obstacle : m_layout.GetObstacles())
+	{
+		SaveObstacleRecord record;
+		record.m_row = obstacle.m_row;
+		record.m_column = obstacle.m_column;
+		record.m_type = static_cast<AZ::u8>(obstacle.m_type);
+
+		o_file.AddObstacle(record);
+	}
+
+	for(AZ::u8 i = 0; i < m_spaceships.size(); ++i)
+	{
+		const Spaceship& spaceship = m_spaceships[i];
+
+		SaveSpaceshipRecord record;
+		record.m_nameCrc = i;
+		record.m_targetTileId = static_cast<AZ::u32>(spaceship.m_targetTileId);
+		record.m_position[0] = spaceship.m_position.GetX();
+		record.m_position[1] = spaceship.m_position.GetY();
+		record.m_energy = spaceship.m_state.m_energy;
+		record.m_speedMultiplier = spaceship.m_state.m_speedMultiplier;
+		record.m_speedTimer = spaceship.m_state.m_speedTimer;
+		record.m_flags =
+			((spaceship.m_isLanded) ? SaveSpaceshipRecord::FLAG_LANDED : 0) |
+			((i == 0) ? SaveSpaceshipRecord::FLAG_PLAYER : 0) |
+			((spaceship.m_isActive) ? SaveSpaceshipRecord::FLAG_ACTIVE : 0)
+		;
+
+		o_file.AddSpaceship(record);
+	}
+
+	for(const Storm& storm : m_storms)
+	{
+		SaveStormRecord record;
+		record.m_position[0] = storm.m_position.GetX();
+		record.m_position[1] = storm.m_position.GetY();
+		record.m_moveDirection[0] = storm.m_parameters.m_moveDirection.GetX();
+		record.m_moveDirection[1] = storm.m_parameters.m_moveDirection.GetY();
+		record.m_moveSpeed = storm.m_parameters.m_moveSpeed;
+		record.m_strength = storm.m_parameters.m_strength;
+		record.m_duration = storm.m_parameters.m_duration;
+		record.m_timer = storm.m_timer;
+
+		o_file.AddStorm(record);
+	}
+
+	for(const Collectable& collectable : m_collectables)
+	{
+		const AZ::Vector2 position = GetTileCenter(collectable.m_tileId);
+
+		SaveCollectableRecord record;
+		record.m_type = static_cast<AZ::u8>(collectable.m_type);
+		record.m_tileId = static_cast<AZ::u32>(collectable.m_tileId);
+		record.m_position[0] = position.GetX();
+		record.m_position[1] = position.GetY();
+		record.m_timer = collectable.m_timer;
+
+		o_file.AddCollectable(record);
+	}
+
+	SaveScoreRecord score;
+	m_ledger.Save(GetTimeMs(), score);
+
+	o_file.SetScore(score);
+
+	o_file.SetPool(SavePool::LAYOUT, m_seed, 0, 0.f);
+	o_file.SetPool(SavePool::STORMS, m_stormRandomStream.GetSeed(), m_stormRandomStream.GetCounter(), m_stormTimer);
+	o_file.SetPool(SavePool::COLLECTABLES, m_dropRandomStream.GetSeed(), m_dropRandomStream.GetCounter(), 0.f);
+}
+
+bool Simulation::Restore(const SimulationSettings& i_settings, const SaveFile& i_file)
+{
+	const SaveHeader& header = i_file.GetHeader();
+	if(header.m_gridLength != i_settings.m_gridLength)
+	{
+		AZ_Error("Simulation", false, "Save was made on a grid of length %u, not %u", header.m_gridLength, i_settings.m_gridLength);
+		return false;
+	}
+
+	// the layout is generated again from its seed, the saved obstacles only tell if it still comes out the same
+	Start(i_settings, header.m_layoutSeed);
+
+	const AZStd::vector<LayoutPlan::Obstacle>& obstacles = m_layout.GetObstacles();
+	const AZStd::span<const SaveObstacleRecord> savedObstacles = i_file.GetObstacles();
+
+	const auto isSameObstacle = [](const LayoutPlan::Obstacle& i_obstacle, const SaveObstacleRecord& i_record)
+	{
+		return (i_obstacle.m_row == i_record.m_row && i_obstacle.m_column == i_record.m_column && i_obstacle.m_type == i_record.m_type);
+	};
+
+	if(m_isOver || !AZStd::equal(obstacles.begin(), obstacles.end(), savedObstacles.begin(), savedObstacles.end(), isSameObstacle))
+	{
+		AZ_Error("Simulation", false, "Layout generated from seed %llu does not match the saved one", header.m_layoutSeed);
+		return false;
+	}
+
+	const SavedTiles& savedTiles = i_file.GetTiles();
+	for(TileId tileId = 0; tileId < m_tiles.size(); ++tileId)
+	{
+		const AZ::u8 flags = savedTiles.m_flags[tileId];
+
+		Tile& tile = m_tiles[tileId];
+		tile.m_state.m_energy = savedTiles.m_energies[tileId];
+		tile.m_state.m_isClaimed = ((flags & SavedTiles::FLAG_CLAIMED) != 0);
+		tile.m_noDecayTimer = savedTiles.m_noDecayTimers[tileId];
+		tile.m_isRecharging = ((flags & SavedTiles::FLAG_RECHARGING) != 0);
+		tile.m_isLocked = ((flags & SavedTiles::FLAG_LOCKED) != 0);
+		tile.m_isPresent = ((flags & SavedTiles::FLAG_PRESENT) != 0);
+		tile.m_nClaimedNeighbors = 0;
+	}
+
+	for(TileId tileId = 0; tileId < m_tiles.size(); ++tileId)
+	{
+		if(m_tiles[tileId].m_state.m_isClaimed)
+		{
+			UpdateNeighbors(tileId, true);
+		}
+	}
+
+	for(const SaveSpaceshipRecord& record : i_file.GetSpaceships())
+	{
+		if(record.m_nameCrc >= m_spaceships.size())
+		{
+			continue;
+		}
+
+		Spaceship& spaceship = m_spaceships[record.m_nameCrc];
+		spaceship.m_state.m_energy = record.m_energy;
+		spaceship.m_state.m_speedMultiplier = record.m_speedMultiplier;
+		spaceship.m_state.m_speedTimer = record.m_speedTimer;
+		spaceship.m_position = AZ::Vector2 { record.m_position[0], record.m_position[1] };
+		spaceship.m_targetTileId = (record.m_targetTileId < m_tiles.size()) ? record.m_targetTileId : INVALID_TILE_ID;
+		spaceship.m_isLanded = ((record.m_flags & SaveSpaceshipRecord::FLAG_LANDED) != 0);
+		spaceship.m_isActive = ((record.m_flags & SaveSpaceshipRecord::FLAG_ACTIVE) != 0);
+	}
+
+	for(const SaveStormRecord& record : i_file.GetStorms())
+	{
+		Storm storm;
+		storm.m_parameters.m_duration = record.m_duration;
+		storm.m_parameters.m_strength = record.m_strength;
+		storm.m_parameters.m_moveDirection = AZ::Vector2 { record.m_moveDirection[0], record.m_moveDirection[1] };
+		storm.m_parameters.m_moveSpeed = record.m_moveSpeed;
+		storm.m_position = AZ::Vector2 { record.m_position[0], record.m_position[1] };
+		storm.m_timer = record.m_timer;
+
+		m_storms.push_back(storm);
+	}
+
+	for(const SaveCollectableRecord& record : i_file.GetCollectables())
+	{
+		if(record.m_tileId < m_tiles.size())
+		{
+			m_collectables.push_back({ static_cast<CollectableType>(record.m_type), record.m_tileId, record.m_timer });
+		}
+	}
+
+	m_time = header.m_time;
+	m_tick = header.m_tick;
+
+	m_ledger.Restore(i_file.GetScore(), GetTimeMs());
+	m_result.m_maxClaimedTiles = m_ledger.GetClaimedTiles();
+
+	const auto restoreStream = [&i_file](SavePool i_pool, RandomStream& io_randomStream) -> const SavePoolRecord*
+	{
+		const SavePoolRecord* record = i_file.FindPool(i_pool);
+		if(record)
+		{
+			io_randomStream.SetSeed(record->m_seed);
+			io_randomStream.SetCounter(record->m_counter);
+		}
+
+		return record;
+	};
+
+	restoreStream(SavePool::COLLECTABLES, m_dropRandomStream);
+
+	if(const SavePoolRecord* stormPool = restoreStream(SavePool::STORMS, m_stormRandomStream))
+	{
+		m_stormTimer = stormPool->m_timer;
+	}
+
+	return true;
+}
+
+void Simulation::SetTraceRecorder(TraceRecorder* io_recorder)
+{
+	m_traceRecorder = io_recorder;
+}
+
+void Simulation::UpdateSpaceship(AZ::u8 i_index, float i_deltaTime)
+{
+	Spaceship& spaceship = m_spaceships[i_index];
+	if(!spaceship.m_isActive)
+	{
+		return;
+	}
+
+	const SpaceshipSettings& settings = m_settings.m_spaceship;
+
+	if(spaceship.m_isLanded)
+	{
+		const float recharge = SpaceshipRules::CalculateRecharge(settings, spaceship.m_state, i_deltaTime);
+		if(recharge > 0.f)
+		{
+			AddSpaceshipEnergy(i_index, recharge);
+		}
+		else
+		{
+			spaceship.m_isLanded = false;
+		}
+
+		SpaceshipRules::UpdateSpeedModifier(settings, spaceship.m_state, i_deltaTime);
+		return;
+	}
+
+	SpaceshipRules::UpdateSpeedModifier(settings, spaceship.m_state, i_deltaTime);
+
+	// the beam is locked in energy saving mode, so there is nothing left to do but landing
+	bool isLanding = SpaceshipRules::IsLowEnergy(settings, spaceship.m_state);
+
+	// a beamed tile is filled up before moving on, to give it the longest life
+	TileId targetTileId = spaceship.m_targetTileId;
+
+	const bool isKept = (isLanding)
+		? IsTarget(targetTileId, isLanding)
+		: IsFilling(targetTileId)
+	;
+
+	if(!isKept)
+	{
+		targetTileId = FindTarget(spaceship.m_position, isLanding);
+		if(targetTileId == INVALID_TILE_ID && !isLanding)
+		{
+			isLanding = true;
+			targetTileId = FindTarget(spaceship.m_position, isLanding);
+		}
+	}
+
+	if(targetTileId == INVALID_TILE_ID)
+	{
+		return;
+	}
+
+	spaceship.m_targetTileId = targetTileId;
+
+	const bool isMoving = MoveSpaceship(spaceship, targetTileId, i_deltaTime);
+	if(isMoving)
+	{
+		const float consumption = SpaceshipRules::CalculateConsumption(settings, spaceship.m_state, i_deltaTime);
+		if(consumption > 0.f)
+		{
+			AddSpaceshipEnergy(i_index, -consumption);
+		}
+
+		return;
+	}
+
+	if(isLanding)
+	{
+		spaceship.m_isLanded = true;
+		spaceship.m_targetTileId = INVALID_TILE_ID;
+
+		return;
+	}
+
+	const BeamTransfer transfer = BeamRules::CalculateTransfer(m_settings.m_beamTransferSpeed, 1, i_deltaTime);
+
+	AddTileEnergy(targetTileId, transfer.m_tileEnergy);
+	AddSpaceshipEnergy(i_index, -transfer.m_sentEnergy);
+}
+
+void Simulation::UpdateStorms(float i_deltaTime)
+{
+	if(m_settings.m_stormSpawnDelay > 0.f)
+	{
+		m_stormTimer -= i_deltaTime;
+
+		if(m_stormTimer <= 0.f)
+		{
+			while(m_stormTimer < 0.f)
+			{
+				m_stormTimer += m_settings.m_stormSpawnDelay;
+			}
+
+			SpawnStorm();
+		}
+	}
+
+	const float tileScale = 1.f / m_settings.m_tileSize;
+	const float radius = m_settings.m_stormRadius * tileScale;
+	const float squaredRadius = radius * radius;
+
+	const auto gridLength = static_cast<AZ::s32>(m_layout.GetGridLength());
+
+	for(Storm& storm : m_storms)
+	{
+		storm.m_timer -= i_deltaTime;
+		storm.m_position += storm.m_parameters.m_moveDirection * (storm.m_parameters.m_moveSpeed * tileScale * i_deltaTime);
+
+		const float damage = StormRules::CalculateDamage(storm.m_parameters.m_strength, i_deltaTime);
+
+		for(AZ::u8 i = 0; i < m_spaceships.size() && !m_isOver; ++i)
+		{
+			const Spaceship& spaceship = m_spaceships[i];
+			if(spaceship.m_isActive && (spaceship.m_position - storm.m_position).GetLengthSq() <= squaredRadius)
+			{
+				AddSpaceshipEnergy(i, -damage);
+			}
+		}
+
+		if(m_isOver)
+		{
+			return;
+		}
+
+		const AZ::s32 firstRow = AZStd::max(static_cast<AZ::s32>(storm.m_position.GetY() - radius), 0);
+		const AZ::s32 lastRow = AZStd::min(static_cast<AZ::s32>(storm.m_position.GetY() + radius), gridLength - 1);
+		const AZ::s32 firstColumn = AZStd::max(static_cast<AZ::s32>(storm.m_position.GetX() - radius), 0);
+		const AZ::s32 lastColumn = AZStd::min(static_cast<AZ::s32>(storm.m_position.GetX() + radius), gridLength - 1);
+
+		for(AZ::s32 row = firstRow; row <= lastRow; ++row)
+		{
+			for(AZ::s32 column = firstColumn; column <= lastColumn; ++column)
+			{
+				const TileId tileId = static_cast<TileId>((row * gridLength) + column);
+				if((GetTileCenter(tileId) - storm.m_position).GetLengthSq() <= squaredRadius)
+				{
+					AddTileEnergy(tileId, -damage);
+				}
+			}
+		}
+	}
+
+	m_storms.erase(AZStd::remove_if(m_storms.begin(), m_storms.end(), [](const Storm& i_storm)
+	{
+		return (i_storm.m_timer < 0.f);
+	}), m_storms.end());
+}
+
+void Simulation::UpdateTiles(float i_deltaTime)
+{
+	for(TileId tileId = 0; tileId < m_tiles.size(); ++tileId)
+	{
+		Tile& tile = m_tiles[tileId];
+		if(!tile.m_isPresent || tile.m_isLocked)
+		{
+			continue;
+		}
+
+		if(tile.m_noDecayTimer > 0.f)
+		{
+			tile.m_noDecayTimer -= i_deltaTime;
+		}
+
+		if(tile.m_isRecharging)
+		{
+			tile.m_isRecharging = false;
+		}
+		else if(tile.m_noDecayTimer < 0.f && tile.m_state.m_energy > 0.f)
+		{
+			const float lostEnergy = TileRules::CalculateDecay(m_settings.m_tile, tile.m_nClaimedNeighbors, i_deltaTime);
+			AddTileEnergy(tileId, -lostEnergy);
+		}
+	}
+}
+
+void Simulation::UpdateCollectables(float i_deltaTime)
+{
+	const float squaredPickDistance = PICK_DISTANCE * PICK_DISTANCE;
+
+	for(AZStd::size_t i = 0; i < m_collectables.size() && !m_isOver;)
+	{
+		Collectable& collectable = m_collectables[i];
+		collectable.m_timer -= i_deltaTime;
+
+		bool isRemoved = (collectable.m_timer < 0.f);
+		if(!isRemoved)
+		{
+			const AZ::Vector2 collectablePosition = GetTileCenter(collectable.m_tileId);
+
+			for(AZ::u8 j = 0; j < m_spaceships.size(); ++j)
+			{
+				const Spaceship& spaceship = m_spaceships[j];
+				if(spaceship.m_isActive && (spaceship.m_position - collectablePosition).GetLengthSq() <= squaredPickDistance)
+				{
+					const Collectable pickedCollectable = collectable;
+					isRemoved = true;
+
+					PickCollectable(j, pickedCollectable);
+					break;
+				}
+			}
+		}
+
+		if(isRemoved)
+		{
+			m_collectables[i] = m_collectables.back();
+			m_collectables.pop_back();
+		}
+		else
+		{
+			++i;
+		}
+	}
+}
+
+bool Simulation::MoveSpaceship(Spaceship& io_spaceship, TileId i_targetTileId, float i_deltaTime) const
+{
+	const AZ::Vector2 offset = GetTileCenter(i_targetTileId) - io_spaceship.m_position;
+
+	const float distance = offset.GetLength();
+	if(distance < AZ::Constants::FloatEpsilon)
+	{
+		return false;
+	}
+
+	const float step = m_settings.m_spaceshipSpeed * io_spaceship.m_state.m_speedMultiplier * i_deltaTime / m_settings.m_tileSize;
+	if(step >= distance)
+	{
+		io_spaceship.m_position = GetTileCenter(i_targetTileId);
+	}
+	else
+	{
+		io_spaceship.m_position += offset * (step / distance);
+	}
+
+	return true;
+}
+
+void Simulation::AddSpaceshipEnergy(AZ::u8 i_index, float i_amount)
+{
+	Spaceship& spaceship = m_spaceships[i_index];
+	SpaceshipRules::AddEnergy(m_settings.m_spaceship, spaceship.m_state, i_amount);
+
+	if(!SpaceshipRules::IsDepleted(spaceship.m_state))
+	{
+		return;
+	}
+
+	if(i_index == 0)
+	{
+		m_result.m_isDepleted = true;
+		Finish();
+	}
+	else
+	{
+		spaceship.m_isActive = false;
+	}
+}
+
+void Simulation::AddTileEnergy(TileId i_tileId, float i_amount)
+{
+	Tile& tile = m_tiles[i_tileId];
+	if(!tile.m_isPresent || tile.m_isLocked)
+	{
+		return;
+	}
+
+	const TileTransition transition = TileRules::AddEnergy(m_settings.m_tile, tile.m_state, i_amount);
+
+	if(i_amount > 0.f)
+	{
+		tile.m_isRecharging = true;
+	}
+
+	if(transition == TileTransition::TOGGLE)
+	{
+		tile.m_state.m_isClaimed = !tile.m_state.m_isClaimed;
+		ToggleTile(i_tileId);
+	}
+}
+
+void Simulation::ToggleTile(TileId i_tileId)
+{
+	const bool isClaimed = m_tiles[i_tileId].m_state.m_isClaimed;
+	UpdateNeighbors(i_tileId, isClaimed);
+
+	if(m_tiles[i_tileId].m_isLocked)
+	{
+		return;
+	}
+
+	if(isClaimed)
+	{
+		m_ledger.ClaimTile(GetTimeMs());
+		m_result.m_maxClaimedTiles = AZStd::max(m_result.m_maxClaimedTiles, m_ledger.GetClaimedTiles());
+
+		DropCollectable(i_tileId);
+	}
+	else
+	{
+		m_ledger.LoseTile(GetTimeMs());
+	}
+}
+
+void Simulation::UpdateNeighbors(TileId i_tileId, bool i_isClaimed)
+{
+	const auto gridLength = static_cast<AZ::s32>(m_layout.GetGridLength());
+	const auto row = static_cast<AZ::s32>(i_tileId / gridLength);
+	const auto column = static_cast<AZ::s32>(i_tileId % gridLength);
+
+	for(AZ::s32 i = AZStd::max(row - 1, 0); i <= AZStd::min(row + 1, gridLength - 1); ++i)
+	{
+		for(AZ::s32 j = AZStd::max(column - 1, 0); j <= AZStd::min(column + 1, gridLength - 1); ++j)
+		{
+			if(i == row && j == column)
+			{
+				continue;
+			}
+
+			Tile& neighbor = m_tiles[(i * gridLength) + j];
+			if(i_isClaimed && neighbor.m_nClaimedNeighbors < TileRules::MAX_NEIGHBORS)
+			{
+				++neighbor.m_nClaimedNeighbors;
+			}
+			else if(!i_isClaimed && neighbor.m_nClaimedNeighbors > 0)
+			{
+				--neighbor.m_nClaimedNeighbors;
+			}
+		}
+	}
+}
+
+void Simulation::SpawnStorm()
+{
+	Storm storm;
+	storm.m_parameters = StormRules::GenerateStorm(m_settings.m_storm, m_stormRandomStream);
+	storm.m_timer = storm.m_parameters.m_duration;
+
+	const float halfLength = static_cast<float>(m_layout.GetGridLength()) / 2.f;
+	const float column = StormRules::GenerateRandomInRange(m_stormRandomStream, -halfLength, halfLength);
+	const float row = StormRules::GenerateRandomInRange(m_stormRandomStream, -halfLength, halfLength);
+
+	storm.m_position = AZ::Vector2 { column + halfLength, row + halfLength };
+
+	m_storms.push_back(storm);
+	++m_result.m_nStorms;
+}
+
+void Simulation::DropCollectable(TileId i_tileId)
+{
+	const CollectableType collectableType = CollectableRules::SampleDrop(m_dropRandomStream, m_settings.m_collectableProbability, CollectableRules::N_TYPES);
+	if(collectableType == CollectableType::NONE)
+	{
+		return;
+	}
+
+	const float expiration = CollectableRules::GenerateRandomInRange(m_dropRandomStream, m_settings.m_minCollectableExpiration, m_settings.m_maxCollectableExpiration);
+	m_collectables.push_back({ collectableType, i_tileId, expiration });
+
+	++m_result.m_nDroppedCollectables;
+}
+
+void Simulation::PickCollectable(AZ::u8 i_spaceshipIndex, const Collectable& i_collectable)
+{
+	const SimulationSettings::Collectable& values = m_settings.m_collectables[static_cast<AZ::u8>(i_collectable.m_type) - 1];
+	const CollectableEffect effect = CollectableRules::CalculateEffect(i_collectable.m_type, values.m_amount, values.m_duration);
+
+	++m_result.m_nPickedCollectables;
+
+	if(effect.m_points > 0)
+	{
+		m_ledger.AddPoints(effect.m_points);
+	}
+
+	if(effect.m_stopDecayDuration > 0.f || effect.m_tileEnergy != 0.f)
+	{
+		for(TileId tileId = 0; tileId < m_tiles.size(); ++tileId)
+		{
+			Tile& tile = m_tiles[tileId];
+			if(!tile.m_isPresent || !tile.m_state.m_isClaimed)
+			{
+				continue;
+			}
+
+			if(effect.m_stopDecayDuration > 0.f)
+			{
+				tile.m_noDecayTimer = effect.m_stopDecayDuration;
+			}
+
+			if(effect.m_tileEnergy != 0.f)
+			{
+				AddTileEnergy(tileId, effect.m_tileEnergy);
+			}
+		}
+	}
+
+	if(effect.m_speedDuration > 0.f)
+	{
+		SpaceshipRules::ApplySpeedModifier(m_spaceships[i_spaceshipIndex].m_state, effect.m_speedMultiplier, effect.m_speedDuration);
+	}
+
+	if(effect.m_spaceshipEnergy != 0.f)
+	{
+		AddSpaceshipEnergy(i_spaceshipIndex, effect.m_spaceshipEnergy);
+	}
+}
+
+bool Simulation::IsFilling(TileId i_tileId) const
+{
+	if(i_tileId == INVALID_TILE_ID)
+	{
+		return false;
+	}
+
+	const Tile& tile = m_tiles[i_tileId];
+	return (tile.m_isPresent && !tile.m_isLocked && tile.m_state.m_energy < m_settings.m_tile.m_maxEnergy);
+}
+
+TileId Simulation::FindTarget(const AZ::Vector2& i_position, bool i_isLanding) const
+{
+	TileId targetTileId = INVALID_TILE_ID;
+	float targetDistance = AZStd::numeric_limits<float>::max();
+
+	for(TileId tileId = 0; tileId < m_tiles.size(); ++tileId)
+	{
+		if(!IsTarget(tileId, i_isLanding))
+		{
+			continue;
+		}
+
+		const float distance = (GetTileCenter(tileId) - i_position).GetLengthSq();
+		if(distance < targetDistance)
+		{
+			targetTileId = tileId;
+			targetDistance = distance;
+		}
+	}
+
+	return targetTileId;
+}
+
+bool Simulation::IsTarget(TileId i_tileId, bool i_isLanding) const
+{
+	if(i_tileId == INVALID_TILE_ID)
+	{
+		return false;
+	}
+
+	const Tile& tile = m_tiles[i_tileId];
+	if(!tile.m_isPresent)
+	{
+		return false;
+	}
+
+	if(i_isLanding)
+	{
+		return tile.m_state.m_isClaimed;
+	}
+
+	return (!tile.m_isLocked && (!tile.m_state.m_isClaimed || tile.m_state.m_energy < m_settings.m_tile.m_alertEnergyThreshold));
+}
+
+AZ::Vector2 Simulation::GetTileCenter(TileId i_tileId) const
+{
+	const AZ::u16 gridLength = m_layout.GetGridLength();
+
+	const auto row = static_cast<float>(i_tileId / gridLength);
+	const auto column = static_cast<float>(i_tileId % gridLength);
+
+	return AZ::Vector2 { column + 0.5f, row + 0.5f };
+}
+
+ScoreLedger::TimeMs Simulation::GetTimeMs() const
+{
+	return static_cast<ScoreLedger::TimeMs>(static_cast<double>(m_time) * 1000.0);
+}
+
+void Simulation::Finish()
+{
+	m_ledger.Stop(GetTimeMs());
+
+	m_result.m_duration = m_time;
+	m_result.m_totalPoints = m_ledger.GetTotalPoints();
+	m_result.m_nClaimedTiles = m_ledger.GetClaimedTiles();
+
+	m_isOver = true;
+}
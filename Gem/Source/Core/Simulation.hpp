@@ -0,0 +1,219 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+#include "CollectableRules.hpp"
+#include "GridTypes.hpp"
+#include "LayoutPlan.hpp"
+#include "RandomStream.hpp"
+#include "ScoreLedger.hpp"
+#include "SpaceshipRules.hpp"
+#include "StormRules.hpp"
+#include "TileRules.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class SaveFile;
+	class TraceRecorder;
+
+	struct SimulationSettings
+	{
+		struct Collectable
+		{
+			float m_amount { 0.f };
+			float m_duration { 0.f };
+		};
+
+		AZ::u16 m_gridLength { 11 };
+		AZ::u16 m_maxObstacles { 5 };
+		float m_tileSize { 3.f };
+		float m_obstacleSize { 6.f };
+		AZStd::size_t m_nObstacleTypes { 1 };
+		AZStd::size_t m_nTileTypes { 2 };
+
+		TileSettings m_tile {};
+
+		SpaceshipSettings m_spaceship {};
+		float m_spaceshipSpeed { 5.f };
+		AZ::u8 m_nSpaceships { 1 };
+
+		float m_beamTransferSpeed { 4.f };
+
+		StormSettings m_storm {};
+		float m_stormSpawnDelay { 15.f };
+		float m_stormRadius { 3.f };
+
+		float m_collectableProbability { 0.25f };
+		float m_minCollectableExpiration { 3.f };
+		float m_maxCollectableExpiration { 20.f };
+
+		// indexed by collectable type, starting from the first one after NONE
+		AZStd::array<Collectable, CollectableRules::N_TYPES> m_collectables
+		{{
+			{ 0.f, 10.f },	// STOP_DECAY
+			{ 10.f, 0.f },	// SPACESHIP_DAMAGE
+			{ 20.f, 0.f },	// SPACESHIP_ENERGY
+			{ 3.f, 0.f },	// TILE_DAMAGE
+			{ 3.f, 0.f },	// TILE_ENERGY
+			{ 10.f, 0.f },	// SMALL_POINTS
+			{ 25.f, 0.f },	// MEDIUM_POINTS
+			{ 50.f, 0.f },	// LARGE_POINTS
+			{ 2.f, 5.f },	// SPEED_UP
+			{ 2.f, 5.f }	// SPEED_DOWN
+		}};
+
+		ScoreLedger::Points m_claimedTilePoints { 1 };
+		float m_tileTimerPeriod { 5.f };
+
+		float m_timeStep { 1.f / 30.f };
+		float m_maxDuration { 600.f };
+	};
+
+	struct SimulationResult
+	{
+		AZ::u64 m_seed { 0 };
+		float m_duration { 0.f };
+
+		ScoreLedger::TotalPoints m_totalPoints { 0 };
+		TileCount m_nClaimedTiles { 0 };
+		TileCount m_maxClaimedTiles { 0 };
+
+		AZ::u32 m_nStorms { 0 };
+		AZ::u32 m_nDroppedCollectables { 0 };
+		AZ::u32 m_nPickedCollectables { 0 };
+
+		bool m_isDepleted { false };
+	};
+
+	// A whole game session played by autopilots on top of the core rules, with no entity, physics or rendering involved.
+	// Distances are measured in tiles, the first spaceship plays the role of the player.
+	class Simulation
+	{
+	public:
+		SimulationResult Run(const SimulationSettings& i_settings, AZ::u64 i_seed);
+
+		void Start(const SimulationSettings& i_settings, AZ::u64 i_seed);
+		bool Step();
+
+		bool IsOver() const;
+		SimulationResult GetResult() const;
+
+		const LayoutPlan& GetLayout() const;
+
+		// number of steps played since the start, and a hash of the tiles, spaceships and score at this point
+		AZ::u32 GetTick() const;
+		AZ::u64 CalculateChecksum() const;
+
+		// the random streams are stored with their counters, so a run restored from the file goes on in the same way
+		void Save(SaveFile& o_file) const;
+		bool Restore(const SimulationSettings& i_settings, const SaveFile& i_file);
+
+		// when set, every stage of the following steps is recorded as a trace scope
+		void SetTraceRecorder(TraceRecorder* io_recorder);
+
+	private:
+		struct Tile
+		{
+			TileState m_state {};
+			AZ::u8 m_nClaimedNeighbors { 0 };
+			float m_noDecayTimer { -1.f };
+			bool m_isRecharging { false };
+			bool m_isLocked { false };
+			bool m_isPresent { false };
+		};
+
+		struct Spaceship
+		{
+			SpaceshipState m_state {};
+			AZ::Vector2 m_position { AZ::Vector2::CreateZero() };
+			TileId m_targetTileId { INVALID_TILE_ID };
+			bool m_isLanded { true };
+			bool m_isActive { true };
+		};
+
+		struct Storm
+		{
+			StormParameters m_parameters {};
+			AZ::Vector2 m_position { AZ::Vector2::CreateZero() };
+			float m_timer { 0.f };
+		};
+
+		struct Collectable
+		{
+			CollectableType m_type { CollectableType::NONE };
+			TileId m_tileId { INVALID_TILE_ID };
+			float m_timer { 0.f };
+		};
+
+		void UpdateSpaceship(AZ::u8 i_index, float i_deltaTime);
+		void UpdateStorms(float i_deltaTime);
+		void UpdateTiles(float i_deltaTime);
+		void UpdateCollectables(float i_deltaTime);
+
+		bool MoveSpaceship(Spaceship& io_spaceship, TileId i_targetTileId, float i_deltaTime) const;
+		void AddSpaceshipEnergy(AZ::u8 i_index, float i_amount);
+
+		void AddTileEnergy(TileId i_tileId, float i_amount);
+		void ToggleTile(TileId i_tileId);
+		void UpdateNeighbors(TileId i_tileId, bool i_isClaimed);
+
+		void SpawnStorm();
+		void DropCollectable(TileId i_tileId);
+		void PickCollectable(AZ::u8 i_spaceshipIndex, const Collectable& i_collectable);
+
+		TileId FindTarget(const AZ::Vector2& i_position, bool i_isLanding) const;
+		bool IsTarget(TileId i_tileId, bool i_isLanding) const;
+		bool IsFilling(TileId i_tileId) const;
+		AZ::Vector2 GetTileCenter(TileId i_tileId) const;
+
+		ScoreLedger::TimeMs GetTimeMs() const;
+		void Finish();
+
+		SimulationSettings m_settings {};
+		AZ::u64 m_seed { 0 };
+
+		LayoutPlan m_layout {};
+		AZStd::vector<Tile> m_tiles {};
+		TileId m_startTileId { INVALID_TILE_ID };
+
+		AZStd::vector<Spaceship> m_spaceships {};
+		AZStd::vector<Storm> m_storms {};
+		AZStd::vector<Collectable> m_collectables {};
+
+		ScoreLedger m_ledger {};
+
+		RandomStream m_stormRandomStream { RandomStreamId::STORMS };
+		RandomStream m_dropRandomStream { RandomStreamId::DROPS };
+
+		float m_time { 0.f };
+		AZ::u32 m_tick { 0 };
+		float m_stormTimer { 0.f };
+
+		SimulationResult m_result {};
+		bool m_isOver { true };
+
+		TraceRecorder* m_traceRecorder { nullptr };
+
+		static constexpr float PICK_DISTANCE = 0.5f;
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,112 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+
+#include "SpaceshipRules.hpp"
+
+using Loherangrin::Games::O3DEJam2305::SpaceshipRules;
+using Loherangrin::Games::O3DEJam2305::SpaceshipTransition;
+
+
+bool SpaceshipRules::IsLowEnergy(const SpaceshipSettings& i_settings, const SpaceshipState& i_state)
+{
+	return (i_state.m_energy > 0.f && i_state.m_energy < i_settings.m_lowEnergyThreshold);
+}
+
+bool SpaceshipRules::IsDepleted(const SpaceshipState& i_state)
+{
+	return (i_state.m_energy < 0.f);
+}
+
+SpaceshipTransition SpaceshipRules::AddEnergy(const SpaceshipSettings& i_settings, SpaceshipState& io_state, float i_amount)
+{
+	const bool wasLowEnergy = IsLowEnergy(i_settings, io_state);
+
+	io_state.m_energy = AZStd::clamp(io_state.m_energy + i_amount, MIN_ENERGY, i_settings.m_maxEnergy);
+
+	const bool isLowEnergy = IsLowEnergy(i_settings, io_state);
+	if(isLowEnergy == wasLowEnergy)
+	{
+		return SpaceshipTransition::NONE;
+	}
+
+	if(isLowEnergy)
+	{
+		io_state.m_speedMultiplier = AZStd::min(i_settings.m_lowEnergySpeedMultiplier, io_state.m_speedMultiplier);
+
+		return SpaceshipTransition::ENERGY_SAVING_ACTIVATED;
+	}
+	else
+	{
+		io_state.m_speedMultiplier = 1.f;
+
+		return SpaceshipTransition::ENERGY_SAVING_DEACTIVATED;
+	}
+}
+
+float SpaceshipRules::CalculateConsumption(const SpaceshipSettings& i_settings, const SpaceshipState& i_state, float i_deltaTime)
+{
+	if(IsLowEnergy(i_settings, i_state))
+	{
+		return 0.f;
+	}
+
+	return (i_settings.m_consumptionRate * i_deltaTime);
+}
+
+float SpaceshipRules::CalculateRecharge(const SpaceshipSettings& i_settings, const SpaceshipState& i_state, float i_deltaTime)
+{
+	if(AZ::IsClose(i_state.m_energy, i_settings.m_maxEnergy, AZ::Constants::FloatEpsilon))
+	{
+		return 0.f;
+	}
+
+	return (i_settings.m_rechargeRate * i_deltaTime);
+}
+
+void SpaceshipRules::ApplySpeedModifier(SpaceshipState& io_state, float i_multiplier, float i_duration)
+{
+	io_state.m_speedMultiplier = i_multiplier;
+	io_state.m_speedTimer = i_duration;
+}
+
+void SpaceshipRules::UpdateSpeedModifier(const SpaceshipSettings& i_settings, SpaceshipState& io_state, float i_deltaTime)
+{
+	if(io_state.m_speedTimer < 0.f)
+	{
+		return;
+	}
+
+	io_state.m_speedTimer -= i_deltaTime;
+
+	if(io_state.m_speedTimer < 0.f)
+	{
+		io_state.m_speedMultiplier = (IsLowEnergy(i_settings, io_state))
+			? i_settings.m_lowEnergySpeedMultiplier
+			: 1.f
+		;
+	}
+}
+
+void SpaceshipRules::Reset(const SpaceshipSettings& i_settings, SpaceshipState& io_state)
+{
+	io_state.m_energy = i_settings.m_maxEnergy;
+
+	io_state.m_speedMultiplier = 1.f;
+	io_state.m_speedTimer = -1.f;
+}
@@ -0,0 +1,68 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	struct SpaceshipSettings
+	{
+		float m_maxEnergy { 100.f };
+		float m_consumptionRate { 0.5f };
+		float m_rechargeRate { 5.f };
+
+		float m_lowEnergyThreshold { 15.f };
+		float m_lowEnergySpeedMultiplier { 0.2f };
+	};
+
+	struct SpaceshipState
+	{
+		float m_energy { 0.f };
+
+		float m_speedMultiplier { 1.f };
+		float m_speedTimer { -1.f };
+	};
+
+	enum class SpaceshipTransition : AZ::u8
+	{
+		NONE = 0,
+		ENERGY_SAVING_ACTIVATED,
+		ENERGY_SAVING_DEACTIVATED
+	};
+
+	class SpaceshipRules
+	{
+	public:
+		static bool IsLowEnergy(const SpaceshipSettings& i_settings, const SpaceshipState& i_state);
+		static bool IsDepleted(const SpaceshipState& i_state);
+
+		static SpaceshipTransition AddEnergy(const SpaceshipSettings& i_settings, SpaceshipState& io_state, float i_amount);
+
+		static float CalculateConsumption(const SpaceshipSettings& i_settings, const SpaceshipState& i_state, float i_deltaTime);
+		static float CalculateRecharge(const SpaceshipSettings& i_settings, const SpaceshipState& i_state, float i_deltaTime);
+
+		static void ApplySpeedModifier(SpaceshipState& io_state, float i_multiplier, float i_duration);
+		static void UpdateSpeedModifier(const SpaceshipSettings& i_settings, SpaceshipState& io_state, float i_deltaTime);
+
+		static void Reset(const SpaceshipSettings& i_settings, SpaceshipState& io_state);
+
+		static constexpr float MIN_ENERGY = -1.f;
+	};
+
+} // Loherangrin::Games::O3DEJam2305
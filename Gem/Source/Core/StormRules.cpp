@@ -0,0 +1,47 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StormRules.hpp"
+
+using Loherangrin::Games::O3DEJam2305::RandomStream;
+using Loherangrin::Games::O3DEJam2305::StormParameters;
+using Loherangrin::Games::O3DEJam2305::StormRules;
+
+
+float StormRules::CalculateDamage(float i_strength, float i_deltaTime)
+{
+	return (i_strength * i_deltaTime);
+}
+
+StormParameters StormRules::GenerateStorm(const StormSettings& i_settings, RandomStream& io_randomStream)
+{
+	StormParameters storm;
+	storm.m_duration = GenerateRandomInRange(io_randomStream, i_settings.m_minDuration, i_settings.m_maxDuration);
+	storm.m_strength = GenerateRandomInRange(io_randomStream, i_settings.m_minStrength, i_settings.m_maxStrength);
+
+	const float directionX = io_randomStream.GetRandomFloat();
+	const float directionY = io_randomStream.GetRandomFloat();
+	storm.m_moveDirection = AZ::Vector2 { directionX, directionY }.GetNormalized();
+
+	storm.m_moveSpeed = GenerateRandomInRange(io_randomStream, i_settings.m_minSpeed, i_settings.m_maxSpeed);
+
+	return storm;
+}
+
+float StormRules::GenerateRandomInRange(RandomStream& io_randomStream, float i_min, float i_max)
+{
+	return (i_min + (io_randomStream.GetRandomFloat() * (i_max - i_min)));
+}
@@ -0,0 +1,58 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector2.h>
+
+#include "RandomStream.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	struct StormSettings
+	{
+		float m_minDuration { 5.f };
+		float m_maxDuration { 15.f };
+
+		float m_minSpeed { 1.f };
+		float m_maxSpeed { 4.f };
+
+		float m_minStrength { 5.f };
+		float m_maxStrength { 10.f };
+	};
+
+	struct StormParameters
+	{
+		float m_duration { 0.f };
+		float m_strength { 0.f };
+
+		AZ::Vector2 m_moveDirection { AZ::Vector2::CreateZero() };
+		float m_moveSpeed { 0.f };
+	};
+
+	class StormRules
+	{
+	public:
+		// the same damage hits every spaceship and tile inside the storm
+		static float CalculateDamage(float i_strength, float i_deltaTime);
+
+		static StormParameters GenerateStorm(const StormSettings& i_settings, RandomStream& io_randomStream);
+
+		static float GenerateRandomInRange(RandomStream& io_randomStream, float i_min, float i_max);
+	};
+
+} // Loherangrin::Games::O3DEJam2305
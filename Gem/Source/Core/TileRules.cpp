@@ -0,0 +1,61 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/std/algorithm.h>
+
+#include "TileRules.hpp"
+
+using Loherangrin::Games::O3DEJam2305::TileRules;
+using Loherangrin::Games::O3DEJam2305::TileTransition;
+
+
+float TileRules::CalculateDecay(const TileSettings& i_settings, AZ::u8 i_nClaimedNeighbors, float i_deltaTime)
+{
+	const float decayMultiplier = 1.f - static_cast<float>(i_nClaimedNeighbors) / static_cast<float>(MAX_NEIGHBORS);
+
+	return (decayMultiplier * i_settings.m_decaySpeed * i_deltaTime);
+}
+
+TileTransition TileRules::AddEnergy(const TileSettings& i_settings, TileState& io_state, float i_amount)
+{
+	io_state.m_energy = AZStd::clamp(io_state.m_energy + i_amount, 0.f, i_settings.m_maxEnergy);
+
+	const bool isAdded = (i_amount > 0.f);
+	if(isAdded)
+	{
+		if(!io_state.m_isClaimed && io_state.m_energy > i_settings.m_toggleEnergyThreshold)
+		{
+			return TileTransition::TOGGLE;
+		}
+		else if(io_state.m_isClaimed && io_state.m_energy > i_settings.m_alertEnergyThreshold)
+		{
+			return TileTransition::RECOVER;
+		}
+	}
+	else if(io_state.m_isClaimed)
+	{
+		if(io_state.m_energy < i_settings.m_toggleEnergyThreshold)
+		{
+			return TileTransition::TOGGLE;
+		}
+		else if(io_state.m_energy < i_settings.m_alertEnergyThreshold)
+		{
+			return TileTransition::ALERT;
+		}
+	}
+
+	return TileTransition::NONE;
+}
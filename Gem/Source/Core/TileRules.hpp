@@ -0,0 +1,58 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	struct TileSettings
+	{
+		float m_maxEnergy { 10.f };
+		float m_decaySpeed { 0.25f };
+
+		float m_toggleEnergyThreshold { 2.5f };
+		float m_alertEnergyThreshold { 3.5f };
+	};
+
+	struct TileState
+	{
+		float m_energy { 0.f };
+		bool m_isClaimed { false };
+	};
+
+	enum class TileTransition : AZ::u8
+	{
+		NONE = 0,
+		TOGGLE,
+		ALERT,
+		RECOVER
+	};
+
+	class TileRules
+	{
+	public:
+		static float CalculateDecay(const TileSettings& i_settings, AZ::u8 i_nClaimedNeighbors, float i_deltaTime);
+
+		// the claimed flag is left untouched, since the owner decides when a toggle takes effect
+		static TileTransition AddEnergy(const TileSettings& i_settings, TileState& io_state, float i_amount);
+
+		static constexpr AZ::u8 MAX_NEIGHBORS = 8;
+	};
+
+} // Loherangrin::Games::O3DEJam2305
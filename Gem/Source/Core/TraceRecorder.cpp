@@ -0,0 +1,161 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/IO/SystemFile.h>
+
+#include "TraceRecorder.hpp"
+
+using Loherangrin::Games::O3DEJam2305::TraceRecorder;
+
+
+void TraceRecorder::Start()
+{
+	m_events.clear();
+	m_nDroppedEvents = 0;
+
+	m_startTime = Clock::now();
+	m_isRecording = true;
+}
+
+void TraceRecorder::Stop()
+{
+	m_isRecording = false;
+}
+
+bool TraceRecorder::IsRecording() const
+{
+	return m_isRecording;
+}
+
+void TraceRecorder::AddScope(const char* i_category, const char* i_name, Clock::time_point i_start, Clock::time_point i_end)
+{
+	if(!CanAddEvent())
+	{
+		return;
+	}
+
+	Event& event = m_events.emplace_back();
+	event.m_category = i_category;
+	event.m_name = i_name;
+	event.m_time = i_start;
+	event.m_duration = i_end - i_start;
+	event.m_type = EventType::SCOPE;
+}
+
+void TraceRecorder::AddCounter(const char* i_name, AZ::s64 i_value, Clock::time_point i_time)
+{
+	if(!CanAddEvent())
+	{
+		return;
+	}
+
+	Event& event = m_events.emplace_back();
+	event.m_name = i_name;
+	event.m_time = i_time;
+	event.m_value = i_value;
+	event.m_type = EventType::COUNTER;
+}
+
+AZStd::size_t TraceRecorder::GetEventsCount() const
+{
+	return m_events.size();
+}
+
+AZStd::size_t TraceRecorder::GetDroppedEventsCount() const
+{
+	return m_nDroppedEvents;
+}
+
+void TraceRecorder::PrintChromeTrace(AZStd::string& o_text) const
+{
+	using Microseconds = AZStd::chrono::duration<double, AZStd::micro>;
+
+	o_text += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+	for(AZStd::size_t i = 0; i < m_events.size(); ++i)
+	{
+		const Event& event = m_events[i];
+		const double timestamp = AZStd::chrono::duration_cast<Microseconds>(event.m_time - m_startTime).count();
+
+		if(i > 0)
+		{
+			o_text += ',';
+		}
+
+		switch(event.m_type)
+		{
+			case EventType::SCOPE:
+			{
+				const double duration = AZStd::chrono::duration_cast<Microseconds>(event.m_duration).count();
+
+				o_text += AZStd::string::format("\n{\"ph\":\"X\",\"pid\":1,\"tid\":1,\"cat\":\"%s\",\"name\":\"%s\",\"ts\":%.3f,\"dur\":%.3f}",
+					event.m_category, event.m_name, timestamp, duration);
+			}
+			break;
+
+			case EventType::COUNTER:
+			{
+				o_text += AZStd::string::format("\n{\"ph\":\"C\",\"pid\":1,\"tid\":1,\"name\":\"%s\",\"ts\":%.3f,\"args\":{\"value\":%lld}}",
+					event.m_name, timestamp, static_cast<long long>(event.m_value));
+			}
+			break;
+
+			default:
+			{}
+		}
+	}
+
+	o_text += "\n]}\n";
+}
+
+bool TraceRecorder::WriteChromeTrace(const char* i_filePath) const
+{
+	AZ::IO::SystemFile file;
+
+	const int openMode = AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY;
+	const bool isFileOpen = file.Open(i_filePath, openMode);
+
+	AZ_Error("TraceRecorder", isFileOpen, "Unable to open the trace file at %s", i_filePath);
+	if(!isFileOpen)
+	{
+		return false;
+	}
+
+	AZStd::string text;
+	PrintChromeTrace(text);
+
+	const bool isWritten = (file.Write(text.data(), text.size()) == text.size());
+	file.Close();
+
+	AZ_Error("TraceRecorder", isWritten, "Unable to write the trace file at %s", i_filePath);
+	return isWritten;
+}
+
+bool TraceRecorder::CanAddEvent()
+{
+	if(!m_isRecording)
+	{
+		return false;
+	}
+
+	if(m_events.size() >= MAX_EVENTS)
+	{
+		++m_nDroppedEvents;
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,112 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Collects timed scopes and counters in memory, to be exported in the Chrome trace event format
+	// (chrome://tracing, Perfetto) when the engine profiler is not available, e.g. in headless runs.
+	// Names and categories are stored as pointers, so they must be string literals.
+	class TraceRecorder
+	{
+	public:
+		using Clock = AZStd::chrono::steady_clock;
+
+		void Start();
+		void Stop();
+		bool IsRecording() const;
+
+		void AddScope(const char* i_category, const char* i_name, Clock::time_point i_start, Clock::time_point i_end);
+		void AddCounter(const char* i_name, AZ::s64 i_value, Clock::time_point i_time);
+
+		AZStd::size_t GetEventsCount() const;
+		AZStd::size_t GetDroppedEventsCount() const;
+
+		void PrintChromeTrace(AZStd::string& o_text) const;
+		bool WriteChromeTrace(const char* i_filePath) const;
+
+	private:
+		enum class EventType : AZ::u8
+		{
+			SCOPE = 0,
+			COUNTER
+		};
+
+		struct Event
+		{
+			const char* m_category { nullptr };
+			const char* m_name { nullptr };
+			Clock::time_point m_time {};
+			Clock::duration m_duration {};
+			AZ::s64 m_value { 0 };
+			EventType m_type { EventType::SCOPE };
+		};
+
+		bool CanAddEvent();
+
+		AZStd::vector<Event> m_events {};
+		AZStd::size_t m_nDroppedEvents { 0 };
+
+		Clock::time_point m_startTime {};
+		bool m_isRecording { false };
+
+		// about 64 MB of events, that is several minutes of gameplay
+		static constexpr AZStd::size_t MAX_EVENTS = 1 << 20;
+	};
+
+	// ---
+
+	class ScopedTraceEvent
+	{
+	public:
+		ScopedTraceEvent(TraceRecorder* io_recorder, const char* i_category, const char* i_name);
+		~ScopedTraceEvent();
+
+		ScopedTraceEvent(const ScopedTraceEvent&) = delete;
+		ScopedTraceEvent& operator=(const ScopedTraceEvent&) = delete;
+
+	private:
+		TraceRecorder* m_recorder;
+		const char* m_category;
+		const char* m_name;
+		TraceRecorder::Clock::time_point m_start;
+	};
+
+	// ---
+
+	inline ScopedTraceEvent::ScopedTraceEvent(TraceRecorder* io_recorder, const char* i_category, const char* i_name)
+		: m_recorder { (io_recorder && io_recorder->IsRecording()) ? io_recorder : nullptr }
+		, m_category { i_category }
+		, m_name { i_name }
+		, m_start { (m_recorder) ? TraceRecorder::Clock::now() : TraceRecorder::Clock::time_point {} }
+	{}
+
+	inline ScopedTraceEvent::~ScopedTraceEvent()
+	{
+		if(m_recorder)
+		{
+			m_recorder->AddScope(m_category, m_name, m_start, TraceRecorder::Clock::now());
+		}
+	}
+
+} // Loherangrin::Games::O3DEJam2305
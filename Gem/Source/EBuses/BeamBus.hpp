@@ -0,0 +1,50 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/EBus/EBus.h>
+
+#include "../Utils/GameEventPolicy.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class BeamRequests
+	{
+	public:
+		AZ_RTTI(BeamRequests, "{AB96BE61-527D-49CA-84C2-6E1BFD40685E}");
+		virtual ~BeamRequests() = default;
+
+		virtual void Toggle() = 0;
+		virtual bool IsEnabled() const = 0;
+	};
+	
+	class BeamRequestBusTraits
+		: public AZ::EBusTraits
+	{
+	public:
+		// EBusTraits
+		static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+		static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+		using EventProcessingPolicy = GameEventProcessingPolicy;
+		using BusIdType = AZ::EntityId;
+	};
+
+	using BeamRequestBus = AZ::EBus<BeamRequests, BeamRequestBusTraits>;
+
+} // Loherangrin::Games::O3DEJam2305
@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <AzCore/Component/EntityId.h>
 #include <AzCore/EBus/EBus.h>
 
+#include "../Utils/GameEventPolicy.hpp"
+
 
 namespace Loherangrin::Games::O3DEJam2305
 {
@@ -30,10 +33,10 @@ namespace Loherangrin::Games::O3DEJam2305
         virtual ~CollectablesNotifications() = default;
 
 		virtual void OnStopDecayCollected([[maybe_unused]] float i_duration){}
-		virtual void OnSpaceshipEnergyCollected([[maybe_unused]] float i_energy){}
+		virtual void OnSpaceshipEnergyCollected([[maybe_unused]] const AZ::EntityId& i_spaceshipEntityId, [[maybe_unused]] float i_energy){}
 		virtual void OnTileEnergyCollected([[maybe_unused]] float i_energy){}
         virtual void OnPointsCollected([[maybe_unused]] Points i_points){}
-        virtual void OnSpeedCollected([[maybe_unused]] float i_multiplier, [[maybe_unused]] float i_duration){}
+        virtual void OnSpeedCollected([[maybe_unused]] const AZ::EntityId& i_spaceshipEntityId, [[maybe_unused]] float i_multiplier, [[maybe_unused]] float i_duration){}
     };
     
     class CollectablesNotificationBusTraits
@@ -43,6 +46,7 @@ namespace Loherangrin::Games::O3DEJam2305
 		// EBusTraits
         static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
         static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        using EventProcessingPolicy = GameEventProcessingPolicy;
     };
 
     using CollectablesNotificationBus = AZ::EBus<CollectablesNotifications, CollectablesNotificationBusTraits>;
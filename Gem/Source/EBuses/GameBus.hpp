@@ -18,9 +18,36 @@
 
 #include <AzCore/EBus/EBus.h>
 
+#include "../Utils/GameEventPolicy.hpp"
+
 
 namespace Loherangrin::Games::O3DEJam2305
 {
+	class GameRequests
+	{
+	public:
+		AZ_RTTI(GameRequests, "{483E4F7F-2D7D-4525-A96C-98077B57E92F}");
+		virtual ~GameRequests() = default;
+
+		virtual void NewGame() = 0;
+		virtual void RetryGame() = 0;
+		virtual void ResumeGame() = 0;
+	};
+
+	class GameRequestBusTraits
+		: public AZ::EBusTraits
+	{
+	public:
+		// EBusTraits
+		static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+		static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+		using EventProcessingPolicy = GameEventProcessingPolicy;
+	};
+
+	using GameRequestBus = AZ::EBus<GameRequests, GameRequestBusTraits>;
+
+	// ---
+
     class GameNotifications
     {
     public:
@@ -43,6 +70,7 @@ namespace Loherangrin::Games::O3DEJam2305
 		// EBusTraits
         static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
         static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        using EventProcessingPolicy = GameEventProcessingPolicy;
     };
 
     using GameNotificationBus = AZ::EBus<GameNotifications, GameNotificationBusTraits>;
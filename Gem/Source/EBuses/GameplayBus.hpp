@@ -0,0 +1,109 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+
+#include "../Utils/GameEventPolicy.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Phases of a gameplay frame, in the order they are run by the scheduler
+	enum class GameplayStage : AZ::u8
+	{
+		INPUT = 0,
+		SPACESHIPS,
+		TRANSFERS,
+		TILES,
+		COLLECTABLES,
+		SCORE,
+		UI,
+		COUNT
+	};
+
+	struct GameplayStageStats
+	{
+		float m_averageMs { 0.f };
+		float m_maxMs { 0.f };
+		float m_handlersPerFrame { 0.f };
+	};
+
+	class GameplaySchedulerRequests
+	{
+	public:
+		AZ_RTTI(GameplaySchedulerRequests, "{8E0C2D57-6F3B-4C1A-9B7E-2A51D4F0C6E3}");
+		virtual ~GameplaySchedulerRequests() = default;
+
+		virtual GameplayStageStats GetStageStats(GameplayStage i_stage) const = 0;
+
+		// a positive time step runs the stages as many times as the frame time allows, instead of once per frame
+		virtual void SetFixedTimeStep(float i_timeStep) = 0;
+
+		// number of times the stages were run since the last game started loading
+		virtual AZ::u32 GetTick() const = 0;
+
+		// seconds simulated by those ticks, which only follow the fixed time step while one is set
+		virtual double GetGameTime() const = 0;
+	};
+
+	class GameplaySchedulerRequestBusTraits
+		: public AZ::EBusTraits
+	{
+	public:
+		// EBusTraits
+		static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+		static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+		using EventProcessingPolicy = GameEventProcessingPolicy;
+	};
+
+	using GameplaySchedulerRequestBus = AZ::EBus<GameplaySchedulerRequests, GameplaySchedulerRequestBusTraits>;
+
+	// ---
+
+    class GameplayStageNotifications
+    {
+    public:
+        AZ_RTTI(GameplayStageNotifications, "{3B7A9E14-C2D8-4F65-A0B3-7E19C5D28F4A}");
+        virtual ~GameplayStageNotifications() = default;
+
+		virtual void OnStageTick(float i_deltaTime) = 0;
+
+		// handlers of the same stage are run by ascending order,
+		// which must not change while they are connected
+		virtual AZ::u64 GetStageOrder() const { return 0; }
+
+		bool Compare(const GameplayStageNotifications* i_other) const
+		{
+			return (GetStageOrder() < i_other->GetStageOrder());
+		}
+    };
+    
+    class GameplayStageNotificationBusTraits
+        : public AZ::EBusTraits
+    {
+    public:
+		// EBusTraits
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::MultipleAndOrdered;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ByIdAndOrdered;
+        using EventProcessingPolicy = GameEventProcessingPolicy;
+        using BusIdType = GameplayStage;
+    };
+
+    using GameplayStageNotificationBus = AZ::EBus<GameplayStageNotifications, GameplayStageNotificationBusTraits>;
+
+} // Loherangrin::Games::O3DEJam2305
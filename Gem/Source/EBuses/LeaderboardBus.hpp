@@ -0,0 +1,93 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/std/containers/vector.h>
+
+#include "../Utils/GameEventPolicy.hpp"
+#include "ScoreBus.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	using LeaderboardRank = AZ::u32;
+	using LeaderboardSeed = AZ::u64;
+
+	struct LeaderboardEntry
+	{
+		ScoreNotifications::TotalPoints m_points { 0 };
+		LeaderboardSeed m_seed { 0 };
+		AZ::u64 m_time { 0 };
+		TileCount m_claimedTiles { 0 };
+	};
+
+	// ---
+
+	class LeaderboardRequests
+	{
+	public:
+		using TotalPoints = ScoreNotifications::TotalPoints;
+
+		AZ_RTTI(LeaderboardRequests, "{1F6B0C9D-58E2-4A73-B4D1-E8A05C3F72B6}");
+		virtual ~LeaderboardRequests() = default;
+
+		virtual AZ::u32 GetRunCount() const = 0;
+
+		virtual LeaderboardRank GetRank(TotalPoints i_points) const = 0;
+		virtual LeaderboardRank GetSeedRank(LeaderboardSeed i_seed, TotalPoints i_points) const = 0;
+
+		virtual AZStd::vector<LeaderboardEntry> GetTopEntries(AZ::u32 i_count) const = 0;
+		virtual AZStd::vector<LeaderboardEntry> GetSeedTopEntries(LeaderboardSeed i_seed, AZ::u32 i_count) const = 0;
+	};
+
+	class LeaderboardRequestBusTraits
+		: public AZ::EBusTraits
+	{
+	public:
+		// EBusTraits
+		static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+		static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+		using EventProcessingPolicy = GameEventProcessingPolicy;
+	};
+
+	using LeaderboardRequestBus = AZ::EBus<LeaderboardRequests, LeaderboardRequestBusTraits>;
+
+	// ---
+
+	class LeaderboardNotifications
+    {
+    public:
+        AZ_RTTI(LeaderboardNotifications, "{8A4E27D3-C15B-4F96-9E0A-3B7D61F48C25}");
+        virtual ~LeaderboardNotifications() = default;
+
+		virtual void OnRunRecorded([[maybe_unused]] const LeaderboardEntry& i_entry, [[maybe_unused]] LeaderboardRank i_rank, [[maybe_unused]] LeaderboardRank i_seedRank){}
+    };
+    
+    class LeaderboardNotificationBusTraits
+        : public AZ::EBusTraits
+    {
+    public:
+		// EBusTraits
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        using EventProcessingPolicy = GameEventProcessingPolicy;
+    };
+
+    using LeaderboardNotificationBus = AZ::EBus<LeaderboardNotifications, LeaderboardNotificationBusTraits>;
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,72 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+
+#include <Atom/RPI.Public/Image/StreamingImage.h>
+
+#include "../Utils/GameEventPolicy.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class MinimapRequests
+	{
+	public:
+		AZ_RTTI(MinimapRequests, "{B3E19A70-6D2C-4F85-A4E8-0C71D5F92B3A}");
+		virtual ~MinimapRequests() = default;
+
+		virtual AZ::Data::Instance<AZ::RPI::StreamingImage> GetMinimapImage() const = 0;
+	};
+
+	class MinimapRequestBusTraits
+		: public AZ::EBusTraits
+	{
+	public:
+		// EBusTraits
+		static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+		static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+		using EventProcessingPolicy = GameEventProcessingPolicy;
+	};
+
+	using MinimapRequestBus = AZ::EBus<MinimapRequests, MinimapRequestBusTraits>;
+
+	// ---
+
+	class MinimapNotifications
+    {
+    public:
+        AZ_RTTI(MinimapNotifications, "{47C8F2D1-9B05-4E63-8A1F-D6E3B07C5A92}");
+        virtual ~MinimapNotifications() = default;
+
+		virtual void OnMinimapImageCreated([[maybe_unused]] AZ::Data::Instance<AZ::RPI::StreamingImage> i_image){}
+    };
+    
+    class MinimapNotificationBusTraits
+        : public AZ::EBusTraits
+    {
+    public:
+		// EBusTraits
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        using EventProcessingPolicy = GameEventProcessingPolicy;
+    };
+
+    using MinimapNotificationBus = AZ::EBus<MinimapNotifications, MinimapNotificationBusTraits>;
+
+} // Loherangrin::Games::O3DEJam2305
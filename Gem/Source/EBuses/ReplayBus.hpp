@@ -0,0 +1,84 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/string/string.h>
+
+#include "../Utils/GameEventPolicy.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class ReplayRequests
+	{
+	public:
+		AZ_RTTI(ReplayRequests, "{C47E2B19-8D3A-4F05-9B61-2E7A0D95F3C8}");
+		virtual ~ReplayRequests() = default;
+
+		// both take effect from the next game that is started
+		virtual bool StartRecording(const AZStd::string& i_filePath) = 0;
+		virtual bool StartPlayback(const AZStd::string& i_filePath) = 0;
+		virtual void Stop() = 0;
+
+		virtual bool IsPlaying() const = 0;
+
+		// checksums of the last playback that did not match the recorded ones
+		virtual AZ::u32 GetDivergencesCount() const = 0;
+
+		// input channel states are stored as the value of AzFramework::InputChannel::State
+		virtual void RecordInput(AZ::Crc32 i_channel, AZ::u8 i_state, float i_value) = 0;
+	};
+
+	class ReplayRequestBusTraits
+		: public AZ::EBusTraits
+	{
+	public:
+		// EBusTraits
+		static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+		static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+		using EventProcessingPolicy = GameEventProcessingPolicy;
+	};
+
+	using ReplayRequestBus = AZ::EBus<ReplayRequests, ReplayRequestBusTraits>;
+
+	// ---
+
+	class ReplayInputNotifications
+    {
+    public:
+        AZ_RTTI(ReplayInputNotifications, "{5A93D0E6-1C7F-4B28-A4E3-96F1B2C08D74}");
+        virtual ~ReplayInputNotifications() = default;
+
+		// played back in place of the input channel event that was recorded at the same tick
+		virtual void OnReplayInput([[maybe_unused]] AZ::Crc32 i_channel, [[maybe_unused]] AZ::u8 i_state, [[maybe_unused]] float i_value){}
+    };
+    
+    class ReplayInputNotificationBusTraits
+        : public AZ::EBusTraits
+    {
+    public:
+		// EBusTraits
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        using EventProcessingPolicy = GameEventProcessingPolicy;
+    };
+
+    using ReplayInputNotificationBus = AZ::EBus<ReplayInputNotifications, ReplayInputNotificationBusTraits>;
+
+} // Loherangrin::Games::O3DEJam2305
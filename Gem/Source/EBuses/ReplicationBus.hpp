@@ -0,0 +1,64 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+
+#include "../Utils/GameEventPolicy.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	struct ReplicationStats
+	{
+		float m_sentBytesPerSecond { 0.f };
+		float m_receivedBytesPerSecond { 0.f };
+		float m_sentPacketsPerSecond { 0.f };
+
+		AZ::u64 m_totalSentBytes { 0 };
+		AZ::u64 m_totalReceivedBytes { 0 };
+
+		AZ::u32 m_sequence { 0 };
+	};
+
+	class ReplicationRequests
+	{
+	public:
+		AZ_RTTI(ReplicationRequests, "{6F2D8A41-93C5-4E7B-B1D0-5A48E2C7F913}");
+		virtual ~ReplicationRequests() = default;
+
+		// the server replicates its tiles from the next layout that is created
+		virtual bool StartServer() = 0;
+		virtual bool StartClient() = 0;
+		virtual void Stop() = 0;
+
+		virtual ReplicationStats GetStats() const = 0;
+	};
+
+	class ReplicationRequestBusTraits
+		: public AZ::EBusTraits
+	{
+	public:
+		// EBusTraits
+		static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+		static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+		using EventProcessingPolicy = GameEventProcessingPolicy;
+	};
+
+	using ReplicationRequestBus = AZ::EBus<ReplicationRequests, ReplicationRequestBusTraits>;
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,85 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/std/string/string.h>
+
+#include "../Utils/GameEventPolicy.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class SaveFile;
+
+	class SaveGameRequests
+	{
+	public:
+		AZ_RTTI(SaveGameRequests, "{3B8E51D2-6F4A-4C97-A2D0-8E15C7B94F63}");
+		virtual ~SaveGameRequests() = default;
+
+		// only a game in progress can be saved
+		virtual bool SaveGame(const AZStd::string& i_filePath) = 0;
+
+		// takes effect from the next game that is started, which is the one whose layout is restored
+		virtual bool LoadGame(const AZStd::string& i_filePath) = 0;
+
+		// while restoring, the state changes of the game are not caused by the gameplay, so they must not be reacted to
+		virtual bool IsRestoring() const = 0;
+	};
+
+	class SaveGameRequestBusTraits
+		: public AZ::EBusTraits
+	{
+	public:
+		// EBusTraits
+		static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+		static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+		using EventProcessingPolicy = GameEventProcessingPolicy;
+	};
+
+	using SaveGameRequestBus = AZ::EBus<SaveGameRequests, SaveGameRequestBusTraits>;
+
+	// ---
+
+	class SaveGameNotifications
+    {
+    public:
+        AZ_RTTI(SaveGameNotifications, "{9D2C6A47-E1B8-4F35-8C0A-52F7E3D16B94}");
+        virtual ~SaveGameNotifications() = default;
+
+		// every listener adds its own records to the file
+		virtual void OnGameSaving([[maybe_unused]] SaveFile& io_file){}
+
+		// every listener takes its own records back, then all of them are told that the whole game was restored
+		virtual void OnGameRestoring([[maybe_unused]] const SaveFile& i_file){}
+		virtual void OnGameRestored([[maybe_unused]] const SaveFile& i_file){}
+    };
+    
+    class SaveGameNotificationBusTraits
+        : public AZ::EBusTraits
+    {
+    public:
+		// EBusTraits
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        using EventProcessingPolicy = GameEventProcessingPolicy;
+    };
+
+    using SaveGameNotificationBus = AZ::EBus<SaveGameNotifications, SaveGameNotificationBusTraits>;
+
+} // Loherangrin::Games::O3DEJam2305
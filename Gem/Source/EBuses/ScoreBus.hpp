@@ -18,11 +18,37 @@
 
 #include <AzCore/EBus/EBus.h>
 
+#include "../Utils/GameEventPolicy.hpp"
 #include "TileBus.hpp"
 
 
 namespace Loherangrin::Games::O3DEJam2305
 {
+	class ScoreRequests
+	{
+	public:
+		using TotalPoints = AZ::u64;
+
+		AZ_RTTI(ScoreRequests, "{C0E7A3F5-4B92-4D8E-9A1C-6F2B8D5E7A31}");
+		virtual ~ScoreRequests() = default;
+
+		virtual TotalPoints GetTotalPoints() = 0;
+	};
+
+	class ScoreRequestBusTraits
+		: public AZ::EBusTraits
+	{
+	public:
+		// EBusTraits
+		static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+		static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+		using EventProcessingPolicy = GameEventProcessingPolicy;
+	};
+
+	using ScoreRequestBus = AZ::EBus<ScoreRequests, ScoreRequestBusTraits>;
+
+	// ---
+
 	class ScoreNotifications
     {
     public:
@@ -42,6 +68,7 @@ namespace Loherangrin::Games::O3DEJam2305
 		// EBusTraits
         static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
         static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        using EventProcessingPolicy = GameEventProcessingPolicy;
     };
 
     using ScoreNotificationBus = AZ::EBus<ScoreNotifications, ScoreNotificationBusTraits>;
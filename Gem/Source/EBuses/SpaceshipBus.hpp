@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <AzCore/Component/EntityId.h>
 #include <AzCore/EBus/EBus.h>
 
+#include "../Utils/GameEventPolicy.hpp"
+
 
 namespace Loherangrin::Games::O3DEJam2305
 {
@@ -27,7 +30,17 @@ namespace Loherangrin::Games::O3DEJam2305
 		AZ_RTTI(SpaceshipRequests, "{4AF25A16-1664-41F6-8362-F5FA62372D67}");
 		virtual ~SpaceshipRequests() = default;
 
+		virtual AZ::EntityId GetSpaceshipId() const = 0;
+		virtual bool IsPlayer() const = 0;
+
         virtual void SubtractEnergy(float i_amount) = 0;
+
+		virtual void Move(float i_direction) = 0;
+		virtual void Turn(float i_direction) = 0;
+		virtual bool ToggleLanding() = 0;
+
+		virtual bool IsLanded() const = 0;
+		virtual float GetNormalizedEnergy() const = 0;
 	};
 	
 	class SpaceshipRequestBusTraits
@@ -36,7 +49,9 @@ namespace Loherangrin::Games::O3DEJam2305
 	public:
 		// EBusTraits
 		static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
-		static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+		static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+		using EventProcessingPolicy = GameEventProcessingPolicy;
+		using BusIdType = AZ::EntityId;
 	};
 
 	using SpaceshipRequestBus = AZ::EBus<SpaceshipRequests, SpaceshipRequestBusTraits>;
@@ -67,9 +82,35 @@ namespace Loherangrin::Games::O3DEJam2305
     public:
 		// EBusTraits
         static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
-        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+        using EventProcessingPolicy = GameEventProcessingPolicy;
+        using BusIdType = AZ::EntityId;
     };
 
     using SpaceshipNotificationBus = AZ::EBus<SpaceshipNotifications, SpaceshipNotificationBusTraits>;
 
+	// ---
+
+    class SpaceshipsNotifications
+    {
+    public:
+        AZ_RTTI(SpaceshipsNotifications, "{E4C3F093-03A9-4CF7-8E74-AB19A832803D}");
+        virtual ~SpaceshipsNotifications() = default;
+
+		virtual void OnSpaceshipRegistered([[maybe_unused]] const AZ::EntityId& i_spaceshipEntityId){}
+		virtual void OnSpaceshipUnregistered([[maybe_unused]] const AZ::EntityId& i_spaceshipEntityId){}
+    };
+    
+    class SpaceshipsNotificationBusTraits
+        : public AZ::EBusTraits
+    {
+    public:
+		// EBusTraits
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        using EventProcessingPolicy = GameEventProcessingPolicy;
+    };
+
+    using SpaceshipsNotificationBus = AZ::EBus<SpaceshipsNotifications, SpaceshipsNotificationBusTraits>;
+
 } // Loherangrin::Games::O3DEJam2305
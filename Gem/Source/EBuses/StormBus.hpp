@@ -0,0 +1,49 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/Math/Vector3.h>
+
+#include "../Utils/GameEventPolicy.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class StormsNotifications
+    {
+    public:
+        AZ_RTTI(StormsNotifications, "{5D2B8E61-93A7-4C0F-B1E4-27F6A9C3D805}");
+        virtual ~StormsNotifications() = default;
+
+		virtual void OnStormSpawned([[maybe_unused]] const AZ::EntityId& i_stormEntityId, [[maybe_unused]] const AZ::Vector3& i_position){}
+    };
+    
+    class StormsNotificationBusTraits
+        : public AZ::EBusTraits
+    {
+    public:
+		// EBusTraits
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        using EventProcessingPolicy = GameEventProcessingPolicy;
+    };
+
+    using StormsNotificationBus = AZ::EBus<StormsNotifications, StormsNotificationBusTraits>;
+
+} // Loherangrin::Games::O3DEJam2305
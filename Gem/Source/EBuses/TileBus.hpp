@@ -18,15 +18,14 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+
+#include "../Core/GridTypes.hpp"
+#include "../Utils/GameEventPolicy.hpp"
 
 
 namespace Loherangrin::Games::O3DEJam2305
 {
-	using TileId = AZStd::size_t;
-	using TileCount = TileId;
-
-    static constexpr TileId INVALID_TILE_ID = AZStd::numeric_limits<TileId>::max();
-
 	class TileRequests
 	{
 	public:
@@ -39,8 +38,15 @@ namespace Loherangrin::Games::O3DEJam2305
 		virtual TileId GetTileId() const = 0;
         virtual bool IsClaimed() const = 0;
 		virtual bool IsLandingArea() const = 0;
+		virtual bool IsLocked() const = 0;
 
 		virtual void SetSelected(bool i_enabled) = 0;
+
+		// the tile stops simulating its energy, which is only set by the replication from then on
+		virtual void ApplyReplicatedState(float i_normalizedEnergy, bool i_isClaimed, bool i_isLocked) = 0;
+
+		// the tile simulates its energy again, from the last state that was replicated
+		virtual void StopReplication() = 0;
 	};
 	
 	class TileRequestBusTraits
@@ -50,6 +56,7 @@ namespace Loherangrin::Games::O3DEJam2305
 		// EBusTraits
 		static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
 		static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+		using EventProcessingPolicy = GameEventProcessingPolicy;
 		using BusIdType = AZ::EntityId;
 	};
 
@@ -64,6 +71,21 @@ namespace Loherangrin::Games::O3DEJam2305
 		virtual ~TilesRequests() = default;
 
 		virtual AZ::Vector2 GetGridSize() const = 0;
+		virtual AZ::u16 GetGridLength() const = 0;
+		virtual AZ::u64 GetLayoutSeed() const = 0;
+		virtual AZ::Vector3 GetTilePosition(TileId i_tileId) const = 0;
+
+		virtual TileId FindLandingAreaAt(const AZ::Vector3& i_position, bool i_onlyClaimed) const = 0;
+		virtual TileId FindNearestClaimedLandingArea(const AZ::Vector3& i_position) const = 0;
+		virtual TileId FindNearestUnclaimedTile(const AZ::Vector3& i_position) const = 0;
+
+		virtual AZ::Vector3 GetFlowDirectionToTile(const AZ::Vector3& i_position, TileId i_targetTileId) = 0;
+		virtual AZ::Vector3 GetFlowDirectionToLandingArea(const AZ::Vector3& i_position) = 0;
+
+		virtual bool IsNextLayoutReady() const = 0;
+
+		// the next game is played on the layout of this seed, instead of a new one
+		virtual void SetNextLayoutSeed(AZ::u64 i_seed) = 0;
 	};
 	
 	class TilesRequestBusTraits
@@ -73,6 +95,7 @@ namespace Loherangrin::Games::O3DEJam2305
 		// EBusTraits
 		static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
 		static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+		using EventProcessingPolicy = GameEventProcessingPolicy;
 	};
 
 	using TilesRequestBus = AZ::EBus<TilesRequests, TilesRequestBusTraits>;
@@ -96,6 +119,7 @@ namespace Loherangrin::Games::O3DEJam2305
 		// EBusTraits
         static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
         static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+        using EventProcessingPolicy = GameEventProcessingPolicy;
         using BusIdType = TileId;
     };
 
@@ -110,6 +134,7 @@ namespace Loherangrin::Games::O3DEJam2305
         virtual ~TilesNotifications() = default;
 
 		virtual void OnAllTilesCreated(){}
+		virtual void OnTileCreated([[maybe_unused]] const AZ::EntityId& i_tileEntityId){}
 
 		virtual void OnTileEnergyChanged([[maybe_unused]] const AZ::EntityId& i_tileEntityId, [[maybe_unused]] float i_normalizedNewEnergy){}
 
@@ -127,6 +152,7 @@ namespace Loherangrin::Games::O3DEJam2305
 		// EBusTraits
         static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
         static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        using EventProcessingPolicy = GameEventProcessingPolicy;
     };
 
     using TilesNotificationBus = AZ::EBus<TilesNotifications, TilesNotificationBusTraits>;
@@ -17,9 +17,18 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Module/Module.h>
 
+#include "Components/AutopilotComponent.hpp"
 #include "Components/BeamComponent.hpp"
 #include "Components/CollectableComponent.hpp"
 #include "Components/CollectablesPoolComponent.hpp"
+#include "Components/EventRecorderComponent.hpp"
+#include "Components/GameplaySchedulerSystemComponent.hpp"
+#include "Components/GridReplicationComponent.hpp"
+#include "Components/LeaderboardComponent.hpp"
+#include "Components/MinimapComponent.hpp"
+#include "Components/PerformanceOverlayComponent.hpp"
+#include "Components/ReplayComponent.hpp"
+#include "Components/SaveGameComponent.hpp"
 #include "Components/ScoreComponent.hpp"
 #include "Components/SpaceshipComponent.hpp"
 #include "Components/StormComponent.hpp"
@@ -43,9 +52,18 @@ namespace Loherangrin::Games::O3DEJam2305
 		{
 			m_descriptors.insert(m_descriptors.end(),
 			{
+				AutopilotComponent::CreateDescriptor(),
 				BeamComponent::CreateDescriptor(),
 				CollectableComponent::CreateDescriptor(),
 				CollectablesPoolComponent::CreateDescriptor(),
+				EventRecorderComponent::CreateDescriptor(),
+				GameplaySchedulerSystemComponent::CreateDescriptor(),
+				GridReplicationComponent::CreateDescriptor(),
+				LeaderboardComponent::CreateDescriptor(),
+				MinimapComponent::CreateDescriptor(),
+				PerformanceOverlayComponent::CreateDescriptor(),
+				ReplayComponent::CreateDescriptor(),
+				SaveGameComponent::CreateDescriptor(),
 				ScoreComponent::CreateDescriptor(),
 				SpaceshipComponent::CreateDescriptor(),
 				StormComponent::CreateDescriptor(),
@@ -58,7 +76,10 @@ namespace Loherangrin::Games::O3DEJam2305
 
 		AZ::ComponentTypeList GetRequiredSystemComponents() const override
 		{
-			return AZ::ComponentTypeList {};
+			return AZ::ComponentTypeList
+			{
+				azrtti_typeid<GameplaySchedulerSystemComponent>()
+			};
 		}
 	};
 
@@ -0,0 +1,417 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Settings/CommandLine.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/conversions.h>
+
+#include <cstdio>
+
+#include "../Core/ReplayFile.hpp"
+#include "../Core/SaveFile.hpp"
+#include "../Core/Simulation.hpp"
+#include "../Core/TraceRecorder.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	static AZ::u64 ReadInteger(const AZ::CommandLine& i_commandLine, const char* i_switchName, AZ::u64 i_defaultValue)
+	{
+		if(!i_commandLine.HasSwitch(i_switchName))
+		{
+			return i_defaultValue;
+		}
+
+		return AZStd::stoull(i_commandLine.GetSwitchValue(i_switchName, 0));
+	}
+
+	static float ReadFloat(const AZ::CommandLine& i_commandLine, const char* i_switchName, float i_defaultValue)
+	{
+		if(!i_commandLine.HasSwitch(i_switchName))
+		{
+			return i_defaultValue;
+		}
+
+		return AZStd::stof(i_commandLine.GetSwitchValue(i_switchName, 0));
+	}
+
+	static SimulationSettings ReadSettings(const AZ::CommandLine& i_commandLine)
+	{
+		SimulationSettings settings;
+		settings.m_gridLength = static_cast<AZ::u16>(ReadInteger(i_commandLine, "grid", settings.m_gridLength));
+		settings.m_maxObstacles = static_cast<AZ::u16>(ReadInteger(i_commandLine, "obstacles", settings.m_maxObstacles));
+		settings.m_nSpaceships = static_cast<AZ::u8>(ReadInteger(i_commandLine, "ships", settings.m_nSpaceships));
+		settings.m_maxDuration = ReadFloat(i_commandLine, "duration", settings.m_maxDuration);
+		settings.m_timeStep = 1.f / AZStd::max(ReadFloat(i_commandLine, "rate", 1.f / settings.m_timeStep), 1.f);
+
+		return settings;
+	}
+
+	// Plays a session step by step, taking a checksum of its state every few ticks
+	static SimulationResult RecordSession(Simulation& io_simulation, const SimulationSettings& i_settings, AZ::u64 i_seed, AZ::u16 i_checksumInterval, ReplayFile& o_replay)
+	{
+		ReplayHeader header;
+		header.m_checksumInterval = i_checksumInterval;
+		header.m_seed = i_seed;
+		header.m_timeStep = i_settings.m_timeStep;
+		header.m_gridLength = i_settings.m_gridLength;
+		header.m_maxObstacles = i_settings.m_maxObstacles;
+		header.m_nSpaceships = i_settings.m_nSpaceships;
+
+		o_replay.Reset(header);
+
+		io_simulation.Start(i_settings, i_seed);
+		o_replay.AddChecksum(0, io_simulation.CalculateChecksum());
+
+		while(io_simulation.Step())
+		{
+			const AZ::u32 tick = io_simulation.GetTick();
+			if(o_replay.IsChecksumTick(tick))
+			{
+				o_replay.AddChecksum(tick, io_simulation.CalculateChecksum());
+			}
+		}
+
+		o_replay.SetTicksCount(io_simulation.GetTick());
+
+		return io_simulation.GetResult();
+	}
+
+	// Usage: Simulator --replay FILE [--realtime]
+	// Plays a recorded session again, as fast as possible unless asked otherwise, and stops at the first checksum that does not match.
+	// Only sessions recorded by the simulator itself can be played: a game recording holds the inputs of a player, whose spaceship
+	// is moved by the physics character controller, while simulated spaceships are autopilots moving on the grid without physics.
+	// Neither can game recordings be played faster in game, as the controller moves a spaceship once per physics frame,
+	// whatever the number of gameplay ticks run in that frame.
+	static int ReplaySession(const AZ::CommandLine& i_commandLine)
+	{
+		const AZStd::string replayFilePath = i_commandLine.GetSwitchValue("replay", 0);
+
+		ReplayFile replay;
+		if(!replay.Read(replayFilePath.c_str()))
+		{
+			return 1;
+		}
+
+		const ReplayHeader& header = replay.GetHeader();
+		if(header.m_nInputs > 0)
+		{
+			fprintf(stderr, "%s was recorded in game with %u player inputs, which need the physics of the game to be played: use game_replayPlay instead\n", replayFilePath.c_str(), header.m_nInputs);
+			return 1;
+		}
+
+		SimulationSettings settings;
+		settings.m_gridLength = header.m_gridLength;
+		settings.m_maxObstacles = header.m_maxObstacles;
+		settings.m_nSpaceships = header.m_nSpaceships;
+		settings.m_timeStep = header.m_timeStep;
+		settings.m_maxDuration = header.m_timeStep * static_cast<float>(header.m_nTicks + 1);
+
+		const bool isRealTime = i_commandLine.HasSwitch("realtime");
+		const auto stepDuration = AZStd::chrono::microseconds { static_cast<AZ::s64>(header.m_timeStep * 1000000.f) };
+
+		Simulation simulation;
+		simulation.Start(settings, header.m_seed);
+
+		const auto startTime = AZStd::chrono::steady_clock::now();
+
+		AZ::u32 nVerifiedChecksums = 0;
+		bool isRunning = true;
+
+		while(isRunning)
+		{
+			const AZ::u32 tick = simulation.GetTick();
+
+			AZ::u64 expectedChecksum { 0 };
+			if(replay.FindChecksum(tick, expectedChecksum))
+			{
+				const AZ::u64 checksum = simulation.CalculateChecksum();
+				if(checksum != expectedChecksum)
+				{
+					fprintf(stderr, "Replay diverged at tick %u (%.2f s): checksum %016llx, expected %016llx\n",
+						tick,
+						static_cast<float>(tick) * header.m_timeStep,
+						static_cast<unsigned long long>(checksum),
+						static_cast<unsigned long long>(expectedChecksum)
+					);
+
+					return 2;
+				}
+
+				++nVerifiedChecksums;
+			}
+
+			isRunning = (tick < header.m_nTicks && simulation.Step());
+
+			if(isRealTime)
+			{
+				AZStd::this_thread::sleep_until(startTime + stepDuration * (tick + 1));
+			}
+		}
+
+		if(simulation.GetTick() != header.m_nTicks)
+		{
+			fprintf(stderr, "Replay ended at tick %u, while the recording lasted %u ticks\n", simulation.GetTick(), header.m_nTicks);
+			return 2;
+		}
+
+		const auto elapsedTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - startTime);
+
+		printf("Replayed %u ticks of seed %llu in %.3f s, %u checksums verified\n",
+			header.m_nTicks,
+			static_cast<unsigned long long>(header.m_seed),
+			static_cast<double>(elapsedTime.count()) / 1000000.0,
+			nVerifiedChecksums
+		);
+
+		return 0;
+	}
+
+	static void PrintSessionEnd(const Simulation& i_simulation)
+	{
+		const SimulationResult result = i_simulation.GetResult();
+
+		printf("Session ended at tick %u (%.2f s) with %llu points and %llu claimed tiles, checksum %016llx\n",
+			i_simulation.GetTick(),
+			result.m_duration,
+			static_cast<unsigned long long>(result.m_totalPoints),
+			static_cast<unsigned long long>(result.m_nClaimedTiles),
+			static_cast<unsigned long long>(i_simulation.CalculateChecksum())
+		);
+	}
+
+	// Usage: Simulator --save FILE --save-at SECONDS [--seed S] [--grid L] [--obstacles N] [--ships N] [--duration SECONDS] [--rate HZ]
+	// Plays a session, saves it at the given time and then plays it until the end, for comparison with --load
+	static int SaveSession(const AZ::CommandLine& i_commandLine)
+	{
+		const SimulationSettings settings = ReadSettings(i_commandLine);
+
+		const AZStd::string saveFilePath = i_commandLine.GetSwitchValue("save", 0);
+		const AZ::u64 seed = ReadInteger(i_commandLine, "seed", 1234);
+		const float saveTime = ReadFloat(i_commandLine, "save-at", 60.f);
+
+		Simulation simulation;
+		simulation.Start(settings, seed);
+
+		bool isRunning = !simulation.IsOver();
+		while(isRunning && static_cast<float>(simulation.GetTick() + 1) * settings.m_timeStep <= saveTime)
+		{
+			isRunning = simulation.Step();
+		}
+
+		if(!isRunning)
+		{
+			fprintf(stderr, "Session of seed %llu ended before %.2f s, there is nothing to save\n", static_cast<unsigned long long>(seed), saveTime);
+			return 1;
+		}
+
+		SaveFile save;
+		simulation.Save(save);
+
+		if(!save.Write(saveFilePath.c_str()))
+		{
+			return 1;
+		}
+
+		fprintf(stderr, "Saved tick %u of seed %llu to %s\n", simulation.GetTick(), static_cast<unsigned long long>(seed), saveFilePath.c_str());
+
+		while(simulation.Step())
+		{}
+
+		PrintSessionEnd(simulation);
+		return 0;
+	}
+
+	// Usage: Simulator --load FILE [--obstacles N] [--ships N] [--duration SECONDS] [--rate HZ]
+	// Goes on with a saved session until the end, the settings must be the same ones it was saved with
+	static int LoadSession(const AZ::CommandLine& i_commandLine)
+	{
+		const AZStd::string saveFilePath = i_commandLine.GetSwitchValue("load", 0);
+
+		SaveFile save;
+		if(!save.Read(saveFilePath.c_str()))
+		{
+			return 1;
+		}
+
+		SimulationSettings settings = ReadSettings(i_commandLine);
+		settings.m_gridLength = save.GetHeader().m_gridLength;
+
+		Simulation simulation;
+		if(!simulation.Restore(settings, save))
+		{
+			return 1;
+		}
+
+		fprintf(stderr, "Loaded tick %u of seed %llu from %s\n", simulation.GetTick(), static_cast<unsigned long long>(save.GetHeader().m_layoutSeed), saveFilePath.c_str());
+
+		while(simulation.Step())
+		{}
+
+		PrintSessionEnd(simulation);
+		return 0;
+	}
+
+	// Usage: Simulator [--sessions N] [--seed S] [--grid L] [--obstacles N] [--ships N] [--duration SECONDS] [--rate HZ] [--csv] [--trace FILE] [--record FILE] [--checksums TICKS]
+	// The first session only is traced or recorded, since a whole batch would not fit in memory
+	static int RunSessions(const AZ::CommandLine& i_commandLine)
+	{
+		const SimulationSettings settings = ReadSettings(i_commandLine);
+
+		const AZ::u64 nSessions = ReadInteger(i_commandLine, "sessions", 1000);
+		const AZ::u64 firstSeed = ReadInteger(i_commandLine, "seed", 1234);
+		const bool isCsv = i_commandLine.HasSwitch("csv");
+
+		if(isCsv)
+		{
+			printf("seed,duration,points,claimed,max_claimed,storms,dropped,picked,depleted\n");
+		}
+
+		AZ::u64 totalPoints = 0;
+		AZ::u64 minPoints = AZStd::numeric_limits<AZ::u64>::max();
+		AZ::u64 maxPoints = 0;
+		AZ::u64 totalMaxClaimedTiles = 0;
+		AZ::u64 nDepleted = 0;
+		double totalDuration = 0.0;
+
+		const bool isTraced = i_commandLine.HasSwitch("trace");
+		const bool isRecorded = i_commandLine.HasSwitch("record");
+
+		const auto checksumInterval = static_cast<AZ::u16>(AZStd::max<AZ::u64>(ReadInteger(i_commandLine, "checksums", 30), 1));
+		ReplayFile replay;
+
+		TraceRecorder traceRecorder;
+		Simulation simulation;
+
+		if(isTraced)
+		{
+			traceRecorder.Start();
+			simulation.SetTraceRecorder(&traceRecorder);
+		}
+
+		const auto startTime = AZStd::chrono::steady_clock::now();
+
+		for(AZ::u64 i = 0; i < nSessions; ++i)
+		{
+			const SimulationResult result = (isRecorded && i == 0)
+				? RecordSession(simulation, settings, firstSeed + i, checksumInterval, replay)
+				: simulation.Run(settings, firstSeed + i)
+			;
+
+			if(isTraced && i == 0)
+			{
+				traceRecorder.Stop();
+				simulation.SetTraceRecorder(nullptr);
+			}
+
+			totalPoints += result.m_totalPoints;
+			minPoints = AZStd::min(minPoints, result.m_totalPoints);
+			maxPoints = AZStd::max(maxPoints, result.m_totalPoints);
+			totalMaxClaimedTiles += result.m_maxClaimedTiles;
+			nDepleted += (result.m_isDepleted) ? 1 : 0;
+			totalDuration += result.m_duration;
+
+			if(isCsv)
+			{
+				printf("%llu,%.2f,%llu,%llu,%llu,%u,%u,%u,%d\n",
+					static_cast<unsigned long long>(result.m_seed),
+					result.m_duration,
+					static_cast<unsigned long long>(result.m_totalPoints),
+					static_cast<unsigned long long>(result.m_nClaimedTiles),
+					static_cast<unsigned long long>(result.m_maxClaimedTiles),
+					result.m_nStorms,
+					result.m_nDroppedCollectables,
+					result.m_nPickedCollectables,
+					(result.m_isDepleted) ? 1 : 0
+				);
+			}
+		}
+
+		const auto elapsedTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - startTime);
+		const double elapsedSeconds = static_cast<double>(elapsedTime.count()) / 1000000.0;
+
+		if(isTraced)
+		{
+			const AZStd::string traceFilePath = i_commandLine.GetSwitchValue("trace", 0);
+			if(!traceRecorder.WriteChromeTrace(traceFilePath.c_str()))
+			{
+				return 1;
+			}
+
+			fprintf(stderr, "Traced %zu events (%zu dropped) to %s\n", traceRecorder.GetEventsCount(), traceRecorder.GetDroppedEventsCount(), traceFilePath.c_str());
+		}
+
+		if(isRecorded && nSessions > 0)
+		{
+			const AZStd::string replayFilePath = i_commandLine.GetSwitchValue("record", 0);
+			if(!replay.Write(replayFilePath.c_str()))
+			{
+				return 1;
+			}
+
+			fprintf(stderr, "Recorded %u ticks of seed %llu to %s\n", replay.GetHeader().m_nTicks, static_cast<unsigned long long>(firstSeed), replayFilePath.c_str());
+		}
+
+		if(nSessions == 0)
+		{
+			return 0;
+		}
+
+		const auto sessions = static_cast<double>(nSessions);
+
+		fprintf((isCsv) ? stderr : stdout,
+			"%llu sessions | points avg %.1f min %llu max %llu | max claimed tiles avg %.1f | depleted %llu | simulated %.0f s in %.3f s (x%.0f)\n",
+			static_cast<unsigned long long>(nSessions),
+			static_cast<double>(totalPoints) / sessions,
+			static_cast<unsigned long long>(minPoints),
+			static_cast<unsigned long long>(maxPoints),
+			static_cast<double>(totalMaxClaimedTiles) / sessions,
+			static_cast<unsigned long long>(nDepleted),
+			totalDuration,
+			elapsedSeconds,
+			(elapsedSeconds > 0.0) ? totalDuration / elapsedSeconds : 0.0
+		);
+
+		return 0;
+	}
+
+} // Loherangrin::Games::O3DEJam2305
+
+// Plays whole sessions on the gameplay rules without starting the engine, so that parameters can be balanced in bulk
+int main(int argc, char* argv[])
+{
+	AZ::CommandLine commandLine;
+	commandLine.Parse(argc, argv);
+
+	if(commandLine.HasSwitch("replay"))
+	{
+		return Loherangrin::Games::O3DEJam2305::ReplaySession(commandLine);
+	}
+
+	if(commandLine.HasSwitch("save"))
+	{
+		return Loherangrin::Games::O3DEJam2305::SaveSession(commandLine);
+	}
+
+	if(commandLine.HasSwitch("load"))
+	{
+		return Loherangrin::Games::O3DEJam2305::LoadSession(commandLine);
+	}
+
+	return Loherangrin::Games::O3DEJam2305::RunSessions(commandLine);
+}
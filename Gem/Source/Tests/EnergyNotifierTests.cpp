@@ -0,0 +1,154 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <AzTest/AzTest.h>
+
+#include "../Utils/EnergyNotifier.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class EnergyNotifierTest
+		: public UnitTest::LeakDetectionFixture
+	{
+	protected:
+		struct Notification
+		{
+			int m_id { 0 };
+			float m_energy { 0.f };
+		};
+
+		void Configure(EnergyNotifier& io_notifier, int i_id)
+		{
+			io_notifier.Configure(GameSubsystem::TILES, QUANTUM, { 0.25f }, [this, i_id](float i_normalizedEnergy)
+			{
+				m_notifications.push_back({ i_id, i_normalizedEnergy });
+			});
+		}
+
+		static constexpr float QUANTUM = 0.1f;
+
+		AZStd::vector<Notification> m_notifications {};
+	};
+
+	TEST_F(EnergyNotifierTest, UpdatesAreCoalescedUntilFlush)
+	{
+		EnergyNotifier notifier;
+		Configure(notifier, 1);
+
+		notifier.Update(0.9f);
+		notifier.Update(0.8f);
+		notifier.Update(0.7f);
+
+		EXPECT_TRUE(m_notifications.empty());
+
+		EnergyNotifier::FlushAll();
+
+		ASSERT_EQ(m_notifications.size(), 1u);
+		EXPECT_FLOAT_EQ(m_notifications[0].m_energy, 0.7f);
+
+		EnergyNotifier::FlushAll();
+		EXPECT_EQ(m_notifications.size(), 1u);
+	}
+
+	TEST_F(EnergyNotifierTest, SmallChangesAreNotNotified)
+	{
+		EnergyNotifier notifier;
+		Configure(notifier, 1);
+
+		notifier.Publish(0.7f);
+		m_notifications.clear();
+
+		notifier.Update(0.65f);
+		EnergyNotifier::FlushAll();
+		EXPECT_TRUE(m_notifications.empty());
+
+		// crossing a threshold is always notified, however small the change is
+		notifier.Update(0.26f);
+		EnergyNotifier::FlushAll();
+		notifier.Update(0.24f);
+		EnergyNotifier::FlushAll();
+
+		ASSERT_EQ(m_notifications.size(), 2u);
+		EXPECT_FLOAT_EQ(m_notifications[1].m_energy, 0.24f);
+	}
+
+	TEST_F(EnergyNotifierTest, NotifiersAreFlushedInUpdateOrder)
+	{
+		EnergyNotifier first;
+		EnergyNotifier second;
+		EnergyNotifier third;
+
+		Configure(first, 1);
+		Configure(second, 2);
+		Configure(third, 3);
+
+		third.Update(0.3f);
+		first.Update(0.1f);
+		second.Update(0.2f);
+		third.Update(0.35f);
+
+		EnergyNotifier::FlushAll();
+
+		ASSERT_EQ(m_notifications.size(), 3u);
+		EXPECT_EQ(m_notifications[0].m_id, 3);
+		EXPECT_EQ(m_notifications[1].m_id, 1);
+		EXPECT_EQ(m_notifications[2].m_id, 2);
+	}
+
+	TEST_F(EnergyNotifierTest, CancelledAndDestroyedNotifiersAreNotFlushed)
+	{
+		EnergyNotifier first;
+		EnergyNotifier second;
+
+		Configure(first, 1);
+		Configure(second, 2);
+
+		auto third = AZStd::make_unique<EnergyNotifier>();
+		Configure(*third, 3);
+
+		first.Update(0.1f);
+		third->Update(0.3f);
+		second.Update(0.2f);
+
+		first.Cancel();
+		third.reset();
+
+		EnergyNotifier::FlushAll();
+
+		ASSERT_EQ(m_notifications.size(), 1u);
+		EXPECT_EQ(m_notifications[0].m_id, 2);
+	}
+
+	TEST_F(EnergyNotifierTest, PublishLeavesTheQueue)
+	{
+		EnergyNotifier notifier;
+		Configure(notifier, 1);
+
+		notifier.Update(0.5f);
+		notifier.Publish(0.6f);
+
+		EnergyNotifier::FlushAll();
+
+		ASSERT_EQ(m_notifications.size(), 1u);
+		EXPECT_FLOAT_EQ(m_notifications[0].m_energy, 0.6f);
+	}
+
+} // Loherangrin::Games::O3DEJam2305
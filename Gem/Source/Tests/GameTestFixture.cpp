@@ -0,0 +1,281 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/algorithm.h>
+
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+
+#include "../Components/GameplaySchedulerSystemComponent.hpp"
+#include "../Components/ReplayComponent.hpp"
+#include "../Components/ScoreComponent.hpp"
+#include "../Components/SpaceshipComponent.hpp"
+#include "../Components/TileComponent.hpp"
+#include "../Components/TilesPoolComponent.hpp"
+#include "../Utils/EnergyNotifier.hpp"
+#include "../Utils/GameAllocators.hpp"
+#include "GameTestFixture.hpp"
+#include "StubPhysicsComponent.hpp"
+
+using Loherangrin::Games::O3DEJam2305::EnergyNotifier;
+using Loherangrin::Games::O3DEJam2305::GameArenas;
+using Loherangrin::Games::O3DEJam2305::GameplaySchedulerSystemComponent;
+using Loherangrin::Games::O3DEJam2305::GameplayStage;
+using Loherangrin::Games::O3DEJam2305::GameplayStageNotificationBus;
+using Loherangrin::Games::O3DEJam2305::GameTestFixture;
+using Loherangrin::Games::O3DEJam2305::ReplayComponent;
+using Loherangrin::Games::O3DEJam2305::ScoreComponent;
+using Loherangrin::Games::O3DEJam2305::SpaceshipComponent;
+using Loherangrin::Games::O3DEJam2305::StubPhysicsComponent;
+using Loherangrin::Games::O3DEJam2305::StubSpawnableEntities;
+using Loherangrin::Games::O3DEJam2305::TileComponent;
+using Loherangrin::Games::O3DEJam2305::TilesNotificationBus;
+using Loherangrin::Games::O3DEJam2305::TilesNotificationRecorder;
+using Loherangrin::Games::O3DEJam2305::TilesPoolComponent;
+
+
+TilesNotificationRecorder::TilesNotificationRecorder()
+{
+	TilesNotificationBus::Handler::BusConnect();
+}
+
+TilesNotificationRecorder::~TilesNotificationRecorder()
+{
+	TilesNotificationBus::Handler::BusDisconnect();
+}
+
+const AZStd::vector<AZ::EntityId>& TilesNotificationRecorder::GetCreatedTiles() const
+{
+	return m_createdTiles;
+}
+
+const AZStd::vector<AZ::EntityId>& TilesNotificationRecorder::GetClaimedTiles() const
+{
+	return m_claimedTiles;
+}
+
+const AZStd::vector<AZ::EntityId>& TilesNotificationRecorder::GetLostTiles() const
+{
+	return m_lostTiles;
+}
+
+void TilesNotificationRecorder::Clear()
+{
+	m_createdTiles.clear();
+	m_claimedTiles.clear();
+	m_lostTiles.clear();
+}
+
+void TilesNotificationRecorder::OnTileCreated(const AZ::EntityId& i_tileEntityId)
+{
+	m_createdTiles.push_back(i_tileEntityId);
+}
+
+void TilesNotificationRecorder::OnTileClaimed(const AZ::EntityId& i_tileEntityId)
+{
+	m_claimedTiles.push_back(i_tileEntityId);
+}
+
+void TilesNotificationRecorder::OnTileLost(const AZ::EntityId& i_tileEntityId)
+{
+	m_lostTiles.push_back(i_tileEntityId);
+}
+
+// ---
+
+void GameTestFixture::SetUp()
+{
+	UnitTest::LeakDetectionFixture::SetUp();
+
+	AZ::ComponentApplication::StartupParameters startupParameters;
+	startupParameters.m_loadSettingsRegistry = false;
+
+	m_application = AZStd::make_unique<AZ::ComponentApplication>();
+	m_application->Create(AZ::ComponentApplication::Descriptor {}, startupParameters);
+
+	m_application->RegisterComponentDescriptor(AzFramework::TransformComponent::CreateDescriptor());
+	m_application->RegisterComponentDescriptor(StubPhysicsComponent::CreateDescriptor());
+
+	m_application->RegisterComponentDescriptor(GameplaySchedulerSystemComponent::CreateDescriptor());
+	m_application->RegisterComponentDescriptor(ReplayComponent::CreateDescriptor());
+	m_application->RegisterComponentDescriptor(ScoreComponent::CreateDescriptor());
+	m_application->RegisterComponentDescriptor(SpaceshipComponent::CreateDescriptor());
+	m_application->RegisterComponentDescriptor(TileComponent::CreateDescriptor());
+	m_application->RegisterComponentDescriptor(TilesPoolComponent::CreateDescriptor());
+
+	// every prefab spawns as a tile, the same way as the real ones: a root entity followed by the tile itself
+	m_spawnableEntities = AZStd::make_unique<StubSpawnableEntities>();
+	m_spawnableEntities->SetEntityFactory([]()
+	{
+		auto rootEntity = aznew AZ::Entity("TileRoot");
+		rootEntity->CreateComponent<AzFramework::TransformComponent>();
+
+		auto tileEntity = aznew AZ::Entity("Tile");
+		tileEntity->CreateComponent<AzFramework::TransformComponent>();
+		tileEntity->CreateComponent<TileComponent>();
+
+		return AZStd::vector<AZ::Entity*> { rootEntity, tileEntity };
+	});
+
+	m_tilesRecorder = AZStd::make_unique<TilesNotificationRecorder>();
+}
+
+void GameTestFixture::TearDown()
+{
+	m_tilesRecorder.reset();
+
+	while(!m_entities.empty())
+	{
+		DestroyEntity(m_entities.back());
+	}
+
+	// the despawns queued while deactivating must run before the tickets can be released
+	m_spawnableEntities->ProcessRequests();
+	m_spawnableEntities.reset();
+
+	// without the scheduler, nobody else gives the arena blocks back before the leak check
+	GameArenas::ReleaseAll();
+
+	m_application->Destroy();
+	m_application.reset();
+
+	UnitTest::LeakDetectionFixture::TearDown();
+}
+
+AZ::Entity* GameTestFixture::CreateTile()
+{
+	auto tileEntity = aznew AZ::Entity("Tile");
+	tileEntity->CreateComponent<AzFramework::TransformComponent>();
+	tileEntity->CreateComponent<TileComponent>();
+
+	return ActivateEntity(tileEntity);
+}
+
+AZ::Entity* GameTestFixture::CreateTilesPool(AZ::u16 i_gridLength, AZ::u64 i_seed)
+{
+	auto poolEntity = aznew AZ::Entity("TilesPool");
+	poolEntity->CreateComponent<AzFramework::TransformComponent>();
+
+	auto tilesPool = poolEntity->CreateComponent<TilesPoolComponent>();
+
+	// a single type of tile besides the landing one, and no obstacles
+	const AZStd::vector<AZ::Data::Asset<AzFramework::Spawnable>> tilePrefabs { AZ::Data::Asset<AzFramework::Spawnable> {} };
+
+	SetField(*tilesPool, "Grid", i_gridLength);
+	SetField(*tilesPool, "Seed", i_seed);
+	SetField(*tilesPool, "Tiles", tilePrefabs);
+	SetField(*tilesPool, "ObstacleCount", AZ::u16 { 0 });
+
+	ActivateEntity(poolEntity);
+	ProcessSpawns();
+
+	return poolEntity;
+}
+
+AZ::Entity* GameTestFixture::CreateSpaceship()
+{
+	auto spaceshipEntity = aznew AZ::Entity("Spaceship");
+	spaceshipEntity->CreateComponent<AzFramework::TransformComponent>();
+	spaceshipEntity->CreateComponent<StubPhysicsComponent>();
+	spaceshipEntity->CreateComponent<SpaceshipComponent>();
+
+	return ActivateEntity(spaceshipEntity);
+}
+
+AZ::Entity* GameTestFixture::CreateScheduler()
+{
+	auto schedulerEntity = aznew AZ::Entity("GameplayScheduler");
+	schedulerEntity->CreateComponent<GameplaySchedulerSystemComponent>();
+
+	return ActivateEntity(schedulerEntity);
+}
+
+AZ::Entity* GameTestFixture::CreateScore()
+{
+	auto scoreEntity = aznew AZ::Entity("Score");
+	scoreEntity->CreateComponent<ScoreComponent>();
+
+	return ActivateEntity(scoreEntity);
+}
+
+AZ::Entity* GameTestFixture::CreateReplay()
+{
+	auto replayEntity = aznew AZ::Entity("Replay");
+	replayEntity->CreateComponent<ReplayComponent>();
+
+	return ActivateEntity(replayEntity);
+}
+
+AZ::Entity* GameTestFixture::ActivateEntity(AZ::Entity* io_entity)
+{
+	io_entity->Init();
+	io_entity->Activate();
+
+	m_entities.push_back(io_entity);
+
+	return io_entity;
+}
+
+void GameTestFixture::DestroyEntity(AZ::Entity* io_entity)
+{
+	auto entityIt = AZStd::find(m_entities.begin(), m_entities.end(), io_entity);
+	if(entityIt == m_entities.end())
+	{
+		return;
+	}
+
+	m_entities.erase(entityIt);
+
+	if(io_entity->GetState() == AZ::Entity::State::Active)
+	{
+		io_entity->Deactivate();
+	}
+
+	delete io_entity;
+}
+
+void GameTestFixture::ProcessSpawns()
+{
+	m_spawnableEntities->ProcessRequests();
+}
+
+AZStd::size_t GameTestFixture::GetSpawnedEntitiesCount() const
+{
+	return m_spawnableEntities->GetSpawnedEntitiesCount();
+}
+
+void GameTestFixture::TickStage(GameplayStage i_stage, float i_duration)
+{
+	const auto nFrames = static_cast<AZ::u32>(i_duration / FRAME_TIME + 0.5f);
+
+	for(AZ::u32 i = 0; i < nFrames; ++i)
+	{
+		EBUS_EVENT_ID(i_stage, GameplayStageNotificationBus, OnStageTick, FRAME_TIME);
+		EnergyNotifier::FlushAll();
+	}
+}
+
+void GameTestFixture::RunFrame(float i_frameTime)
+{
+	EBUS_EVENT(AZ::TickBus, OnTick, i_frameTime, AZ::ScriptTimePoint {});
+}
+
+const TilesNotificationRecorder& GameTestFixture::GetTilesRecorder() const
+{
+	return *m_tilesRecorder;
+}
@@ -0,0 +1,132 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <AzTest/AzTest.h>
+
+#include "../EBuses/GameplayBus.hpp"
+#include "../EBuses/TileBus.hpp"
+#include "StubSpawnableEntities.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class TilesNotificationRecorder
+		: protected TilesNotificationBus::Handler
+	{
+	public:
+		TilesNotificationRecorder();
+		~TilesNotificationRecorder() override;
+
+		const AZStd::vector<AZ::EntityId>& GetCreatedTiles() const;
+		const AZStd::vector<AZ::EntityId>& GetClaimedTiles() const;
+		const AZStd::vector<AZ::EntityId>& GetLostTiles() const;
+
+		void Clear();
+
+	protected:
+		// TilesNotificationBus
+		void OnTileCreated(const AZ::EntityId& i_tileEntityId) override;
+		void OnTileClaimed(const AZ::EntityId& i_tileEntityId) override;
+		void OnTileLost(const AZ::EntityId& i_tileEntityId) override;
+
+	private:
+		AZStd::vector<AZ::EntityId> m_createdTiles {};
+		AZStd::vector<AZ::EntityId> m_claimedTiles {};
+		AZStd::vector<AZ::EntityId> m_lostTiles {};
+	};
+
+	// ---
+
+	// Minimal application where gameplay components are activated on plain entities,
+	// with spawnables built in place and physics services provided by stubs.
+	// Stages are ticked directly, in place of the scheduler, unless one is created to run whole frames.
+	class GameTestFixture
+		: public UnitTest::LeakDetectionFixture
+	{
+	protected:
+		void SetUp() override;
+		void TearDown() override;
+
+		AZ::Entity* CreateTile();
+		AZ::Entity* CreateTilesPool(AZ::u16 i_gridLength, AZ::u64 i_seed);
+		AZ::Entity* CreateSpaceship();
+		AZ::Entity* CreateScheduler();
+		AZ::Entity* CreateScore();
+		AZ::Entity* CreateReplay();
+
+		void DestroyEntity(AZ::Entity* io_entity);
+
+		void ProcessSpawns();
+		AZStd::size_t GetSpawnedEntitiesCount() const;
+
+		void TickStage(GameplayStage i_stage, float i_duration);
+		void RunFrame(float i_frameTime);
+
+		const TilesNotificationRecorder& GetTilesRecorder() const;
+
+		// sets a serialized field by its name, as if it was assigned in the editor
+		template <typename t_Component, typename t_Value>
+		static void SetField(t_Component& io_component, const char* i_fieldName, const t_Value& i_value);
+
+		static constexpr float FRAME_TIME = 1.f / 30.f;
+
+	private:
+		AZ::Entity* ActivateEntity(AZ::Entity* io_entity);
+
+		AZStd::unique_ptr<AZ::ComponentApplication> m_application {};
+		AZStd::unique_ptr<StubSpawnableEntities> m_spawnableEntities {};
+		AZStd::unique_ptr<TilesNotificationRecorder> m_tilesRecorder {};
+
+		AZStd::vector<AZ::Entity*> m_entities {};
+	};
+
+} // Loherangrin::Games::O3DEJam2305
+
+
+template <typename t_Component, typename t_Value>
+void Loherangrin::Games::O3DEJam2305::GameTestFixture::SetField(t_Component& io_component, const char* i_fieldName, const t_Value& i_value)
+{
+	AZ::SerializeContext* serializeContext { nullptr };
+	EBUS_EVENT_RESULT(serializeContext, AZ::ComponentApplicationBus, GetSerializeContext);
+	ASSERT_NE(serializeContext, nullptr);
+
+	const AZ::SerializeContext::ClassData* classData = serializeContext->FindClassData(azrtti_typeid<t_Component>());
+	ASSERT_NE(classData, nullptr);
+
+	for(const AZ::SerializeContext::ClassElement& element : classData->m_elements)
+	{
+		if(strcmp(element.m_name, i_fieldName) != 0)
+		{
+			continue;
+		}
+
+		ASSERT_EQ(element.m_typeId, azrtti_typeid<t_Value>()) << "Field " << i_fieldName << " has a different type";
+
+		*reinterpret_cast<t_Value*>(reinterpret_cast<char*>(&io_component) + element.m_offset) = i_value;
+		return;
+	}
+
+	FAIL() << "Field " << i_fieldName << " is not serialized";
+}
@@ -0,0 +1,409 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+#include <AzTest/AzTest.h>
+
+#include "../Core/GridReplication.hpp"
+#include "../Core/ReplicationSocket.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class GridReplicationTest
+		: public UnitTest::LeakDetectionFixture
+	{
+	protected:
+		// ports of the tests only, so that they don't collide with a game replicating on the default ones
+		static constexpr AZ::u16 SERVER_PORT = 47330;
+		static constexpr AZ::u16 CLIENT_PORT = 47331;
+
+		static constexpr AZStd::chrono::milliseconds RECEIVE_TIMEOUT { 200 };
+
+		static PackedGrid CreateGrid(AZ::u16 i_gridLength, AZ::u32 i_seed)
+		{
+			PackedGrid grid(static_cast<TileId>(i_gridLength) * i_gridLength);
+			for(TileId i = 0; i < grid.size(); ++i)
+			{
+				grid[i] = PackedTile::Pack(static_cast<float>((i * 31 + i_seed) % 97) / 96.f, (i + i_seed) % 3 == 0, (i + i_seed) % 11 == 0);
+			}
+
+			return grid;
+		}
+
+		// sends deltas until the client is up to date, dropping the packets chosen by the filter, and returns the number of packets sent
+		template <typename t_DropFilter>
+		static AZ::u32 Replicate(const PackedGrid& i_grid, GridDeltaEncoder& io_encoder, GridDeltaDecoder& io_decoder, t_DropFilter i_dropFilter)
+		{
+			AZStd::vector<AZ::u8> packet(MAX_REPLICATION_PACKET_SIZE);
+
+			for(AZ::u32 nPackets = 0; nPackets < 10000; ++nPackets)
+			{
+				const AZStd::size_t packetSize = io_encoder.Encode(i_grid, packet.data(), packet.size());
+				if(packetSize == 0)
+				{
+					return nPackets;
+				}
+
+				EXPECT_LE(packetSize, MAX_REPLICATION_PACKET_SIZE);
+
+				if(i_dropFilter(nPackets))
+				{
+					continue;
+				}
+
+				const AZ::u32 ackedSequence = io_decoder.Decode(packet.data(), packetSize);
+				if(ackedSequence != 0)
+				{
+					io_encoder.Acknowledge(ackedSequence);
+				}
+			}
+
+			ADD_FAILURE() << "Replication did not converge";
+			return 0;
+		}
+
+		static AZ::u32 Replicate(const PackedGrid& i_grid, GridDeltaEncoder& io_encoder, GridDeltaDecoder& io_decoder)
+		{
+			return Replicate(i_grid, io_encoder, io_decoder, [](AZ::u32){ return false; });
+		}
+
+		// a packet sent over loopback is not always readable right away, so the socket is polled for a short while
+		static AZStd::size_t ReceiveWithTimeout(ReplicationSocket& io_socket, AZStd::vector<AZ::u8>& o_packet)
+		{
+			const AZStd::chrono::steady_clock::time_point deadline = AZStd::chrono::steady_clock::now() + RECEIVE_TIMEOUT;
+
+			while(true)
+			{
+				const AZStd::size_t receivedSize = io_socket.Receive(o_packet.data(), o_packet.size());
+				if(receivedSize > 0 || AZStd::chrono::steady_clock::now() >= deadline)
+				{
+					return receivedSize;
+				}
+
+				AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds { 1 });
+			}
+		}
+	};
+
+	TEST_F(GridReplicationTest, PackedTileRoundTrips)
+	{
+		const PackedTile tile = PackedTile::Pack(0.5f, true, false);
+
+		EXPECT_NEAR(tile.GetNormalizedEnergy(), 0.5f, 1.f / 255.f);
+		EXPECT_TRUE(tile.IsClaimed());
+		EXPECT_FALSE(tile.IsLocked());
+
+		EXPECT_EQ(PackedTile::Pack(2.f, false, true).m_energy, 255);
+		EXPECT_EQ(PackedTile::Pack(-1.f, false, true).m_energy, 0);
+	}
+
+	TEST_F(GridReplicationTest, ClientConvergesOnServerGrid)
+	{
+		GridDeltaEncoder encoder;
+		encoder.Reset(11, 1);
+
+		GridDeltaDecoder decoder;
+
+		PackedGrid grid = CreateGrid(11, 1);
+		EXPECT_EQ(Replicate(grid, encoder, decoder), 1u);
+		EXPECT_EQ(decoder.GetGrid(), grid);
+
+		// only the changed tile is sent once the first snapshot is acknowledged
+		grid[60] = PackedTile::Pack(0.25f, true, true);
+
+		AZStd::vector<AZ::u8> packet(MAX_REPLICATION_PACKET_SIZE);
+		const AZStd::size_t packetSize = encoder.Encode(grid, packet.data(), packet.size());
+		EXPECT_EQ(packetSize, sizeof(GridDeltaHeader) + 2 + sizeof(PackedTile));
+
+		encoder.Acknowledge(decoder.Decode(packet.data(), packetSize));
+		EXPECT_EQ(decoder.GetGrid(), grid);
+
+		EXPECT_EQ(encoder.Encode(grid, packet.data(), packet.size()), 0u);
+	}
+
+	TEST_F(GridReplicationTest, NewLayoutRestartsReplication)
+	{
+		GridDeltaEncoder encoder;
+		encoder.Reset(11, 1);
+
+		GridDeltaDecoder decoder;
+
+		Replicate(CreateGrid(11, 1), encoder, decoder);
+
+		encoder.Reset(5, 2);
+
+		const PackedGrid grid = CreateGrid(5, 2);
+		Replicate(grid, encoder, decoder);
+
+		EXPECT_EQ(decoder.GetLayoutSeed(), 2u);
+		EXPECT_EQ(decoder.GetGridLength(), 5);
+		EXPECT_EQ(decoder.GetGrid(), grid);
+	}
+
+	TEST_F(GridReplicationTest, NewSessionOnSameLayoutRestartsReplication)
+	{
+		GridDeltaEncoder encoder;
+		encoder.Reset(11, 1);
+
+		GridDeltaDecoder decoder;
+
+		for(AZ::u32 seed = 0; seed < 5; ++seed)
+		{
+			Replicate(CreateGrid(11, seed), encoder, decoder);
+		}
+
+		ASSERT_GT(decoder.GetSequence(), 1u);
+
+		// a new game on the same layout starts again from the first sequence
+		encoder.Reset(11, 1);
+
+		const PackedGrid grid = CreateGrid(11, 7);
+		EXPECT_EQ(Replicate(grid, encoder, decoder), 1u);
+
+		EXPECT_EQ(decoder.GetSequence(), 1u);
+		EXPECT_EQ(decoder.GetGrid(), grid);
+	}
+
+	TEST_F(GridReplicationTest, ClientConvergesDespiteLostPackets)
+	{
+		GridDeltaEncoder encoder;
+		encoder.Reset(33, 1);
+
+		GridDeltaDecoder decoder;
+
+		for(AZ::u32 seed = 0; seed < 5; ++seed)
+		{
+			const PackedGrid grid = CreateGrid(33, seed);
+			Replicate(grid, encoder, decoder, [](AZ::u32 i_nPackets){ return (i_nPackets % 3 == 0); });
+
+			EXPECT_EQ(decoder.GetGrid(), grid);
+		}
+	}
+
+	TEST_F(GridReplicationTest, DelayedAcksDoNotRevertTiles)
+	{
+		GridDeltaEncoder encoder;
+		encoder.Reset(33, 1);
+
+		GridDeltaDecoder decoder;
+
+		PackedGrid grid = CreateGrid(33, 1);
+
+		AZStd::vector<AZ::u8> packet(MAX_REPLICATION_PACKET_SIZE);
+		AZStd::vector<AZ::u32> pendingAcks;
+		AZStd::size_t nReplicatedTiles = 0;
+
+		for(AZ::u32 i = 0; i < 100 && decoder.GetGrid() != grid; ++i)
+		{
+			// tiles already sent keep changing while their packets are not acknowledged
+			if(i == 1)
+			{
+				grid[0] = PackedTile::Pack(1.f, true, false);
+			}
+
+			const AZStd::size_t packetSize = encoder.Encode(grid, packet.data(), packet.size());
+			ASSERT_GT(packetSize, 0u);
+
+			const AZ::u32 sequence = decoder.Decode(packet.data(), packetSize);
+			ASSERT_NE(sequence, 0u);
+
+			// each ack reaches the server two packets later
+			pendingAcks.push_back(sequence);
+			if(pendingAcks.size() > 2)
+			{
+				encoder.Acknowledge(pendingAcks.front());
+				pendingAcks.erase(pendingAcks.begin());
+			}
+
+			// a packet built on an older base never brings back the base state of the tiles of the packets before it
+			const PackedGrid& clientGrid = decoder.GetGrid();
+
+			AZStd::size_t nMatchingTiles = 0;
+			for(TileId tileId = 0; tileId < grid.size(); ++tileId)
+			{
+				nMatchingTiles += (clientGrid[tileId] == grid[tileId]) ? 1 : 0;
+			}
+
+			EXPECT_GE(nMatchingTiles, nReplicatedTiles);
+			nReplicatedTiles = nMatchingTiles;
+		}
+
+		EXPECT_EQ(decoder.GetGrid(), grid);
+	}
+
+	TEST_F(GridReplicationTest, PacketsOfLargeGridsStayBounded)
+	{
+		static constexpr AZ::u16 GRID_LENGTH = 256;
+
+		GridDeltaEncoder encoder;
+		encoder.Reset(GRID_LENGTH, 1);
+
+		GridDeltaDecoder decoder;
+
+		const PackedGrid grid = CreateGrid(GRID_LENGTH, 7);
+		const AZ::u32 nPackets = Replicate(grid, encoder, decoder);
+
+		EXPECT_EQ(decoder.GetGrid(), grid);
+		EXPECT_LE(nPackets, (grid.size() * sizeof(PackedTile)) / (MAX_REPLICATION_PACKET_SIZE / 2));
+	}
+
+	TEST_F(GridReplicationTest, MalformedPacketsAreDropped)
+	{
+		GridDeltaDecoder decoder;
+
+		GridDeltaHeader header;
+		header.m_gridLength = 4;
+		header.m_sequence = 1;
+		header.m_nRuns = 1;
+
+		AZ::u8 packet[sizeof(GridDeltaHeader) + 3];
+		memcpy(packet, &header, sizeof(GridDeltaHeader));
+		packet[sizeof(GridDeltaHeader)] = 15;
+		packet[sizeof(GridDeltaHeader) + 1] = 2;
+		packet[sizeof(GridDeltaHeader) + 2] = 0;
+
+		EXPECT_EQ(decoder.Decode(packet, sizeof(packet)), 0u);
+		EXPECT_EQ(decoder.Decode(packet, sizeof(GridDeltaHeader) - 1), 0u);
+		EXPECT_EQ(decoder.GetSequence(), 0u);
+	}
+
+	TEST_F(GridReplicationTest, SocketsReplicateOverLoopback)
+	{
+		ReplicationSocket serverSocket;
+		ASSERT_TRUE(serverSocket.Open(SERVER_PORT, CLIENT_PORT));
+
+		ReplicationSocket clientSocket;
+		ASSERT_TRUE(clientSocket.Open(CLIENT_PORT, SERVER_PORT));
+
+		GridDeltaEncoder encoder;
+		encoder.Reset(33, 1);
+
+		GridDeltaDecoder decoder;
+
+		const PackedGrid grid = CreateGrid(33, 3);
+
+		AZStd::vector<AZ::u8> packet(MAX_REPLICATION_PACKET_SIZE);
+		for(AZ::u32 i = 0; i < 100 && decoder.GetGrid() != grid; ++i)
+		{
+			const AZStd::size_t packetSize = encoder.Encode(grid, packet.data(), packet.size());
+			ASSERT_GT(packetSize, 0u);
+			ASSERT_TRUE(serverSocket.Send(packet.data(), packetSize));
+
+			const AZStd::size_t receivedPacketSize = ReceiveWithTimeout(clientSocket, packet);
+			ASSERT_EQ(receivedPacketSize, packetSize);
+
+			GridAckPacket ack;
+			ack.m_sequence = decoder.Decode(packet.data(), receivedPacketSize);
+			ASSERT_NE(ack.m_sequence, 0u);
+
+			ASSERT_TRUE(clientSocket.Send(reinterpret_cast<const AZ::u8*>(&ack), sizeof(GridAckPacket)));
+
+			const AZStd::size_t receivedAckSize = ReceiveWithTimeout(serverSocket, packet);
+			ASSERT_EQ(receivedAckSize, sizeof(GridAckPacket));
+
+			memcpy(&ack, packet.data(), sizeof(GridAckPacket));
+			encoder.Acknowledge(ack.m_sequence);
+		}
+
+		EXPECT_EQ(decoder.GetGrid(), grid);
+
+		serverSocket.Update(1.f);
+		clientSocket.Update(1.f);
+
+		EXPECT_EQ(serverSocket.GetSentBandwidth().GetTotalBytes(), clientSocket.GetReceivedBandwidth().GetTotalBytes());
+		EXPECT_GT(serverSocket.GetSentBandwidth().GetBytesPerSecond(), 0.f);
+		EXPECT_EQ(clientSocket.GetSentBandwidth().GetTotalBytes(), serverSocket.GetReceivedBandwidth().GetTotalBytes());
+	}
+
+	TEST_F(GridReplicationTest, ReplicaOverridesTilesChangedByTheClient)
+	{
+		static constexpr AZ::u16 GRID_LENGTH = 11;
+		static constexpr TileId UNTOUCHED_TILE_ID = 60;
+
+		ReplicationSocket serverSocket;
+		ASSERT_TRUE(serverSocket.Open(SERVER_PORT, CLIENT_PORT));
+
+		ReplicationSocket clientSocket;
+		ASSERT_TRUE(clientSocket.Open(CLIENT_PORT, SERVER_PORT));
+
+		GridDeltaEncoder encoder;
+		encoder.Reset(GRID_LENGTH, 1);
+
+		GridDeltaDecoder decoder;
+
+		GridReplica replica;
+		replica.Reset(static_cast<TileId>(GRID_LENGTH) * GRID_LENGTH);
+
+		// the server never touches this tile, while the client has claimed it on its own
+		PackedGrid serverGrid = CreateGrid(GRID_LENGTH, 1);
+		serverGrid[UNTOUCHED_TILE_ID] = PackedTile {};
+
+		PackedGrid clientGrid(serverGrid.size());
+		clientGrid[UNTOUCHED_TILE_ID] = PackedTile::Pack(1.f, true, false);
+
+		AZStd::vector<AZ::u8> packet(MAX_REPLICATION_PACKET_SIZE);
+		for(AZ::u32 i = 0; i < 10; ++i)
+		{
+			const AZStd::size_t packetSize = encoder.Encode(serverGrid, packet.data(), packet.size());
+			if(packetSize == 0)
+			{
+				break;
+			}
+
+			ASSERT_TRUE(serverSocket.Send(packet.data(), packetSize));
+
+			const AZStd::size_t receivedPacketSize = ReceiveWithTimeout(clientSocket, packet);
+			ASSERT_EQ(receivedPacketSize, packetSize);
+
+			GridAckPacket ack;
+			ack.m_sequence = decoder.Decode(packet.data(), receivedPacketSize);
+			ASSERT_NE(ack.m_sequence, 0u);
+
+			replica.Apply(decoder.GetGrid(), [&clientGrid](TileId i_tileId, const PackedTile& i_replicatedTile)
+			{
+				clientGrid[i_tileId] = i_replicatedTile;
+				return true;
+			});
+
+			ASSERT_TRUE(clientSocket.Send(reinterpret_cast<const AZ::u8*>(&ack), sizeof(GridAckPacket)));
+
+			const AZStd::size_t receivedAckSize = ReceiveWithTimeout(serverSocket, packet);
+			ASSERT_EQ(receivedAckSize, sizeof(GridAckPacket));
+
+			memcpy(&ack, packet.data(), sizeof(GridAckPacket));
+			encoder.Acknowledge(ack.m_sequence);
+		}
+
+		EXPECT_EQ(clientGrid[UNTOUCHED_TILE_ID], PackedTile {});
+		EXPECT_EQ(clientGrid, serverGrid);
+
+		// later snapshots only reach the tiles that changed since
+		AZ::u32 nAppliedTiles = 0;
+		replica.Apply(decoder.GetGrid(), [&nAppliedTiles](TileId, const PackedTile&)
+		{
+			++nAppliedTiles;
+			return true;
+		});
+
+		EXPECT_EQ(nAppliedTiles, 0u);
+	}
+
+} // Loherangrin::Games::O3DEJam2305
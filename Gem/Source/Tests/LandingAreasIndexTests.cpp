@@ -0,0 +1,180 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <AzTest/AzTest.h>
+
+#include "../Utils/LandingAreasIndex.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class LandingAreasIndexTest
+		: public UnitTest::LeakDetectionFixture
+	{
+	protected:
+		struct Cell
+		{
+			AZ::u16 m_row { 0 };
+			AZ::u16 m_column { 0 };
+		};
+
+		static TileId CalculateTileId(const Cell& i_cell)
+		{
+			return static_cast<TileId>(i_cell.m_row) * GRID_LENGTH + i_cell.m_column;
+		}
+
+		static float CalculateDistanceSq(const Cell& i_cell, float i_row, float i_column)
+		{
+			const float rowDistance = static_cast<float>(i_cell.m_row) - i_row;
+			const float columnDistance = static_cast<float>(i_cell.m_column) - i_column;
+
+			return (rowDistance * rowDistance + columnDistance * columnDistance);
+		}
+
+		void AddLandingArea(const Cell& i_cell, bool i_isClaimed)
+		{
+			m_index.AddLandingArea(CalculateTileId(i_cell), i_cell.m_row, i_cell.m_column, i_isClaimed);
+		}
+
+		// 4 cells per bucket, so that the grid ends in the middle of the last one
+		static constexpr AZ::u16 GRID_LENGTH = 33;
+
+		LandingAreasIndex m_index {};
+	};
+
+	TEST_F(LandingAreasIndexTest, NearestClaimedIsFoundInFartherRings)
+	{
+		m_index.Reset(GRID_LENGTH);
+
+		// the query falls in bucket (1, 1): the first area is in its first ring, while the nearer one is in the second ring
+		const Cell fartherCell { 0, 0 };
+		const Cell nearerCell { 12, 5 };
+
+		AddLandingArea(fartherCell, true);
+		AddLandingArea(nearerCell, true);
+
+		ASSERT_LT(CalculateDistanceSq(nearerCell, 5.4f, 5.4f), CalculateDistanceSq(fartherCell, 5.4f, 5.4f));
+		EXPECT_EQ(m_index.FindNearestClaimedLandingArea(5.4f, 5.4f), CalculateTileId(nearerCell));
+	}
+
+	TEST_F(LandingAreasIndexTest, NearestClaimedMatchesExhaustiveSearch)
+	{
+		m_index.Reset(GRID_LENGTH);
+
+		AZStd::vector<Cell> claimedCells;
+		AZ::u32 random = 12345;
+
+		auto nextRandom = [&random]()
+		{
+			random = random * 1664525u + 1013904223u;
+			return (random >> 8);
+		};
+
+		for(AZ::u16 i = 0; i < 12; ++i)
+		{
+			const Cell cell { static_cast<AZ::u16>(nextRandom() % GRID_LENGTH), static_cast<AZ::u16>(nextRandom() % GRID_LENGTH) };
+			if(m_index.FindLandingArea(cell.m_row, cell.m_column, false) != INVALID_TILE_ID)
+			{
+				continue;
+			}
+
+			AddLandingArea(cell, true);
+			claimedCells.push_back(cell);
+		}
+
+		// queries cover the borders of the buckets, and the outside of the grid as well
+		for(AZ::u32 i = 0; i < 1000; ++i)
+		{
+			const float row = static_cast<float>(nextRandom() % 4000) / 100.f - 4.f;
+			const float column = static_cast<float>(nextRandom() % 4000) / 100.f - 4.f;
+
+			float nearestDistanceSq = CalculateDistanceSq(claimedCells[0], row, column);
+			for(const Cell& cell : claimedCells)
+			{
+				nearestDistanceSq = AZStd::min(nearestDistanceSq, CalculateDistanceSq(cell, row, column));
+			}
+
+			const TileId tileId = m_index.FindNearestClaimedLandingArea(row, column);
+			ASSERT_NE(tileId, INVALID_TILE_ID);
+
+			const Cell foundCell { static_cast<AZ::u16>(tileId / GRID_LENGTH), static_cast<AZ::u16>(tileId % GRID_LENGTH) };
+			EXPECT_FLOAT_EQ(CalculateDistanceSq(foundCell, row, column), nearestDistanceSq) << "Query at " << row << ", " << column;
+		}
+	}
+
+	TEST_F(LandingAreasIndexTest, ClaimsAndLossesUpdateNearestClaimed)
+	{
+		m_index.Reset(GRID_LENGTH);
+
+		const Cell nearCell { 3, 4 };
+		const Cell farCell { 30, 30 };
+
+		AddLandingArea(nearCell, false);
+		AddLandingArea(farCell, true);
+
+		EXPECT_EQ(m_index.FindNearestClaimedLandingArea(3.f, 3.f), CalculateTileId(farCell));
+
+		EXPECT_TRUE(m_index.SetClaimed(CalculateTileId(nearCell), true));
+		EXPECT_EQ(m_index.FindNearestClaimedLandingArea(3.f, 3.f), CalculateTileId(nearCell));
+
+		// claiming twice keeps a single entry, so that a single loss removes it
+		EXPECT_TRUE(m_index.SetClaimed(CalculateTileId(nearCell), true));
+		EXPECT_TRUE(m_index.SetClaimed(CalculateTileId(nearCell), false));
+		EXPECT_EQ(m_index.FindNearestClaimedLandingArea(3.f, 3.f), CalculateTileId(farCell));
+
+		EXPECT_TRUE(m_index.SetClaimed(CalculateTileId(farCell), false));
+		EXPECT_EQ(m_index.FindNearestClaimedLandingArea(3.f, 3.f), INVALID_TILE_ID);
+
+		// tiles that are not landing areas are not indexed
+		EXPECT_FALSE(m_index.SetClaimed(CalculateTileId({ 5, 5 }), true));
+		EXPECT_EQ(m_index.FindNearestClaimedLandingArea(5.f, 5.f), INVALID_TILE_ID);
+	}
+
+	TEST_F(LandingAreasIndexTest, LandingAreasAreFoundOnlyInTheirCell)
+	{
+		m_index.Reset(GRID_LENGTH);
+
+		const Cell claimedCell { 8, 7 };
+		const Cell unclaimedCell { 8, 8 };
+
+		AddLandingArea(claimedCell, true);
+		AddLandingArea(unclaimedCell, false);
+
+		EXPECT_EQ(m_index.FindLandingArea(8, 7, true), CalculateTileId(claimedCell));
+		EXPECT_EQ(m_index.FindLandingArea(8, 7, false), CalculateTileId(claimedCell));
+
+		EXPECT_EQ(m_index.FindLandingArea(8, 8, true), INVALID_TILE_ID);
+		EXPECT_EQ(m_index.FindLandingArea(8, 8, false), CalculateTileId(unclaimedCell));
+
+		EXPECT_EQ(m_index.FindLandingArea(7, 7, false), INVALID_TILE_ID);
+		EXPECT_EQ(m_index.FindLandingArea(GRID_LENGTH, 7, false), INVALID_TILE_ID);
+	}
+
+	TEST_F(LandingAreasIndexTest, ResetDropsAllLandingAreas)
+	{
+		m_index.Reset(GRID_LENGTH);
+		AddLandingArea({ 1, 1 }, true);
+
+		m_index.Reset(GRID_LENGTH);
+
+		EXPECT_EQ(m_index.FindLandingArea(1, 1, false), INVALID_TILE_ID);
+		EXPECT_EQ(m_index.FindNearestClaimedLandingArea(1.f, 1.f), INVALID_TILE_ID);
+	}
+
+} // Loherangrin::Games::O3DEJam2305
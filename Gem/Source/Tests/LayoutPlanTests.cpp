@@ -0,0 +1,142 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+
+#include <AzTest/AzTest.h>
+
+#include "../Core/LayoutPlan.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class LayoutPlanTest
+		: public UnitTest::LeakDetectionFixture
+	{
+	protected:
+		static LayoutPlan::Settings CreateSettings(AZ::u16 i_gridLength)
+		{
+			LayoutPlan::Settings settings;
+			settings.m_gridLength = i_gridLength;
+			settings.m_maxObstacles = static_cast<AZ::u16>((i_gridLength * i_gridLength) / 25);
+			settings.m_obstacleCellSize = { 6.f, 6.f };
+			settings.m_tileCellSize = { 3.f, 3.f };
+			settings.m_nObstacleTypes = 3;
+			settings.m_nTileTypes = 4;
+
+			return settings;
+		}
+
+		static void ExpectSamePlan(const LayoutPlan& i_plan, const LayoutPlan& i_otherPlan)
+		{
+			EXPECT_EQ(i_plan.GetSeed(), i_otherPlan.GetSeed());
+			EXPECT_EQ(i_plan.GetGridLength(), i_otherPlan.GetGridLength());
+			EXPECT_EQ(i_plan.GetObstacleCells(), i_otherPlan.GetObstacleCells());
+
+			const AZStd::vector<LayoutPlan::Obstacle>& obstacles = i_plan.GetObstacles();
+			const AZStd::vector<LayoutPlan::Obstacle>& otherObstacles = i_otherPlan.GetObstacles();
+
+			ASSERT_EQ(obstacles.size(), otherObstacles.size());
+			for(AZStd::size_t i = 0; i < obstacles.size(); ++i)
+			{
+				EXPECT_EQ(obstacles[i].m_row, otherObstacles[i].m_row);
+				EXPECT_EQ(obstacles[i].m_column, otherObstacles[i].m_column);
+				EXPECT_EQ(obstacles[i].m_type, otherObstacles[i].m_type);
+			}
+
+			const AZStd::vector<LayoutPlan::Tile>& tiles = i_plan.GetTiles();
+			const AZStd::vector<LayoutPlan::Tile>& otherTiles = i_otherPlan.GetTiles();
+
+			ASSERT_EQ(tiles.size(), otherTiles.size());
+			for(AZStd::size_t i = 0; i < tiles.size(); ++i)
+			{
+				EXPECT_EQ(tiles[i].m_row, otherTiles[i].m_row);
+				EXPECT_EQ(tiles[i].m_column, otherTiles[i].m_column);
+				EXPECT_EQ(tiles[i].m_type, otherTiles[i].m_type);
+				EXPECT_EQ(tiles[i].m_isStart, otherTiles[i].m_isStart);
+			}
+		}
+
+		static constexpr AZ::u64 SEED = 1234;
+
+		// lengths around the chunks of 32 rows, which usually leave a last chunk shorter than the others
+		static constexpr AZStd::array<AZ::u16, 7> GRID_LENGTHS = { 11, 31, 32, 33, 65, 100, 317 };
+	};
+
+	TEST_F(LayoutPlanTest, ChunkedPlanMatchesSerialPlan)
+	{
+		AZ::JobManagerDesc jobManagerDesc;
+		for(AZ::u32 i = 0; i < 4; ++i)
+		{
+			jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc {});
+		}
+
+		AZ::JobManager jobManager { jobManagerDesc };
+		AZ::JobContext jobContext { jobManager };
+
+		for(const AZ::u16 gridLength : GRID_LENGTHS)
+		{
+			SCOPED_TRACE(gridLength);
+
+			const LayoutPlan::Settings settings = CreateSettings(gridLength);
+
+			LayoutPlan serialPlan;
+			serialPlan.Generate(settings, SEED);
+
+			LayoutPlan chunkedPlan;
+			chunkedPlan.Generate(settings, SEED, &jobContext);
+
+			ExpectSamePlan(chunkedPlan, serialPlan);
+
+			// every chunk wrote its own rows, without leaving any free cell out
+			const FlowField::CellMask& obstacleCells = chunkedPlan.GetObstacleCells();
+			EXPECT_EQ(chunkedPlan.GetTiles().size(), static_cast<AZStd::size_t>(AZStd::count(obstacleCells.begin(), obstacleCells.end(), false)));
+		}
+	}
+
+	TEST_F(LayoutPlanTest, ChunkedPlanOfEmptyTilesMatchesSerialPlan)
+	{
+		AZ::JobManagerDesc jobManagerDesc;
+		jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc {});
+
+		AZ::JobManager jobManager { jobManagerDesc };
+		AZ::JobContext jobContext { jobManager };
+
+		for(const AZ::u16 gridLength : GRID_LENGTHS)
+		{
+			SCOPED_TRACE(gridLength);
+
+			LayoutPlan::Settings settings = CreateSettings(gridLength);
+			settings.m_maxObstacles = 0;
+			settings.m_forceEmptyTiles = true;
+
+			LayoutPlan serialPlan;
+			serialPlan.Generate(settings, SEED);
+
+			LayoutPlan chunkedPlan;
+			chunkedPlan.Generate(settings, SEED, &jobContext);
+
+			ExpectSamePlan(chunkedPlan, serialPlan);
+			EXPECT_EQ(chunkedPlan.GetTiles().size(), static_cast<AZStd::size_t>(gridLength * gridLength));
+		}
+	}
+
+} // Loherangrin::Games::O3DEJam2305
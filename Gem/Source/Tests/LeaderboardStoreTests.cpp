@@ -0,0 +1,205 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(AZ_PLATFORM_LINUX) || defined(AZ_PLATFORM_MAC)
+#include <signal.h>
+#include <sys/resource.h>
+#endif // AZ_PLATFORM_LINUX || AZ_PLATFORM_MAC
+
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+
+#include "../Utils/LeaderboardStore.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class LeaderboardStoreTest
+		: public UnitTest::LeakDetectionFixture
+	{
+	protected:
+		static LeaderboardEntry CreateEntry(LeaderboardStore::TotalPoints i_points, LeaderboardSeed i_seed, AZ::u64 i_time)
+		{
+			LeaderboardEntry entry;
+			entry.m_points = i_points;
+			entry.m_seed = i_seed;
+			entry.m_time = i_time;
+			entry.m_claimedTiles = static_cast<TileCount>(i_time);
+
+			return entry;
+		}
+
+		AZ::IO::Path GetFilePath() const
+		{
+			return m_tempDirectory.Resolve("leaderboard.bin");
+		}
+
+		AZ::Test::ScopedAutoTempDirectory m_tempDirectory {};
+	};
+
+	TEST_F(LeaderboardStoreTest, EntriesAreRankedByPoints)
+	{
+		LeaderboardStore store;
+		ASSERT_TRUE(store.Open(GetFilePath().c_str()));
+
+		EXPECT_TRUE(store.AddEntry(CreateEntry(100, 1, 1)));
+		EXPECT_TRUE(store.AddEntry(CreateEntry(300, 1, 2)));
+		EXPECT_TRUE(store.AddEntry(CreateEntry(200, 2, 3)));
+
+		const AZStd::vector<LeaderboardEntry> topEntries = store.GetTopEntries(10);
+		ASSERT_EQ(topEntries.size(), 3u);
+		EXPECT_EQ(topEntries[0].m_points, 300u);
+		EXPECT_EQ(topEntries[1].m_points, 200u);
+		EXPECT_EQ(topEntries[2].m_points, 100u);
+
+		EXPECT_EQ(store.GetTopEntries(2).size(), 2u);
+
+		EXPECT_EQ(store.GetRank(400), 1u);
+		EXPECT_EQ(store.GetRank(250), 2u);
+		EXPECT_EQ(store.GetRank(50), 4u);
+	}
+
+	TEST_F(LeaderboardStoreTest, TiesKeepTheirRecordingOrder)
+	{
+		LeaderboardStore store;
+		ASSERT_TRUE(store.Open(GetFilePath().c_str()));
+
+		store.AddEntry(CreateEntry(100, 1, 1));
+		store.AddEntry(CreateEntry(200, 1, 2));
+		store.AddEntry(CreateEntry(100, 1, 3));
+		store.AddEntry(CreateEntry(100, 1, 4));
+
+		const AZStd::vector<LeaderboardEntry> topEntries = store.GetTopEntries(10);
+		ASSERT_EQ(topEntries.size(), 4u);
+		EXPECT_EQ(topEntries[0].m_time, 2u);
+		EXPECT_EQ(topEntries[1].m_time, 1u);
+		EXPECT_EQ(topEntries[2].m_time, 3u);
+		EXPECT_EQ(topEntries[3].m_time, 4u);
+
+		// an equal score shares the rank of the entries it ties with
+		EXPECT_EQ(store.GetRank(100), 2u);
+	}
+
+	TEST_F(LeaderboardStoreTest, SeedEntriesAreFiltered)
+	{
+		LeaderboardStore store;
+		ASSERT_TRUE(store.Open(GetFilePath().c_str()));
+
+		store.AddEntry(CreateEntry(100, 1, 1));
+		store.AddEntry(CreateEntry(500, 2, 2));
+		store.AddEntry(CreateEntry(300, 1, 3));
+
+		const AZStd::vector<LeaderboardEntry> seedEntries = store.GetSeedTopEntries(1, 10);
+		ASSERT_EQ(seedEntries.size(), 2u);
+		EXPECT_EQ(seedEntries[0].m_points, 300u);
+		EXPECT_EQ(seedEntries[1].m_points, 100u);
+
+		EXPECT_EQ(store.GetSeedRank(1, 400), 1u);
+		EXPECT_EQ(store.GetSeedRank(1, 200), 2u);
+		EXPECT_EQ(store.GetSeedRank(2, 200), 2u);
+
+		EXPECT_TRUE(store.GetSeedTopEntries(3, 10).empty());
+		EXPECT_EQ(store.GetSeedRank(3, 0), 1u);
+	}
+
+	TEST_F(LeaderboardStoreTest, ReopenedFileKeepsItsEntries)
+	{
+		// more entries than the initial capacity, so that the file has to grow
+		static constexpr AZ::u32 N_ENTRIES = 1100;
+
+		{
+			LeaderboardStore store;
+			ASSERT_TRUE(store.Open(GetFilePath().c_str()));
+
+			for(AZ::u32 i = 0; i < N_ENTRIES; ++i)
+			{
+				ASSERT_TRUE(store.AddEntry(CreateEntry(i % 100, i % 3, i)));
+			}
+		}
+
+		LeaderboardStore store;
+		ASSERT_TRUE(store.Open(GetFilePath().c_str()));
+
+		EXPECT_EQ(store.GetEntryCount(), N_ENTRIES);
+
+		const AZStd::vector<LeaderboardEntry> topEntries = store.GetTopEntries(3);
+		ASSERT_EQ(topEntries.size(), 3u);
+		EXPECT_EQ(topEntries[0].m_points, 99u);
+		EXPECT_EQ(topEntries[0].m_time, 99u);
+		EXPECT_EQ(topEntries[1].m_time, 199u);
+		EXPECT_EQ(topEntries[2].m_time, 299u);
+		EXPECT_EQ(topEntries[0].m_claimedTiles, 99u);
+
+		const AZStd::vector<LeaderboardEntry> seedEntries = store.GetSeedTopEntries(1, 1);
+		ASSERT_EQ(seedEntries.size(), 1u);
+		EXPECT_EQ(seedEntries[0].m_seed, 1u);
+		EXPECT_EQ(seedEntries[0].m_points, 99u);
+	}
+
+	TEST_F(LeaderboardStoreTest, FailedGrowKeepsTheStoredEntries)
+	{
+#if defined(AZ_PLATFORM_LINUX) || defined(AZ_PLATFORM_MAC)
+		// exactly the initial capacity, so that the next entry has to grow the file
+		static constexpr AZ::u32 N_ENTRIES = 1024;
+
+		LeaderboardStore store;
+		ASSERT_TRUE(store.Open(GetFilePath().c_str()));
+
+		for(AZ::u32 i = 0; i < N_ENTRIES; ++i)
+		{
+			ASSERT_TRUE(store.AddEntry(CreateEntry(i, 1, i)));
+		}
+
+		// a file size limit makes the grow fail, as a full disk would
+		rlimit previousLimit;
+		ASSERT_EQ(getrlimit(RLIMIT_FSIZE, &previousLimit), 0);
+
+		rlimit fileLimit = previousLimit;
+		fileLimit.rlim_cur = static_cast<rlim_t>(AZ::IO::SystemFile::Length(GetFilePath().c_str()));
+
+		auto previousHandler = signal(SIGXFSZ, SIG_IGN);
+		ASSERT_EQ(setrlimit(RLIMIT_FSIZE, &fileLimit), 0);
+
+		const bool isAdded = store.AddEntry(CreateEntry(N_ENTRIES, 2, N_ENTRIES));
+
+		setrlimit(RLIMIT_FSIZE, &previousLimit);
+		signal(SIGXFSZ, previousHandler);
+
+		EXPECT_FALSE(isAdded);
+
+		EXPECT_EQ(store.GetEntryCount(), N_ENTRIES);
+		EXPECT_EQ(store.GetRank(N_ENTRIES), 1u);
+		EXPECT_EQ(store.GetSeedRank(1, 0), N_ENTRIES);
+
+		const AZStd::vector<LeaderboardEntry> topEntries = store.GetTopEntries(1);
+		ASSERT_EQ(topEntries.size(), 1u);
+		EXPECT_EQ(topEntries[0].m_points, N_ENTRIES - 1);
+
+		EXPECT_TRUE(store.GetSeedTopEntries(2, 1).empty());
+
+		// the store recovers once the file can grow again
+		EXPECT_TRUE(store.AddEntry(CreateEntry(N_ENTRIES, 2, N_ENTRIES)));
+		EXPECT_EQ(store.GetEntryCount(), N_ENTRIES + 1);
+		EXPECT_EQ(store.GetSeedRank(2, 0), 2u);
+#else
+		GTEST_SKIP() << "File size limits are not available on this platform";
+#endif // AZ_PLATFORM_LINUX || AZ_PLATFORM_MAC
+	}
+
+} // Loherangrin::Games::O3DEJam2305
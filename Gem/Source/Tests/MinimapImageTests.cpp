@@ -0,0 +1,139 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <AzTest/AzTest.h>
+
+#include "../Utils/MinimapImage.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class MinimapImageTest
+		: public UnitTest::LeakDetectionFixture
+	{
+	protected:
+		static constexpr MinimapImage::Texel BACKGROUND = 0xFF000000;
+		static constexpr MinimapImage::Texel CLAIMED = 0xFF00FF00;
+
+		static MinimapImage::Texel GetTexel(const MinimapImage& i_image, AZ::u32 i_x, AZ::u32 i_y)
+		{
+			const auto texels = reinterpret_cast<const MinimapImage::Texel*>(i_image.GetData());
+			return texels[i_y * i_image.GetWidth() + i_x];
+		}
+
+		static void ExpectRect(const MinimapImage::Rect& i_rect, AZ::u32 i_left, AZ::u32 i_top, AZ::u32 i_width, AZ::u32 i_height)
+		{
+			EXPECT_EQ(i_rect.m_left, i_left);
+			EXPECT_EQ(i_rect.m_top, i_top);
+			EXPECT_EQ(i_rect.m_width, i_width);
+			EXPECT_EQ(i_rect.m_height, i_height);
+		}
+	};
+
+	TEST_F(MinimapImageTest, ResetMarksWholeImageDirty)
+	{
+		MinimapImage image;
+		image.Reset(4, 2, BACKGROUND);
+
+		EXPECT_EQ(image.GetWidth(), 8u);
+		EXPECT_EQ(image.GetRowPitch(), 8u * sizeof(MinimapImage::Texel));
+
+		ASSERT_EQ(image.GetDirtyRects().size(), 1u);
+		ExpectRect(image.GetDirtyRects()[0], 0, 0, 8, 8);
+	}
+
+	TEST_F(MinimapImageTest, SetTileWritesItsBlockOnly)
+	{
+		MinimapImage image;
+		image.Reset(4, 2, BACKGROUND);
+		image.ClearDirtyRects();
+
+		// tile 6 is at column 2 and row 1
+		EXPECT_TRUE(image.SetTile(6, CLAIMED));
+		EXPECT_EQ(image.GetTile(6), CLAIMED);
+
+		for(AZ::u32 y = 0; y < image.GetHeight(); ++y)
+		{
+			for(AZ::u32 x = 0; x < image.GetWidth(); ++x)
+			{
+				const bool isInBlock = (x >= 4 && x < 6 && y >= 2 && y < 4);
+				EXPECT_EQ(GetTexel(image, x, y), (isInBlock) ? CLAIMED : BACKGROUND);
+			}
+		}
+
+		ASSERT_EQ(image.GetDirtyRects().size(), 1u);
+		ExpectRect(image.GetDirtyRects()[0], 4, 2, 2, 2);
+
+		image.ClearDirtyRects();
+
+		EXPECT_FALSE(image.SetTile(6, CLAIMED));
+		EXPECT_FALSE(image.SetTile(16, CLAIMED));
+		EXPECT_FALSE(image.IsDirty());
+	}
+
+	TEST_F(MinimapImageTest, TilesSharingAnEdgeMerge)
+	{
+		MinimapImage image;
+		image.Reset(4, 2, BACKGROUND);
+		image.ClearDirtyRects();
+
+		image.SetTile(0, CLAIMED);
+		image.SetTile(1, CLAIMED);
+		image.SetTile(5, CLAIMED);
+
+		ASSERT_EQ(image.GetDirtyRects().size(), 1u);
+		ExpectRect(image.GetDirtyRects()[0], 0, 0, 4, 4);
+	}
+
+	TEST_F(MinimapImageTest, TilesTouchingAtACornerStayApart)
+	{
+		MinimapImage image;
+		image.Reset(4, 2, BACKGROUND);
+		image.ClearDirtyRects();
+
+		image.SetTile(0, CLAIMED);
+		image.SetTile(5, CLAIMED);
+
+		ASSERT_EQ(image.GetDirtyRects().size(), 2u);
+		ExpectRect(image.GetDirtyRects()[0], 0, 0, 2, 2);
+		ExpectRect(image.GetDirtyRects()[1], 2, 2, 2, 2);
+	}
+
+	TEST_F(MinimapImageTest, FullDirtyListCollapsesIntoOneRect)
+	{
+		MinimapImage image;
+		image.Reset(8, 1, BACKGROUND);
+		image.ClearDirtyRects();
+
+		for(TileId row = 0; row < 4; row += 2)
+		{
+			for(TileId column = 0; column < 8; column += 2)
+			{
+				image.SetTile(row * 8 + column, CLAIMED);
+			}
+		}
+
+		ASSERT_EQ(image.GetDirtyRects().size(), MinimapImage::MAX_DIRTY_RECTS);
+
+		image.SetTile(63, CLAIMED);
+
+		ASSERT_EQ(image.GetDirtyRects().size(), 1u);
+		ExpectRect(image.GetDirtyRects()[0], 0, 0, 8, 8);
+	}
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,126 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <AzTest/AzTest.h>
+
+#include "../Core/RandomStream.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class RandomStreamTest
+		: public UnitTest::LeakDetectionFixture
+	{
+	protected:
+		static constexpr AZ::u64 SEED = 1234;
+	};
+
+	TEST_F(RandomStreamTest, ValuesDependOnlyOnTheirIndex)
+	{
+		RandomStream randomStream { RandomStreamId::TILE_TYPES, SEED };
+
+		AZStd::vector<AZ::u64> values;
+		for(AZ::u32 i = 0; i < 64; ++i)
+		{
+			values.push_back(randomStream.Getu64Random());
+		}
+
+		EXPECT_EQ(randomStream.GetCounter(), values.size());
+
+		const RandomStream otherStream { RandomStreamId::TILE_TYPES, SEED };
+		for(AZ::u32 i = static_cast<AZ::u32>(values.size()); i > 0; --i)
+		{
+			EXPECT_EQ(otherStream.Getu64At(i - 1), values[i - 1]);
+		}
+	}
+
+	TEST_F(RandomStreamTest, StreamsOfTheSameSeedDiffer)
+	{
+		const RandomStream tileTypeStream { RandomStreamId::TILE_TYPES, SEED };
+		const RandomStream obstacleStream { RandomStreamId::OBSTACLES, SEED };
+		const RandomStream otherSeedStream { RandomStreamId::TILE_TYPES, SEED + 1 };
+
+		AZ::u32 nEqualValues = 0;
+		for(AZ::u64 i = 0; i < 64; ++i)
+		{
+			nEqualValues += (tileTypeStream.Getu64At(i) == obstacleStream.Getu64At(i)) ? 1 : 0;
+			nEqualValues += (tileTypeStream.Getu64At(i) == otherSeedStream.Getu64At(i)) ? 1 : 0;
+		}
+
+		EXPECT_EQ(nEqualValues, 0u);
+	}
+
+	TEST_F(RandomStreamTest, RestoredCounterGoesOnTheSameWay)
+	{
+		RandomStream randomStream { RandomStreamId::STORMS, SEED };
+		for(AZ::u32 i = 0; i < 10; ++i)
+		{
+			randomStream.GetRandomFloat();
+		}
+
+		RandomStream restoredStream { RandomStreamId::STORMS };
+		restoredStream.SetSeed(randomStream.GetSeed());
+		restoredStream.SetCounter(randomStream.GetCounter());
+
+		for(AZ::u32 i = 0; i < 10; ++i)
+		{
+			EXPECT_EQ(restoredStream.GetRandomFloat(), randomStream.GetRandomFloat());
+			EXPECT_EQ(restoredStream.GetRandomBounded(13), randomStream.GetRandomBounded(13));
+		}
+	}
+
+	TEST_F(RandomStreamTest, BoundedValuesAreUniform)
+	{
+		static constexpr AZ::u32 RANGE = 7;
+		static constexpr AZ::u32 N_SAMPLES_PER_VALUE = 10000;
+
+		const RandomStream randomStream { RandomStreamId::DROPS, SEED };
+
+		AZStd::array<AZ::u32, RANGE> counts {};
+		for(AZ::u64 i = 0; i < RANGE * N_SAMPLES_PER_VALUE; ++i)
+		{
+			const AZ::u32 value = randomStream.GetBoundedAt(i, RANGE);
+			ASSERT_LT(value, RANGE);
+
+			++counts[value];
+		}
+
+		for(const AZ::u32 count : counts)
+		{
+			EXPECT_NEAR(static_cast<float>(count), static_cast<float>(N_SAMPLES_PER_VALUE), N_SAMPLES_PER_VALUE * 0.05f);
+		}
+
+		EXPECT_EQ(randomStream.GetBoundedAt(0, 0), 0u);
+		EXPECT_EQ(randomStream.GetBoundedAt(0, 1), 0u);
+	}
+
+	TEST_F(RandomStreamTest, FloatsStayBelowOne)
+	{
+		const RandomStream randomStream { RandomStreamId::STORMS, SEED };
+		for(AZ::u64 i = 0; i < 10000; ++i)
+		{
+			const float value = randomStream.GetFloatAt(i);
+
+			EXPECT_GE(value, 0.f);
+			EXPECT_LT(value, 1.f);
+		}
+	}
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,210 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/string.h>
+
+#include <AzTest/Utils.h>
+
+#include "../Core/ReplayFile.hpp"
+#include "../EBuses/GameBus.hpp"
+#include "../EBuses/GameplayBus.hpp"
+#include "../EBuses/ReplayBus.hpp"
+#include "../EBuses/ScoreBus.hpp"
+#include "../EBuses/TileBus.hpp"
+#include "GameTestFixture.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Claims a few tiles at fixed ticks and keeps them charged, then ends the game,
+	// standing in for the player so that the same game is played whatever the frame rate
+	class ScriptedGame
+		: protected GameplayStageNotificationBus::Handler
+	{
+	public:
+		static constexpr AZ::u32 END_TICK = 600;
+		static constexpr AZ::u32 RECHARGE_INTERVAL = 30;
+
+		explicit ScriptedGame(AZStd::vector<AZ::EntityId>&& i_tileEntityIds)
+			: m_tileEntityIds { AZStd::move(i_tileEntityIds) }
+		{
+			GameplayStageNotificationBus::Handler::BusConnect(GameplayStage::TILES);
+		}
+
+		~ScriptedGame() override
+		{
+			GameplayStageNotificationBus::Handler::BusDisconnect();
+		}
+
+		bool IsOver() const
+		{
+			return m_isOver;
+		}
+
+	protected:
+		// GameplayStageNotificationBus
+		void OnStageTick([[maybe_unused]] float i_deltaTime) override
+		{
+			AZ::u32 tick { 0 };
+			EBUS_EVENT_RESULT(tick, GameplaySchedulerRequestBus, GetTick);
+
+			if(tick == END_TICK)
+			{
+				m_isOver = true;
+				GameplayStageNotificationBus::Handler::BusDisconnect();
+
+				EBUS_EVENT(GameNotificationBus, OnGameEnded);
+				return;
+			}
+
+			for(AZStd::size_t i = 0; i < m_tileEntityIds.size(); ++i)
+			{
+				const AZ::u32 claimTick = CLAIM_TICKS[i];
+				if(tick < claimTick || (tick - claimTick) % RECHARGE_INTERVAL != 0)
+				{
+					continue;
+				}
+
+				EBUS_EVENT_ID(m_tileEntityIds[i], TileRequestBus, AddEnergy, 100.f);
+			}
+		}
+
+	private:
+		static constexpr AZ::u32 CLAIM_TICKS[] { 10, 95, 250 };
+
+		AZStd::vector<AZ::EntityId> m_tileEntityIds {};
+		bool m_isOver { false };
+	};
+
+	// ---
+
+	class ReplayComponentTest
+		: public GameTestFixture
+	{
+	protected:
+		void SetUp() override
+		{
+			GameTestFixture::SetUp();
+
+			CreateTilesPool(GRID_LENGTH, 1234);
+			CreateScheduler();
+			CreateScore();
+			CreateReplay();
+		}
+
+		// frames are run with the given durations in turn, until the scripted game is over
+		ScoreRequests::TotalPoints PlayGame(const AZStd::vector<float>& i_frameTimes)
+		{
+			EBUS_EVENT(GameNotificationBus, OnGameLoading);
+			ProcessSpawns();
+
+			EBUS_EVENT(GameNotificationBus, OnGameStarted);
+
+			ScriptedGame game { FindScriptedTiles() };
+			for(AZStd::size_t i = 0; !game.IsOver() && i < MAX_FRAMES; ++i)
+			{
+				RunFrame(i_frameTimes[i % i_frameTimes.size()]);
+			}
+
+			EXPECT_TRUE(game.IsOver());
+
+			ScoreRequests::TotalPoints totalPoints { 0 };
+			EBUS_EVENT_RESULT(totalPoints, ScoreRequestBus, GetTotalPoints);
+
+			return totalPoints;
+		}
+
+		// the first tiles of the last grid that was spawned, by tile id, leaving out the landing areas
+		AZStd::vector<AZ::EntityId> FindScriptedTiles() const
+		{
+			const AZStd::vector<AZ::EntityId>& createdTiles = GetTilesRecorder().GetCreatedTiles();
+
+			AZStd::vector<AZStd::pair<TileId, AZ::EntityId>> tiles;
+			for(auto tileEntityIt = createdTiles.end() - N_TILES; tileEntityIt != createdTiles.end(); ++tileEntityIt)
+			{
+				bool isLandingArea { false };
+				EBUS_EVENT_ID_RESULT(isLandingArea, *tileEntityIt, TileRequestBus, IsLandingArea);
+
+				if(isLandingArea)
+				{
+					continue;
+				}
+
+				TileId tileId { INVALID_TILE_ID };
+				EBUS_EVENT_ID_RESULT(tileId, *tileEntityIt, TileRequestBus, GetTileId);
+
+				tiles.emplace_back(tileId, *tileEntityIt);
+			}
+
+			AZStd::sort(tiles.begin(), tiles.end());
+
+			AZStd::vector<AZ::EntityId> tileEntityIds;
+			for(AZStd::size_t i = 0; i < N_SCRIPTED_TILES && i < tiles.size(); ++i)
+			{
+				tileEntityIds.push_back(tiles[i].second);
+			}
+
+			return tileEntityIds;
+		}
+
+		static AZ::u32 GetDivergencesCount()
+		{
+			AZ::u32 nDivergences { 0 };
+			EBUS_EVENT_RESULT(nDivergences, ReplayRequestBus, GetDivergencesCount);
+
+			return nDivergences;
+		}
+
+		AZStd::string GetFilePath() const
+		{
+			return m_tempDirectory.Resolve("game.rply").c_str();
+		}
+
+		static constexpr AZ::u16 GRID_LENGTH = 11;
+		static constexpr AZStd::size_t N_TILES = GRID_LENGTH * GRID_LENGTH;
+		static constexpr AZStd::size_t N_SCRIPTED_TILES = 3;
+		static constexpr AZStd::size_t MAX_FRAMES = 10 * ScriptedGame::END_TICK;
+
+		AZ::Test::ScopedAutoTempDirectory m_tempDirectory {};
+	};
+
+	TEST_F(ReplayComponentTest, PlaybackAtAnotherFrameRateMatchesRecording)
+	{
+		bool isStarted { false };
+		EBUS_EVENT_RESULT(isStarted, ReplayRequestBus, StartRecording, GetFilePath());
+		ASSERT_TRUE(isStarted);
+
+		const ScoreRequests::TotalPoints recordedPoints = PlayGame({ 1.f / 60.f });
+		EXPECT_GT(recordedPoints, 0u);
+
+		ReplayFile replay;
+		ASSERT_TRUE(replay.Read(GetFilePath().c_str()));
+		EXPECT_EQ(replay.GetHeader().m_nTicks, ScriptedGame::END_TICK);
+		EXPECT_GT(replay.GetHeader().m_nChecksums, 0u);
+
+		EBUS_EVENT_RESULT(isStarted, ReplayRequestBus, StartPlayback, GetFilePath());
+		ASSERT_TRUE(isStarted);
+
+		// uneven frames run from none to several ticks each, while the score has to follow the ticks only
+		const ScoreRequests::TotalPoints playedPoints = PlayGame({ 1.f / 30.f, 1.f / 90.f, 1.f / 45.f, 1.f / 20.f, 0.f });
+
+		EXPECT_EQ(GetDivergencesCount(), 0u);
+		EXPECT_EQ(playedPoints, recordedPoints);
+	}
+
+} // Loherangrin::Games::O3DEJam2305
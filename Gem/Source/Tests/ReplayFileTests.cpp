@@ -0,0 +1,216 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+
+#include <cstring>
+
+#include "../Core/ReplayFile.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class ReplayFileTest
+		: public UnitTest::LeakDetectionFixture
+	{
+	protected:
+		static void FillReplay(ReplayFile& o_replay)
+		{
+			ReplayHeader header;
+			header.m_checksumInterval = 10;
+			header.m_seed = 77;
+			header.m_timeStep = 1.f / 60.f;
+			header.m_gridLength = 32;
+			header.m_maxObstacles = 20;
+			header.m_nSpaceships = 3;
+
+			o_replay.Reset(header);
+
+			o_replay.AddInput(CreateInput(0, 1, 1.f));
+			o_replay.AddInput(CreateInput(5, 1, 0.f));
+			o_replay.AddInput(CreateInput(5, 2, -1.f));
+			o_replay.AddInput(CreateInput(12, 3, 1.f));
+
+			o_replay.AddChecksum(0, 0xAAAA);
+			o_replay.AddChecksum(10, 0xBBBB);
+			o_replay.AddChecksum(20, 0xCCCC);
+
+			o_replay.SetTicksCount(25);
+		}
+
+		static ReplayInputRecord CreateInput(AZ::u32 i_tick, AZ::u32 i_channel, float i_value)
+		{
+			ReplayInputRecord input;
+			input.m_tick = i_tick;
+			input.m_channel = i_channel;
+			input.m_value = i_value;
+			input.m_state = 1;
+
+			return input;
+		}
+
+		static AZStd::vector<AZ::u8> ReadBytes(const char* i_filePath)
+		{
+			AZ::IO::SystemFile file;
+			if(!file.Open(i_filePath, AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+			{
+				return {};
+			}
+
+			AZStd::vector<AZ::u8> bytes(file.Length());
+			file.Read(bytes.size(), bytes.data());
+			file.Close();
+
+			return bytes;
+		}
+
+		static void WriteBytes(const char* i_filePath, const AZStd::vector<AZ::u8>& i_bytes)
+		{
+			AZ::IO::SystemFile file;
+
+			const int openMode = AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY;
+			ASSERT_TRUE(file.Open(i_filePath, openMode));
+
+			file.Write(i_bytes.data(), i_bytes.size());
+			file.Close();
+		}
+
+		static void ExpectRejected(ReplayFile& io_replay, const char* i_filePath)
+		{
+			AZ_TEST_START_TRACE_SUPPRESSION;
+			EXPECT_FALSE(io_replay.Read(i_filePath));
+			AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+			EXPECT_EQ(io_replay.GetHeader().m_seed, 0u);
+			EXPECT_TRUE(io_replay.GetInputs(5).empty());
+		}
+
+		AZ::IO::Path GetFilePath() const
+		{
+			return m_tempDirectory.Resolve("game.replay");
+		}
+
+		AZ::Test::ScopedAutoTempDirectory m_tempDirectory {};
+	};
+
+	TEST_F(ReplayFileTest, RecordsAreReadBack)
+	{
+		ReplayFile writtenReplay;
+		FillReplay(writtenReplay);
+		ASSERT_TRUE(writtenReplay.Write(GetFilePath().c_str()));
+
+		ReplayFile readReplay;
+		ASSERT_TRUE(readReplay.Read(GetFilePath().c_str()));
+
+		const ReplayHeader& header = readReplay.GetHeader();
+		EXPECT_EQ(header.m_seed, 77u);
+		EXPECT_EQ(header.m_timeStep, 1.f / 60.f);
+		EXPECT_EQ(header.m_nTicks, 25u);
+		EXPECT_EQ(header.m_gridLength, 32u);
+		EXPECT_EQ(header.m_maxObstacles, 20u);
+		EXPECT_EQ(header.m_nSpaceships, 3u);
+		EXPECT_EQ(header.m_nInputs, 4u);
+		EXPECT_EQ(header.m_nChecksums, 3u);
+
+		const AZStd::span<const ReplayInputRecord> tickInputs = readReplay.GetInputs(5);
+		ASSERT_EQ(tickInputs.size(), 2u);
+		EXPECT_EQ(tickInputs[0].m_channel, 1u);
+		EXPECT_EQ(tickInputs[1].m_channel, 2u);
+		EXPECT_EQ(tickInputs[1].m_value, -1.f);
+
+		EXPECT_EQ(readReplay.GetInputs(0).size(), 1u);
+		EXPECT_EQ(readReplay.GetInputs(12).size(), 1u);
+		EXPECT_TRUE(readReplay.GetInputs(7).empty());
+
+		AZ::u64 checksum = 0;
+		EXPECT_TRUE(readReplay.FindChecksum(10, checksum));
+		EXPECT_EQ(checksum, 0xBBBBu);
+		EXPECT_FALSE(readReplay.FindChecksum(15, checksum));
+
+		EXPECT_TRUE(readReplay.IsChecksumTick(20));
+		EXPECT_FALSE(readReplay.IsChecksumTick(21));
+	}
+
+	TEST_F(ReplayFileTest, TruncatedFileIsRejected)
+	{
+		ReplayFile replay;
+		FillReplay(replay);
+		ASSERT_TRUE(replay.Write(GetFilePath().c_str()));
+
+		AZStd::vector<AZ::u8> bytes = ReadBytes(GetFilePath().c_str());
+		bytes.resize(bytes.size() - sizeof(ReplayChecksumRecord) / 2);
+		WriteBytes(GetFilePath().c_str(), bytes);
+
+		ExpectRejected(replay, GetFilePath().c_str());
+	}
+
+	TEST_F(ReplayFileTest, CountsBeyondFileAreRejected)
+	{
+		ReplayFile replay;
+		FillReplay(replay);
+		ASSERT_TRUE(replay.Write(GetFilePath().c_str()));
+
+		AZStd::vector<AZ::u8> bytes = ReadBytes(GetFilePath().c_str());
+
+		ReplayHeader header;
+		std::memcpy(&header, bytes.data(), sizeof(ReplayHeader));
+		header.m_nInputs = 0xFFFF'FFFF;
+		std::memcpy(bytes.data(), &header, sizeof(ReplayHeader));
+
+		WriteBytes(GetFilePath().c_str(), bytes);
+
+		ExpectRejected(replay, GetFilePath().c_str());
+	}
+
+	TEST_F(ReplayFileTest, UnsortedInputsAreRejected)
+	{
+		ReplayFile replay;
+		FillReplay(replay);
+		ASSERT_TRUE(replay.Write(GetFilePath().c_str()));
+
+		AZStd::vector<AZ::u8> bytes = ReadBytes(GetFilePath().c_str());
+
+		const AZ::u32 lateTick = 100;
+		std::memcpy(bytes.data() + sizeof(ReplayHeader), &lateTick, sizeof(AZ::u32));
+
+		WriteBytes(GetFilePath().c_str(), bytes);
+
+		ExpectRejected(replay, GetFilePath().c_str());
+	}
+
+	TEST_F(ReplayFileTest, RepeatedChecksumTicksAreRejected)
+	{
+		ReplayFile replay;
+		FillReplay(replay);
+		ASSERT_TRUE(replay.Write(GetFilePath().c_str()));
+
+		AZStd::vector<AZ::u8> bytes = ReadBytes(GetFilePath().c_str());
+
+		const AZ::u32 repeatedTick = 10;
+		const AZStd::size_t lastChecksumOffset = bytes.size() - sizeof(ReplayChecksumRecord);
+		std::memcpy(bytes.data() + lastChecksumOffset, &repeatedTick, sizeof(AZ::u32));
+
+		WriteBytes(GetFilePath().c_str(), bytes);
+
+		ExpectRejected(replay, GetFilePath().c_str());
+	}
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,295 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+
+#include <cstddef>
+#include <cstring>
+
+#include "../Core/SaveFile.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class SaveFileTest
+		: public UnitTest::LeakDetectionFixture
+	{
+	protected:
+		static constexpr AZ::u16 GRID_LENGTH = 4;
+
+		static void FillSave(SaveFile& o_save)
+		{
+			SaveHeader header;
+			header.m_gridLength = GRID_LENGTH;
+			header.m_layoutSeed = 0x1234'5678'9ABCull;
+			header.m_time = 45.5f;
+			header.m_tick = 2730;
+
+			o_save.Reset(header);
+
+			SavedTiles& tiles = o_save.GetTiles();
+			for(TileCount i = 0; i < tiles.GetCount(); ++i)
+			{
+				tiles.m_energies[i] = static_cast<float>(i) * 0.5f;
+				tiles.m_noDecayTimers[i] = (i % 2 == 0) ? -1.f : static_cast<float>(i);
+				tiles.m_flags[i] = static_cast<AZ::u8>(SavedTiles::FLAG_PRESENT | ((i % 3 == 0) ? SavedTiles::FLAG_CLAIMED : 0));
+			}
+
+			SaveObstacleRecord obstacle;
+			obstacle.m_row = 1;
+			obstacle.m_column = 2;
+			obstacle.m_type = 3;
+			o_save.AddObstacle(obstacle);
+
+			SaveSpaceshipRecord spaceship;
+			spaceship.m_nameCrc = 0xCAFE;
+			spaceship.m_targetTileId = 7;
+			spaceship.m_position[0] = 10.f;
+			spaceship.m_energy = 42.f;
+			spaceship.m_flags = SaveSpaceshipRecord::FLAG_PLAYER | SaveSpaceshipRecord::FLAG_ACTIVE;
+			o_save.AddSpaceship(spaceship);
+
+			SaveStormRecord storm;
+			storm.m_position[1] = 5.f;
+			storm.m_strength = 3.f;
+			storm.m_timer = 1.5f;
+			o_save.AddStorm(storm);
+
+			SaveCollectableRecord collectable;
+			collectable.m_type = 2;
+			collectable.m_tileId = 9;
+			collectable.m_timer = 4.f;
+			o_save.AddCollectable(collectable);
+
+			SaveScoreRecord score;
+			score.m_totalPoints = 1500;
+			score.m_nClaimedTiles = 6;
+			score.m_isIntegrating = 1;
+			o_save.SetScore(score);
+
+			o_save.SetPool(SavePool::LAYOUT, 11, 0, 0.f);
+			o_save.SetPool(SavePool::STORMS, 22, 5, 2.5f);
+			o_save.SetPool(SavePool::COLLECTABLES, 33, 8, 0.75f);
+		}
+
+		static AZStd::vector<AZ::u8> ReadBytes(const char* i_filePath)
+		{
+			AZ::IO::SystemFile file;
+			if(!file.Open(i_filePath, AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+			{
+				return {};
+			}
+
+			AZStd::vector<AZ::u8> bytes(file.Length());
+			file.Read(bytes.size(), bytes.data());
+			file.Close();
+
+			return bytes;
+		}
+
+		static void WriteBytes(const char* i_filePath, const AZStd::vector<AZ::u8>& i_bytes)
+		{
+			AZ::IO::SystemFile file;
+
+			const int openMode = AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY;
+			ASSERT_TRUE(file.Open(i_filePath, openMode));
+
+			file.Write(i_bytes.data(), i_bytes.size());
+			file.Close();
+		}
+
+		static void InsertChunk(AZStd::vector<AZ::u8>& io_bytes, AZStd::size_t i_position, AZ::u32 i_payloadSize, AZ::u32 i_declaredSize)
+		{
+			SaveChunkHeader chunk;
+			chunk.m_tag = 0x5254'5841; // "AXTR"
+			chunk.m_size = i_declaredSize;
+
+			AZStd::vector<AZ::u8> chunkBytes(sizeof(SaveChunkHeader) + i_payloadSize, 0xAB);
+			std::memcpy(chunkBytes.data(), &chunk, sizeof(SaveChunkHeader));
+
+			io_bytes.insert(io_bytes.begin() + i_position, chunkBytes.begin(), chunkBytes.end());
+
+			SaveHeader header;
+			std::memcpy(&header, io_bytes.data(), sizeof(SaveHeader));
+			++header.m_nChunks;
+			std::memcpy(io_bytes.data(), &header, sizeof(SaveHeader));
+		}
+
+		static void ExpectRejected(SaveFile& io_save, const char* i_filePath)
+		{
+			AZ_TEST_START_TRACE_SUPPRESSION;
+			EXPECT_FALSE(io_save.Read(i_filePath));
+			AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+			EXPECT_EQ(io_save.GetHeader().m_gridLength, 0u);
+			EXPECT_EQ(io_save.GetTiles().GetCount(), 0u);
+			EXPECT_TRUE(io_save.GetSpaceships().empty());
+		}
+
+		AZ::IO::Path GetFilePath() const
+		{
+			return m_tempDirectory.Resolve("game.save");
+		}
+
+		AZ::Test::ScopedAutoTempDirectory m_tempDirectory {};
+	};
+
+	TEST_F(SaveFileTest, EveryChunkIsReadBack)
+	{
+		SaveFile writtenSave;
+		FillSave(writtenSave);
+		ASSERT_TRUE(writtenSave.Write(GetFilePath().c_str()));
+
+		SaveFile readSave;
+		ASSERT_TRUE(readSave.Read(GetFilePath().c_str()));
+
+		const SaveHeader& header = readSave.GetHeader();
+		EXPECT_EQ(header.m_gridLength, GRID_LENGTH);
+		EXPECT_EQ(header.m_layoutSeed, writtenSave.GetHeader().m_layoutSeed);
+		EXPECT_EQ(header.m_time, 45.5f);
+		EXPECT_EQ(header.m_tick, 2730u);
+
+		const SavedTiles& writtenTiles = writtenSave.GetTiles();
+		const SavedTiles& readTiles = readSave.GetTiles();
+		ASSERT_EQ(readTiles.GetCount(), GRID_LENGTH * GRID_LENGTH);
+		EXPECT_EQ(readTiles.m_energies, writtenTiles.m_energies);
+		EXPECT_EQ(readTiles.m_noDecayTimers, writtenTiles.m_noDecayTimers);
+		EXPECT_EQ(readTiles.m_flags, writtenTiles.m_flags);
+
+		ASSERT_EQ(readSave.GetObstacles().size(), 1u);
+		EXPECT_EQ(readSave.GetObstacles()[0].m_row, 1u);
+		EXPECT_EQ(readSave.GetObstacles()[0].m_column, 2u);
+		EXPECT_EQ(readSave.GetObstacles()[0].m_type, 3u);
+
+		const SaveSpaceshipRecord* spaceship = readSave.FindSpaceship(0xCAFE);
+		ASSERT_NE(spaceship, nullptr);
+		EXPECT_EQ(spaceship->m_targetTileId, 7u);
+		EXPECT_EQ(spaceship->m_position[0], 10.f);
+		EXPECT_EQ(spaceship->m_energy, 42.f);
+		EXPECT_EQ(spaceship->m_flags, SaveSpaceshipRecord::FLAG_PLAYER | SaveSpaceshipRecord::FLAG_ACTIVE);
+		EXPECT_EQ(readSave.FindSpaceship(0xBEEF), nullptr);
+
+		ASSERT_EQ(readSave.GetStorms().size(), 1u);
+		EXPECT_EQ(readSave.GetStorms()[0].m_position[1], 5.f);
+		EXPECT_EQ(readSave.GetStorms()[0].m_strength, 3.f);
+		EXPECT_EQ(readSave.GetStorms()[0].m_timer, 1.5f);
+
+		ASSERT_EQ(readSave.GetCollectables().size(), 1u);
+		EXPECT_EQ(readSave.GetCollectables()[0].m_type, 2u);
+		EXPECT_EQ(readSave.GetCollectables()[0].m_tileId, 9u);
+		EXPECT_EQ(readSave.GetCollectables()[0].m_timer, 4.f);
+
+		EXPECT_EQ(readSave.GetScore().m_totalPoints, 1500u);
+		EXPECT_EQ(readSave.GetScore().m_nClaimedTiles, 6u);
+		EXPECT_EQ(readSave.GetScore().m_isIntegrating, 1u);
+
+		const SavePoolRecord* stormsPool = readSave.FindPool(SavePool::STORMS);
+		ASSERT_NE(stormsPool, nullptr);
+		EXPECT_EQ(stormsPool->m_seed, 22u);
+		EXPECT_EQ(stormsPool->m_counter, 5u);
+		EXPECT_EQ(stormsPool->m_timer, 2.5f);
+
+		const SavePoolRecord* collectablesPool = readSave.FindPool(SavePool::COLLECTABLES);
+		ASSERT_NE(collectablesPool, nullptr);
+		EXPECT_EQ(collectablesPool->m_seed, 33u);
+		EXPECT_EQ(collectablesPool->m_counter, 8u);
+
+		EXPECT_NE(readSave.FindPool(SavePool::LAYOUT), nullptr);
+	}
+
+	TEST_F(SaveFileTest, UnknownChunksAreSkipped)
+	{
+		SaveFile writtenSave;
+		FillSave(writtenSave);
+		ASSERT_TRUE(writtenSave.Write(GetFilePath().c_str()));
+
+		// placed before all the known chunks, so that they are read only if the unknown one is skipped correctly
+		AZStd::vector<AZ::u8> bytes = ReadBytes(GetFilePath().c_str());
+		InsertChunk(bytes, sizeof(SaveHeader), 12, 12);
+		WriteBytes(GetFilePath().c_str(), bytes);
+
+		SaveFile readSave;
+		ASSERT_TRUE(readSave.Read(GetFilePath().c_str()));
+
+		EXPECT_EQ(readSave.GetHeader().m_nChunks, 10u);
+		EXPECT_EQ(readSave.GetTiles().m_energies, writtenSave.GetTiles().m_energies);
+		EXPECT_EQ(readSave.GetScore().m_totalPoints, 1500u);
+		EXPECT_NE(readSave.FindPool(SavePool::COLLECTABLES), nullptr);
+	}
+
+	TEST_F(SaveFileTest, TruncatedFileIsRejected)
+	{
+		SaveFile save;
+		FillSave(save);
+		ASSERT_TRUE(save.Write(GetFilePath().c_str()));
+
+		AZStd::vector<AZ::u8> bytes = ReadBytes(GetFilePath().c_str());
+		bytes.resize(bytes.size() - 4);
+		WriteBytes(GetFilePath().c_str(), bytes);
+
+		ExpectRejected(save, GetFilePath().c_str());
+	}
+
+	TEST_F(SaveFileTest, ChunkLargerThanFileIsRejected)
+	{
+		SaveFile save;
+		FillSave(save);
+		ASSERT_TRUE(save.Write(GetFilePath().c_str()));
+
+		AZStd::vector<AZ::u8> bytes = ReadBytes(GetFilePath().c_str());
+
+		SaveChunkHeader chunk;
+		std::memcpy(&chunk, bytes.data() + sizeof(SaveHeader), sizeof(SaveChunkHeader));
+		chunk.m_size = 0xFFFF'FFF0;
+		std::memcpy(bytes.data() + sizeof(SaveHeader), &chunk, sizeof(SaveChunkHeader));
+
+		WriteBytes(GetFilePath().c_str(), bytes);
+
+		ExpectRejected(save, GetFilePath().c_str());
+	}
+
+	TEST_F(SaveFileTest, UnknownChunkLargerThanFileIsRejected)
+	{
+		SaveFile save;
+		FillSave(save);
+		ASSERT_TRUE(save.Write(GetFilePath().c_str()));
+
+		AZStd::vector<AZ::u8> bytes = ReadBytes(GetFilePath().c_str());
+		InsertChunk(bytes, bytes.size(), 4, 0x0100'0000);
+		WriteBytes(GetFilePath().c_str(), bytes);
+
+		ExpectRejected(save, GetFilePath().c_str());
+	}
+
+	TEST_F(SaveFileTest, WrongMagicIsRejected)
+	{
+		SaveFile save;
+		FillSave(save);
+		ASSERT_TRUE(save.Write(GetFilePath().c_str()));
+
+		AZStd::vector<AZ::u8> bytes = ReadBytes(GetFilePath().c_str());
+		bytes[0] = 'X';
+		WriteBytes(GetFilePath().c_str(), bytes);
+
+		ExpectRejected(save, GetFilePath().c_str());
+	}
+
+} // Loherangrin::Games::O3DEJam2305
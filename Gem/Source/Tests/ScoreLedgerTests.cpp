@@ -0,0 +1,186 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <AzTest/AzTest.h>
+
+#include "../Core/SaveFile.hpp"
+#include "../Core/ScoreLedger.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class ScoreLedgerTest
+		: public UnitTest::LeakDetectionFixture
+	{
+	protected:
+		static constexpr ScoreLedger::Points TILE_POINTS = 3;
+		static constexpr ScoreLedger::TimeMs TILE_PERIOD = 5000;
+
+		static ScoreLedger CreateLedger(ScoreLedger::TimeMs i_now)
+		{
+			ScoreLedger ledger;
+			ledger.Configure(TILE_POINTS, TILE_PERIOD);
+			ledger.Start(i_now);
+
+			return ledger;
+		}
+	};
+
+	TEST_F(ScoreLedgerTest, ClaimedTilesPayEveryPeriod)
+	{
+		ScoreLedger ledger = CreateLedger(1000);
+
+		ledger.ClaimTile(1000);
+		ledger.ClaimTile(1000);
+
+		ledger.Settle(1000 + TILE_PERIOD);
+		EXPECT_EQ(ledger.GetTotalPoints(), 2u * TILE_POINTS);
+
+		ledger.Settle(1000 + 3 * TILE_PERIOD);
+		EXPECT_EQ(ledger.GetTotalPoints(), 6u * TILE_POINTS);
+		EXPECT_EQ(ledger.GetClaimedTiles(), 2u);
+	}
+
+	TEST_F(ScoreLedgerTest, ClaimsAndLossesAreIntegratedExactly)
+	{
+		ScoreLedger ledger = CreateLedger(0);
+
+		// one tile for 2 s, three tiles for 1 s, then two tiles for 4 s: 2 + 3 + 8 = 13 tile seconds
+		ledger.ClaimTile(0);
+		ledger.ClaimTile(2000);
+		ledger.ClaimTile(2000);
+		EXPECT_TRUE(ledger.LoseTile(3000));
+
+		ledger.Settle(7000);
+		EXPECT_EQ(ledger.GetTotalPoints(), (13000u * TILE_POINTS) / TILE_PERIOD);
+
+		EXPECT_TRUE(ledger.LoseTile(7000));
+		EXPECT_TRUE(ledger.LoseTile(7000));
+		EXPECT_FALSE(ledger.LoseTile(7000));
+
+		// no tile is claimed anymore, so time alone does not pay anything
+		ledger.Settle(100000);
+		EXPECT_EQ(ledger.GetTotalPoints(), (13000u * TILE_POINTS) / TILE_PERIOD);
+	}
+
+	TEST_F(ScoreLedgerTest, FractionsOfPeriodsAddUp)
+	{
+		ScoreLedger ledger = CreateLedger(0);
+
+		// a third of a period is not enough for a whole point, but three of them pay all the tile points
+		ledger.ClaimTile(0);
+		EXPECT_TRUE(ledger.LoseTile(TILE_PERIOD / 3));
+
+		ledger.Settle(TILE_PERIOD);
+		EXPECT_EQ(ledger.GetTotalPoints(), 0u);
+
+		ledger.ClaimTile(TILE_PERIOD);
+		EXPECT_TRUE(ledger.LoseTile(TILE_PERIOD + TILE_PERIOD / 3));
+
+		ledger.ClaimTile(2 * TILE_PERIOD);
+		EXPECT_TRUE(ledger.LoseTile(2 * TILE_PERIOD + TILE_PERIOD - 2 * (TILE_PERIOD / 3)));
+
+		ledger.Settle(3 * TILE_PERIOD);
+		EXPECT_EQ(ledger.GetTotalPoints(), TILE_POINTS);
+	}
+
+	TEST_F(ScoreLedgerTest, SettlingOftenPaysAsMuchAsSettlingOnce)
+	{
+		ScoreLedger frequentLedger = CreateLedger(0);
+		ScoreLedger finalLedger = CreateLedger(0);
+
+		frequentLedger.ClaimTile(0);
+		finalLedger.ClaimTile(0);
+
+		// a settle every 16 ms never loses the fraction left over by the previous one
+		for(ScoreLedger::TimeMs now = 0; now <= 12345; now += 16)
+		{
+			frequentLedger.Settle(now);
+		}
+
+		frequentLedger.Stop(12345);
+		finalLedger.Stop(12345);
+
+		EXPECT_EQ(frequentLedger.GetTotalPoints(), (12345u * TILE_POINTS) / TILE_PERIOD);
+		EXPECT_EQ(frequentLedger.GetTotalPoints(), finalLedger.GetTotalPoints());
+	}
+
+	TEST_F(ScoreLedgerTest, PausesAreNotIntegrated)
+	{
+		ScoreLedger ledger = CreateLedger(0);
+
+		ledger.ClaimTile(0);
+		ledger.Settle(TILE_PERIOD / 2);
+
+		ledger.Pause(TILE_PERIOD / 2);
+		EXPECT_FALSE(ledger.IsIntegrating());
+
+		// tiles can still change during a pause, without paying for it
+		ledger.ClaimTile(10 * TILE_PERIOD);
+		ledger.Settle(20 * TILE_PERIOD);
+		EXPECT_EQ(ledger.GetTotalPoints(), 1u);
+
+		ledger.Resume(20 * TILE_PERIOD);
+		EXPECT_TRUE(ledger.IsIntegrating());
+
+		// half a period with one tile before the pause, and one with two tiles after it
+		ledger.Settle(20 * TILE_PERIOD + TILE_PERIOD / 2);
+		EXPECT_EQ(ledger.GetTotalPoints(), (3u * TILE_POINTS) / 2);
+	}
+
+	TEST_F(ScoreLedgerTest, CollectedPointsAreAddedRightAway)
+	{
+		ScoreLedger ledger = CreateLedger(0);
+
+		ledger.AddPoints(7);
+		EXPECT_EQ(ledger.GetTotalPoints(), 7u);
+
+		ledger.ClaimTile(0);
+		ledger.Stop(TILE_PERIOD);
+		EXPECT_EQ(ledger.GetTotalPoints(), 7u + TILE_POINTS);
+
+		// a stopped ledger does not integrate anymore
+		ledger.Settle(10 * TILE_PERIOD);
+		EXPECT_EQ(ledger.GetTotalPoints(), 7u + TILE_POINTS);
+	}
+
+	TEST_F(ScoreLedgerTest, RestoredLedgerGoesOnFromAnyClock)
+	{
+		ScoreLedger ledger = CreateLedger(0);
+
+		ledger.ClaimTile(0);
+		ledger.ClaimTile(1000);
+		ledger.Settle(2000);
+
+		SaveScoreRecord record;
+		ledger.Save(2500, record);
+
+		// the restored game runs on a clock that started again from a different time
+		ScoreLedger restoredLedger;
+		restoredLedger.Configure(TILE_POINTS, TILE_PERIOD);
+		restoredLedger.Restore(record, 100000);
+
+		ledger.Settle(2500 + TILE_PERIOD);
+		restoredLedger.Settle(100000 + TILE_PERIOD);
+
+		EXPECT_EQ(restoredLedger.GetTotalPoints(), ledger.GetTotalPoints());
+		EXPECT_EQ(restoredLedger.GetClaimedTiles(), 2u);
+		EXPECT_TRUE(restoredLedger.IsIntegrating());
+	}
+
+} // Loherangrin::Games::O3DEJam2305
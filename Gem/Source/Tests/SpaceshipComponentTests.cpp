@@ -0,0 +1,127 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Crc.h>
+
+#include "../Core/SaveFile.hpp"
+#include "../EBuses/CollectableBus.hpp"
+#include "../EBuses/GameBus.hpp"
+#include "../EBuses/SaveGameBus.hpp"
+#include "../EBuses/SpaceshipBus.hpp"
+#include "../EBuses/TileBus.hpp"
+#include "GameTestFixture.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class SpaceshipComponentTest
+		: public GameTestFixture
+	{
+	protected:
+		static float GetNormalizedEnergy(const AZ::EntityId& i_spaceshipEntityId)
+		{
+			float energy { -1.f };
+			EBUS_EVENT_ID_RESULT(energy, i_spaceshipEntityId, SpaceshipRequestBus, GetNormalizedEnergy);
+
+			return energy;
+		}
+
+		// the claimed tile below the spaceship, as recorded when the game is saved
+		static AZ::u32 SaveLandingTileId(const AZ::EntityId& i_spaceshipEntityId, const AZ::Vector3& i_position)
+		{
+			EBUS_EVENT_ID(i_spaceshipEntityId, AZ::TransformBus, SetWorldTranslation, i_position);
+
+			SaveFile save;
+			EBUS_EVENT(SaveGameNotificationBus, OnGameSaving, save);
+
+			const SaveSpaceshipRecord* record = save.FindSpaceship(AZ::Crc32 { "Spaceship" });
+			if(!record)
+			{
+				ADD_FAILURE() << "Spaceship was not saved";
+				return 0;
+			}
+
+			return record->m_targetTileId;
+		}
+	};
+
+	TEST_F(SpaceshipComponentTest, GameLoadingRefillsEnergy)
+	{
+		const AZ::EntityId spaceshipEntityId = CreateSpaceship()->GetId();
+
+		EBUS_EVENT(GameNotificationBus, OnGameLoading);
+
+		EXPECT_FLOAT_EQ(GetNormalizedEnergy(spaceshipEntityId), 1.f);
+	}
+
+	TEST_F(SpaceshipComponentTest, EnergyCollectedRechargesSpaceship)
+	{
+		const AZ::EntityId spaceshipEntityId = CreateSpaceship()->GetId();
+
+		EBUS_EVENT(GameNotificationBus, OnGameLoading);
+		EBUS_EVENT_ID(spaceshipEntityId, SpaceshipRequestBus, SubtractEnergy, 50.f);
+
+		EBUS_EVENT(CollectablesNotificationBus, OnSpaceshipEnergyCollected, spaceshipEntityId, 20.f);
+
+		EXPECT_NEAR(GetNormalizedEnergy(spaceshipEntityId), 0.7f, 0.001f);
+	}
+
+	TEST_F(SpaceshipComponentTest, EnergyCollectedIgnoresOtherSpaceships)
+	{
+		const AZ::EntityId collectingEntityId = CreateSpaceship()->GetId();
+		const AZ::EntityId otherEntityId = CreateSpaceship()->GetId();
+
+		EBUS_EVENT(GameNotificationBus, OnGameLoading);
+		EBUS_EVENT_ID(otherEntityId, SpaceshipRequestBus, SubtractEnergy, 50.f);
+
+		EBUS_EVENT(CollectablesNotificationBus, OnSpaceshipEnergyCollected, collectingEntityId, 20.f);
+
+		EXPECT_NEAR(GetNormalizedEnergy(otherEntityId), 0.5f, 0.001f);
+	}
+
+	TEST_F(SpaceshipComponentTest, LandingTileIsTheClaimedCellBelow)
+	{
+		static constexpr AZ::u16 GRID_LENGTH = 11;
+
+		CreateTilesPool(GRID_LENGTH, 1234);
+		const AZ::EntityId spaceshipEntityId = CreateSpaceship()->GetId();
+
+		EBUS_EVENT(GameNotificationBus, OnGameLoading);
+		ProcessSpawns();
+
+		TileId startTileId { INVALID_TILE_ID };
+		EBUS_EVENT_RESULT(startTileId, TilesRequestBus, FindNearestClaimedLandingArea, AZ::Vector3::CreateZero());
+		ASSERT_NE(startTileId, INVALID_TILE_ID);
+
+		AZ::Vector3 tilePosition { AZ::Vector3::CreateZero() };
+		EBUS_EVENT_RESULT(tilePosition, TilesRequestBus, GetTilePosition, startTileId);
+
+		AZ::Vector2 gridSize { AZ::Vector2::CreateZero() };
+		EBUS_EVENT_RESULT(gridSize, TilesRequestBus, GetGridSize);
+
+		const AZ::Vector2 cellSize = gridSize / static_cast<float>(GRID_LENGTH);
+
+		// the cell is looked up from the position alone, up to its edges and at any height
+		const AZ::Vector3 insidePosition = tilePosition + AZ::Vector3 { cellSize.GetX() * 0.45f, -cellSize.GetY() * 0.45f, 5.f };
+		EXPECT_EQ(SaveLandingTileId(spaceshipEntityId, insidePosition), static_cast<AZ::u32>(startTileId));
+
+		// only the landing area of the start is claimed, so the cells around it never are
+		const AZ::Vector3 outsidePosition = tilePosition + AZ::Vector3 { cellSize.GetX() * 0.55f, 0.f, 0.f };
+		EXPECT_EQ(SaveLandingTileId(spaceshipEntityId, outsidePosition), static_cast<AZ::u32>(INVALID_TILE_ID));
+	}
+
+} // Loherangrin::Games::O3DEJam2305
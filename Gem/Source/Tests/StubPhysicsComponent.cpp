@@ -0,0 +1,60 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Serialization/SerializeContext.h>
+
+#include "StubPhysicsComponent.hpp"
+
+using Loherangrin::Games::O3DEJam2305::StubPhysicsComponent;
+
+
+void StubPhysicsComponent::Reflect(AZ::ReflectContext* io_context)
+{
+	if(auto serializeContext = azrtti_cast<AZ::SerializeContext*>(io_context))
+	{
+		serializeContext->Class<StubPhysicsComponent, AZ::Component>()
+			->Version(0)
+		;
+	}
+}
+
+void StubPhysicsComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& io_provided)
+{
+	io_provided.push_back(AZ_CRC_CE("PhysicsCharacterControllerService"));
+	io_provided.push_back(AZ_CRC_CE("PhysicsRigidBodyService"));
+	io_provided.push_back(AZ_CRC_CE("PhysicsTriggerService"));
+}
+
+void StubPhysicsComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& io_incompatible)
+{
+	io_incompatible.push_back(AZ_CRC_CE("PhysicsCharacterControllerService"));
+	io_incompatible.push_back(AZ_CRC_CE("PhysicsRigidBodyService"));
+	io_incompatible.push_back(AZ_CRC_CE("PhysicsTriggerService"));
+}
+
+void StubPhysicsComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& io_required)
+{
+	io_required.push_back(AZ_CRC_CE("TransformService"));
+}
+
+void StubPhysicsComponent::GetDependentServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& io_dependent)
+{}
+
+void StubPhysicsComponent::Activate()
+{}
+
+void StubPhysicsComponent::Deactivate()
+{}
@@ -0,0 +1,303 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/algorithm.h>
+
+#include "StubSpawnableEntities.hpp"
+
+using Loherangrin::Games::O3DEJam2305::StubSpawnableEntities;
+
+
+StubSpawnableEntities::StubSpawnableEntities()
+{
+	AzFramework::SpawnableEntitiesInterface::Register(this);
+}
+
+StubSpawnableEntities::~StubSpawnableEntities()
+{
+	AzFramework::SpawnableEntitiesInterface::Unregister(this);
+
+	for(auto& [ticketId, ticket] : m_tickets)
+	{
+		for(AZ::Entity* entity : ticket->m_entities)
+		{
+			DestroyEntity(entity);
+		}
+	}
+}
+
+void StubSpawnableEntities::SetEntityFactory(EntityFactory i_factory)
+{
+	m_entityFactory = AZStd::move(i_factory);
+}
+
+void StubSpawnableEntities::ProcessRequests()
+{
+	// requests may queue further requests from their callbacks
+	while(!m_requests.empty())
+	{
+		Request request = AZStd::move(m_requests.front());
+		m_requests.pop_front();
+
+		request();
+	}
+}
+
+AZStd::size_t StubSpawnableEntities::GetSpawnedEntitiesCount() const
+{
+	AZStd::size_t nEntities = 0;
+	for(const auto& [ticketId, ticket] : m_tickets)
+	{
+		nEntities += ticket->m_entities.size();
+	}
+
+	return nEntities;
+}
+
+void StubSpawnableEntities::SpawnAllEntities(AzFramework::EntitySpawnTicket& io_ticket, AzFramework::SpawnAllEntitiesOptionalArgs i_optionalArgs)
+{
+	Ticket* ticket = FindTicket(io_ticket);
+
+	QueueRequest(ticket, [this, ticket, optionalArgs = AZStd::move(i_optionalArgs)]()
+	{
+		AZStd::vector<AZ::Entity*> newEntities = (m_entityFactory) ? m_entityFactory() : AZStd::vector<AZ::Entity*> {};
+
+		if(optionalArgs.m_preInsertionCallback)
+		{
+			optionalArgs.m_preInsertionCallback(ticket->m_id, AzFramework::SpawnableEntityContainerView { newEntities.data(), newEntities.size() });
+		}
+
+		for(AZ::Entity* newEntity : newEntities)
+		{
+			newEntity->Init();
+			newEntity->Activate();
+
+			ticket->m_entities.push_back(newEntity);
+		}
+
+		m_onSpawnedEvent.Signal(ticket->m_spawnable);
+
+		if(optionalArgs.m_completionCallback)
+		{
+			optionalArgs.m_completionCallback(ticket->m_id, AzFramework::SpawnableConstEntityContainerView { newEntities.data(), newEntities.size() });
+		}
+	});
+}
+
+void StubSpawnableEntities::SpawnEntities(AzFramework::EntitySpawnTicket& io_ticket, [[maybe_unused]] AZStd::vector<uint32_t> i_entityIndices, AzFramework::SpawnEntitiesOptionalArgs i_optionalArgs)
+{
+	// the gem always spawns whole prefabs, so single entities are spawned as none
+	Ticket* ticket = FindTicket(io_ticket);
+
+	QueueRequest(ticket, [ticket, optionalArgs = AZStd::move(i_optionalArgs)]()
+	{
+		if(optionalArgs.m_completionCallback)
+		{
+			optionalArgs.m_completionCallback(ticket->m_id, AzFramework::SpawnableConstEntityContainerView { nullptr, 0 });
+		}
+	});
+}
+
+void StubSpawnableEntities::DespawnAllEntities(AzFramework::EntitySpawnTicket& io_ticket, AzFramework::DespawnAllEntitiesOptionalArgs i_optionalArgs)
+{
+	Ticket* ticket = FindTicket(io_ticket);
+
+	QueueRequest(ticket, [this, ticket, optionalArgs = AZStd::move(i_optionalArgs)]()
+	{
+		for(AZ::Entity* entity : ticket->m_entities)
+		{
+			DestroyEntity(entity);
+		}
+
+		ticket->m_entities.clear();
+
+		m_onDespawnedEvent.Signal(ticket->m_spawnable);
+
+		if(optionalArgs.m_completionCallback)
+		{
+			optionalArgs.m_completionCallback(ticket->m_id);
+		}
+	});
+}
+
+void StubSpawnableEntities::DespawnEntity(AZ::EntityId i_entityId, AzFramework::EntitySpawnTicket& io_ticket, AzFramework::DespawnEntityOptionalArgs i_optionalArgs)
+{
+	Ticket* ticket = FindTicket(io_ticket);
+
+	QueueRequest(ticket, [ticket, i_entityId, optionalArgs = AZStd::move(i_optionalArgs)]()
+	{
+		auto entityIt = AZStd::find_if(ticket->m_entities.begin(), ticket->m_entities.end(), [i_entityId](const AZ::Entity* i_entity)
+		{
+			return (i_entity->GetId() == i_entityId);
+		});
+
+		if(entityIt != ticket->m_entities.end())
+		{
+			DestroyEntity(*entityIt);
+			ticket->m_entities.erase(entityIt);
+		}
+
+		if(optionalArgs.m_completionCallback)
+		{
+			optionalArgs.m_completionCallback(ticket->m_id);
+		}
+	});
+}
+
+void StubSpawnableEntities::RetrieveTicket([[maybe_unused]] AzFramework::EntitySpawnTicket::Id i_ticketId, [[maybe_unused]] AzFramework::RetrieveEntitySpawnTicketCallback i_callback, [[maybe_unused]] AzFramework::RetrieveTicketOptionalArgs i_optionalArgs)
+{
+	AZ_Assert(false, "Retrieving tickets is not supported by the stub spawnable system");
+}
+
+void StubSpawnableEntities::ReloadSpawnable([[maybe_unused]] AzFramework::EntitySpawnTicket& io_ticket, [[maybe_unused]] AZ::Data::Asset<AzFramework::Spawnable> i_spawnable, [[maybe_unused]] AzFramework::ReloadSpawnableOptionalArgs i_optionalArgs)
+{
+	AZ_Assert(false, "Reloading spawnables is not supported by the stub spawnable system");
+}
+
+void StubSpawnableEntities::UpdateEntityAliasTypes([[maybe_unused]] AzFramework::EntitySpawnTicket& io_ticket, [[maybe_unused]] AZStd::vector<AzFramework::EntityAliasTypeChange> i_updatedAliases, [[maybe_unused]] AzFramework::UpdateEntityAliasTypesOptionalArgs i_optionalArgs)
+{
+	AZ_Assert(false, "Entity aliases are not supported by the stub spawnable system");
+}
+
+void StubSpawnableEntities::ListEntities(AzFramework::EntitySpawnTicket& io_ticket, AzFramework::ListEntitiesCallback i_listCallback, [[maybe_unused]] AzFramework::ListEntitiesOptionalArgs i_optionalArgs)
+{
+	Ticket* ticket = FindTicket(io_ticket);
+
+	QueueRequest(ticket, [ticket, listCallback = AZStd::move(i_listCallback)]()
+	{
+		listCallback(ticket->m_id, AzFramework::SpawnableConstEntityContainerView { ticket->m_entities.data(), ticket->m_entities.size() });
+	});
+}
+
+void StubSpawnableEntities::ListIndicesAndEntities([[maybe_unused]] AzFramework::EntitySpawnTicket& io_ticket, [[maybe_unused]] AzFramework::ListIndicesEntitiesCallback i_listCallback, [[maybe_unused]] AzFramework::ListEntitiesOptionalArgs i_optionalArgs)
+{
+	AZ_Assert(false, "Entity indices are not supported by the stub spawnable system");
+}
+
+void StubSpawnableEntities::ClaimEntities(AzFramework::EntitySpawnTicket& io_ticket, AzFramework::ClaimEntitiesCallback i_listCallback, [[maybe_unused]] AzFramework::ClaimEntitiesOptionalArgs i_optionalArgs)
+{
+	Ticket* ticket = FindTicket(io_ticket);
+
+	QueueRequest(ticket, [ticket, listCallback = AZStd::move(i_listCallback)]()
+	{
+		listCallback(ticket->m_id, AzFramework::SpawnableEntityContainerView { ticket->m_entities.data(), ticket->m_entities.size() });
+
+		// claimed entities belong to the caller from now on
+		ticket->m_entities.clear();
+	});
+}
+
+void StubSpawnableEntities::Barrier(AzFramework::EntitySpawnTicket& io_ticket, AzFramework::BarrierCallback i_completionCallback, [[maybe_unused]] AzFramework::BarrierOptionalArgs i_optionalArgs)
+{
+	Ticket* ticket = FindTicket(io_ticket);
+
+	QueueRequest(ticket, [ticket, completionCallback = AZStd::move(i_completionCallback)]()
+	{
+		completionCallback(ticket->m_id);
+	});
+}
+
+void StubSpawnableEntities::LoadBarrier(AzFramework::EntitySpawnTicket& io_ticket, AzFramework::BarrierCallback i_completionCallback, [[maybe_unused]] AzFramework::LoadBarrierOptionalArgs i_optionalArgs)
+{
+	// nothing has to be loaded, so this is the same as a barrier
+	Barrier(io_ticket, AZStd::move(i_completionCallback));
+}
+
+void StubSpawnableEntities::AddOnSpawnedHandler(AZ::Event<AZ::Data::Asset<AzFramework::Spawnable>>::Handler& io_handler)
+{
+	io_handler.Connect(m_onSpawnedEvent);
+}
+
+void StubSpawnableEntities::AddOnDespawnedHandler(AZ::Event<AZ::Data::Asset<AzFramework::Spawnable>>::Handler& io_handler)
+{
+	io_handler.Connect(m_onDespawnedEvent);
+}
+
+AZStd::pair<AzFramework::EntitySpawnTicket::Id, void*> StubSpawnableEntities::CreateTicket(AZ::Data::Asset<AzFramework::Spawnable>&& i_spawnable)
+{
+	auto ticket = AZStd::make_unique<Ticket>();
+	ticket->m_id = m_nextTicketId++;
+	ticket->m_spawnable = AZStd::move(i_spawnable);
+
+	const AzFramework::EntitySpawnTicket::Id ticketId = ticket->m_id;
+	Ticket* ticketPayload = ticket.get();
+
+	m_tickets[ticketId] = AZStd::move(ticket);
+
+	return { ticketId, ticketPayload };
+}
+
+void StubSpawnableEntities::IncrementTicketReference(void* io_ticket)
+{
+	++(reinterpret_cast<Ticket*>(io_ticket)->m_nReferences);
+}
+
+void StubSpawnableEntities::DecrementTicketReference(void* io_ticket)
+{
+	auto ticket = reinterpret_cast<Ticket*>(io_ticket);
+	if(--ticket->m_nReferences > 0)
+	{
+		return;
+	}
+
+	for(AZ::Entity* entity : ticket->m_entities)
+	{
+		DestroyEntity(entity);
+	}
+
+	m_tickets.erase(ticket->m_id);
+}
+
+AzFramework::EntitySpawnTicket::Id StubSpawnableEntities::GetTicketId(void* i_ticket)
+{
+	return reinterpret_cast<Ticket*>(i_ticket)->m_id;
+}
+
+const AZ::Data::Asset<AzFramework::Spawnable>& StubSpawnableEntities::GetSpawnableOnTicket(void* i_ticket) const
+{
+	return reinterpret_cast<Ticket*>(i_ticket)->m_spawnable;
+}
+
+StubSpawnableEntities::Ticket* StubSpawnableEntities::FindTicket(const AzFramework::EntitySpawnTicket& i_ticket) const
+{
+	auto ticketIt = m_tickets.find(i_ticket.GetId());
+	AZ_Assert(ticketIt != m_tickets.end(), "Ticket was not created by the stub spawnable system");
+
+	return ticketIt->second.get();
+}
+
+void StubSpawnableEntities::QueueRequest(Ticket* io_ticket, Request&& i_request)
+{
+	// as in the real system, a queued request keeps its ticket alive
+	IncrementTicketReference(io_ticket);
+
+	m_requests.push_back([this, io_ticket, request = AZStd::move(i_request)]()
+	{
+		request();
+		DecrementTicketReference(io_ticket);
+	});
+}
+
+void StubSpawnableEntities::DestroyEntity(AZ::Entity* io_entity)
+{
+	if(io_entity->GetState() == AZ::Entity::State::Active)
+	{
+		io_entity->Deactivate();
+	}
+
+	delete io_entity;
+}
@@ -0,0 +1,100 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Spawnable system that builds every spawn from a factory instead of loading prefabs.
+	// Requests are queued as in the real system, and they are only carried out by ProcessRequests.
+	class StubSpawnableEntities
+		: public AzFramework::SpawnableEntitiesDefinition
+	{
+	public:
+		// the first entity is the root one, as in a prefab
+		using EntityFactory = AZStd::function<AZStd::vector<AZ::Entity*>()>;
+
+		StubSpawnableEntities();
+		~StubSpawnableEntities() override;
+
+		void SetEntityFactory(EntityFactory i_factory);
+		void ProcessRequests();
+
+		AZStd::size_t GetSpawnedEntitiesCount() const;
+
+		// AzFramework::SpawnableEntitiesDefinition
+		void SpawnAllEntities(AzFramework::EntitySpawnTicket& io_ticket, AzFramework::SpawnAllEntitiesOptionalArgs i_optionalArgs = {}) override;
+		void SpawnEntities(AzFramework::EntitySpawnTicket& io_ticket, AZStd::vector<uint32_t> i_entityIndices, AzFramework::SpawnEntitiesOptionalArgs i_optionalArgs = {}) override;
+		void DespawnAllEntities(AzFramework::EntitySpawnTicket& io_ticket, AzFramework::DespawnAllEntitiesOptionalArgs i_optionalArgs = {}) override;
+		void DespawnEntity(AZ::EntityId i_entityId, AzFramework::EntitySpawnTicket& io_ticket, AzFramework::DespawnEntityOptionalArgs i_optionalArgs = {}) override;
+		void RetrieveTicket(AzFramework::EntitySpawnTicket::Id i_ticketId, AzFramework::RetrieveEntitySpawnTicketCallback i_callback, AzFramework::RetrieveTicketOptionalArgs i_optionalArgs = {}) override;
+		void ReloadSpawnable(AzFramework::EntitySpawnTicket& io_ticket, AZ::Data::Asset<AzFramework::Spawnable> i_spawnable, AzFramework::ReloadSpawnableOptionalArgs i_optionalArgs = {}) override;
+		void UpdateEntityAliasTypes(AzFramework::EntitySpawnTicket& io_ticket, AZStd::vector<AzFramework::EntityAliasTypeChange> i_updatedAliases, AzFramework::UpdateEntityAliasTypesOptionalArgs i_optionalArgs = {}) override;
+		void ListEntities(AzFramework::EntitySpawnTicket& io_ticket, AzFramework::ListEntitiesCallback i_listCallback, AzFramework::ListEntitiesOptionalArgs i_optionalArgs = {}) override;
+		void ListIndicesAndEntities(AzFramework::EntitySpawnTicket& io_ticket, AzFramework::ListIndicesEntitiesCallback i_listCallback, AzFramework::ListEntitiesOptionalArgs i_optionalArgs = {}) override;
+		void ClaimEntities(AzFramework::EntitySpawnTicket& io_ticket, AzFramework::ClaimEntitiesCallback i_listCallback, AzFramework::ClaimEntitiesOptionalArgs i_optionalArgs = {}) override;
+		void Barrier(AzFramework::EntitySpawnTicket& io_ticket, AzFramework::BarrierCallback i_completionCallback, AzFramework::BarrierOptionalArgs i_optionalArgs = {}) override;
+		void LoadBarrier(AzFramework::EntitySpawnTicket& io_ticket, AzFramework::BarrierCallback i_completionCallback, AzFramework::LoadBarrierOptionalArgs i_optionalArgs = {}) override;
+
+		void AddOnSpawnedHandler(AZ::Event<AZ::Data::Asset<AzFramework::Spawnable>>::Handler& io_handler) override;
+		void AddOnDespawnedHandler(AZ::Event<AZ::Data::Asset<AzFramework::Spawnable>>::Handler& io_handler) override;
+
+	protected:
+		// AzFramework::SpawnableEntitiesDefinition
+		AZStd::pair<AzFramework::EntitySpawnTicket::Id, void*> CreateTicket(AZ::Data::Asset<AzFramework::Spawnable>&& i_spawnable) override;
+		void IncrementTicketReference(void* io_ticket) override;
+		void DecrementTicketReference(void* io_ticket) override;
+		AzFramework::EntitySpawnTicket::Id GetTicketId(void* i_ticket) override;
+		const AZ::Data::Asset<AzFramework::Spawnable>& GetSpawnableOnTicket(void* i_ticket) const override;
+
+	private:
+		struct Ticket
+		{
+			AzFramework::EntitySpawnTicket::Id m_id { 0 };
+			AZ::Data::Asset<AzFramework::Spawnable> m_spawnable {};
+			AZStd::vector<AZ::Entity*> m_entities {};
+			AZ::u32 m_nReferences { 0 };
+		};
+
+		using Request = AZStd::function<void()>;
+
+		Ticket* FindTicket(const AzFramework::EntitySpawnTicket& i_ticket) const;
+		void QueueRequest(Ticket* io_ticket, Request&& i_request);
+
+		static void DestroyEntity(AZ::Entity* io_entity);
+
+		EntityFactory m_entityFactory {};
+
+		AZStd::unordered_map<AzFramework::EntitySpawnTicket::Id, AZStd::unique_ptr<Ticket>> m_tickets {};
+		AzFramework::EntitySpawnTicket::Id m_nextTicketId { 1 };
+
+		AZStd::deque<Request> m_requests {};
+
+		AZ::Event<AZ::Data::Asset<AzFramework::Spawnable>> m_onSpawnedEvent {};
+		AZ::Event<AZ::Data::Asset<AzFramework::Spawnable>> m_onDespawnedEvent {};
+	};
+
+} // Loherangrin::Games::O3DEJam2305
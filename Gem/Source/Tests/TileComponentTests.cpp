@@ -0,0 +1,145 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../EBuses/CollectableBus.hpp"
+#include "../EBuses/GameBus.hpp"
+#include "../EBuses/TileBus.hpp"
+#include "GameTestFixture.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// With the default settings, a tile holds up to 10 energy and loses 0.25 of it per second when it has no claimed neighbors.
+	// It toggles below 2.5 and a flip takes 1.33 seconds, so a tile claimed with 3 energy is lost in less than 4 seconds.
+	class TileComponentTest
+		: public GameTestFixture
+	{
+	protected:
+		static bool IsTileClaimed(const AZ::EntityId& i_tileEntityId)
+		{
+			bool isClaimed { false };
+			EBUS_EVENT_ID_RESULT(isClaimed, i_tileEntityId, TileRequestBus, IsClaimed);
+
+			return isClaimed;
+		}
+	};
+
+	TEST_F(TileComponentTest, EnergyAboveToggleThresholdClaimsTile)
+	{
+		const AZ::EntityId tileEntityId = CreateTile()->GetId();
+
+		EBUS_EVENT_ID(tileEntityId, TileRequestBus, AddEnergy, 5.f);
+		EXPECT_TRUE(IsTileClaimed(tileEntityId));
+		EXPECT_TRUE(GetTilesRecorder().GetClaimedTiles().empty());
+
+		TickStage(GameplayStage::TILES, 2.f);
+
+		ASSERT_EQ(GetTilesRecorder().GetClaimedTiles().size(), 1u);
+		EXPECT_EQ(GetTilesRecorder().GetClaimedTiles()[0], tileEntityId);
+	}
+
+	TEST_F(TileComponentTest, EnergyBelowToggleThresholdLosesTile)
+	{
+		const AZ::EntityId tileEntityId = CreateTile()->GetId();
+
+		EBUS_EVENT_ID(tileEntityId, TileRequestBus, AddEnergy, 5.f);
+		EBUS_EVENT_ID(tileEntityId, TileRequestBus, SubtractEnergy, 4.f);
+
+		EXPECT_FALSE(IsTileClaimed(tileEntityId));
+	}
+
+	TEST_F(TileComponentTest, DecayLosesClaimedTile)
+	{
+		const AZ::EntityId tileEntityId = CreateTile()->GetId();
+
+		EBUS_EVENT_ID(tileEntityId, TileRequestBus, AddEnergy, 3.f);
+		TickStage(GameplayStage::TILES, 5.f);
+
+		EXPECT_FALSE(IsTileClaimed(tileEntityId));
+
+		ASSERT_EQ(GetTilesRecorder().GetLostTiles().size(), 1u);
+		EXPECT_EQ(GetTilesRecorder().GetLostTiles()[0], tileEntityId);
+	}
+
+	TEST_F(TileComponentTest, PausedGameStopsDecay)
+	{
+		const AZ::EntityId tileEntityId = CreateTile()->GetId();
+
+		EBUS_EVENT_ID(tileEntityId, TileRequestBus, AddEnergy, 3.f);
+
+		EBUS_EVENT(GameNotificationBus, OnGamePaused);
+		TickStage(GameplayStage::TILES, 5.f);
+
+		EXPECT_TRUE(IsTileClaimed(tileEntityId));
+		EXPECT_TRUE(GetTilesRecorder().GetClaimedTiles().empty());
+
+		EBUS_EVENT(GameNotificationBus, OnGameResumed);
+		TickStage(GameplayStage::TILES, 5.f);
+
+		EXPECT_FALSE(IsTileClaimed(tileEntityId));
+	}
+
+	TEST_F(TileComponentTest, EndedGameStopsDecay)
+	{
+		const AZ::EntityId tileEntityId = CreateTile()->GetId();
+
+		EBUS_EVENT_ID(tileEntityId, TileRequestBus, AddEnergy, 3.f);
+
+		EBUS_EVENT(GameNotificationBus, OnGameEnded);
+		TickStage(GameplayStage::TILES, 5.f);
+
+		EXPECT_TRUE(IsTileClaimed(tileEntityId));
+	}
+
+	TEST_F(TileComponentTest, StopDecayCollectedKeepsClaimedTile)
+	{
+		const AZ::EntityId tileEntityId = CreateTile()->GetId();
+
+		EBUS_EVENT_ID(tileEntityId, TileRequestBus, AddEnergy, 3.f);
+
+		EBUS_EVENT(CollectablesNotificationBus, OnStopDecayCollected, 10.f);
+		TickStage(GameplayStage::TILES, 5.f);
+
+		EXPECT_TRUE(IsTileClaimed(tileEntityId));
+
+		TickStage(GameplayStage::TILES, 10.f);
+
+		EXPECT_FALSE(IsTileClaimed(tileEntityId));
+	}
+
+	TEST_F(TileComponentTest, TileEnergyCollectedRechargesClaimedTile)
+	{
+		const AZ::EntityId tileEntityId = CreateTile()->GetId();
+
+		EBUS_EVENT_ID(tileEntityId, TileRequestBus, AddEnergy, 3.f);
+
+		EBUS_EVENT(CollectablesNotificationBus, OnTileEnergyCollected, 5.f);
+		TickStage(GameplayStage::TILES, 5.f);
+
+		EXPECT_TRUE(IsTileClaimed(tileEntityId));
+		EXPECT_TRUE(GetTilesRecorder().GetLostTiles().empty());
+	}
+
+	TEST_F(TileComponentTest, TileEnergyCollectedIgnoresUnclaimedTile)
+	{
+		const AZ::EntityId tileEntityId = CreateTile()->GetId();
+
+		EBUS_EVENT(CollectablesNotificationBus, OnTileEnergyCollected, 5.f);
+
+		EXPECT_FALSE(IsTileClaimed(tileEntityId));
+	}
+
+} // Loherangrin::Games::O3DEJam2305
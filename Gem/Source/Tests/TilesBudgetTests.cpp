@@ -0,0 +1,81 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/std/chrono/chrono.h>
+
+#include "../EBuses/GameBus.hpp"
+#include "../EBuses/GameplayBus.hpp"
+#include "../EBuses/TileBus.hpp"
+#include "GameTestFixture.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	struct TilesBudget
+	{
+		AZ::u16 m_gridLength { 0 };
+		float m_maxFrameMs { 0.f };
+	};
+
+	// Timings depend on the machine, so these tests only run as part of the benchmark suite
+	class TilesBudgetTest
+		: public GameTestFixture
+		, public ::testing::WithParamInterface<TilesBudget>
+	{
+	protected:
+		static constexpr AZ::u32 N_WARMUP_FRAMES = 30;
+		static constexpr AZ::u32 N_MEASURED_FRAMES = 120;
+	};
+
+	TEST_P(TilesBudgetTest, SUITE_benchmark_TilesStageWithinBudget)
+	{
+		const TilesBudget budget = GetParam();
+
+		CreateTilesPool(budget.m_gridLength, 1234);
+
+		EBUS_EVENT(GameNotificationBus, OnGameLoading);
+		ProcessSpawns();
+
+		// every tile is claimed and ticking, which is the most expensive frame of the stage
+		for(const AZ::EntityId& tileEntityId : GetTilesRecorder().GetCreatedTiles())
+		{
+			EBUS_EVENT_ID(tileEntityId, TileRequestBus, AddEnergy, 10.f);
+		}
+
+		TickStage(GameplayStage::TILES, N_WARMUP_FRAMES * FRAME_TIME);
+
+		const AZStd::chrono::steady_clock::time_point start = AZStd::chrono::steady_clock::now();
+
+		TickStage(GameplayStage::TILES, N_MEASURED_FRAMES * FRAME_TIME);
+
+		using Milliseconds = AZStd::chrono::duration<float, AZStd::milli>;
+		const float frameMs = AZStd::chrono::duration_cast<Milliseconds>(AZStd::chrono::steady_clock::now() - start).count() / N_MEASURED_FRAMES;
+
+		EXPECT_LT(frameMs, budget.m_maxFrameMs) << "Tiles stage of a " << budget.m_gridLength << "x" << budget.m_gridLength << " grid";
+	}
+
+	INSTANTIATE_TEST_SUITE_P(GridLengths, TilesBudgetTest, ::testing::Values
+	(
+		TilesBudget { 11, 0.5f },
+		TilesBudget { 33, 2.f },
+		TilesBudget { 101, 16.f }
+	),
+	[](const ::testing::TestParamInfo<TilesBudget>& i_info)
+	{
+		return std::to_string(i_info.param.m_gridLength);
+	});
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,235 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_set.h>
+
+#include "../EBuses/GameBus.hpp"
+#include "../EBuses/TileBus.hpp"
+#include "GameTestFixture.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class TilesPoolComponentTest
+		: public GameTestFixture
+	{
+	protected:
+		void LoadGame()
+		{
+			EBUS_EVENT(GameNotificationBus, OnGameLoading);
+			ProcessSpawns();
+		}
+
+		static AZ::u16 GetGridLength()
+		{
+			AZ::u16 gridLength { 0 };
+			EBUS_EVENT_RESULT(gridLength, TilesRequestBus, GetGridLength);
+
+			return gridLength;
+		}
+
+		static AZ::Vector2 GetCellSize()
+		{
+			AZ::Vector2 gridSize { AZ::Vector2::CreateZero() };
+			EBUS_EVENT_RESULT(gridSize, TilesRequestBus, GetGridSize);
+
+			return (gridSize / static_cast<float>(GetGridLength()));
+		}
+
+		static AZ::u64 GetLayoutSeed()
+		{
+			AZ::u64 layoutSeed { 0 };
+			EBUS_EVENT_RESULT(layoutSeed, TilesRequestBus, GetLayoutSeed);
+
+			return layoutSeed;
+		}
+
+		// tile ids of the landing areas of the active grid
+		AZStd::unordered_set<TileId> FindLandingAreas() const
+		{
+			AZStd::unordered_set<TileId> landingAreas;
+
+			for(const AZ::EntityId& tileEntityId : GetTilesRecorder().GetCreatedTiles())
+			{
+				bool isLandingArea { false };
+				EBUS_EVENT_ID_RESULT(isLandingArea, tileEntityId, TileRequestBus, IsLandingArea);
+
+				if(!isLandingArea)
+				{
+					continue;
+				}
+
+				TileId tileId { INVALID_TILE_ID };
+				EBUS_EVENT_ID_RESULT(tileId, tileEntityId, TileRequestBus, GetTileId);
+
+				landingAreas.insert(tileId);
+			}
+
+			return landingAreas;
+		}
+
+		static constexpr AZ::u16 GRID_LENGTH = 11;
+		static constexpr AZStd::size_t N_TILES = GRID_LENGTH * GRID_LENGTH;
+
+		// the empty grid shown behind the main menu
+		static constexpr AZ::u16 MENU_GRID_LENGTH = 5;
+		static constexpr AZStd::size_t N_MENU_TILES = MENU_GRID_LENGTH * MENU_GRID_LENGTH;
+	};
+
+	TEST_F(TilesPoolComponentTest, ActivationSpawnsMenuGrid)
+	{
+		CreateTilesPool(GRID_LENGTH, 1234);
+
+		EXPECT_EQ(GetGridLength(), MENU_GRID_LENGTH);
+		EXPECT_EQ(GetTilesRecorder().GetCreatedTiles().size(), N_MENU_TILES);
+	}
+
+	TEST_F(TilesPoolComponentTest, GameLoadingReplacesMenuGrid)
+	{
+		CreateTilesPool(GRID_LENGTH, 1234);
+		LoadGame();
+
+		EXPECT_EQ(GetGridLength(), GRID_LENGTH);
+
+		// each spawned tile is made of a root entity and the tile entity
+		EXPECT_EQ(GetSpawnedEntitiesCount(), 2 * N_TILES);
+	}
+
+	TEST_F(TilesPoolComponentTest, SpawnedTilesHaveUniqueIds)
+	{
+		CreateTilesPool(GRID_LENGTH, 1234);
+		LoadGame();
+
+		const AZStd::vector<AZ::EntityId>& createdTiles = GetTilesRecorder().GetCreatedTiles();
+		ASSERT_EQ(createdTiles.size(), N_MENU_TILES + N_TILES);
+
+		AZStd::unordered_set<TileId> tileIds;
+		for(auto tileEntityIt = createdTiles.begin() + N_MENU_TILES; tileEntityIt != createdTiles.end(); ++tileEntityIt)
+		{
+			TileId tileId { INVALID_TILE_ID };
+			EBUS_EVENT_ID_RESULT(tileId, *tileEntityIt, TileRequestBus, GetTileId);
+
+			EXPECT_LT(tileId, N_TILES);
+			tileIds.insert(tileId);
+		}
+
+		EXPECT_EQ(tileIds.size(), N_TILES);
+	}
+
+	TEST_F(TilesPoolComponentTest, GameStartsFromClaimedLandingArea)
+	{
+		CreateTilesPool(GRID_LENGTH, 1234);
+		LoadGame();
+
+		TileId startTileId { INVALID_TILE_ID };
+		EBUS_EVENT_RESULT(startTileId, TilesRequestBus, FindNearestClaimedLandingArea, AZ::Vector3::CreateZero());
+
+		EXPECT_NE(startTileId, INVALID_TILE_ID);
+		EXPECT_EQ(FindLandingAreas().count(startTileId), 1u);
+	}
+
+	TEST_F(TilesPoolComponentTest, LandingAreaIsFoundUpToItsCellEdges)
+	{
+		CreateTilesPool(GRID_LENGTH, 1234);
+		LoadGame();
+
+		TileId startTileId { INVALID_TILE_ID };
+		EBUS_EVENT_RESULT(startTileId, TilesRequestBus, FindNearestClaimedLandingArea, AZ::Vector3::CreateZero());
+		ASSERT_NE(startTileId, INVALID_TILE_ID);
+
+		AZ::Vector3 tilePosition { AZ::Vector3::CreateZero() };
+		EBUS_EVENT_RESULT(tilePosition, TilesRequestBus, GetTilePosition, startTileId);
+
+		const AZ::Vector2 cellSize = GetCellSize();
+		const AZStd::array<AZ::Vector2, 4> directions { AZ::Vector2 { 1.f, 0.f }, AZ::Vector2 { -1.f, 0.f }, AZ::Vector2 { 0.f, 1.f }, AZ::Vector2 { 0.f, -1.f } };
+
+		for(const AZ::Vector2& direction : directions)
+		{
+			const AZ::Vector2 insideOffset = direction * cellSize * 0.49f;
+			const AZ::Vector2 outsideOffset = direction * cellSize * 0.51f;
+
+			TileId insideTileId { INVALID_TILE_ID };
+			EBUS_EVENT_RESULT(insideTileId, TilesRequestBus, FindLandingAreaAt, tilePosition + AZ::Vector3 { insideOffset.GetX(), insideOffset.GetY(), 0.f }, true);
+
+			TileId outsideTileId { INVALID_TILE_ID };
+			EBUS_EVENT_RESULT(outsideTileId, TilesRequestBus, FindLandingAreaAt, tilePosition + AZ::Vector3 { outsideOffset.GetX(), outsideOffset.GetY(), 0.f }, true);
+
+			EXPECT_EQ(insideTileId, startTileId);
+			EXPECT_NE(outsideTileId, startTileId);
+		}
+
+		// far outside the grid, where no cell can be rounded to
+		TileId outsideGridTileId { INVALID_TILE_ID };
+		EBUS_EVENT_RESULT(outsideGridTileId, TilesRequestBus, FindLandingAreaAt, AZ::Vector3 { -1000.f, -1000.f, 0.f }, false);
+
+		EXPECT_EQ(outsideGridTileId, INVALID_TILE_ID);
+	}
+
+	TEST_F(TilesPoolComponentTest, SameSeedReproducesLayout)
+	{
+		AZ::Entity* tilesPoolEntity = CreateTilesPool(GRID_LENGTH, 1234);
+		LoadGame();
+
+		const AZ::u64 layoutSeed = GetLayoutSeed();
+		const AZStd::unordered_set<TileId> landingAreas = FindLandingAreas();
+
+		DestroyEntity(tilesPoolEntity);
+		ProcessSpawns();
+
+		CreateTilesPool(GRID_LENGTH, 1234);
+		LoadGame();
+
+		EXPECT_EQ(GetLayoutSeed(), layoutSeed);
+		EXPECT_EQ(FindLandingAreas(), landingAreas);
+	}
+
+	TEST_F(TilesPoolComponentTest, DifferentSeedChangesLayout)
+	{
+		AZ::Entity* tilesPoolEntity = CreateTilesPool(GRID_LENGTH, 1234);
+		LoadGame();
+
+		const AZ::u64 layoutSeed = GetLayoutSeed();
+
+		DestroyEntity(tilesPoolEntity);
+		ProcessSpawns();
+
+		CreateTilesPool(GRID_LENGTH, 4321);
+		LoadGame();
+
+		EXPECT_NE(GetLayoutSeed(), layoutSeed);
+	}
+
+	TEST_F(TilesPoolComponentTest, NextLayoutSeedIsPlayedOnAnotherSeed)
+	{
+		AZ::Entity* tilesPoolEntity = CreateTilesPool(GRID_LENGTH, 1234);
+		LoadGame();
+
+		const AZ::u64 layoutSeed = GetLayoutSeed();
+		const AZStd::unordered_set<TileId> landingAreas = FindLandingAreas();
+
+		DestroyEntity(tilesPoolEntity);
+		ProcessSpawns();
+
+		CreateTilesPool(GRID_LENGTH, 4321);
+		EBUS_EVENT(TilesRequestBus, SetNextLayoutSeed, layoutSeed);
+		LoadGame();
+
+		EXPECT_EQ(GetLayoutSeed(), layoutSeed);
+		EXPECT_EQ(FindLandingAreas(), landingAreas);
+	}
+
+} // Loherangrin::Games::O3DEJam2305
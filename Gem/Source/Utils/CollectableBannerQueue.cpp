@@ -0,0 +1,193 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/std/algorithm.h>
+
+#include <LyShine/Bus/UiElementBus.h>
+
+#include "CollectableBannerQueue.hpp"
+#include "GameMetrics.hpp"
+
+using Loherangrin::Games::O3DEJam2305::CollectableBannerQueue;
+
+
+void CollectableBannerQueue::Bind(const AZ::EntityId& i_positiveEntityId, const AZ::EntityId& i_negativeEntityId)
+{
+	m_positiveEntityId = i_positiveEntityId;
+	m_negativeEntityId = i_negativeEntityId;
+
+	m_positiveText.Bind(m_positiveEntityId);
+	m_negativeText.Bind(m_negativeEntityId);
+}
+
+void CollectableBannerQueue::Unbind()
+{
+	Clear();
+
+	m_positiveText.Unbind();
+	m_negativeText.Unbind();
+
+	m_positiveEntityId.SetInvalid();
+	m_negativeEntityId.SetInvalid();
+}
+
+void CollectableBannerQueue::SetDisplayDuration(float i_duration)
+{
+	m_displayDuration = i_duration;
+}
+
+void CollectableBannerQueue::Push(bool i_isPositive, const char* i_format, ...)
+{
+	va_list arguments;
+	va_start(arguments, i_format);
+
+	PushV(i_isPositive, i_format, arguments);
+
+	va_end(arguments);
+}
+
+void CollectableBannerQueue::PushV(bool i_isPositive, const char* i_format, va_list i_arguments)
+{
+	Banner& stagedBanner = m_stagedBanners[(i_isPositive) ? 1 : 0];
+	stagedBanner.m_isPositive = i_isPositive;
+
+	AZStd::size_t length = stagedBanner.m_length;
+	if(length > 0)
+	{
+		const int separatorLength = azsnprintf(stagedBanner.m_text.data() + length, TEXT_CAPACITY - length, "%s", TEXT_SEPARATOR);
+		if(separatorLength < 0)
+		{
+			return;
+		}
+
+		length = AZStd::min(length + static_cast<AZStd::size_t>(separatorLength), TEXT_CAPACITY - 1);
+	}
+
+	const int messageLength = azvsnprintf(stagedBanner.m_text.data() + length, TEXT_CAPACITY - length, i_format, i_arguments);
+	if(messageLength < 0)
+	{
+		return;
+	}
+
+	stagedBanner.m_length = AZStd::min(length + static_cast<AZStd::size_t>(messageLength), TEXT_CAPACITY - 1);
+
+	if(!AZ::TickBus::Handler::BusIsConnected())
+	{
+		AZ::TickBus::Handler::BusConnect();
+	}
+}
+
+void CollectableBannerQueue::Refresh()
+{
+	m_positiveText.Refresh();
+	m_negativeText.Refresh();
+}
+
+void CollectableBannerQueue::Clear()
+{
+	AZ::TickBus::Handler::BusDisconnect();
+
+	for(Banner& stagedBanner : m_stagedBanners)
+	{
+		stagedBanner.m_length = 0;
+	}
+
+	Banner discardedBanner;
+	while(m_queuedBanners.TryPopRange(&discardedBanner, 1) > 0)
+	{}
+
+	HideBanners();
+}
+
+void CollectableBannerQueue::OnTick(float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint i_time)
+{
+	GAME_PROFILE_SCOPE(UI, "CollectableBannerQueue::OnTick");
+
+	FlushStagedBanners();
+
+	if(m_isDisplaying)
+	{
+		m_displayTime += i_deltaTime;
+
+		const float displayDuration = (m_queuedBanners.IsEmpty()) ? m_displayDuration : AZStd::min(m_displayDuration, MIN_DISPLAY_DURATION);
+		if(m_displayTime < displayDuration)
+		{
+			return;
+		}
+	}
+
+	if(!ShowNextBanner())
+	{
+		HideBanners();
+
+		AZ::TickBus::Handler::BusDisconnect();
+	}
+}
+
+int CollectableBannerQueue::GetTickOrder()
+{
+	return AZ::ComponentTickBus::TICK_UI;
+}
+
+void CollectableBannerQueue::FlushStagedBanners()
+{
+	for(Banner& stagedBanner : m_stagedBanners)
+	{
+		if(stagedBanner.m_length == 0)
+		{
+			continue;
+		}
+
+		// when the queue is full, the newest pickups are dropped rather than delaying the older ones further
+		[[maybe_unused]] const bool isQueued = m_queuedBanners.TryPush(stagedBanner);
+		AZ_Warning("CollectableBannerQueue", isQueued, "Too many collectable notifications. Some of them won't be displayed");
+
+		stagedBanner.m_length = 0;
+	}
+}
+
+bool CollectableBannerQueue::ShowNextBanner()
+{
+	Banner banner;
+	if(m_queuedBanners.TryPopRange(&banner, 1) == 0)
+	{
+		return false;
+	}
+
+	banner.m_text[banner.m_length] = '\0';
+
+	const AZ::EntityId& shownEntityId = (banner.m_isPositive) ? m_positiveEntityId : m_negativeEntityId;
+	const AZ::EntityId& hiddenEntityId = (banner.m_isPositive) ? m_negativeEntityId : m_positiveEntityId;
+
+	EBUS_EVENT_ID(hiddenEntityId, UiElementBus, SetIsEnabled, false);
+	EBUS_EVENT_ID(shownEntityId, UiElementBus, SetIsEnabled, true);
+
+	HudTextBinding& shownText = (banner.m_isPositive) ? m_positiveText : m_negativeText;
+	shownText.SetText(banner.m_text.data());
+
+	m_displayTime = 0.f;
+	m_isDisplaying = true;
+
+	return true;
+}
+
+void CollectableBannerQueue::HideBanners()
+{
+	EBUS_EVENT_ID(m_positiveEntityId, UiElementBus, SetIsEnabled, false);
+	EBUS_EVENT_ID(m_negativeEntityId, UiElementBus, SetIsEnabled, false);
+
+	m_isDisplaying = false;
+}
@@ -0,0 +1,88 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/array.h>
+
+#include <cstdarg>
+
+#include "HudTextBinding.hpp"
+#include "RingBuffer.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Shows collectable pickups on the positive and negative HUD banners.
+	// Pickups of the same frame are merged into one message per banner, and messages
+	// wait in a bounded queue with their own timer, separate from any screen transition.
+	class CollectableBannerQueue
+		: protected AZ::TickBus::Handler
+	{
+	public:
+		void Bind(const AZ::EntityId& i_positiveEntityId, const AZ::EntityId& i_negativeEntityId);
+		void Unbind();
+
+		void SetDisplayDuration(float i_duration);
+
+		void Push(bool i_isPositive, const char* i_format, ...);
+		void PushV(bool i_isPositive, const char* i_format, va_list i_arguments);
+
+		void Refresh();
+		void Clear();
+
+	protected:
+		// AZ::TickBus
+		void OnTick(float i_deltaTime, AZ::ScriptTimePoint i_time) override;
+		int GetTickOrder() override;
+
+	private:
+		static constexpr AZStd::size_t TEXT_CAPACITY = 64;
+		static constexpr AZStd::size_t QUEUE_CAPACITY = 8;
+
+		static constexpr const char* TEXT_SEPARATOR = ", ";
+
+		// a banner is cut short after this time when other messages are waiting
+		static constexpr float MIN_DISPLAY_DURATION = 1.f;
+
+		struct Banner
+		{
+			AZStd::array<char, TEXT_CAPACITY> m_text {};
+			AZStd::size_t m_length { 0 };
+			bool m_isPositive { false };
+		};
+
+		void FlushStagedBanners();
+		bool ShowNextBanner();
+		void HideBanners();
+
+		AZ::EntityId m_positiveEntityId {};
+		AZ::EntityId m_negativeEntityId {};
+
+		HudTextBinding m_positiveText {};
+		HudTextBinding m_negativeText {};
+
+		AZStd::array<Banner, 2> m_stagedBanners {};
+		RingBuffer<Banner, QUEUE_CAPACITY> m_queuedBanners {};
+
+		float m_displayDuration { 5.f };
+		float m_displayTime { 0.f };
+		bool m_isDisplaying { false };
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,170 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/std/math.h>
+
+#include "EnergyNotifier.hpp"
+
+using Loherangrin::Games::O3DEJam2305::EnergyNotifier;
+using Loherangrin::Games::O3DEJam2305::ScopedSubsystemTimer;
+
+
+EnergyNotifier* EnergyNotifier::s_firstPending { nullptr };
+EnergyNotifier* EnergyNotifier::s_lastPending { nullptr };
+
+EnergyNotifier::~EnergyNotifier()
+{
+	Dequeue();
+}
+
+void EnergyNotifier::Configure(GameSubsystem i_subsystem, float i_quantum, AZStd::initializer_list<float> i_normalizedThresholds, Callback&& i_callback)
+{
+	m_subsystem = i_subsystem;
+	m_quantum = i_quantum;
+
+	m_thresholds.clear();
+	for(const float threshold : i_normalizedThresholds)
+	{
+		if(m_thresholds.size() == m_thresholds.capacity())
+		{
+			break;
+		}
+
+		m_thresholds.push_back(threshold);
+	}
+
+	m_callback = AZStd::move(i_callback);
+
+	m_isPublished = false;
+}
+
+void EnergyNotifier::Update(float i_normalizedEnergy)
+{
+	m_pendingEnergy = i_normalizedEnergy;
+
+	if(m_isPending || !IsSignificantChange(i_normalizedEnergy))
+	{
+		return;
+	}
+
+	Enqueue();
+}
+
+void EnergyNotifier::Publish(float i_normalizedEnergy)
+{
+	Dequeue();
+
+	m_pendingEnergy = i_normalizedEnergy;
+	m_publishedEnergy = i_normalizedEnergy;
+	m_isPublished = true;
+
+	if(m_callback)
+	{
+		m_callback(i_normalizedEnergy);
+	}
+}
+
+void EnergyNotifier::Cancel()
+{
+	Dequeue();
+}
+
+void EnergyNotifier::FlushAll()
+{
+	// callbacks may queue other notifiers, which are published in the same flush
+	while(EnergyNotifier* notifier = s_firstPending)
+	{
+		notifier->Dequeue();
+
+		if(notifier->IsSignificantChange(notifier->m_pendingEnergy))
+		{
+			const ScopedSubsystemTimer subsystemTimer { notifier->m_subsystem, "EnergyNotifier::FlushAll" };
+			notifier->Publish(notifier->m_pendingEnergy);
+		}
+	}
+}
+
+bool EnergyNotifier::IsSignificantChange(float i_normalizedEnergy) const
+{
+	if(!m_isPublished)
+	{
+		return true;
+	}
+
+	if(AZStd::abs(i_normalizedEnergy - m_publishedEnergy) >= m_quantum)
+	{
+		return true;
+	}
+
+	for(const float threshold : m_thresholds)
+	{
+		if((i_normalizedEnergy < threshold) != (m_publishedEnergy < threshold))
+		{
+			return true;
+		}
+	}
+
+	const bool isBoundary = (i_normalizedEnergy <= 0.f || i_normalizedEnergy >= 1.f);
+	return (isBoundary && i_normalizedEnergy != m_publishedEnergy);
+}
+
+void EnergyNotifier::Enqueue()
+{
+	m_previousPending = s_lastPending;
+	m_nextPending = nullptr;
+
+	if(s_lastPending)
+	{
+		s_lastPending->m_nextPending = this;
+	}
+	else
+	{
+		s_firstPending = this;
+	}
+
+	s_lastPending = this;
+	m_isPending = true;
+}
+
+void EnergyNotifier::Dequeue()
+{
+	if(!m_isPending)
+	{
+		return;
+	}
+
+	if(m_previousPending)
+	{
+		m_previousPending->m_nextPending = m_nextPending;
+	}
+	else
+	{
+		s_firstPending = m_nextPending;
+	}
+
+	if(m_nextPending)
+	{
+		m_nextPending->m_previousPending = m_previousPending;
+	}
+	else
+	{
+		s_lastPending = m_previousPending;
+	}
+
+	m_previousPending = nullptr;
+	m_nextPending = nullptr;
+	m_isPending = false;
+}
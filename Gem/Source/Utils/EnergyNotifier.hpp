@@ -0,0 +1,74 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/functional.h>
+
+#include "GameMetrics.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Notifiers with a significant change are queued in a single list, which is published at once by FlushAll,
+	// so that a tile or a spaceship changing its energy many times in a tick notifies it only once
+	class EnergyNotifier
+	{
+	public:
+		using Callback = AZStd::function<void(float)>;
+
+		EnergyNotifier() = default;
+		EnergyNotifier(const EnergyNotifier&) = delete;
+		EnergyNotifier& operator=(const EnergyNotifier&) = delete;
+		~EnergyNotifier();
+
+		// the callbacks run at the end of the tick, so their time is counted under the subsystem of the notifier
+		void Configure(GameSubsystem i_subsystem, float i_quantum, AZStd::initializer_list<float> i_normalizedThresholds, Callback&& i_callback);
+
+		void Update(float i_normalizedEnergy);
+		void Publish(float i_normalizedEnergy);
+		void Cancel();
+
+		// the gameplay scheduler calls it at the end of every tick
+		static void FlushAll();
+
+	private:
+		bool IsSignificantChange(float i_normalizedEnergy) const;
+
+		void Enqueue();
+		void Dequeue();
+
+		GameSubsystem m_subsystem { GameSubsystem::TILES };
+		float m_quantum { 1.f / 256.f };
+		AZStd::fixed_vector<float, 4> m_thresholds {};
+
+		float m_publishedEnergy { 0.f };
+		float m_pendingEnergy { 0.f };
+		bool m_isPublished { false };
+
+		Callback m_callback {};
+
+		// links of the pending list, which is intrusive so that queueing never allocates
+		EnergyNotifier* m_previousPending { nullptr };
+		EnergyNotifier* m_nextPending { nullptr };
+		bool m_isPending { false };
+
+		static EnergyNotifier* s_firstPending;
+		static EnergyNotifier* s_lastPending;
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,208 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+
+#include "GameAllocators.hpp"
+
+using Loherangrin::Games::O3DEJam2305::GameArena;
+using Loherangrin::Games::O3DEJam2305::GameArenas;
+using Loherangrin::Games::O3DEJam2305::GameMetrics;
+using Loherangrin::Games::O3DEJam2305::GameSubsystem;
+using Loherangrin::Games::O3DEJam2305::LinearArena;
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	static constexpr AZStd::size_t SESSION_BLOCK_SIZE = 256 * 1024;
+	static constexpr AZStd::size_t FRAME_BLOCK_SIZE = 64 * 1024;
+
+	static LinearArena& GetSessionArena()
+	{
+		static LinearArena arena { "Session", SESSION_BLOCK_SIZE };
+		return arena;
+	}
+
+	static LinearArena& GetFrameArena()
+	{
+		static LinearArena arena { "Frame", FRAME_BLOCK_SIZE };
+		return arena;
+	}
+
+	static void DumpMemory([[maybe_unused]] const AZ::ConsoleCommandContainer& i_arguments)
+	{
+		AZStd::string text;
+		GameArenas::PrintArenas(text);
+
+		AZ_Printf("Performance", "%s", text.c_str());
+	}
+
+	AZ_CONSOLEFREEFUNC("game_dumpMemory", DumpMemory, AZ::ConsoleFunctorFlags::Null, "Print the memory used by each gameplay subsystem in the session and frame arenas");
+
+} // Loherangrin::Games::O3DEJam2305
+
+
+LinearArena::LinearArena(const char* i_name, AZStd::size_t i_blockSize)
+	: m_name { i_name }
+	, m_blockSize { i_blockSize }
+{}
+
+LinearArena::~LinearArena()
+{
+	Release();
+}
+
+void* LinearArena::Allocate(AZStd::size_t i_size, AZStd::size_t i_alignment, GameSubsystem i_subsystem)
+{
+	const AZStd::size_t alignment = AZStd::max(i_alignment, AZStd::size_t { 1 });
+
+	while(true)
+	{
+		if(m_currentBlock < m_blocks.size())
+		{
+			const Block& block = m_blocks[m_currentBlock];
+
+			const AZStd::size_t address = reinterpret_cast<AZStd::size_t>(block.m_data) + m_currentOffset;
+			const AZStd::size_t alignedAddress = (address + alignment - 1) & ~(alignment - 1);
+			const AZStd::size_t alignedOffset = m_currentOffset + (alignedAddress - address);
+
+			if(alignedOffset + i_size <= block.m_size)
+			{
+				m_currentOffset = alignedOffset + i_size;
+
+				m_usedSize += i_size;
+				m_peakSize = AZStd::max(m_peakSize, m_usedSize);
+				m_subsystemSizes[static_cast<AZStd::size_t>(i_subsystem)] += i_size;
+
+				return block.m_data + alignedOffset;
+			}
+
+			// the rest of a block is wasted until the next reset, so that the offset never goes back
+			if(m_currentBlock + 1 < m_blocks.size())
+			{
+				++m_currentBlock;
+				m_currentOffset = 0;
+
+				continue;
+			}
+		}
+
+		Block newBlock;
+		newBlock.m_size = AZStd::max(m_blockSize, i_size + alignment);
+		newBlock.m_data = static_cast<AZ::u8*>(AZ::AllocatorInstance<GameAllocator>::Get().allocate(newBlock.m_size, BLOCK_ALIGNMENT));
+
+		AZ_Assert(newBlock.m_data, "Unable to grow the %s arena by %zu bytes", m_name, newBlock.m_size);
+		if(!newBlock.m_data)
+		{
+			return nullptr;
+		}
+
+		m_blocks.push_back(newBlock);
+		m_currentBlock = m_blocks.size() - 1;
+		m_currentOffset = 0;
+	}
+}
+
+void LinearArena::Reset()
+{
+	m_currentBlock = 0;
+	m_currentOffset = 0;
+
+	m_usedSize = 0;
+	m_subsystemSizes = {};
+}
+
+void LinearArena::Release()
+{
+	for(const Block& block : m_blocks)
+	{
+		AZ::AllocatorInstance<GameAllocator>::Get().deallocate(block.m_data, block.m_size, BLOCK_ALIGNMENT);
+	}
+
+	AZStd::vector<Block, GameStdAllocator>().swap(m_blocks);
+
+	Reset();
+	m_peakSize = 0;
+}
+
+const char* LinearArena::GetName() const
+{
+	return m_name;
+}
+
+AZStd::size_t LinearArena::GetUsedSize() const
+{
+	return m_usedSize;
+}
+
+AZStd::size_t LinearArena::GetPeakSize() const
+{
+	return m_peakSize;
+}
+
+AZStd::size_t LinearArena::GetCapacity() const
+{
+	AZStd::size_t capacity { 0 };
+	for(const Block& block : m_blocks)
+	{
+		capacity += block.m_size;
+	}
+
+	return capacity;
+}
+
+AZStd::size_t LinearArena::GetSubsystemSize(GameSubsystem i_subsystem) const
+{
+	return m_subsystemSizes[static_cast<AZStd::size_t>(i_subsystem)];
+}
+
+LinearArena& GameArenas::Get(GameArena i_arena)
+{
+	return (i_arena == GameArena::SESSION) ? GetSessionArena() : GetFrameArena();
+}
+
+void GameArenas::Reset(GameArena i_arena)
+{
+	Get(i_arena).Reset();
+}
+
+void GameArenas::ReleaseAll()
+{
+	GetSessionArena().Release();
+	GetFrameArena().Release();
+}
+
+void GameArenas::PrintArenas(AZStd::string& o_text)
+{
+	for(AZ::u8 i = 0; i < static_cast<AZ::u8>(GameArena::COUNT); ++i)
+	{
+		const LinearArena& arena = Get(static_cast<GameArena>(i));
+
+		o_text += AZStd::string::format("%s arena: used %zu - peak %zu - capacity %zu bytes\n", arena.GetName(), arena.GetUsedSize(), arena.GetPeakSize(), arena.GetCapacity());
+
+		for(AZ::u8 j = 0; j <= static_cast<AZ::u8>(GameSubsystem::COUNT); ++j)
+		{
+			const auto subsystem = static_cast<GameSubsystem>(j);
+
+			const AZStd::size_t subsystemSize = arena.GetSubsystemSize(subsystem);
+			if(subsystemSize > 0)
+			{
+				o_text += AZStd::string::format("  %-14s %8zu\n", GameMetrics::GetSubsystemName(subsystem), subsystemSize);
+			}
+		}
+	}
+}
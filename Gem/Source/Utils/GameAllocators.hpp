@@ -0,0 +1,212 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Memory/ChildAllocatorSchema.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/string/string.h>
+
+#include "GameMetrics.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Parent of the memory owned by the gameplay code, so that the allocator manager reports it on its own
+	AZ_CHILD_ALLOCATOR_WITH_NAME(GameAllocator, "GameAllocator", "{2C9E4A17-5B83-4F60-A1D2-7E58C3B90F46}", AZ::SystemAllocator);
+
+	using GameStdAllocator = AZ::AZStdAlloc<GameAllocator>;
+
+	// ---
+
+	// Hands out memory by bumping an offset through blocks taken from the GameAllocator.
+	// Nothing is freed piecemeal: a reset rewinds all the blocks at once and keeps them for the next round,
+	// so that a long play session doesn't fragment the heap.
+	class LinearArena
+	{
+	public:
+		LinearArena(const char* i_name, AZStd::size_t i_blockSize);
+		~LinearArena();
+
+		LinearArena(const LinearArena&) = delete;
+		LinearArena& operator=(const LinearArena&) = delete;
+
+		void* Allocate(AZStd::size_t i_size, AZStd::size_t i_alignment, GameSubsystem i_subsystem);
+
+		// invalidates every pointer returned so far
+		void Reset();
+		void Release();
+
+		const char* GetName() const;
+		AZStd::size_t GetUsedSize() const;
+		AZStd::size_t GetPeakSize() const;
+		AZStd::size_t GetCapacity() const;
+		AZStd::size_t GetSubsystemSize(GameSubsystem i_subsystem) const;
+
+	private:
+		struct Block
+		{
+			AZ::u8* m_data { nullptr };
+			AZStd::size_t m_size { 0 };
+		};
+
+		static constexpr AZStd::size_t N_SUBSYSTEMS = static_cast<AZStd::size_t>(GameSubsystem::COUNT) + 1;
+		static constexpr AZStd::size_t BLOCK_ALIGNMENT = 16;
+
+		const char* m_name;
+		AZStd::size_t m_blockSize;
+
+		AZStd::vector<Block, GameStdAllocator> m_blocks {};
+		AZStd::size_t m_currentBlock { 0 };
+		AZStd::size_t m_currentOffset { 0 };
+
+		AZStd::size_t m_usedSize { 0 };
+		AZStd::size_t m_peakSize { 0 };
+		AZStd::array<AZStd::size_t, N_SUBSYSTEMS> m_subsystemSizes {};
+	};
+
+	// ---
+
+	enum class GameArena : AZ::u8
+	{
+		// reset when a new game is loading
+		SESSION = 0,
+
+		// reset at the beginning of every frame, before the gameplay stages
+		FRAME,
+
+		COUNT
+	};
+
+	class GameArenas
+	{
+	public:
+		static LinearArena& Get(GameArena i_arena);
+
+		static void Reset(GameArena i_arena);
+		static void ReleaseAll();
+
+		static void PrintArenas(AZStd::string& o_text);
+	};
+
+	// ---
+
+	// Lets AZStd containers live in one of the game arenas.
+	// Containers must not outlive the reset of their arena, apart from being destroyed or released without further use.
+	template <GameArena t_arena>
+	class ArenaStdAllocator
+	{
+	public:
+		using value_type = void;
+		using pointer = void*;
+		using size_type = AZStd::size_t;
+		using difference_type = AZStd::ptrdiff_t;
+		using align_type = AZStd::size_t;
+		using propagate_on_container_copy_assignment = AZStd::true_type;
+		using propagate_on_container_move_assignment = AZStd::true_type;
+
+		ArenaStdAllocator() = default;
+		explicit ArenaStdAllocator(GameSubsystem i_subsystem);
+
+		pointer allocate(size_type i_byteSize, size_type i_alignment, int i_flags = 0);
+		void deallocate(pointer i_pointer, size_type i_byteSize, size_type i_alignment);
+		pointer reallocate(pointer i_pointer, size_type i_newSize, align_type i_newAlignment = 1);
+
+		size_type max_size() const;
+		size_type get_allocated_size() const;
+
+		GameSubsystem GetSubsystem() const;
+
+	private:
+		GameSubsystem m_subsystem { GameSubsystem::COUNT };
+	};
+
+	template <GameArena t_arena>
+	bool operator==(const ArenaStdAllocator<t_arena>& i_lhs, const ArenaStdAllocator<t_arena>& i_rhs);
+
+	template <GameArena t_arena>
+	bool operator!=(const ArenaStdAllocator<t_arena>& i_lhs, const ArenaStdAllocator<t_arena>& i_rhs);
+
+	using SessionStdAllocator = ArenaStdAllocator<GameArena::SESSION>;
+	using FrameStdAllocator = ArenaStdAllocator<GameArena::FRAME>;
+
+	template <typename t_Element>
+	using SessionVector = AZStd::vector<t_Element, SessionStdAllocator>;
+
+	template <typename t_Element>
+	using FrameVector = AZStd::vector<t_Element, FrameStdAllocator>;
+
+	// ---
+
+	template <GameArena t_arena>
+	ArenaStdAllocator<t_arena>::ArenaStdAllocator(GameSubsystem i_subsystem)
+		: m_subsystem { i_subsystem }
+	{}
+
+	template <GameArena t_arena>
+	typename ArenaStdAllocator<t_arena>::pointer ArenaStdAllocator<t_arena>::allocate(size_type i_byteSize, size_type i_alignment, [[maybe_unused]] int i_flags)
+	{
+		return GameArenas::Get(t_arena).Allocate(i_byteSize, i_alignment, m_subsystem);
+	}
+
+	template <GameArena t_arena>
+	void ArenaStdAllocator<t_arena>::deallocate([[maybe_unused]] pointer i_pointer, [[maybe_unused]] size_type i_byteSize, [[maybe_unused]] size_type i_alignment)
+	{
+		// the memory is given back when the whole arena is reset
+	}
+
+	template <GameArena t_arena>
+	typename ArenaStdAllocator<t_arena>::pointer ArenaStdAllocator<t_arena>::reallocate([[maybe_unused]] pointer i_pointer, [[maybe_unused]] size_type i_newSize, [[maybe_unused]] align_type i_newAlignment)
+	{
+		// blocks can't grow in place, so the container falls back to a new allocation
+		return nullptr;
+	}
+
+	template <GameArena t_arena>
+	typename ArenaStdAllocator<t_arena>::size_type ArenaStdAllocator<t_arena>::max_size() const
+	{
+		return AZStd::numeric_limits<size_type>::max();
+	}
+
+	template <GameArena t_arena>
+	typename ArenaStdAllocator<t_arena>::size_type ArenaStdAllocator<t_arena>::get_allocated_size() const
+	{
+		return GameArenas::Get(t_arena).GetSubsystemSize(m_subsystem);
+	}
+
+	template <GameArena t_arena>
+	GameSubsystem ArenaStdAllocator<t_arena>::GetSubsystem() const
+	{
+		return m_subsystem;
+	}
+
+	template <GameArena t_arena>
+	bool operator==([[maybe_unused]] const ArenaStdAllocator<t_arena>& i_lhs, [[maybe_unused]] const ArenaStdAllocator<t_arena>& i_rhs)
+	{
+		// any allocator of the same arena can release the memory of another one, since releasing is a no-op
+		return true;
+	}
+
+	template <GameArena t_arena>
+	bool operator!=(const ArenaStdAllocator<t_arena>& i_lhs, const ArenaStdAllocator<t_arena>& i_rhs)
+	{
+		return !(i_lhs == i_rhs);
+	}
+
+} // Loherangrin::Games::O3DEJam2305
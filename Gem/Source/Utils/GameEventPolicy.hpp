@@ -0,0 +1,71 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/EBus/Policies.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/utils.h>
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Number of handler invocations of the game buses since the metrics last collected it.
+	// It only depends on AzCore, so that every bus header can include it.
+	class GameEventCounter
+	{
+	public:
+		static void CountEvent();
+		static AZ::u32 TakeCount();
+
+	private:
+		static inline AZStd::atomic<AZ::u32> s_nEvents { 0 };
+	};
+
+	// ---
+
+	// Counts every handler invocation of the game buses that opt into it through their traits
+	struct GameEventProcessingPolicy
+	{
+		template <typename t_Results, typename t_Function, typename t_Interface, typename... t_Arguments>
+		static void CallResult(t_Results& io_results, t_Function&& i_function, t_Interface&& i_interface, t_Arguments&&... i_arguments)
+		{
+			GameEventCounter::CountEvent();
+			AZ::EBusEventProcessingPolicy::CallResult(io_results, AZStd::forward<t_Function>(i_function), AZStd::forward<t_Interface>(i_interface), AZStd::forward<t_Arguments>(i_arguments)...);
+		}
+
+		template <typename t_Function, typename t_Interface, typename... t_Arguments>
+		static void Call(t_Function&& i_function, t_Interface&& i_interface, t_Arguments&&... i_arguments)
+		{
+			GameEventCounter::CountEvent();
+			AZ::EBusEventProcessingPolicy::Call(AZStd::forward<t_Function>(i_function), AZStd::forward<t_Interface>(i_interface), AZStd::forward<t_Arguments>(i_arguments)...);
+		}
+	};
+
+	// ---
+
+	inline void GameEventCounter::CountEvent()
+	{
+		s_nEvents.fetch_add(1, AZStd::memory_order_relaxed);
+	}
+
+	inline AZ::u32 GameEventCounter::TakeCount()
+	{
+		return s_nEvents.exchange(0, AZStd::memory_order_relaxed);
+	}
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,343 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/std/containers/vector.h>
+
+#include "GameEventPolicy.hpp"
+#include "GameMetrics.hpp"
+
+using Loherangrin::Games::O3DEJam2305::GameEventCounter;
+using Loherangrin::Games::O3DEJam2305::GameMetrics;
+using Loherangrin::Games::O3DEJam2305::GameSubsystem;
+using Loherangrin::Games::O3DEJam2305::TraceRecorder;
+
+AZ_DEFINE_BUDGET(O3DEJam2305);
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	static constexpr AZ::u32 FRAMES_PER_SAMPLE = 60;
+	static constexpr AZStd::size_t N_SUBSYSTEMS = static_cast<AZStd::size_t>(GameSubsystem::COUNT);
+
+	struct SubsystemAccumulator
+	{
+		AZStd::chrono::steady_clock::duration m_sampleTime {};
+		AZStd::chrono::steady_clock::duration m_frameTime {};
+		AZStd::chrono::steady_clock::duration m_maxFrameTime {};
+		AZ::u32 m_nSampleCalls { 0 };
+	};
+
+	struct TrackedSpawnTicket
+	{
+		GameSubsystem m_subsystem { GameSubsystem::COUNT };
+		AzFramework::EntitySpawnTicket* m_ticket { nullptr };
+		AzFramework::EntitySpawnTicket::Id m_ticketId { 0 };
+		AZStd::size_t m_nLiveEntities { 0 };
+		AZ::u32 m_nPendingSpawns { 0 };
+	};
+
+	static AZStd::array<SubsystemAccumulator, N_SUBSYSTEMS> s_subsystemAccumulators {};
+	static AZ::u64 s_nSampleEvents { 0 };
+	static AZStd::size_t s_nFrameSpawnedEntities { 0 };
+	static AZ::u32 s_nSampleFrames { 0 };
+
+	static AZStd::vector<TrackedSpawnTicket> s_spawnTickets {};
+
+	static GameMetrics::FrameStats s_frameStats {};
+
+	static TraceRecorder s_traceRecorder {};
+
+	static TrackedSpawnTicket* FindSpawnTicket(AzFramework::EntitySpawnTicket::Id i_ticketId)
+	{
+		for(TrackedSpawnTicket& spawnTicket : s_spawnTickets)
+		{
+			if(spawnTicket.m_ticketId == i_ticketId)
+			{
+				return &spawnTicket;
+			}
+		}
+
+		return nullptr;
+	}
+
+	static void DumpPerformance([[maybe_unused]] const AZ::ConsoleCommandContainer& i_arguments)
+	{
+		AZStd::string text;
+		GameMetrics::PrintFrameStats(text);
+
+		AZ_Printf("Performance", "%s", text.c_str());
+	}
+
+	static void DumpSpawnTickets([[maybe_unused]] const AZ::ConsoleCommandContainer& i_arguments)
+	{
+		AZStd::string text;
+		GameMetrics::PrintSpawnTickets(text);
+
+		AZ_Printf("Performance", "%s", text.c_str());
+	}
+
+	static void StartTrace([[maybe_unused]] const AZ::ConsoleCommandContainer& i_arguments)
+	{
+		s_traceRecorder.Start();
+	}
+
+	static void StopTrace(const AZ::ConsoleCommandContainer& i_arguments)
+	{
+		if(!s_traceRecorder.IsRecording())
+		{
+			AZ_Warning("Performance", false, "No trace is being recorded, use game_traceStart first");
+			return;
+		}
+
+		s_traceRecorder.Stop();
+
+		auto fileIO = AZ::IO::FileIOBase::GetInstance();
+		AZ_Assert(fileIO, "Unable to retrieve the file system");
+
+		const AZ::IO::PathView filePath = (i_arguments.empty()) ? AZ::IO::PathView { "@user@/Traces/gameplay.json" } : AZ::IO::PathView { i_arguments.front() };
+
+		AZ::IO::FixedMaxPath resolvedFilePath;
+		if(!fileIO->ResolvePath(resolvedFilePath, filePath))
+		{
+			AZ_Error("Performance", false, "Unable to resolve the trace path %.*s", AZ_STRING_ARG(filePath.Native()));
+			return;
+		}
+
+		if(s_traceRecorder.WriteChromeTrace(resolvedFilePath.c_str()))
+		{
+			AZ_Printf("Performance", "Traced %zu events (%zu dropped) to %s\n", s_traceRecorder.GetEventsCount(), s_traceRecorder.GetDroppedEventsCount(), resolvedFilePath.c_str());
+		}
+	}
+
+	AZ_CONSOLEFREEFUNC("game_dumpPerformance", DumpPerformance, AZ::ConsoleFunctorFlags::Null, "Print the average cost per frame of each gameplay subsystem");
+	AZ_CONSOLEFREEFUNC("game_dumpSpawnTickets", DumpSpawnTickets, AZ::ConsoleFunctorFlags::Null, "Print the live entities and the pending requests of each spawn ticket");
+	AZ_CONSOLEFREEFUNC("game_traceStart", StartTrace, AZ::ConsoleFunctorFlags::Null, "Start recording the gameplay markers and counters");
+	AZ_CONSOLEFREEFUNC("game_traceStop", StopTrace, AZ::ConsoleFunctorFlags::Null, "Stop recording and write the markers and counters as Chrome trace JSON to the given file");
+
+} // Loherangrin::Games::O3DEJam2305
+
+void GameMetrics::AddSubsystemTime(GameSubsystem i_subsystem, const char* i_name, AZStd::chrono::steady_clock::time_point i_start, AZStd::chrono::steady_clock::time_point i_end, AZStd::chrono::steady_clock::duration i_exclusiveTime)
+{
+	SubsystemAccumulator& accumulator = s_subsystemAccumulators[static_cast<AZStd::size_t>(i_subsystem)];
+	accumulator.m_frameTime += i_exclusiveTime;
+	++accumulator.m_nSampleCalls;
+
+	s_traceRecorder.AddScope(GetSubsystemName(i_subsystem), i_name, i_start, i_end);
+}
+
+void GameMetrics::TrackSpawnTicket(GameSubsystem i_subsystem, AzFramework::EntitySpawnTicket& io_ticket)
+{
+	if(!io_ticket.IsValid() || FindSpawnTicket(io_ticket.GetId()))
+	{
+		return;
+	}
+
+	TrackedSpawnTicket spawnTicket;
+	spawnTicket.m_subsystem = i_subsystem;
+	spawnTicket.m_ticket = &io_ticket;
+	spawnTicket.m_ticketId = io_ticket.GetId();
+
+	s_spawnTickets.push_back(spawnTicket);
+}
+
+void GameMetrics::UntrackSpawnTicket(const AzFramework::EntitySpawnTicket& i_ticket)
+{
+	const AzFramework::EntitySpawnTicket::Id ticketId = i_ticket.GetId();
+
+	for(auto it = s_spawnTickets.begin(); it != s_spawnTickets.end(); ++it)
+	{
+		if(it->m_ticketId == ticketId)
+		{
+			s_spawnTickets.erase(it);
+			return;
+		}
+	}
+}
+
+void GameMetrics::BeginSpawn(AzFramework::EntitySpawnTicket::Id i_ticketId)
+{
+	if(TrackedSpawnTicket* spawnTicket = FindSpawnTicket(i_ticketId))
+	{
+		++spawnTicket->m_nPendingSpawns;
+	}
+}
+
+void GameMetrics::EndSpawn(AzFramework::EntitySpawnTicket::Id i_ticketId, AZStd::size_t i_nSpawnedEntities)
+{
+	s_nFrameSpawnedEntities += i_nSpawnedEntities;
+
+	if(TrackedSpawnTicket* spawnTicket = FindSpawnTicket(i_ticketId))
+	{
+		if(spawnTicket->m_nPendingSpawns > 0)
+		{
+			--spawnTicket->m_nPendingSpawns;
+		}
+	}
+}
+
+void GameMetrics::EndFrame()
+{
+	for(SubsystemAccumulator& accumulator : s_subsystemAccumulators)
+	{
+		accumulator.m_sampleTime += accumulator.m_frameTime;
+		accumulator.m_maxFrameTime = AZStd::max(accumulator.m_maxFrameTime, accumulator.m_frameTime);
+		accumulator.m_frameTime = {};
+	}
+
+	const AZ::u32 nFrameEvents = GameEventCounter::TakeCount();
+	s_nSampleEvents += nFrameEvents;
+
+	AZ_PROFILE_DATAPOINT(O3DEJam2305, nFrameEvents, "Game bus events");
+	AZ_PROFILE_DATAPOINT(O3DEJam2305, s_nFrameSpawnedEntities, "Spawned entities");
+
+	if(s_traceRecorder.IsRecording())
+	{
+		const TraceRecorder::Clock::time_point now = TraceRecorder::Clock::now();
+
+		s_traceRecorder.AddCounter("Game bus events", nFrameEvents, now);
+		s_traceRecorder.AddCounter("Spawned entities", static_cast<AZ::s64>(s_nFrameSpawnedEntities), now);
+	}
+
+	s_nFrameSpawnedEntities = 0;
+
+	if(++s_nSampleFrames < FRAMES_PER_SAMPLE)
+	{
+		return;
+	}
+
+	using Milliseconds = AZStd::chrono::duration<float, AZStd::milli>;
+	const float nFrames = static_cast<float>(s_nSampleFrames);
+
+	for(AZStd::size_t i = 0; i < N_SUBSYSTEMS; ++i)
+	{
+		SubsystemAccumulator& accumulator = s_subsystemAccumulators[i];
+		SubsystemStats& stats = s_frameStats.m_subsystems[i];
+
+		stats.m_averageMs = AZStd::chrono::duration_cast<Milliseconds>(accumulator.m_sampleTime).count() / nFrames;
+		stats.m_maxMs = AZStd::chrono::duration_cast<Milliseconds>(accumulator.m_maxFrameTime).count();
+		stats.m_callsPerFrame = accumulator.m_nSampleCalls / nFrames;
+
+		accumulator = {};
+	}
+
+	s_frameStats.m_eventsPerFrame = s_nSampleEvents / nFrames;
+	s_frameStats.m_tickHandlers = AZ::TickBus::GetTotalNumOfEventHandlers();
+
+	s_nSampleEvents = 0;
+	s_nSampleFrames = 0;
+
+	RefreshSpawnTickets();
+}
+
+const GameMetrics::FrameStats& GameMetrics::GetFrameStats()
+{
+	return s_frameStats;
+}
+
+void GameMetrics::PrintFrameStats(AZStd::string& o_text)
+{
+	o_text += AZStd::string::format("%-14s %8s %8s %8s\n", "Subsystem", "Avg ms", "Max ms", "Calls");
+
+	for(AZStd::size_t i = 0; i < N_SUBSYSTEMS; ++i)
+	{
+		const SubsystemStats& stats = s_frameStats.m_subsystems[i];
+		o_text += AZStd::string::format("%-14s %8.3f %8.3f %8.1f\n", GetSubsystemName(static_cast<GameSubsystem>(i)), stats.m_averageMs, stats.m_maxMs, stats.m_callsPerFrame);
+	}
+
+	o_text += AZStd::string::format("Tick handlers: %zu\n", s_frameStats.m_tickHandlers);
+	o_text += AZStd::string::format("Events per frame: %.1f\n", s_frameStats.m_eventsPerFrame);
+}
+
+void GameMetrics::PrintSpawnTickets(AZStd::string& o_text)
+{
+	AZStd::size_t nTotalLiveEntities { 0 };
+	AZ::u32 nTotalPendingSpawns { 0 };
+
+	for(const TrackedSpawnTicket& spawnTicket : s_spawnTickets)
+	{
+		o_text += AZStd::string::format("%-14s %-40s live %5zu pending %3u\n",
+			GetSubsystemName(spawnTicket.m_subsystem), spawnTicket.m_ticket->GetSpawnable().GetHint().c_str(),
+			spawnTicket.m_nLiveEntities, spawnTicket.m_nPendingSpawns);
+
+		nTotalLiveEntities += spawnTicket.m_nLiveEntities;
+		nTotalPendingSpawns += spawnTicket.m_nPendingSpawns;
+	}
+
+	o_text += AZStd::string::format("Spawned entities: %zu - Pending spawns: %u\n", nTotalLiveEntities, nTotalPendingSpawns);
+}
+
+const char* GameMetrics::GetSubsystemName(GameSubsystem i_subsystem)
+{
+	switch(i_subsystem)
+	{
+		case GameSubsystem::TILES:
+			return "Tiles";
+
+		case GameSubsystem::BEAM:
+			return "Beam";
+
+		case GameSubsystem::STORMS:
+			return "Storms";
+
+		case GameSubsystem::COLLECTABLES:
+			return "Collectables";
+
+		case GameSubsystem::SPACESHIPS:
+			return "Spaceships";
+
+		case GameSubsystem::SCORE:
+			return "Score";
+
+		case GameSubsystem::UI:
+			return "UI";
+
+		default:
+			return "Unknown";
+	}
+}
+
+TraceRecorder* GameMetrics::GetTraceRecorder()
+{
+	return &s_traceRecorder;
+}
+
+void GameMetrics::RefreshSpawnTickets()
+{
+	auto spawnableSystem = AzFramework::SpawnableEntitiesInterface::Get();
+	if(!spawnableSystem)
+	{
+		return;
+	}
+
+	// Spawned entities may also be destroyed on their own, so the spawnable system is the only reliable source
+	for(TrackedSpawnTicket& spawnTicket : s_spawnTickets)
+	{
+		AzFramework::ListEntitiesOptionalArgs listOptions;
+
+		spawnableSystem->ListEntities(*spawnTicket.m_ticket,
+			[](AzFramework::EntitySpawnTicket::Id i_ticketId, AzFramework::SpawnableConstEntityContainerView i_entities)
+			{
+				if(TrackedSpawnTicket* listedTicket = FindSpawnTicket(i_ticketId))
+				{
+					listedTicket->m_nLiveEntities = i_entities.size();
+				}
+			},
+			AZStd::move(listOptions));
+	}
+}
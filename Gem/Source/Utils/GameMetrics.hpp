@@ -0,0 +1,143 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Debug/Budget.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/string/string.h>
+
+#include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
+
+#include "../Core/TraceRecorder.hpp"
+
+// Every marker of the gameplay code is grouped under this budget in the engine profiler
+AZ_DECLARE_BUDGET(O3DEJam2305);
+
+// Marks the enclosing scope both for the engine profiler and for the per-frame costs of a subsystem
+#define GAME_PROFILE_SCOPE(i_subsystem, i_name) \
+	AZ_PROFILE_SCOPE(O3DEJam2305, i_name); \
+	const ::Loherangrin::Games::O3DEJam2305::ScopedSubsystemTimer AZ_JOIN(subsystemTimer, __LINE__) { ::Loherangrin::Games::O3DEJam2305::GameSubsystem::i_subsystem, i_name }
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	enum class GameSubsystem : AZ::u8
+	{
+		TILES = 0,
+		BEAM,
+		STORMS,
+		COLLECTABLES,
+		SPACESHIPS,
+		SCORE,
+		UI,
+		COUNT
+	};
+
+	// Registry of the per-frame costs of the gameplay code.
+	// Samples are accumulated by the game thread and published every few frames,
+	// so that readers (overlay, console commands) always see a stable average.
+	class GameMetrics
+	{
+	public:
+		struct SubsystemStats
+		{
+			float m_averageMs { 0.f };
+			float m_maxMs { 0.f };
+			float m_callsPerFrame { 0.f };
+		};
+
+		struct FrameStats
+		{
+			AZStd::array<SubsystemStats, static_cast<AZStd::size_t>(GameSubsystem::COUNT)> m_subsystems {};
+			float m_eventsPerFrame { 0.f };
+			AZStd::size_t m_tickHandlers { 0 };
+		};
+
+		// only the exclusive time is added to the subsystem, while the trace keeps the whole scope
+		static void AddSubsystemTime(GameSubsystem i_subsystem, const char* i_name, AZStd::chrono::steady_clock::time_point i_start, AZStd::chrono::steady_clock::time_point i_end, AZStd::chrono::steady_clock::duration i_exclusiveTime);
+
+		static void TrackSpawnTicket(GameSubsystem i_subsystem, AzFramework::EntitySpawnTicket& io_ticket);
+		static void UntrackSpawnTicket(const AzFramework::EntitySpawnTicket& i_ticket);
+		static void BeginSpawn(AzFramework::EntitySpawnTicket::Id i_ticketId);
+		static void EndSpawn(AzFramework::EntitySpawnTicket::Id i_ticketId, AZStd::size_t i_nSpawnedEntities);
+
+		static void EndFrame();
+		static const FrameStats& GetFrameStats();
+
+		static void PrintFrameStats(AZStd::string& o_text);
+		static void PrintSpawnTickets(AZStd::string& o_text);
+
+		static const char* GetSubsystemName(GameSubsystem i_subsystem);
+
+		// Records the markers and the counters of the following frames, until it is stopped by the game_traceStop command
+		static TraceRecorder* GetTraceRecorder();
+
+	private:
+		static void RefreshSpawnTickets();
+	};
+
+	// ---
+
+	// Scopes opened inside another one, even of another subsystem, are subtracted from it,
+	// so that nested subsystems (e.g. the score of a claimed tile) are not counted twice
+	class ScopedSubsystemTimer
+	{
+	public:
+		ScopedSubsystemTimer(GameSubsystem i_subsystem, const char* i_name);
+		~ScopedSubsystemTimer();
+
+		ScopedSubsystemTimer(const ScopedSubsystemTimer&) = delete;
+		ScopedSubsystemTimer& operator=(const ScopedSubsystemTimer&) = delete;
+
+	private:
+		GameSubsystem m_subsystem;
+		const char* m_name;
+		AZStd::chrono::steady_clock::time_point m_start;
+		AZStd::chrono::steady_clock::duration m_nestedTime {};
+
+		ScopedSubsystemTimer* m_outerTimer;
+		static inline thread_local ScopedSubsystemTimer* s_innermostTimer { nullptr };
+	};
+
+	// ---
+
+	inline ScopedSubsystemTimer::ScopedSubsystemTimer(GameSubsystem i_subsystem, const char* i_name)
+		: m_subsystem { i_subsystem }
+		, m_name { i_name }
+		, m_start { AZStd::chrono::steady_clock::now() }
+		, m_outerTimer { s_innermostTimer }
+	{
+		s_innermostTimer = this;
+	}
+
+	inline ScopedSubsystemTimer::~ScopedSubsystemTimer()
+	{
+		const AZStd::chrono::steady_clock::time_point end = AZStd::chrono::steady_clock::now();
+		const AZStd::chrono::steady_clock::duration time = end - m_start;
+
+		s_innermostTimer = m_outerTimer;
+		if(m_outerTimer)
+		{
+			m_outerTimer->m_nestedTime += time;
+		}
+
+		GameMetrics::AddSubsystemTime(m_subsystem, m_name, m_start, end, time - m_nestedTime);
+	}
+
+} // Loherangrin::Games::O3DEJam2305
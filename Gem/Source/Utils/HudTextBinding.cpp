@@ -0,0 +1,143 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/string/string_view.h>
+
+#include <LyShine/Bus/UiElementBus.h>
+#include <LyShine/Bus/UiTextBus.h>
+
+#include "GameMetrics.hpp"
+#include "HudTextBinding.hpp"
+
+using Loherangrin::Games::O3DEJam2305::HudTextBinding;
+
+
+HudTextBinding::HudTextBinding()
+{
+	// the rendered text is only reassigned later, so its storage is never reallocated
+	m_renderedText.reserve(TEXT_CAPACITY);
+}
+
+void HudTextBinding::Bind(const AZ::EntityId& i_elementEntityId)
+{
+	m_elementEntityId = i_elementEntityId;
+	m_isRendered = false;
+
+	MarkDirty();
+}
+
+void HudTextBinding::Unbind()
+{
+	AZ::TickBus::Handler::BusDisconnect();
+
+	m_elementEntityId.SetInvalid();
+	m_isRendered = false;
+}
+
+void HudTextBinding::SetText(const char* i_text)
+{
+	const AZStd::size_t length = AZStd::min(strlen(i_text), TEXT_CAPACITY - 1);
+
+	AZStd::copy(i_text, i_text + length, m_pendingText.begin());
+	m_pendingText[length] = '\0';
+	m_pendingLength = length;
+	m_hasPendingText = true;
+
+	MarkDirty();
+}
+
+void HudTextBinding::Format(const char* i_format, ...)
+{
+	va_list arguments;
+	va_start(arguments, i_format);
+
+	FormatV(i_format, arguments);
+
+	va_end(arguments);
+}
+
+void HudTextBinding::FormatV(const char* i_format, va_list i_arguments)
+{
+	const int length = azvsnprintf(m_pendingText.data(), TEXT_CAPACITY, i_format, i_arguments);
+	if(length < 0)
+	{
+		return;
+	}
+
+	m_pendingLength = AZStd::min(static_cast<AZStd::size_t>(length), TEXT_CAPACITY - 1);
+	m_hasPendingText = true;
+
+	MarkDirty();
+}
+
+void HudTextBinding::Refresh()
+{
+	MarkDirty();
+}
+
+void HudTextBinding::OnTick([[maybe_unused]] float i_deltaTime, [[maybe_unused]] AZ::ScriptTimePoint i_time)
+{
+	GAME_PROFILE_SCOPE(UI, "HudTextBinding::OnTick");
+
+	AZ::TickBus::Handler::BusDisconnect();
+
+	if(!IsDirty() || !IsElementVisible())
+	{
+		return;
+	}
+
+	m_renderedText.assign(m_pendingText.data(), m_pendingLength);
+	m_isRendered = true;
+
+	EBUS_EVENT_ID(m_elementEntityId, UiTextBus, SetText, m_renderedText);
+}
+
+int HudTextBinding::GetTickOrder()
+{
+	return AZ::ComponentTickBus::TICK_UI;
+}
+
+void HudTextBinding::MarkDirty()
+{
+	if(!m_elementEntityId.IsValid() || !m_hasPendingText || !IsDirty())
+	{
+		return;
+	}
+
+	if(!AZ::TickBus::Handler::BusIsConnected())
+	{
+		AZ::TickBus::Handler::BusConnect();
+	}
+}
+
+bool HudTextBinding::IsDirty() const
+{
+	if(!m_isRendered)
+	{
+		return true;
+	}
+
+	return (AZStd::string_view { m_pendingText.data(), m_pendingLength } != AZStd::string_view { m_renderedText });
+}
+
+bool HudTextBinding::IsElementVisible() const
+{
+	bool isVisible { false };
+	EBUS_EVENT_ID_RESULT(isVisible, m_elementEntityId, UiElementBus, AreElementAndAncestorsEnabled);
+
+	return isVisible;
+}
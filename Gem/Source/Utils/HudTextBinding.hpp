@@ -0,0 +1,69 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/string/string.h>
+
+#include <cstdarg>
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Formats the text of a LyShine element into a fixed buffer, and pushes it
+	// at most once per frame when it differs from the last rendered one.
+	// Hidden elements keep their pending text until Refresh is called.
+	class HudTextBinding
+		: protected AZ::TickBus::Handler
+	{
+	public:
+		HudTextBinding();
+
+		void Bind(const AZ::EntityId& i_elementEntityId);
+		void Unbind();
+
+		void SetText(const char* i_text);
+		void Format(const char* i_format, ...);
+		void FormatV(const char* i_format, va_list i_arguments);
+
+		void Refresh();
+
+	protected:
+		// AZ::TickBus
+		void OnTick(float i_deltaTime, AZ::ScriptTimePoint i_time) override;
+		int GetTickOrder() override;
+
+	private:
+		static constexpr AZStd::size_t TEXT_CAPACITY = 64;
+
+		void MarkDirty();
+		bool IsDirty() const;
+		bool IsElementVisible() const;
+
+		AZ::EntityId m_elementEntityId {};
+
+		AZStd::array<char, TEXT_CAPACITY> m_pendingText {};
+		AZStd::size_t m_pendingLength { 0 };
+		bool m_hasPendingText { false };
+
+		AZStd::string m_renderedText {};
+		bool m_isRendered { false };
+	};
+
+} // Loherangrin::Games::O3DEJam2305
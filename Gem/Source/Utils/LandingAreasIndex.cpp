@@ -0,0 +1,231 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+#include "LandingAreasIndex.hpp"
+
+using Loherangrin::Games::O3DEJam2305::FrameStdAllocator;
+using Loherangrin::Games::O3DEJam2305::FrameVector;
+using Loherangrin::Games::O3DEJam2305::GameSubsystem;
+using Loherangrin::Games::O3DEJam2305::LandingAreasIndex;
+using Loherangrin::Games::O3DEJam2305::TileId;
+
+
+void LandingAreasIndex::Reset(AZ::u16 i_gridLength)
+{
+	m_gridLength = i_gridLength;
+	m_nBucketsPerSide = (i_gridLength + BUCKET_LENGTH - 1) / BUCKET_LENGTH;
+	m_nClaimedLandingAreas = 0;
+
+	m_landingAreas.clear();
+	m_cellLandingAreas.clear();
+
+	m_claimedBuckets.clear();
+	m_claimedBuckets.resize(m_nBucketsPerSide * m_nBucketsPerSide);
+}
+
+void LandingAreasIndex::AddLandingArea(TileId i_tileId, AZ::u16 i_row, AZ::u16 i_column, bool i_isClaimed)
+{
+	if(i_row >= m_gridLength || i_column >= m_gridLength)
+	{
+		return;
+	}
+
+	const LandingArea landingArea { i_row, i_column, i_isClaimed };
+
+	auto [it, isInserted] = m_landingAreas.emplace(i_tileId, landingArea);
+	if(!isInserted)
+	{
+		return;
+	}
+
+	m_cellLandingAreas[CalculateCellKey(i_row, i_column)] = i_tileId;
+
+	if(i_isClaimed)
+	{
+		InsertIntoBucket(i_tileId, landingArea);
+	}
+}
+
+bool LandingAreasIndex::SetClaimed(TileId i_tileId, bool i_isClaimed)
+{
+	auto it = m_landingAreas.find(i_tileId);
+	if(it == m_landingAreas.end())
+	{
+		return false;
+	}
+
+	LandingArea& landingArea = it->second;
+	if(landingArea.m_isClaimed == i_isClaimed)
+	{
+		return true;
+	}
+
+	landingArea.m_isClaimed = i_isClaimed;
+
+	if(i_isClaimed)
+	{
+		InsertIntoBucket(i_tileId, landingArea);
+	}
+	else
+	{
+		RemoveFromBucket(i_tileId, landingArea);
+	}
+
+	return true;
+}
+
+TileId LandingAreasIndex::FindLandingArea(AZ::u16 i_row, AZ::u16 i_column, bool i_onlyClaimed) const
+{
+	if(i_row >= m_gridLength || i_column >= m_gridLength)
+	{
+		return INVALID_TILE_ID;
+	}
+
+	auto cellIt = m_cellLandingAreas.find(CalculateCellKey(i_row, i_column));
+	if(cellIt == m_cellLandingAreas.end())
+	{
+		return INVALID_TILE_ID;
+	}
+
+	const TileId tileId = cellIt->second;
+	if(i_onlyClaimed && !m_landingAreas.at(tileId).m_isClaimed)
+	{
+		return INVALID_TILE_ID;
+	}
+
+	return tileId;
+}
+
+TileId LandingAreasIndex::FindNearestClaimedLandingArea(float i_row, float i_column) const
+{
+	if(m_nClaimedLandingAreas == 0)
+	{
+		return INVALID_TILE_ID;
+	}
+
+	const auto queryBucketRow = static_cast<AZ::s32>(CalculateBucketIndex(i_row));
+	const auto queryBucketColumn = static_cast<AZ::s32>(CalculateBucketIndex(i_column));
+	const auto nBucketsPerSide = static_cast<AZ::s32>(m_nBucketsPerSide);
+
+	TileId nearestTileId { INVALID_TILE_ID };
+	float nearestDistanceSq { AZStd::numeric_limits<float>::max() };
+
+	for(AZ::s32 ring = 0; ring < nBucketsPerSide; ++ring)
+	{
+		if(nearestTileId != INVALID_TILE_ID && ring > 0)
+		{
+			const float minRingDistance = static_cast<float>((ring - 1) * BUCKET_LENGTH);
+			if(nearestDistanceSq <= minRingDistance * minRingDistance)
+			{
+				break;
+			}
+		}
+
+		const AZ::s32 firstRow = AZStd::max(queryBucketRow - ring, 0);
+		const AZ::s32 lastRow = AZStd::min(queryBucketRow + ring, nBucketsPerSide - 1);
+		const AZ::s32 firstColumn = AZStd::max(queryBucketColumn - ring, 0);
+		const AZ::s32 lastColumn = AZStd::min(queryBucketColumn + ring, nBucketsPerSide - 1);
+
+		for(AZ::s32 bucketRow = firstRow; bucketRow <= lastRow; ++bucketRow)
+		{
+			const bool isBorderRow = (AZStd::abs(bucketRow - queryBucketRow) == ring);
+
+			for(AZ::s32 bucketColumn = firstColumn; bucketColumn <= lastColumn; ++bucketColumn)
+			{
+				if(!isBorderRow && AZStd::abs(bucketColumn - queryBucketColumn) != ring)
+				{
+					continue;
+				}
+
+				const AZStd::vector<TileId>& bucket = m_claimedBuckets[bucketRow * nBucketsPerSide + bucketColumn];
+				for(const TileId tileId : bucket)
+				{
+					const LandingArea& landingArea = m_landingAreas.at(tileId);
+
+					const float rowDistance = static_cast<float>(landingArea.m_row) - i_row;
+					const float columnDistance = static_cast<float>(landingArea.m_column) - i_column;
+					const float distanceSq = rowDistance * rowDistance + columnDistance * columnDistance;
+
+					if(distanceSq < nearestDistanceSq)
+					{
+						nearestDistanceSq = distanceSq;
+						nearestTileId = tileId;
+					}
+				}
+			}
+		}
+	}
+
+	return nearestTileId;
+}
+
+FrameVector<TileId> LandingAreasIndex::GetClaimedLandingAreas() const
+{
+	FrameVector<TileId> tileIds { FrameStdAllocator { GameSubsystem::TILES } };
+	tileIds.reserve(m_nClaimedLandingAreas);
+
+	for(const AZStd::vector<TileId>& bucket : m_claimedBuckets)
+	{
+		tileIds.insert(tileIds.end(), bucket.begin(), bucket.end());
+	}
+
+	return tileIds;
+}
+
+void LandingAreasIndex::InsertIntoBucket(TileId i_tileId, const LandingArea& i_landingArea)
+{
+	GetBucket(i_landingArea.m_row, i_landingArea.m_column).emplace_back(i_tileId);
+	++m_nClaimedLandingAreas;
+}
+
+void LandingAreasIndex::RemoveFromBucket(TileId i_tileId, const LandingArea& i_landingArea)
+{
+	AZStd::vector<TileId>& bucket = GetBucket(i_landingArea.m_row, i_landingArea.m_column);
+
+	auto it = AZStd::find(bucket.begin(), bucket.end(), i_tileId);
+	if(it == bucket.end())
+	{
+		return;
+	}
+
+	*it = bucket.back();
+	bucket.pop_back();
+
+	--m_nClaimedLandingAreas;
+}
+
+AZStd::vector<TileId>& LandingAreasIndex::GetBucket(AZ::u16 i_row, AZ::u16 i_column)
+{
+	const BucketIndex bucketRow = i_row / BUCKET_LENGTH;
+	const BucketIndex bucketColumn = i_column / BUCKET_LENGTH;
+
+	return m_claimedBuckets[bucketRow * m_nBucketsPerSide + bucketColumn];
+}
+
+LandingAreasIndex::BucketIndex LandingAreasIndex::CalculateBucketIndex(float i_cellIndex) const
+{
+	const float bucketIndex = AZStd::floor((i_cellIndex + 0.5f) / static_cast<float>(BUCKET_LENGTH));
+
+	return static_cast<BucketIndex>(AZStd::clamp(bucketIndex, 0.f, static_cast<float>(m_nBucketsPerSide - 1)));
+}
+
+LandingAreasIndex::CellKey LandingAreasIndex::CalculateCellKey(AZ::u16 i_row, AZ::u16 i_column) const
+{
+	return (static_cast<CellKey>(i_row) * m_gridLength) + i_column;
+}
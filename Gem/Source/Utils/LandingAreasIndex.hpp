@@ -0,0 +1,72 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+#include "../EBuses/TileBus.hpp"
+#include "GameAllocators.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	class LandingAreasIndex
+	{
+	public:
+		void Reset(AZ::u16 i_gridLength);
+
+		void AddLandingArea(TileId i_tileId, AZ::u16 i_row, AZ::u16 i_column, bool i_isClaimed);
+		bool SetClaimed(TileId i_tileId, bool i_isClaimed);
+
+		TileId FindLandingArea(AZ::u16 i_row, AZ::u16 i_column, bool i_onlyClaimed) const;
+		TileId FindNearestClaimedLandingArea(float i_row, float i_column) const;
+
+		// the list is scratch memory of the current frame
+		FrameVector<TileId> GetClaimedLandingAreas() const;
+
+	private:
+		using BucketIndex = AZ::u16;
+		using CellKey = AZ::u32;
+
+		struct LandingArea
+		{
+			AZ::u16 m_row { 0 };
+			AZ::u16 m_column { 0 };
+			bool m_isClaimed { false };
+		};
+
+		void InsertIntoBucket(TileId i_tileId, const LandingArea& i_landingArea);
+		void RemoveFromBucket(TileId i_tileId, const LandingArea& i_landingArea);
+
+		AZStd::vector<TileId>& GetBucket(AZ::u16 i_row, AZ::u16 i_column);
+		BucketIndex CalculateBucketIndex(float i_cellIndex) const;
+		CellKey CalculateCellKey(AZ::u16 i_row, AZ::u16 i_column) const;
+
+		AZ::u16 m_gridLength { 0 };
+		BucketIndex m_nBucketsPerSide { 0 };
+		TileCount m_nClaimedLandingAreas { 0 };
+
+		AZStd::unordered_map<TileId, LandingArea> m_landingAreas {};
+		AZStd::unordered_map<CellKey, TileId> m_cellLandingAreas {};
+
+		AZStd::vector<AZStd::vector<TileId>> m_claimedBuckets {};
+
+		static constexpr AZ::u16 BUCKET_LENGTH = 4;
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,251 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+#include "LeaderboardStore.hpp"
+
+using Loherangrin::Games::O3DEJam2305::LeaderboardEntry;
+using Loherangrin::Games::O3DEJam2305::LeaderboardRank;
+using Loherangrin::Games::O3DEJam2305::LeaderboardStore;
+
+
+bool LeaderboardStore::Open(const char* i_filePath)
+{
+	Close();
+
+	if(!m_file.Open(i_filePath, sizeof(Header) + INITIAL_CAPACITY * sizeof(Record)))
+	{
+		return false;
+	}
+
+	if(!ValidateHeader())
+	{
+		Close();
+		return false;
+	}
+
+	BuildAllIndexes();
+
+	return true;
+}
+
+void LeaderboardStore::Close()
+{
+	m_file.Close();
+
+	m_indexes.clear();
+	m_seedIndexes.clear();
+}
+
+bool LeaderboardStore::IsOpen() const
+{
+	return m_file.IsOpen();
+}
+
+bool LeaderboardStore::AddEntry(const LeaderboardEntry& i_entry)
+{
+	if(!IsOpen())
+	{
+		return false;
+	}
+
+	const RecordIndex recordIndex = GetHeader()->m_nRecords;
+	if(recordIndex >= GetRecordCapacity())
+	{
+		const AZStd::size_t newCapacity = static_cast<AZStd::size_t>(GetRecordCapacity()) * 2;
+		if(!m_file.Resize(sizeof(Header) + newCapacity * sizeof(Record)))
+		{
+			// the indexes must not outlive the records they point to
+			if(!m_file.IsOpen())
+			{
+				Close();
+			}
+
+			return false;
+		}
+	}
+
+	Record& record = GetRecords()[recordIndex];
+	record.m_points = i_entry.m_points;
+	record.m_seed = i_entry.m_seed;
+	record.m_time = i_entry.m_time;
+	record.m_claimedTiles = i_entry.m_claimedTiles;
+	record.m_reserved = 0;
+
+	// the count is published last, so an interrupted write leaves the previous entries intact
+	GetHeader()->m_nRecords = recordIndex + 1;
+	m_file.Flush();
+
+	InsertIndex(m_indexes, recordIndex);
+	InsertIndex(m_seedIndexes[i_entry.m_seed], recordIndex);
+
+	return true;
+}
+
+AZ::u32 LeaderboardStore::GetEntryCount() const
+{
+	return static_cast<AZ::u32>(m_indexes.size());
+}
+
+LeaderboardRank LeaderboardStore::GetRank(TotalPoints i_points) const
+{
+	return CalculateRank(m_indexes, i_points);
+}
+
+LeaderboardRank LeaderboardStore::GetSeedRank(LeaderboardSeed i_seed, TotalPoints i_points) const
+{
+	auto seedIt = m_seedIndexes.find(i_seed);
+	if(seedIt == m_seedIndexes.end())
+	{
+		return 1;
+	}
+
+	return CalculateRank(seedIt->second, i_points);
+}
+
+AZStd::vector<LeaderboardEntry> LeaderboardStore::GetTopEntries(AZ::u32 i_count) const
+{
+	return CollectEntries(m_indexes, i_count);
+}
+
+AZStd::vector<LeaderboardEntry> LeaderboardStore::GetSeedTopEntries(LeaderboardSeed i_seed, AZ::u32 i_count) const
+{
+	auto seedIt = m_seedIndexes.find(i_seed);
+	if(seedIt == m_seedIndexes.end())
+	{
+		return {};
+	}
+
+	return CollectEntries(seedIt->second, i_count);
+}
+
+bool LeaderboardStore::ValidateHeader()
+{
+	Header* header = GetHeader();
+
+	const bool isEmptyFile = AZStd::all_of(m_file.GetData(), m_file.GetData() + sizeof(Header), [](AZ::u8 i_byte){ return i_byte == 0; });
+	if(isEmptyFile)
+	{
+		AZStd::copy(AZStd::begin(MAGIC), AZStd::end(MAGIC), header->m_magic);
+		header->m_version = VERSION;
+		header->m_recordSize = sizeof(Record);
+		header->m_nRecords = 0;
+
+		return true;
+	}
+
+	if(!AZStd::equal(AZStd::begin(MAGIC), AZStd::end(MAGIC), header->m_magic) || header->m_version != VERSION || header->m_recordSize != sizeof(Record))
+	{
+		AZ_Error("Leaderboard", false, "The leaderboard file has an unknown format");
+		return false;
+	}
+
+	if(header->m_nRecords > GetRecordCapacity())
+	{
+		AZ_Warning("Leaderboard", false, "The leaderboard file is truncated, only %u entries are kept", GetRecordCapacity());
+		header->m_nRecords = GetRecordCapacity();
+	}
+
+	return true;
+}
+
+void LeaderboardStore::BuildAllIndexes()
+{
+	const AZ::u32 nRecords = GetHeader()->m_nRecords;
+	const Record* records = GetRecords();
+
+	m_indexes.resize(nRecords);
+	for(RecordIndex i = 0; i < nRecords; ++i)
+	{
+		m_indexes[i] = i;
+	}
+
+	AZStd::stable_sort(m_indexes.begin(), m_indexes.end(), [records](RecordIndex i_lhs, RecordIndex i_rhs)
+	{
+		return (records[i_lhs].m_points > records[i_rhs].m_points);
+	});
+
+	m_seedIndexes.clear();
+	for(const RecordIndex recordIndex : m_indexes)
+	{
+		m_seedIndexes[records[recordIndex].m_seed].push_back(recordIndex);
+	}
+}
+
+void LeaderboardStore::InsertIndex(SortedIndexes& io_indexes, RecordIndex i_recordIndex) const
+{
+	const Record* records = GetRecords();
+	const AZ::u64 points = records[i_recordIndex].m_points;
+
+	// equal scores keep their recording order
+	auto insertionIt = AZStd::lower_bound(io_indexes.begin(), io_indexes.end(), points, [records](RecordIndex i_index, AZ::u64 i_points)
+	{
+		return (records[i_index].m_points >= i_points);
+	});
+
+	io_indexes.insert(insertionIt, i_recordIndex);
+}
+
+LeaderboardRank LeaderboardStore::CalculateRank(const SortedIndexes& i_indexes, TotalPoints i_points) const
+{
+	const Record* records = GetRecords();
+
+	auto firstLowerIt = AZStd::lower_bound(i_indexes.begin(), i_indexes.end(), i_points, [records](RecordIndex i_index, TotalPoints i_points)
+	{
+		return (records[i_index].m_points > i_points);
+	});
+
+	return static_cast<LeaderboardRank>(firstLowerIt - i_indexes.begin()) + 1;
+}
+
+AZStd::vector<LeaderboardEntry> LeaderboardStore::CollectEntries(const SortedIndexes& i_indexes, AZ::u32 i_count) const
+{
+	const Record* records = GetRecords();
+	const auto nEntries = AZStd::min(static_cast<AZStd::size_t>(i_count), i_indexes.size());
+
+	AZStd::vector<LeaderboardEntry> entries;
+	entries.reserve(nEntries);
+
+	for(AZStd::size_t i = 0; i < nEntries; ++i)
+	{
+		const Record& record = records[i_indexes[i]];
+
+		LeaderboardEntry& entry = entries.emplace_back();
+		entry.m_points = record.m_points;
+		entry.m_seed = record.m_seed;
+		entry.m_time = record.m_time;
+		entry.m_claimedTiles = static_cast<TileCount>(record.m_claimedTiles);
+	}
+
+	return entries;
+}
+
+LeaderboardStore::Header* LeaderboardStore::GetHeader() const
+{
+	return reinterpret_cast<Header*>(m_file.GetData());
+}
+
+LeaderboardStore::Record* LeaderboardStore::GetRecords() const
+{
+	return reinterpret_cast<Record*>(m_file.GetData() + sizeof(Header));
+}
+
+AZ::u32 LeaderboardStore::GetRecordCapacity() const
+{
+	return static_cast<AZ::u32>((m_file.GetSize() - sizeof(Header)) / sizeof(Record));
+}
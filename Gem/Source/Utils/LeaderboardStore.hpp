@@ -0,0 +1,97 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+#include "../EBuses/LeaderboardBus.hpp"
+#include "MappedFile.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Append-only run history stored as fixed-size records in a memory-mapped file.
+	// Record indexes are kept sorted by points (global and per seed),
+	// so ranks are binary searches and top entries are prefixes.
+	class LeaderboardStore
+	{
+	public:
+		using TotalPoints = LeaderboardRequests::TotalPoints;
+
+		bool Open(const char* i_filePath);
+		void Close();
+
+		bool IsOpen() const;
+
+		bool AddEntry(const LeaderboardEntry& i_entry);
+
+		AZ::u32 GetEntryCount() const;
+
+		LeaderboardRank GetRank(TotalPoints i_points) const;
+		LeaderboardRank GetSeedRank(LeaderboardSeed i_seed, TotalPoints i_points) const;
+
+		AZStd::vector<LeaderboardEntry> GetTopEntries(AZ::u32 i_count) const;
+		AZStd::vector<LeaderboardEntry> GetSeedTopEntries(LeaderboardSeed i_seed, AZ::u32 i_count) const;
+
+	private:
+		using RecordIndex = AZ::u32;
+		using SortedIndexes = AZStd::vector<RecordIndex>;
+
+		struct Header
+		{
+			char m_magic[4];
+			AZ::u16 m_version;
+			AZ::u16 m_recordSize;
+			AZ::u32 m_nRecords;
+			AZ::u8 m_reserved[20];
+		};
+
+		struct Record
+		{
+			AZ::u64 m_points;
+			AZ::u64 m_seed;
+			AZ::u64 m_time;
+			AZ::u32 m_claimedTiles;
+			AZ::u32 m_reserved;
+		};
+
+		static_assert(sizeof(Header) == 32, "Leaderboard header must stay 32 bytes long");
+		static_assert(sizeof(Record) == 32, "Leaderboard records must stay 32 bytes long");
+
+		bool ValidateHeader();
+		void BuildAllIndexes();
+
+		void InsertIndex(SortedIndexes& io_indexes, RecordIndex i_recordIndex) const;
+		LeaderboardRank CalculateRank(const SortedIndexes& i_indexes, TotalPoints i_points) const;
+		AZStd::vector<LeaderboardEntry> CollectEntries(const SortedIndexes& i_indexes, AZ::u32 i_count) const;
+
+		Header* GetHeader() const;
+		Record* GetRecords() const;
+		AZ::u32 GetRecordCapacity() const;
+
+		MappedFile m_file {};
+
+		SortedIndexes m_indexes {};
+		AZStd::unordered_map<LeaderboardSeed, SortedIndexes> m_seedIndexes {};
+
+		static constexpr char MAGIC[4] = { 'L', 'D', 'B', 'D' };
+		static constexpr AZ::u16 VERSION = 1;
+		static constexpr AZ::u32 INITIAL_CAPACITY = 1024;
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,35 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MappedFile.hpp"
+
+using Loherangrin::Games::O3DEJam2305::MappedFile;
+
+
+bool MappedFile::IsOpen() const
+{
+	return (m_data != nullptr);
+}
+
+AZ::u8* MappedFile::GetData() const
+{
+	return m_data;
+}
+
+AZStd::size_t MappedFile::GetSize() const
+{
+	return m_size;
+}
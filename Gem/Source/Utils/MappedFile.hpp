@@ -0,0 +1,57 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Read-write view of a whole file mapped in memory.
+	// The implementation lives in the platform folders.
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		~MappedFile();
+
+		bool Open(const char* i_filePath, AZStd::size_t i_minSize);
+		bool Resize(AZStd::size_t i_newSize);
+		void Flush();
+		void Close();
+
+		bool IsOpen() const;
+
+		AZ::u8* GetData() const;
+		AZStd::size_t GetSize() const;
+
+	private:
+		bool Map(AZStd::size_t i_size);
+		void Unmap();
+
+		AZ::u8* m_data { nullptr };
+		AZStd::size_t m_size { 0 };
+
+		AZ::s64 m_fileHandle { INVALID_HANDLE };
+		AZ::s64 m_mappingHandle { INVALID_HANDLE };
+
+		static constexpr AZ::s64 INVALID_HANDLE = -1;
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,182 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/std/algorithm.h>
+
+#include "MinimapImage.hpp"
+
+using Loherangrin::Games::O3DEJam2305::MinimapImage;
+
+
+void MinimapImage::Reset(AZ::u16 i_gridLength, AZ::u16 i_texelsPerTile, Texel i_background)
+{
+	m_gridLength = i_gridLength;
+	m_texelsPerTile = AZStd::max<AZ::u16>(i_texelsPerTile, 1);
+
+	m_texels.assign(static_cast<AZStd::size_t>(GetWidth()) * GetHeight(), i_background);
+
+	m_dirtyRects.clear();
+	if(!m_texels.empty())
+	{
+		m_dirtyRects.push_back(Rect { 0, 0, GetWidth(), GetHeight() });
+	}
+}
+
+bool MinimapImage::SetTile(TileId i_tileId, Texel i_texel)
+{
+	if(i_tileId >= static_cast<TileId>(m_gridLength) * m_gridLength)
+	{
+		return false;
+	}
+
+	const auto left = static_cast<AZ::u32>(i_tileId % m_gridLength) * m_texelsPerTile;
+	const auto top = static_cast<AZ::u32>(i_tileId / m_gridLength) * m_texelsPerTile;
+
+	if(m_texels[top * GetWidth() + left] == i_texel)
+	{
+		return false;
+	}
+
+	for(AZ::u32 y = top; y < top + m_texelsPerTile; ++y)
+	{
+		Texel* row = m_texels.data() + y * GetWidth();
+		AZStd::fill(row + left, row + left + m_texelsPerTile, i_texel);
+	}
+
+	AddDirtyRect(Rect { left, top, m_texelsPerTile, m_texelsPerTile });
+
+	return true;
+}
+
+MinimapImage::Texel MinimapImage::GetTile(TileId i_tileId) const
+{
+	if(i_tileId >= static_cast<TileId>(m_gridLength) * m_gridLength)
+	{
+		return 0;
+	}
+
+	const auto left = static_cast<AZ::u32>(i_tileId % m_gridLength) * m_texelsPerTile;
+	const auto top = static_cast<AZ::u32>(i_tileId / m_gridLength) * m_texelsPerTile;
+
+	return m_texels[top * GetWidth() + left];
+}
+
+AZ::u32 MinimapImage::GetWidth() const
+{
+	return static_cast<AZ::u32>(m_gridLength) * m_texelsPerTile;
+}
+
+AZ::u32 MinimapImage::GetHeight() const
+{
+	return GetWidth();
+}
+
+AZ::u32 MinimapImage::GetRowPitch() const
+{
+	return GetWidth() * sizeof(Texel);
+}
+
+const AZ::u8* MinimapImage::GetData() const
+{
+	return reinterpret_cast<const AZ::u8*>(m_texels.data());
+}
+
+const AZ::u8* MinimapImage::GetData(const Rect& i_rect) const
+{
+	return reinterpret_cast<const AZ::u8*>(m_texels.data() + i_rect.m_top * GetWidth() + i_rect.m_left);
+}
+
+bool MinimapImage::IsDirty() const
+{
+	return !m_dirtyRects.empty();
+}
+
+const MinimapImage::DirtyRects& MinimapImage::GetDirtyRects() const
+{
+	return m_dirtyRects;
+}
+
+void MinimapImage::ClearDirtyRects()
+{
+	m_dirtyRects.clear();
+}
+
+MinimapImage::Texel MinimapImage::PackTexel(AZ::u8 i_red, AZ::u8 i_green, AZ::u8 i_blue, AZ::u8 i_alpha)
+{
+	// bytes are laid out as R, G, B, A in memory on little-endian targets
+	return (static_cast<Texel>(i_alpha) << 24) | (static_cast<Texel>(i_blue) << 16) | (static_cast<Texel>(i_green) << 8) | static_cast<Texel>(i_red);
+}
+
+void MinimapImage::AddDirtyRect(const Rect& i_rect)
+{
+	Rect newRect = i_rect;
+
+	// absorbing a rectangle can make the grown one touch others, so merging is repeated until stable
+	for(bool isMerged = true; isMerged;)
+	{
+		isMerged = false;
+
+		for(auto rectIt = m_dirtyRects.begin(); rectIt != m_dirtyRects.end(); ++rectIt)
+		{
+			if(AreTouching(*rectIt, newRect))
+			{
+				newRect = Merge(*rectIt, newRect);
+				m_dirtyRects.erase(rectIt);
+
+				isMerged = true;
+				break;
+			}
+		}
+	}
+
+	if(m_dirtyRects.size() == m_dirtyRects.capacity())
+	{
+		for(const Rect& dirtyRect : m_dirtyRects)
+		{
+			newRect = Merge(dirtyRect, newRect);
+		}
+
+		m_dirtyRects.clear();
+	}
+
+	m_dirtyRects.push_back(newRect);
+}
+
+bool MinimapImage::AreTouching(const Rect& i_lhs, const Rect& i_rhs)
+{
+	const AZ::u32 lhsRight = i_lhs.m_left + i_lhs.m_width;
+	const AZ::u32 lhsBottom = i_lhs.m_top + i_lhs.m_height;
+	const AZ::u32 rhsRight = i_rhs.m_left + i_rhs.m_width;
+	const AZ::u32 rhsBottom = i_rhs.m_top + i_rhs.m_height;
+
+	const bool areOverlappingColumns = (i_lhs.m_left < rhsRight && i_rhs.m_left < lhsRight);
+	const bool areOverlappingRows = (i_lhs.m_top < rhsBottom && i_rhs.m_top < lhsBottom);
+	const bool areTouchingColumns = (i_lhs.m_left <= rhsRight && i_rhs.m_left <= lhsRight);
+	const bool areTouchingRows = (i_lhs.m_top <= rhsBottom && i_rhs.m_top <= lhsBottom);
+
+	// rects meeting only at a corner are kept apart, as their bounding box would cover untouched texels
+	return ((areOverlappingColumns && areTouchingRows) || (areTouchingColumns && areOverlappingRows));
+}
+
+MinimapImage::Rect MinimapImage::Merge(const Rect& i_lhs, const Rect& i_rhs)
+{
+	const AZ::u32 left = AZStd::min(i_lhs.m_left, i_rhs.m_left);
+	const AZ::u32 top = AZStd::min(i_lhs.m_top, i_rhs.m_top);
+	const AZ::u32 right = AZStd::max(i_lhs.m_left + i_lhs.m_width, i_rhs.m_left + i_rhs.m_width);
+	const AZ::u32 bottom = AZStd::max(i_lhs.m_top + i_lhs.m_height, i_rhs.m_top + i_rhs.m_height);
+
+	return Rect { left, top, right - left, bottom - top };
+}
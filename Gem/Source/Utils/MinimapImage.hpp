@@ -0,0 +1,76 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
+
+#include "../EBuses/TileBus.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// CPU-side RGBA8 image of the tile grid, with a square block of texels per tile.
+	// Changed blocks are tracked as a few merged rectangles, so that only those are uploaded.
+	class MinimapImage
+	{
+	public:
+		using Texel = AZ::u32;
+
+		struct Rect
+		{
+			AZ::u32 m_left { 0 };
+			AZ::u32 m_top { 0 };
+			AZ::u32 m_width { 0 };
+			AZ::u32 m_height { 0 };
+		};
+
+		static constexpr AZStd::size_t MAX_DIRTY_RECTS = 8;
+		using DirtyRects = AZStd::fixed_vector<Rect, MAX_DIRTY_RECTS>;
+
+		void Reset(AZ::u16 i_gridLength, AZ::u16 i_texelsPerTile, Texel i_background);
+
+		bool SetTile(TileId i_tileId, Texel i_texel);
+		Texel GetTile(TileId i_tileId) const;
+
+		AZ::u32 GetWidth() const;
+		AZ::u32 GetHeight() const;
+		AZ::u32 GetRowPitch() const;
+
+		const AZ::u8* GetData() const;
+		const AZ::u8* GetData(const Rect& i_rect) const;
+
+		bool IsDirty() const;
+		const DirtyRects& GetDirtyRects() const;
+		void ClearDirtyRects();
+
+		static Texel PackTexel(AZ::u8 i_red, AZ::u8 i_green, AZ::u8 i_blue, AZ::u8 i_alpha);
+
+	private:
+		void AddDirtyRect(const Rect& i_rect);
+
+		static bool AreTouching(const Rect& i_lhs, const Rect& i_rhs);
+		static Rect Merge(const Rect& i_lhs, const Rect& i_rhs);
+
+		AZ::u16 m_gridLength { 0 };
+		AZ::u16 m_texelsPerTile { 1 };
+
+		AZStd::vector<Texel> m_texels {};
+		DirtyRects m_dirtyRects {};
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,103 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/atomic.h>
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	// Lock-free queue for exactly one producer thread and one consumer thread.
+	// The capacity must be a power of two, and one slot is always kept free.
+	template <typename t_Element, AZStd::size_t t_CAPACITY>
+	class RingBuffer
+	{
+		static_assert(t_CAPACITY >= 2 && (t_CAPACITY & (t_CAPACITY - 1)) == 0, "Capacity must be a power of two");
+
+	public:
+		using Element = t_Element;
+
+		bool TryPush(const Element& i_element);
+		AZStd::size_t TryPopRange(Element* o_elements, AZStd::size_t i_maxElements);
+
+		bool IsEmpty() const;
+
+		static constexpr AZStd::size_t GetCapacity();
+
+	private:
+		static constexpr AZStd::size_t MASK = t_CAPACITY - 1;
+		static constexpr AZStd::size_t CACHE_LINE_SIZE = 64;
+
+		Element m_elements[t_CAPACITY] {};
+
+		alignas(CACHE_LINE_SIZE) AZStd::atomic<AZStd::size_t> m_head { 0 };
+		alignas(CACHE_LINE_SIZE) AZStd::atomic<AZStd::size_t> m_tail { 0 };
+	};
+
+	// ---
+
+	template <typename t_Element, AZStd::size_t t_CAPACITY>
+	bool RingBuffer<t_Element, t_CAPACITY>::TryPush(const Element& i_element)
+	{
+		const AZStd::size_t tail = m_tail.load(AZStd::memory_order_relaxed);
+		const AZStd::size_t nextTail = (tail + 1) & MASK;
+
+		if(nextTail == m_head.load(AZStd::memory_order_acquire))
+		{
+			return false;
+		}
+
+		m_elements[tail] = i_element;
+		m_tail.store(nextTail, AZStd::memory_order_release);
+
+		return true;
+	}
+
+	template <typename t_Element, AZStd::size_t t_CAPACITY>
+	AZStd::size_t RingBuffer<t_Element, t_CAPACITY>::TryPopRange(Element* o_elements, AZStd::size_t i_maxElements)
+	{
+		const AZStd::size_t head = m_head.load(AZStd::memory_order_relaxed);
+		const AZStd::size_t tail = m_tail.load(AZStd::memory_order_acquire);
+
+		const AZStd::size_t nAvailableElements = (tail - head) & MASK;
+		const AZStd::size_t nElements = AZStd::min(nAvailableElements, i_maxElements);
+
+		for(AZStd::size_t i = 0; i < nElements; ++i)
+		{
+			o_elements[i] = m_elements[(head + i) & MASK];
+		}
+
+		m_head.store((head + nElements) & MASK, AZStd::memory_order_release);
+
+		return nElements;
+	}
+
+	template <typename t_Element, AZStd::size_t t_CAPACITY>
+	bool RingBuffer<t_Element, t_CAPACITY>::IsEmpty() const
+	{
+		return (m_head.load(AZStd::memory_order_acquire) == m_tail.load(AZStd::memory_order_acquire));
+	}
+
+	template <typename t_Element, AZStd::size_t t_CAPACITY>
+	constexpr AZStd::size_t RingBuffer<t_Element, t_CAPACITY>::GetCapacity()
+	{
+		return (t_CAPACITY - 1);
+	}
+
+} // Loherangrin::Games::O3DEJam2305
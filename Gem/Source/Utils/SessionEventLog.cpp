@@ -0,0 +1,144 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Time/ITime.h>
+
+#include "SessionEventLog.hpp"
+
+using Loherangrin::Games::O3DEJam2305::SessionEventLog;
+
+
+SessionEventLog::~SessionEventLog()
+{
+	Close();
+}
+
+void SessionEventLog::Open(const AZ::IO::Path& i_filePath, AZ::u64 i_startTime)
+{
+	if(IsOpen())
+	{
+		Close();
+	}
+
+	m_nextSequence = 0;
+	m_nDroppedRecords = 0;
+	m_isStopRequested = false;
+
+	AZStd::thread_desc threadDesc;
+	threadDesc.m_name = "SessionEventLog";
+
+	m_writerThread = AZStd::thread(threadDesc, [this, filePath = i_filePath, i_startTime]()
+	{
+		RunWriter(filePath, i_startTime);
+	});
+}
+
+void SessionEventLog::Close()
+{
+	if(!IsOpen())
+	{
+		return;
+	}
+
+	{
+		AZStd::lock_guard<AZStd::mutex> stopLock { m_stopMutex };
+		m_isStopRequested = true;
+	}
+
+	m_stopCondition.notify_one();
+	m_writerThread.join();
+}
+
+bool SessionEventLog::IsOpen() const
+{
+	return m_writerThread.joinable();
+}
+
+void SessionEventLog::Record(SessionEventType i_type, AZ::u64 i_subject, float i_firstValue, float i_secondValue)
+{
+	if(!IsOpen())
+	{
+		return;
+	}
+
+	SessionEventRecord record;
+	record.m_time = static_cast<AZ::u64>(static_cast<AZ::s64>(AZ::GetElapsedTimeMs()));
+	record.m_sequence = m_nextSequence++;
+	record.m_type = i_type;
+	record.m_subject = i_subject;
+	record.m_values[0] = i_firstValue;
+	record.m_values[1] = i_secondValue;
+
+	if(!m_buffer.TryPush(record))
+	{
+		m_nDroppedRecords.fetch_add(1, AZStd::memory_order_relaxed);
+	}
+}
+
+AZ::u64 SessionEventLog::GetDroppedRecords() const
+{
+	return m_nDroppedRecords.load(AZStd::memory_order_relaxed);
+}
+
+void SessionEventLog::RunWriter(AZ::IO::Path i_filePath, AZ::u64 i_startTime)
+{
+	AZ::IO::SystemFile file;
+
+	const int openMode = AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY;
+	const bool isFileOpen = file.Open(i_filePath.c_str(), openMode);
+
+	AZ_Error("SessionEventLog", isFileOpen, "Unable to open the session log at %s", i_filePath.c_str());
+
+	if(isFileOpen)
+	{
+		SessionEventLogHeader header;
+		header.m_startTime = i_startTime;
+
+		file.Write(&header, sizeof(header));
+	}
+
+	bool isStopRequested { false };
+	while(!isStopRequested)
+	{
+		{
+			AZStd::unique_lock<AZStd::mutex> stopLock { m_stopMutex };
+			m_stopCondition.wait_for(stopLock, FLUSH_INTERVAL, [this](){ return m_isStopRequested; });
+
+			isStopRequested = m_isStopRequested;
+		}
+
+		WriteAllRecords(file);
+	}
+
+	if(isFileOpen)
+	{
+		file.Close();
+	}
+}
+
+void SessionEventLog::WriteAllRecords(AZ::IO::SystemFile& io_file)
+{
+	AZStd::size_t nRecords { 0 };
+	do
+	{
+		nRecords = m_buffer.TryPopRange(m_batch.data(), m_batch.size());
+		if(nRecords > 0 && io_file.IsOpen())
+		{
+			io_file.Write(m_batch.data(), nRecords * sizeof(SessionEventRecord));
+		}
+	}
+	while(nRecords == m_batch.size());
+}
@@ -0,0 +1,122 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/conditional_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
+#include "RingBuffer.hpp"
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	enum class SessionEventType : AZ::u16
+	{
+		GAME_LOADING = 0,
+		GAME_STARTED,
+		GAME_PAUSED,
+		GAME_RESUMED,
+		GAME_ENDED,
+
+		TILE_CLAIMED,
+		TILE_LOST,
+		CLAIMED_TILES_CHANGED,
+		SCORE_CHANGED,
+
+		STOP_DECAY_COLLECTED,
+		SPACESHIP_ENERGY_COLLECTED,
+		TILE_ENERGY_COLLECTED,
+		POINTS_COLLECTED,
+		SPEED_COLLECTED,
+
+		SPACESHIP_ENERGY_CHANGED,
+		ENERGY_SAVING_ACTIVATED,
+		ENERGY_SAVING_DEACTIVATED,
+		LANDING_STARTED,
+		LANDING_ENDED,
+		TAKE_OFF_STARTED,
+		TAKE_OFF_ENDED,
+
+		STORM_SPAWNED
+	};
+
+	struct SessionEventRecord
+	{
+		AZ::u64 m_time { 0 };
+		AZ::u32 m_sequence { 0 };
+		SessionEventType m_type { SessionEventType::GAME_LOADING };
+		AZ::u16 m_reserved { 0 };
+
+		AZ::u64 m_subject { 0 };
+		float m_values[2] { 0.f, 0.f };
+	};
+
+	static_assert(sizeof(SessionEventRecord) == 32, "Session event records must stay 32 bytes long");
+
+	struct SessionEventLogHeader
+	{
+		char m_magic[4] { 'S', 'E', 'L', 'G' };
+		AZ::u16 m_version { 1 };
+		AZ::u16 m_recordSize { sizeof(SessionEventRecord) };
+		AZ::u64 m_startTime { 0 };
+	};
+
+	// ---
+
+	// Records are staged on the game thread without locks or allocations,
+	// and a writer thread appends them to the log file in large batches.
+	class SessionEventLog
+	{
+	public:
+		~SessionEventLog();
+
+		void Open(const AZ::IO::Path& i_filePath, AZ::u64 i_startTime);
+		void Close();
+
+		bool IsOpen() const;
+
+		void Record(SessionEventType i_type, AZ::u64 i_subject, float i_firstValue = 0.f, float i_secondValue = 0.f);
+
+		AZ::u64 GetDroppedRecords() const;
+
+	private:
+		static constexpr AZStd::size_t BUFFER_CAPACITY = 4096;
+		static constexpr AZStd::size_t BATCH_CAPACITY = 256;
+		static constexpr AZStd::chrono::milliseconds FLUSH_INTERVAL { 250 };
+
+		void RunWriter(AZ::IO::Path i_filePath, AZ::u64 i_startTime);
+		void WriteAllRecords(AZ::IO::SystemFile& io_file);
+
+		RingBuffer<SessionEventRecord, BUFFER_CAPACITY> m_buffer {};
+		AZ::u32 m_nextSequence { 0 };
+		AZStd::atomic<AZ::u64> m_nDroppedRecords { 0 };
+
+		AZStd::thread m_writerThread {};
+		AZStd::array<SessionEventRecord, BATCH_CAPACITY> m_batch {};
+
+		AZStd::mutex m_stopMutex {};
+		AZStd::condition_variable m_stopCondition {};
+		bool m_isStopRequested { false };
+	};
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,207 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+#include <LyShine/Bus/UiCanvasBus.h>
+#include <LyShine/Bus/UiElementBus.h>
+
+#include "UiElementResolver.hpp"
+
+using Loherangrin::Games::O3DEJam2305::UiElementResolver;
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	using ElementPath = AZStd::vector<int>;
+
+	struct CanvasLayout
+	{
+		AZStd::unordered_map<AZStd::string, ElementPath> m_elementPaths {};
+		AZStd::unordered_set<AZStd::string> m_missingNames {};
+	};
+
+	static AZStd::unordered_map<AZStd::string, CanvasLayout> s_canvasLayouts {};
+
+	static bool ResolveCachedPaths(const AZ::EntityId& i_canvasId, const AZStd::vector<const char*>& i_elementNames, const CanvasLayout& i_layout, AZStd::vector<AZ::EntityId>& o_elementEntityIds)
+	{
+		for(AZStd::size_t i = 0; i < i_elementNames.size(); ++i)
+		{
+			const AZStd::string elementName { i_elementNames[i] };
+
+			auto pathIt = i_layout.m_elementPaths.find(elementName);
+			if(pathIt == i_layout.m_elementPaths.end())
+			{
+				if(i_layout.m_missingNames.find(elementName) != i_layout.m_missingNames.end())
+				{
+					continue;
+				}
+
+				// Names never requested before for this canvas
+				return false;
+			}
+
+			const ElementPath& path = pathIt->second;
+
+			AZ::Entity* element { nullptr };
+			EBUS_EVENT_ID_RESULT(element, i_canvasId, UiCanvasBus, GetChildElement, path[0]);
+
+			for(AZStd::size_t depth = 1; element && depth < path.size(); ++depth)
+			{
+				const AZ::EntityId parentEntityId = element->GetId();
+
+				element = nullptr;
+				EBUS_EVENT_ID_RESULT(element, parentEntityId, UiElementBus, GetChildElement, path[depth]);
+			}
+
+			// The hierarchy was modified since the layout was cached
+			if(!element || element->GetName() != elementName)
+			{
+				return false;
+			}
+
+			o_elementEntityIds[i] = element->GetId();
+		}
+
+		return true;
+	}
+
+	static void TraverseCanvas(const AZ::EntityId& i_canvasId, const AZStd::vector<const char*>& i_elementNames, CanvasLayout& o_layout, AZStd::vector<AZ::EntityId>& o_elementEntityIds)
+	{
+		struct VisitedElement
+		{
+			AZ::Entity* m_element { nullptr };
+			AZStd::size_t m_parentIndex { 0 };
+			int m_childIndex { 0 };
+		};
+
+		static constexpr AZStd::size_t ROOT_INDEX = AZStd::numeric_limits<AZStd::size_t>::max();
+
+		AZStd::unordered_multimap<AZStd::string_view, AZStd::size_t> pendingNames;
+		pendingNames.reserve(i_elementNames.size());
+
+		for(AZStd::size_t i = 0; i < i_elementNames.size(); ++i)
+		{
+			pendingNames.emplace(AZStd::string_view { i_elementNames[i] }, i);
+		}
+
+		AZStd::vector<VisitedElement> visitedElements;
+		AZStd::vector<AZStd::size_t> pendingElements;
+
+		LyShine::EntityArray children;
+		EBUS_EVENT_ID_RESULT(children, i_canvasId, UiCanvasBus, GetChildElements);
+
+		for(int i = static_cast<int>(children.size()) - 1; i >= 0; --i)
+		{
+			pendingElements.push_back(visitedElements.size());
+			visitedElements.push_back({ children[i], ROOT_INDEX, i });
+		}
+
+		// Depth-first, in the same order as the hierarchy, so that the first match of a name wins
+		while(!pendingElements.empty() && !pendingNames.empty())
+		{
+			const AZStd::size_t elementIndex = pendingElements.back();
+			pendingElements.pop_back();
+
+			AZ::Entity* element = visitedElements[elementIndex].m_element;
+
+			auto range = pendingNames.equal_range(AZStd::string_view { element->GetName() });
+			if(range.first != range.second)
+			{
+				ElementPath path;
+				for(AZStd::size_t pathIndex = elementIndex; pathIndex != ROOT_INDEX; pathIndex = visitedElements[pathIndex].m_parentIndex)
+				{
+					path.push_back(visitedElements[pathIndex].m_childIndex);
+				}
+
+				AZStd::reverse(path.begin(), path.end());
+
+				for(auto it = range.first; it != range.second; ++it)
+				{
+					o_elementEntityIds[it->second] = element->GetId();
+				}
+
+				o_layout.m_elementPaths[element->GetName()] = AZStd::move(path);
+				pendingNames.erase(range.first, range.second);
+			}
+
+			children.clear();
+			EBUS_EVENT_ID_RESULT(children, element->GetId(), UiElementBus, GetChildElements);
+
+			for(int i = static_cast<int>(children.size()) - 1; i >= 0; --i)
+			{
+				pendingElements.push_back(visitedElements.size());
+				visitedElements.push_back({ children[i], elementIndex, i });
+			}
+		}
+
+		for(const auto& it : pendingNames)
+		{
+			o_layout.m_missingNames.emplace(it.first);
+		}
+	}
+
+} // Loherangrin::Games::O3DEJam2305
+
+bool UiElementResolver::Resolve(const AZ::EntityId& i_canvasId, const AZStd::vector<const char*>& i_elementNames, AZStd::vector<AZ::EntityId>& o_elementEntityIds)
+{
+	o_elementEntityIds.assign(i_elementNames.size(), AZ::EntityId {});
+
+	if(!i_canvasId.IsValid() || i_elementNames.empty())
+	{
+		return i_elementNames.empty();
+	}
+
+	AZStd::string canvasPathname;
+	EBUS_EVENT_ID_RESULT(canvasPathname, i_canvasId, UiCanvasBus, GetPathname);
+
+	// Canvases created at runtime have no asset to be cached for
+	CanvasLayout uncachedLayout;
+	CanvasLayout& layout = (canvasPathname.empty()) ? uncachedLayout : s_canvasLayouts[canvasPathname];
+
+	if(canvasPathname.empty() || !ResolveCachedPaths(i_canvasId, i_elementNames, layout, o_elementEntityIds))
+	{
+		layout = CanvasLayout {};
+		o_elementEntityIds.assign(i_elementNames.size(), AZ::EntityId {});
+
+		TraverseCanvas(i_canvasId, i_elementNames, layout, o_elementEntityIds);
+	}
+
+	AZStd::string missingNames;
+	for(AZStd::size_t i = 0; i < i_elementNames.size(); ++i)
+	{
+		if(!o_elementEntityIds[i].IsValid())
+		{
+			missingNames += (missingNames.empty()) ? "" : ", ";
+			missingNames += i_elementNames[i];
+		}
+	}
+
+	AZ_Error("UiElementResolver", missingNames.empty(), "Canvas %s is missing the following elements: %s", canvasPathname.c_str(), missingNames.c_str());
+
+	return missingNames.empty();
+}
+
+void UiElementResolver::ClearCache()
+{
+	s_canvasLayouts.clear();
+}
@@ -0,0 +1,70 @@
+/* Submission to O3DE Jam - May 5-14, 2023
+ * Copyright 2023 Matteo Grasso
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/std/containers/vector.h>
+
+
+namespace Loherangrin::Games::O3DEJam2305
+{
+	template <typename t_Owner>
+	struct UiElementBinding
+	{
+		const char* m_elementName;
+		AZ::EntityId t_Owner::* m_elementEntityId;
+	};
+
+	// Resolves a table of element names in a single walk of the canvas hierarchy.
+	// The child indices leading to each element are cached per canvas asset, so that
+	// later instances of the same canvas only follow those paths instead of searching again.
+	class UiElementResolver
+	{
+	public:
+		static bool Resolve(const AZ::EntityId& i_canvasId, const AZStd::vector<const char*>& i_elementNames, AZStd::vector<AZ::EntityId>& o_elementEntityIds);
+
+		template <typename t_Owner, AZStd::size_t t_N_BINDINGS>
+		static bool Resolve(const AZ::EntityId& i_canvasId, const UiElementBinding<t_Owner> (&i_bindings)[t_N_BINDINGS], t_Owner& io_owner);
+
+		static void ClearCache();
+	};
+
+	// ---
+
+	template <typename t_Owner, AZStd::size_t t_N_BINDINGS>
+	bool UiElementResolver::Resolve(const AZ::EntityId& i_canvasId, const UiElementBinding<t_Owner> (&i_bindings)[t_N_BINDINGS], t_Owner& io_owner)
+	{
+		AZStd::vector<const char*> elementNames;
+		elementNames.reserve(t_N_BINDINGS);
+
+		for(const UiElementBinding<t_Owner>& binding : i_bindings)
+		{
+			elementNames.push_back(binding.m_elementName);
+		}
+
+		AZStd::vector<AZ::EntityId> elementEntityIds;
+		const bool isComplete = Resolve(i_canvasId, elementNames, elementEntityIds);
+
+		for(AZStd::size_t i = 0; i < t_N_BINDINGS; ++i)
+		{
+			io_owner.*(i_bindings[i].m_elementEntityId) = elementEntityIds[i];
+		}
+
+		return isComplete;
+	}
+
+} // Loherangrin::Games::O3DEJam2305
@@ -0,0 +1,6 @@
+set(FILES
+	Source/Benchmarks/GridBenchmarks.cpp
+	Source/Benchmarks/Main.cpp
+	Source/Benchmarks/RulesBenchmarks.cpp
+	Source/Benchmarks/SimulationBenchmarks.cpp
+)
@@ -0,0 +1,35 @@
+set(FILES
+	Source/Core/BeamRules.cpp
+	Source/Core/BeamRules.hpp
+	Source/Core/CollectableRules.cpp
+	Source/Core/CollectableRules.hpp
+	Source/Core/FlowField.cpp
+	Source/Core/FlowField.hpp
+	Source/Core/GridReplication.cpp
+	Source/Core/GridReplication.hpp
+	Source/Core/GridRules.cpp
+	Source/Core/GridRules.hpp
+	Source/Core/GridTypes.hpp
+	Source/Core/LayoutPlan.cpp
+	Source/Core/LayoutPlan.hpp
+	Source/Core/RandomStream.cpp
+	Source/Core/RandomStream.hpp
+	Source/Core/ReplayFile.cpp
+	Source/Core/ReplayFile.hpp
+	Source/Core/ReplicationSocket.cpp
+	Source/Core/ReplicationSocket.hpp
+	Source/Core/SaveFile.cpp
+	Source/Core/SaveFile.hpp
+	Source/Core/ScoreLedger.cpp
+	Source/Core/ScoreLedger.hpp
+	Source/Core/Simulation.cpp
+	Source/Core/Simulation.hpp
+	Source/Core/SpaceshipRules.cpp
+	Source/Core/SpaceshipRules.hpp
+	Source/Core/StormRules.cpp
+	Source/Core/StormRules.hpp
+	Source/Core/TileRules.cpp
+	Source/Core/TileRules.hpp
+	Source/Core/TraceRecorder.cpp
+	Source/Core/TraceRecorder.hpp
+)
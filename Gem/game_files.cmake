@@ -1,10 +1,28 @@
 set(FILES
+	Source/Components/AutopilotComponent.cpp
+	Source/Components/AutopilotComponent.hpp
 	Source/Components/BeamComponent.cpp
 	Source/Components/BeamComponent.hpp
 	Source/Components/CollectableComponent.cpp
 	Source/Components/CollectableComponent.hpp
 	Source/Components/CollectablesPoolComponent.cpp
 	Source/Components/CollectablesPoolComponent.hpp
+	Source/Components/EventRecorderComponent.cpp
+	Source/Components/EventRecorderComponent.hpp
+	Source/Components/GameplaySchedulerSystemComponent.cpp
+	Source/Components/GameplaySchedulerSystemComponent.hpp
+	Source/Components/GridReplicationComponent.cpp
+	Source/Components/GridReplicationComponent.hpp
+	Source/Components/LeaderboardComponent.cpp
+	Source/Components/LeaderboardComponent.hpp
+	Source/Components/MinimapComponent.cpp
+	Source/Components/MinimapComponent.hpp
+	Source/Components/PerformanceOverlayComponent.cpp
+	Source/Components/PerformanceOverlayComponent.hpp
+	Source/Components/ReplayComponent.cpp
+	Source/Components/ReplayComponent.hpp
+	Source/Components/SaveGameComponent.cpp
+	Source/Components/SaveGameComponent.hpp
 	Source/Components/ScoreComponent.cpp
 	Source/Components/ScoreComponent.hpp
 	Source/Components/SpaceshipComponent.cpp
@@ -19,9 +37,41 @@ set(FILES
 	Source/Components/TilesPoolComponent.hpp
 	Source/Components/UiComponent.cpp
 	Source/Components/UiComponent.hpp
+	Source/EBuses/BeamBus.hpp
 	Source/EBuses/CollectableBus.hpp
 	Source/EBuses/GameBus.hpp
+	Source/EBuses/GameplayBus.hpp
+	Source/EBuses/LeaderboardBus.hpp
+	Source/EBuses/MinimapBus.hpp
+	Source/EBuses/ReplayBus.hpp
+	Source/EBuses/ReplicationBus.hpp
+	Source/EBuses/SaveGameBus.hpp
 	Source/EBuses/ScoreBus.hpp
 	Source/EBuses/SpaceshipBus.hpp
+	Source/EBuses/StormBus.hpp
 	Source/EBuses/TileBus.hpp
+	Source/Utils/CollectableBannerQueue.cpp
+	Source/Utils/CollectableBannerQueue.hpp
+	Source/Utils/EnergyNotifier.cpp
+	Source/Utils/EnergyNotifier.hpp
+	Source/Utils/GameAllocators.cpp
+	Source/Utils/GameAllocators.hpp
+	Source/Utils/GameEventPolicy.hpp
+	Source/Utils/GameMetrics.cpp
+	Source/Utils/GameMetrics.hpp
+	Source/Utils/HudTextBinding.cpp
+	Source/Utils/HudTextBinding.hpp
+	Source/Utils/LandingAreasIndex.cpp
+	Source/Utils/LandingAreasIndex.hpp
+	Source/Utils/LeaderboardStore.cpp
+	Source/Utils/LeaderboardStore.hpp
+	Source/Utils/MappedFile.cpp
+	Source/Utils/MappedFile.hpp
+	Source/Utils/MinimapImage.cpp
+	Source/Utils/MinimapImage.hpp
+	Source/Utils/RingBuffer.hpp
+	Source/Utils/SessionEventLog.cpp
+	Source/Utils/SessionEventLog.hpp
+	Source/Utils/UiElementResolver.cpp
+	Source/Utils/UiElementResolver.hpp
 )
@@ -0,0 +1,3 @@
+set(FILES
+	Source/Simulator/Main.cpp
+)
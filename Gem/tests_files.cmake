@@ -0,0 +1,24 @@
+set(FILES
+	Source/Tests/EnergyNotifierTests.cpp
+	Source/Tests/GameTestFixture.cpp
+	Source/Tests/GameTestFixture.hpp
+	Source/Tests/GridReplicationTests.cpp
+	Source/Tests/LandingAreasIndexTests.cpp
+	Source/Tests/LayoutPlanTests.cpp
+	Source/Tests/LeaderboardStoreTests.cpp
+	Source/Tests/Main.cpp
+	Source/Tests/MinimapImageTests.cpp
+	Source/Tests/RandomStreamTests.cpp
+	Source/Tests/ReplayComponentTests.cpp
+	Source/Tests/ReplayFileTests.cpp
+	Source/Tests/SaveFileTests.cpp
+	Source/Tests/ScoreLedgerTests.cpp
+	Source/Tests/SpaceshipComponentTests.cpp
+	Source/Tests/StubPhysicsComponent.cpp
+	Source/Tests/StubPhysicsComponent.hpp
+	Source/Tests/StubSpawnableEntities.cpp
+	Source/Tests/StubSpawnableEntities.hpp
+	Source/Tests/TileComponentTests.cpp
+	Source/Tests/TilesBudgetTests.cpp
+	Source/Tests/TilesPoolComponentTests.cpp
+)